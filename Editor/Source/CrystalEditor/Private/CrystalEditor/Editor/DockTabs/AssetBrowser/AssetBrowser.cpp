@@ -104,6 +104,18 @@ namespace CE::Editor
                             .Padding(Vec4(1, 0, 1, 0) * 2.5f)
                         ),
 
+                        FAssignNew(FTextInput, searchBox)
+                        .OnTextEdited([this] (FTextInput* input)
+                        {
+                            SetSearchQuery(input->Text());
+                        })
+                        .OnTextEditingFinished([this] (FTextInput* input)
+                        {
+                            SetSearchQuery(input->Text());
+                        })
+                        .FontSize(fontSize - 1)
+                        .Width(200),
+
                         FNew(FTextButton)
                         .Text("Settings")
                         .FontSize(fontSize - 1)
@@ -248,10 +260,15 @@ namespace CE::Editor
 
             PathTreeNode* node = (PathTreeNode*)index.GetData().GetValue<PathTreeNode*>();
 
-            if (currentDirectory != node)
+            // Picking a directory leaves the search results
+            if (currentDirectory != node || searchQuery.NotEmpty())
             {
                 currentDirectory = node;
                 currentPath = node->GetFullPath();
+
+                searchQuery = "";
+                searchBox->Text("");
+
                 UpdateAssetGridView();
             }
 
@@ -413,6 +430,24 @@ namespace CE::Editor
 
         gridView->SetCurrentDirectory(currentPath);
 
+        if (searchQuery.NotEmpty())
+        {
+            Array<CE::Name> resultPaths;
+
+            // Editor assets are hidden from browsing (see AssetBrowserGridView::OnUpdate()). They are excluded by the
+            // search itself, so they don't take the place of other results.
+            for (const AssetSearchIndex::Result& result : AssetRegistry::Get()->SearchAssets(searchQuery, MaxSearchResults, "/Editor/"))
+            {
+                resultPaths.Add(result.assetData->bundlePath);
+            }
+
+            gridView->SetSearchResults(resultPaths);
+        }
+        else
+        {
+            gridView->ClearSearchResults();
+        }
+
         gridView->OnUpdate();
 
         UpdateBreadCrumbs();
@@ -466,6 +501,12 @@ namespace CE::Editor
         int count = gridView->GetSelectedItemCount();
         if (count == 0)
         {
+            if (gridView->IsShowingSearchResults())
+            {
+                statusBarLabel->Text(String::Format("{} results", gridView->GetItemCount()));
+                return;
+            }
+
 	        if (currentPath == "/")
 	        {
                 statusBarLabel->Text("");
@@ -761,6 +802,16 @@ namespace CE::Editor
         OnItemSelectionUpdated();
     }
 
+    void AssetBrowser::SetSearchQuery(const String& query)
+    {
+        if (query == searchQuery)
+            return;
+
+        searchQuery = query;
+
+        UpdateAssetGridView();
+    }
+
     void AssetBrowser::OpenAsset(const CE::Name& path)
     {
         AssetRegistry* registry = AssetRegistry::Get();
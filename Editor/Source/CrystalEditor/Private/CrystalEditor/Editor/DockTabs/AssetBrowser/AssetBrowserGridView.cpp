@@ -48,6 +48,18 @@ namespace CE::Editor
         this->currentPath = directory;
     }
 
+    void AssetBrowserGridView::SetSearchResults(const Array<CE::Name>& assetPaths)
+    {
+        isShowingSearchResults = true;
+        searchResultPaths = assetPaths;
+    }
+
+    void AssetBrowserGridView::ClearSearchResults()
+    {
+        isShowingSearchResults = false;
+        searchResultPaths.Clear();
+    }
+
     int AssetBrowserGridView::GetSelectedItemCount()
     {
         int count = 0;
@@ -94,22 +106,41 @@ namespace CE::Editor
         QueueDestroyAllChildren();
         items.Clear();
 
-        PathTreeNode* currentDirectory = AssetRegistry::Get()->GetCachedPathTree().GetNode(this->currentPath);
+        PathTree& pathTree = AssetRegistry::Get()->GetCachedPathTree();
+        Array<PathTreeNode*> nodes;
 
-        if (currentDirectory != nullptr)
+        if (isShowingSearchResults)
         {
-            AssetBrowserItem* itemToRename = nullptr;
-            AssetBrowserItem* selectedItem = nullptr;
-
-            for (int i = 0; i < currentDirectory->children.GetSize(); i++)
+            for (const CE::Name& path : searchResultPaths)
+            {
+                if (PathTreeNode* node = pathTree.GetNode(path))
+                {
+                    nodes.Add(node);
+                }
+            }
+        }
+        else if (PathTreeNode* currentDirectory = pathTree.GetNode(this->currentPath))
+        {
+            for (PathTreeNode* node : currentDirectory->children)
             {
-                AssetBrowserItem* item = nullptr;
-                auto node = currentDirectory->children[i];
                 if (node->parent != nullptr && node->parent->parent == nullptr && node->name == "Editor")
                 {
                     continue;
                 }
 
+                nodes.Add(node);
+            }
+        }
+
+        if (!nodes.IsEmpty())
+        {
+            AssetBrowserItem* itemToRename = nullptr;
+            AssetBrowserItem* selectedItem = nullptr;
+
+            for (PathTreeNode* node : nodes)
+            {
+                AssetBrowserItem* item = nullptr;
+
                 AddChild(
                     FAssignNew(AssetBrowserItem, item)
                     .Owner(this)
@@ -191,7 +222,7 @@ namespace CE::Editor
 
     void AssetBrowserGridView::OnBackgroundRightClicked(Vec2 globalMousePos)
     {
-        if (!currentPath.IsValid())
+        if (!currentPath.IsValid() || isShowingSearchResults)
             return;
         if (!currentPath.GetString().StartsWith("/Game/Assets"))
             return;
@@ -26,8 +26,13 @@ namespace CE::Editor
 
     public: // - Public API -
 
+        static constexpr u32 MaxSearchResults = 500;
+
         void SetCurrentPath(const CE::Name& path);
 
+        //! @brief Shows the assets matching the query instead of the current directory. An empty query goes back to browsing.
+        void SetSearchQuery(const String& query);
+
         void OpenAsset(const CE::Name& path);
 
         bool IsCurrentDirectoryReadOnly() const;
@@ -86,6 +91,7 @@ namespace CE::Editor
 
         Ref<FHorizontalStack> searchBarStack;
         Ref<FButton> addButton;
+        Ref<FTextInput> searchBox;
         Ref<FLabel> statusBarLabel;
 
         Ref<AssetBrowserGridViewModel> gridViewModel = nullptr;
@@ -95,6 +101,8 @@ namespace CE::Editor
         PathTreeNode* currentDirectory = nullptr;
         CE::Name currentPath = {};
 
+        String searchQuery;
+
         Ref<FHorizontalStack> breadCrumbsContainer = nullptr;
 
         Array<Ref<FSelectableButton>> selectables;
@@ -47,6 +47,15 @@ namespace CE::Editor
 
         void SetCurrentDirectory(const CE::Name& directory);
 
+        //! @brief Shows the given assets instead of the contents of the current directory.
+        void SetSearchResults(const Array<CE::Name>& assetPaths);
+
+        void ClearSearchResults();
+
+        bool IsShowingSearchResults() const { return isShowingSearchResults; }
+
+        int GetItemCount() const { return items.GetSize(); }
+
         int GetSelectedItemCount();
 
         Array<AssetBrowserItem*> GetSelectedItems();
@@ -68,6 +77,9 @@ namespace CE::Editor
 
         CE::Name itemToSelect;
 
+        bool isShowingSearchResults = false;
+        Array<CE::Name> searchResultPaths;
+
         Ref<EditorMenuPopup> contextMenu;
 
     public: // - Fusion Properties - 
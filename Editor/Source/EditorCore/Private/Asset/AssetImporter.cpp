@@ -102,11 +102,16 @@ namespace CE::Editor
 		importResult.sourcePath = job->sourcePath;
 		importResult.productPath = job->productPath;
 		importResult.errorMessage = job->errorMessage;
+		importResult.sourceDependencies = job->sourceDependencies;
 
 		if (!job->success)
 		{
 			CE_LOG(Error, All, "Failed to import asset {}. Error: {}", job->sourcePath, job->errorMessage);
 		}
+		else if (enableLogging && job->fetchedFromCache)
+		{
+			CE_LOG(Info, All, "Fetched Asset from derived data cache: {}", job->productPath);
+		}
 		else if (enableLogging)
 		{
 			CE_LOG(Info, All, "Generated Asset: {}", job->productPath);
@@ -202,6 +207,46 @@ namespace CE::Editor
 		return {};
 	}
 
+	Array<IO::Path> AssetImportJob::PrepareSourceDependencies()
+	{
+		return {};
+	}
+
+	String AssetImportJob::ComputeDerivedDataKey()
+	{
+		DerivedDataCache::KeyInputs inputs{};
+		inputs.importer = importer;
+		inputs.assetDefinitionVersion = importer->assetDefinitionVersion;
+		inputs.targetPlatform = targetPlatform;
+		inputs.sourcePath = sourcePath;
+		inputs.bundlePath = bundlePath;
+		inputs.sourceAssetRelativePath = sourceAssetRelativePath;
+
+		// Game assets are imported on top of the existing product, to keep the uuids of its objects
+		if (isGameAsset)
+		{
+			inputs.existingProductPath = productPath;
+		}
+
+		Array<Name> dependencies = importer->GetProductAssetDependencies();
+		dependencies.AddRange(PrepareProductAssetDependencies());
+
+		for (const Name& dependency : dependencies)
+		{
+			IO::Path dependencyPath = Bundle::GetAbsoluteBundlePath(dependency);
+			if (!dependencyPath.Exists())
+			{
+				dependencyPath = dependency.GetString();
+			}
+
+			inputs.dependencyPaths.Add(dependencyPath);
+		}
+
+		inputs.dependencyPaths.AddRange(sourceDependencies);
+
+		return DerivedDataCache::ComputeKey(inputs);
+	}
+
 	void AssetImportJob::Finish()
 	{
 		onFinish.Broadcast(this);
@@ -281,6 +326,24 @@ namespace CE::Editor
 		editorProductPath = editorProductPath.GetString().Replace({ '\\' }, '/');
 		productPath = productPath.GetString().Replace({'\\'}, '/');
 #endif
+
+		// Needed for the derived data key, and by the asset processor even when the product is fetched from the cache
+		sourceDependencies = PrepareSourceDependencies();
+
+		fetchedFromCache = false;
+		String derivedDataKey{};
+
+		if (importer->derivedDataCache != nullptr && importer->derivedDataCache->IsEnabled())
+		{
+			derivedDataKey = ComputeDerivedDataKey();
+
+			if (importer->derivedDataCache->Fetch(derivedDataKey, productPath))
+			{
+				fetchedFromCache = true;
+				success = true;
+				return;
+			}
+		}
 		
 		Ref<Bundle> bundle = nullptr;
     	Ref<Object> transient = CreateObject<Object>(nullptr, "Transient", OF_Transient);
@@ -388,6 +451,22 @@ namespace CE::Editor
 			success = false;
 			return;
 		}
+
+		if (derivedDataKey.NotEmpty())
+		{
+			importer->derivedDataCache->Store(derivedDataKey, productPath);
+
+			if (isGameAsset)
+			{
+				// Importing the same source on top of the product we just saved gives the same product back.
+				// Storing it under that key too means that touching the source file is still a cache hit.
+				String reimportKey = ComputeDerivedDataKey();
+				if (reimportKey.NotEmpty() && reimportKey != derivedDataKey)
+				{
+					importer->derivedDataCache->Store(reimportKey, productPath);
+				}
+			}
+		}
 	}
     
 } // namespace CE::Editor
@@ -0,0 +1,243 @@
+#include "EditorCore.h"
+
+namespace CE::Editor
+{
+
+	void DerivedDataCache::Initialize(const IO::Path& localCacheDirectory, const IO::Path& sharedCacheDirectory)
+	{
+		this->localCacheDirectory = localCacheDirectory;
+		this->sharedCacheDirectory = sharedCacheDirectory;
+
+		if (!localCacheDirectory.IsEmpty() && !localCacheDirectory.Exists())
+		{
+			IO::Path::CreateDirectories(localCacheDirectory);
+		}
+
+		if (!sharedCacheDirectory.IsEmpty() && !sharedCacheDirectory.Exists())
+		{
+			CE_LOG(Warn, All, "Shared derived data cache directory does not exist: {}", sharedCacheDirectory);
+			this->sharedCacheDirectory = {};
+		}
+
+		ResetStatistics();
+	}
+
+	String DerivedDataCache::ComputeKey(const KeyInputs& inputs)
+	{
+		ZoneScoped;
+
+		if (inputs.importer == nullptr)
+			return "";
+
+		String sourceHash = HashFile(inputs.sourcePath);
+		if (sourceHash.IsEmpty())
+			return "";
+
+		String keyString = String::Format("DDC{};Bundle{}.{}.{};", Version,
+			Bundle::GetCurrentMajor(), Bundle::GetCurrentMinor(), Bundle::GetCurrentPatch());
+
+		ClassType* importerClass = inputs.importer->GetClass();
+
+		keyString += String::Format("{};{};{};{};", importerClass->GetTypeName(), inputs.importer->GetImporterVersion(),
+			inputs.assetDefinitionVersion, (int)inputs.targetPlatform);
+
+		// Import settings
+		for (u32 i = 0; i < importerClass->GetFieldCount(); i++)
+		{
+			Ptr<FieldType> field = importerClass->GetFieldAt(i);
+			if (field == nullptr || !field->HasAnyFieldFlags(FIELD_Config))
+				continue;
+
+			keyString += String::Format("{}={};", field->GetName(), field->GetFieldValueAsString(inputs.importer));
+		}
+
+		keyString += String::Format("{};{};{};", inputs.bundlePath, inputs.sourceAssetRelativePath, sourceHash);
+
+		if (!inputs.existingProductPath.IsEmpty() && inputs.existingProductPath.Exists())
+		{
+			String productHash = HashFile(inputs.existingProductPath);
+			if (productHash.IsEmpty())
+				return "";
+
+			keyString += "Existing=" + productHash + ";";
+		}
+
+		// Dependencies are sorted, so the order they were declared in doesn't change the key
+		Array<String> dependencyHashes{};
+
+		for (const IO::Path& dependencyPath : inputs.dependencyPaths)
+		{
+			String dependencyHash = HashFile(dependencyPath);
+			if (dependencyHash.IsEmpty())
+				return "";
+
+			dependencyHashes.Add(dependencyHash);
+		}
+
+		dependencyHashes.Sort([](const String& lhs, const String& rhs)
+			{
+				return lhs < rhs;
+			});
+
+		for (const String& dependencyHash : dependencyHashes)
+		{
+			keyString += "Dep=" + dependencyHash + ";";
+		}
+
+		Hash128 keyHash = CalculateHash128(keyString.GetCString(), keyString.GetLength());
+		return String::Format("{:016x}{:016x}", keyHash.high64, keyHash.low64);
+	}
+
+	bool DerivedDataCache::Fetch(const String& key, const IO::Path& productPath)
+	{
+		ZoneScoped;
+
+		if (!IsEnabled() || key.IsEmpty())
+			return false;
+
+		IO::Path localEntryPath = GetEntryPath(localCacheDirectory, key);
+		u64 fileSize = 0;
+
+		if (localEntryPath.Exists() && CopyFileAtomic(localEntryPath, productPath, fileSize))
+		{
+			hits++;
+			bytesRead += fileSize;
+			return true;
+		}
+
+		if (!sharedCacheDirectory.IsEmpty())
+		{
+			IO::Path sharedEntryPath = GetEntryPath(sharedCacheDirectory, key);
+
+			if (sharedEntryPath.Exists() && CopyFileAtomic(sharedEntryPath, productPath, fileSize))
+			{
+				// Keep a local copy, so the next lookup doesn't have to go through the shared folder
+				u64 localFileSize = 0;
+				CopyFileAtomic(sharedEntryPath, localEntryPath, localFileSize);
+
+				hits++;
+				bytesRead += fileSize;
+				return true;
+			}
+		}
+
+		misses++;
+		return false;
+	}
+
+	bool DerivedDataCache::Store(const String& key, const IO::Path& productPath)
+	{
+		ZoneScoped;
+
+		if (!IsEnabled() || key.IsEmpty() || !productPath.Exists())
+			return false;
+
+		u64 fileSize = 0;
+
+		if (!CopyFileAtomic(productPath, GetEntryPath(localCacheDirectory, key), fileSize))
+			return false;
+
+		if (!sharedCacheDirectory.IsEmpty())
+		{
+			IO::Path sharedEntryPath = GetEntryPath(sharedCacheDirectory, key);
+			u64 sharedFileSize = 0;
+
+			// Entries are immutable, so there is no need to overwrite one that another machine already stored
+			if (!sharedEntryPath.Exists())
+			{
+				CopyFileAtomic(productPath, sharedEntryPath, sharedFileSize);
+			}
+		}
+
+		stores++;
+		bytesWritten += fileSize;
+		return true;
+	}
+
+	DerivedDataCache::Statistics DerivedDataCache::GetStatistics() const
+	{
+		Statistics statistics{};
+		statistics.hits = hits;
+		statistics.misses = misses;
+		statistics.stores = stores;
+		statistics.bytesRead = bytesRead;
+		statistics.bytesWritten = bytesWritten;
+		return statistics;
+	}
+
+	void DerivedDataCache::ResetStatistics()
+	{
+		hits = 0;
+		misses = 0;
+		stores = 0;
+		bytesRead = 0;
+		bytesWritten = 0;
+	}
+
+	String DerivedDataCache::HashFile(const IO::Path& filePath)
+	{
+		ZoneScoped;
+
+		if (!filePath.Exists() || filePath.IsDirectory())
+			return "";
+
+		FileStream fileStream = FileStream(filePath, Stream::Permissions::ReadOnly);
+		if (!fileStream.IsOpen())
+			return "";
+
+		fileStream.SetBinaryMode(true);
+
+		u64 length = fileStream.GetLength();
+		Array<u8> data{};
+		data.Resize(length);
+
+		if (length > 0 && fileStream.Read(data.GetData(), length) != (s64)length)
+			return "";
+
+		Hash128 hash = CalculateHash128(data.GetData(), length);
+		return String::Format("{:016x}{:016x}", hash.high64, hash.low64);
+	}
+
+	IO::Path DerivedDataCache::GetEntryPath(const IO::Path& cacheDirectory, const String& key)
+	{
+		// Spread the entries over 256 sub-directories to keep directory listings short
+		return cacheDirectory / key.GetSubstring(0, 2) / (key + ".casset");
+	}
+
+	bool DerivedDataCache::CopyFileAtomic(const IO::Path& from, const IO::Path& to, u64& outFileSize)
+	{
+		std::error_code error{};
+
+		IO::Path parentPath = to.GetParentPath();
+		if (!parentPath.Exists())
+		{
+			IO::Path::CreateDirectories(parentPath);
+		}
+
+		// Copy to a temporary file first, so other processes sharing the cache never see a partially written file
+		IO::Path tempPath = parentPath / String::Format("{}.{}.tmp", to.GetFileName().GetString(), Uuid::Random());
+
+		fs::copy_file((fs::path)from, (fs::path)tempPath, fs::copy_options::overwrite_existing, error);
+		if (error)
+		{
+			CE_LOG(Warn, All, "Derived data cache failed to copy {} to {}: {}", from, tempPath, error.message());
+			fs::remove((fs::path)tempPath, error);
+			return false;
+		}
+
+		outFileSize = fs::file_size((fs::path)tempPath, error);
+		if (error)
+			outFileSize = 0;
+
+		fs::rename((fs::path)tempPath, (fs::path)to, error);
+		if (error)
+		{
+			CE_LOG(Warn, All, "Derived data cache failed to write {}: {}", to, error.message());
+			fs::remove((fs::path)tempPath, error);
+			return false;
+		}
+
+		return true;
+	}
+
+} // namespace CE::Editor
@@ -2,6 +2,71 @@
 
 namespace CE::Editor
 {
+
+	struct StageCompileTask
+	{
+		const SubShaderPassEntry* passEntry = nullptr;
+
+		int subShaderIndex = 0;
+		int passIndex = 0;
+		int variantIndex = 0;
+		int stageIndex = 0;
+
+		ShaderBuildConfig buildConfig{};
+		Array<std::wstring> extraArgs{};
+
+		BinaryBlob byteCode{};
+		String errorMessage = "";
+		bool succeeded = false;
+	};
+
+	static String GetKeywordsSuffix(const StageCompileTask& task)
+	{
+		if (task.buildConfig.globalDefines.IsEmpty())
+			return "";
+
+		String keywords = "";
+		for (const String& define : task.buildConfig.globalDefines)
+		{
+			if (keywords.NotEmpty())
+				keywords += ", ";
+			keywords += define;
+		}
+		return " with keywords [" + keywords + "]";
+	}
+
+	static void CompileStage(StageCompileTask& task)
+	{
+		ZoneScoped;
+
+		ShaderCache& shaderCache = ShaderCache::Get();
+		const BinaryBlob& source = task.passEntry->source;
+
+		String cacheKey = "";
+		if (shaderCache.IsEnabled())
+		{
+			cacheKey = ShaderCache::ComputeKey(ShaderBlobFormat::Spirv, source.GetDataPtr(), source.GetDataSize(), task.buildConfig, task.extraArgs);
+
+			if (shaderCache.Fetch(cacheKey, task.byteCode))
+			{
+				task.succeeded = true;
+				return;
+			}
+		}
+
+		// DXC instances can't be shared between threads, so every stage gets its own compiler
+		ShaderCompiler compiler{};
+
+		ShaderCompiler::ErrorCode result = compiler.BuildSpirv(source.GetDataPtr(), (u32)source.GetDataSize(), task.buildConfig, task.byteCode, task.extraArgs);
+		if (result != ShaderCompiler::ERR_Success)
+		{
+			task.errorMessage = compiler.GetErrorMessage();
+			return;
+		}
+
+		shaderCache.Store(cacheKey, task.byteCode);
+		task.succeeded = true;
+	}
     
 	Array<AssetImportJob*> ShaderAssetImporter::CreateImportJobs(const Array<IO::Path>& sourceAssets, const Array<IO::Path>& productAssets)
 	{
@@ -15,6 +80,44 @@ namespace CE::Editor
 		return jobs;
 	}
 
+	void ShaderAssetImportJob::CompileStages(Array<StageCompileTask>& tasks)
+	{
+		// Child jobs can only be waited on from a started job. ImportSourceAssets() calls Process() directly on the calling thread.
+		if (tasks.GetSize() <= 1 || GetDependentCount() != 0)
+		{
+			for (StageCompileTask& task : tasks)
+			{
+				CompileStage(task);
+			}
+			return;
+		}
+
+		for (int i = 0; i < tasks.GetSize(); i++)
+		{
+			StageCompileTask* task = &tasks[i];
+
+			Job* job = new JobFunction([task](Job*)
+				{
+					CompileStage(*task);
+				}, true, GetContext());
+
+			StartAsChild(job);
+		}
+
+		// This thread keeps processing other jobs while it waits
+		WaitForChildren();
+	}
+
+	Array<IO::Path> ShaderAssetImportJob::PrepareSourceDependencies()
+	{
+		Array<IO::Path> includePaths = this->includePaths;
+		includePaths.Add(sourcePath.GetParentPath());
+
+		Array<IO::Path> includedFiles{};
+		ShaderIncludeCache::Get().CollectIncludeDependencies(sourcePath, includePaths, includedFiles);
+		return includedFiles;
+	}
+
 	bool ShaderAssetImportJob::ProcessAsset(const Ref<Bundle>& bundle)
 	{
 		if (bundle == nullptr)
@@ -63,6 +166,8 @@ namespace CE::Editor
 			shader->properties.Add(preprocessData.properties[i]);
 		}
 
+		Array<StageCompileTask> compileTasks{};
+
 		for (SubShaderEntry& subShaderEntry : preprocessData.subShaders)
 		{
 			auto& passEntries = subShaderEntry.passes;
@@ -70,94 +175,115 @@ namespace CE::Editor
 			shader->subShaders.Add({});
 			SubShader& subShader = shader->subShaders.Top();
 			subShader.tags.AddRange(subShaderEntry.subShaderTags);
+			int subShaderIndex = shader->subShaders.GetSize() - 1;
 			int passIndex = 0;
 
 			for (SubShaderPassEntry& passEntry : passEntries)
 			{
-				ShaderCompiler compiler{};
-
 				ShaderBuildConfig buildConfig{};
-				buildConfig.entry = passEntry.vertexEntry.GetString();
-				buildConfig.stage = RHI::ShaderStage::Vertex;
 				buildConfig.includeSearchPaths = includePaths;
 				buildConfig.debugName = preprocessData.shaderName.GetString();
 
+				Array<ShaderPermutation> permutations{};
+				if (!ShaderPermutations::Enumerate(passEntry.features, buildConfig.maxPermutations, permutations))
+				{
+					errorMessage = String::Format("Pass {} has more than {} keyword permutations.", passEntry.passName.GetString(), buildConfig.maxPermutations);
+					return false;
+				}
+
 				subShader.passes.Add({});
 				ShaderPass& pass = subShader.passes.Top();
 				pass.passName = passEntry.passName.GetString();
-				pass.variants.Add(CE::ShaderVariant());
 				pass.tags.AddRange(passEntry.passTags);
+				pass.features = passEntry.features;
 
-				CE::ShaderVariant& variant = pass.variants[0];
-				variant.variantHash = 0;
-				variant.shaderStageBlobs.Add(CreateObject<ShaderBlob>(shader.Get(), String("VertexBlob_") + passIndex));
-				variant.shaderStageBlobs.Add(CreateObject<ShaderBlob>(shader.Get(), String("FragmentBlob_") + passIndex));
-
-				// - Vertex -
-
-				ShaderBlob* vertBlob = variant.shaderStageBlobs[0];
-				vertBlob->format = ShaderBlobFormat::Spirv;
-				vertBlob->shaderStage = RHI::ShaderStage::Vertex;
-
-				Array<std::wstring> vertexExtraArgs{};
-				vertexExtraArgs.AddRange({
-					L"-D", L"COMPILE=1",
-					L"-D", L"VERTEX=1",
-					L"-fspv-preserve-bindings",
-					L"-fspv-debug=vulkan-with-source"
-					});
-
-				ShaderCompiler::ErrorCode result = compiler.BuildSpirv(passEntry.source.GetDataPtr(), (u32)passEntry.source.GetDataSize(), buildConfig, vertBlob->byteCode, vertexExtraArgs);
-				if (result != ShaderCompiler::ERR_Success)
+				for (int variantIndex = 0; variantIndex < permutations.GetSize(); variantIndex++)
 				{
-					errorMessage = "Failed to compile vertex shader. Error: " + compiler.GetErrorMessage();
-					return false;
+					const ShaderPermutation& permutation = permutations[variantIndex];
+
+					pass.variants.Add(CE::ShaderVariant());
+					CE::ShaderVariant& variant = pass.variants.Top();
+					variant.defineFlags = permutation.defines;
+					variant.variantHash = permutation.variantHash;
+
+					// The default variant keeps the blob names it had before permutations existed
+					String blobSuffix = variantIndex == 0 ? String::Format("{}", passIndex) : String::Format("{}_{}", passIndex, variantIndex);
+
+					variant.shaderStageBlobs.Add(CreateObject<ShaderBlob>(shader.Get(), "VertexBlob_" + blobSuffix));
+					variant.shaderStageBlobs.Add(CreateObject<ShaderBlob>(shader.Get(), "FragmentBlob_" + blobSuffix));
+
+					for (int stageIndex = 0; stageIndex < variant.shaderStageBlobs.GetSize(); stageIndex++)
+					{
+						bool isVertex = stageIndex == 0;
+
+						ShaderBlob* blob = variant.shaderStageBlobs[stageIndex];
+						blob->format = ShaderBlobFormat::Spirv;
+						blob->shaderStage = isVertex ? RHI::ShaderStage::Vertex : RHI::ShaderStage::Fragment;
+
+						StageCompileTask& task = compileTasks.EmplaceBack();
+						task.passEntry = &passEntry;
+						task.subShaderIndex = subShaderIndex;
+						task.passIndex = passIndex;
+						task.variantIndex = variantIndex;
+						task.stageIndex = stageIndex;
+
+						task.buildConfig = buildConfig;
+						task.buildConfig.entry = isVertex ? passEntry.vertexEntry.GetString() : passEntry.fragmentEntry.GetString();
+						task.buildConfig.stage = blob->shaderStage;
+
+						for (const String& define : permutation.defines)
+						{
+							task.buildConfig.globalDefines.Add(define + "=1");
+						}
+
+						task.extraArgs.AddRange({
+							L"-D", L"COMPILE=1",
+							L"-D", isVertex ? L"VERTEX=1" : L"FRAGMENT=1",
+							L"-fspv-preserve-bindings",
+							L"-fspv-debug=vulkan-with-source"
+							});
+					}
 				}
 
-				ShaderReflector shaderReflector{};
-				ShaderReflector::ErrorCode reflectionResult =
-					shaderReflector.Reflect(ShaderBlobFormat::Spirv, vertBlob->byteCode.GetDataPtr(), vertBlob->byteCode.GetDataSize(),
-						RHI::ShaderStage::Vertex, variant.reflectionInfo, buildConfig.entry);
-				if (reflectionResult != ShaderReflector::ERR_Success)
-				{
-					errorMessage = "Failed to reflect vertex shader.";
-					return false;
-				}
+				passIndex++;
+			}
+		}
 
-				// - Fragment -
+		CompileStages(compileTasks);
 
-				buildConfig.entry = passEntry.fragmentEntry.GetString();
-				buildConfig.stage = RHI::ShaderStage::Fragment;
-				ShaderBlob* fragBlob = variant.shaderStageBlobs[1];
-				fragBlob->format = ShaderBlobFormat::Spirv;
-				fragBlob->shaderStage = RHI::ShaderStage::Fragment;
+		// Reflection is merged into the variant in the same order as before: vertex, then fragment
+		for (StageCompileTask& task : compileTasks)
+		{
+			const char* stageName = task.buildConfig.stage == RHI::ShaderStage::Vertex ? "vertex" : "fragment";
 
-				Array<std::wstring> fragmentExtraArgs{};
-				fragmentExtraArgs.AddRange({
-					L"-D", L"COMPILE=1",
-					L"-D", L"FRAGMENT=1",
-					L"-fspv-preserve-bindings",
-					L"-fspv-debug=vulkan-with-source"
-					});
+			if (!task.succeeded)
+			{
+				errorMessage = String::Format("Failed to compile {} shader{}. Error: {}", stageName, GetKeywordsSuffix(task), task.errorMessage);
+				return false;
+			}
 
-				result = compiler.BuildSpirv(passEntry.source.GetDataPtr(), (u32)passEntry.source.GetDataSize(), buildConfig, fragBlob->byteCode, fragmentExtraArgs);
-				if (result != ShaderCompiler::ERR_Success)
-				{
-					errorMessage = "Failed to compile fragment shader. Error: " + compiler.GetErrorMessage();
-					return false;
-				}
+			CE::ShaderVariant& variant = shader->subShaders[task.subShaderIndex].passes[task.passIndex].variants[task.variantIndex];
+			ShaderBlob* blob = variant.shaderStageBlobs[task.stageIndex];
+			blob->byteCode = task.byteCode;
+			task.byteCode.Free();
 
-				reflectionResult = shaderReflector.Reflect(ShaderBlobFormat::Spirv, fragBlob->byteCode.GetDataPtr(), fragBlob->byteCode.GetDataSize(),
-					RHI::ShaderStage::Fragment, variant.reflectionInfo, buildConfig.entry);
-				if (reflectionResult != ShaderReflector::ERR_Success)
-				{
-					errorMessage = "Failed to reflect fragment shader.";
-					return false;
-				}
+			ShaderReflector shaderReflector{};
+			ShaderReflector::ErrorCode reflectionResult =
+				shaderReflector.Reflect(ShaderBlobFormat::Spirv, blob->byteCode.GetDataPtr(), blob->byteCode.GetDataSize(),
+					task.buildConfig.stage, variant.reflectionInfo, task.buildConfig.entry);
+			if (reflectionResult != ShaderReflector::ERR_Success)
+			{
+				errorMessage = String::Format("Failed to reflect {} shader{}.", stageName, GetKeywordsSuffix(task));
+				return false;
+			}
+		}
 
-				// Clear the original HLSL source
+		// Clear the original HLSL source
+		for (SubShaderEntry& subShaderEntry : preprocessData.subShaders)
+		{
+			for (SubShaderPassEntry& passEntry : subShaderEntry.passes)
+			{
 				passEntry.source.Free();
-				passIndex++;
 			}
 		}
 		
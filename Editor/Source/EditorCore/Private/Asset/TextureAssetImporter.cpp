@@ -13,6 +13,7 @@ namespace CE::Editor
 			job->compressionQuality = compressionQuality;
 			job->ignoreCompressionFolders = ignoreCompressionFolders;
 			job->anisotropy = anisotropy;
+			job->generateMipMaps = generateMipMaps;
 			job->importHdrAsCubemap = importHdrAsCubemap;
 			job->convoluteCubemap = convoluteCubemap;
 			job->diffuseConvolutionResolution = diffuseConvolutionResolution;
@@ -267,34 +268,41 @@ namespace CE::Editor
 		texture->compressionQuality = compressionQuality;
 		texture->sourceCompressionFormat = compressionFormat;
 
-		Ref<CE::Shader> equirectShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/CubeMap/Equirectangular");
-		Ref<CE::Shader> iblShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/CubeMap/IBL");
-		Ref<CE::Shader> iblConvolutionShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/CubeMap/IBLConvolution");
-		Ref<CE::Shader> mipmapShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/Utils/MipMapGen");
-
-		RPI::ShaderCollection* equirectShaderCollection = equirectShader->GetShaderCollection();
-		RPI::ShaderCollection* iblShaderCollection = iblShader->GetShaderCollection();
-		RPI::ShaderCollection* iblConvolutionShaderCollection = iblConvolutionShader->GetShaderCollection();
-		RPI::ShaderCollection* mipMapShaderCollection = mipmapShader->GetShaderCollection();
-
 		RPI::CubeMapOfflineProcessInfo processInfo{};
 		processInfo.name = name;
 		processInfo.sourceImage = sourceImage;
-		processInfo.equirectangularShader = equirectShaderCollection->At(0).shader;
-		processInfo.grayscaleShader = iblShaderCollection->At(0).shader;
-		processInfo.rowAverageShader = iblShaderCollection->At(1).shader;
-		processInfo.columnAverageShader = iblShaderCollection->At(2).shader;
-		processInfo.divisionShader = iblShaderCollection->At(3).shader;
-		processInfo.cdfMarginalInverseShader = iblShaderCollection->At(4).shader;
-		processInfo.cdfConditionalInverseShader = iblShaderCollection->At(5).shader;
-		processInfo.diffuseConvolutionShader = iblConvolutionShaderCollection->At(0).shader;
 		processInfo.useCompression = (compressionFormat == TextureSourceCompressionFormat::BC6H);
 		processInfo.diffuseIrradianceResolution = convoluteCubemap ? diffuseConvolutionResolution : 0;
 		processInfo.diffuseIrradianceOutput = nullptr;
 		processInfo.compressDiffuseIrradiance = compressConvolution;
 		processInfo.specularConvolution = specularConvolution;
-		processInfo.specularConvolutionShader = iblConvolutionShaderCollection->At(1).shader;
-		processInfo.mipMapShader = mipMapShaderCollection->At(0).shader;
+
+		// Headless asset builds have no RHI: compute the IBL maps on the CPU instead
+		processInfo.useCpu = RHI::gDynamicRHI == nullptr;
+
+		if (!processInfo.useCpu)
+		{
+			Ref<CE::Shader> equirectShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/CubeMap/Equirectangular");
+			Ref<CE::Shader> iblShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/CubeMap/IBL");
+			Ref<CE::Shader> iblConvolutionShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/CubeMap/IBLConvolution");
+			Ref<CE::Shader> mipmapShader = gEngine->GetAssetManager()->LoadAssetAtPath<CE::Shader>("/Editor/Assets/Shaders/Utils/MipMapGen");
+
+			RPI::ShaderCollection* equirectShaderCollection = equirectShader->GetShaderCollection();
+			RPI::ShaderCollection* iblShaderCollection = iblShader->GetShaderCollection();
+			RPI::ShaderCollection* iblConvolutionShaderCollection = iblConvolutionShader->GetShaderCollection();
+			RPI::ShaderCollection* mipMapShaderCollection = mipmapShader->GetShaderCollection();
+
+			processInfo.equirectangularShader = equirectShaderCollection->At(0).shader;
+			processInfo.grayscaleShader = iblShaderCollection->At(0).shader;
+			processInfo.rowAverageShader = iblShaderCollection->At(1).shader;
+			processInfo.columnAverageShader = iblShaderCollection->At(2).shader;
+			processInfo.divisionShader = iblShaderCollection->At(3).shader;
+			processInfo.cdfMarginalInverseShader = iblShaderCollection->At(4).shader;
+			processInfo.cdfConditionalInverseShader = iblShaderCollection->At(5).shader;
+			processInfo.diffuseConvolutionShader = iblConvolutionShaderCollection->At(0).shader;
+			processInfo.specularConvolutionShader = iblConvolutionShaderCollection->At(1).shader;
+			processInfo.mipMapShader = mipMapShaderCollection->At(0).shader;
+		}
 
 		if (convoluteCubemap && diffuseConvolutionResolution > 0)
 		{
@@ -339,11 +347,29 @@ namespace CE::Editor
 		Ref<Texture2D> texture = CreateObject<Texture2D>(bundle, name,
 			OF_NoFlags, Texture2D::StaticClass(), nullptr, textureUuid);
 
+		// Mips are generated on the CPU. BCn encoding works on 4x4 blocks, so every mip must stay a multiple of 4.
+		CMMipGenerationSettings mipSettings{};
+		mipSettings.minResolution = targetSourceFormat != CMImageSourceFormat::None ? 4 : 1;
+		mipSettings.maxMipLevels = generateMipMaps ? 0 : 1;
+		// Only sRGB encoded color is filtered in linear space. Normal, grayscale & other data maps store linear values,
+		// and so does every texture sampled through a UNORM format.
+		mipSettings.gammaCorrect = texture->colorSpace == TextureColorSpace::SRGB && image.GetNumChannels() >= 3;
+
+		CMImageMipGenerator mipGenerator{};
+		BinaryBlob mipStorage{};
+		Array<CMImage> mips{};
+
+		if (!mipGenerator.Generate(image, mipSettings, mipStorage, mips))
+		{
+			mips.Clear();
+			mips.Add(image);
+		}
+
 		texture->anisoLevel = anisotropy;
 		texture->width = image.GetWidth();
 		texture->height = image.GetHeight();
 		texture->arrayCount = 1;
-		texture->mipLevels = 1;
+		texture->mipLevels = mips.GetSize();
 		texture->addressModeU = texture->addressModeV = TextureAddressMode::Repeat;
 		texture->filter = RHI::FilterMode::Linear;
 		texture->pixelFormat = pixelFormat;
@@ -352,9 +378,13 @@ namespace CE::Editor
 
 		if (targetSourceFormat != CMImageSourceFormat::None) // Use BCn format
 		{
-			float quality = 0.05f;
 			CMImageEncoder encoder{};
-			u64 reserveSize = encoder.GetCompressedSizeRequirement(image, targetSourceFormat);
+			u64 reserveSize = 0;
+			for (const CMImage& mip : mips)
+			{
+				reserveSize += encoder.GetCompressedSizeRequirement(mip, targetSourceFormat);
+			}
+
 			if (reserveSize == 0)
 			{
 				errorMessage = "Invalid compression format!";
@@ -363,11 +393,17 @@ namespace CE::Editor
 
 			texture->source.Reserve(reserveSize);
 
-			bool success = encoder.EncodeToBCn(image, texture->source.GetDataPtr(), targetSourceFormat, CMImageEncoder::Quality_Normal);
-			if (!success)
+			u64 offset = 0;
+			for (const CMImage& mip : mips)
 			{
-				errorMessage = "Failed to encode to BCn format!";
-				return false;
+				bool success = encoder.EncodeToBCn(mip, texture->source.GetDataPtr() + offset, targetSourceFormat, CMImageEncoder::Quality_Normal);
+				if (!success)
+				{
+					errorMessage = "Failed to encode to BCn format!";
+					return false;
+				}
+
+				offset += encoder.GetCompressedSizeRequirement(mip, targetSourceFormat);
 			}
 		}
 		else // Store raw pixels
@@ -376,10 +412,6 @@ namespace CE::Editor
 			stream.SetBinaryMode(true);
 			stream.SetAutoResizeIncrement(4_MB);
 
-			u32 width = image.GetWidth();
-			u32 height = image.GetHeight();
-
-			u32 numPixels = width * height;
 			u32 numChannels = image.GetNumChannels();
 			u32 channelStride = numChannels;
 			if (numChannels == 3)
@@ -396,23 +428,59 @@ namespace CE::Editor
 				break;
 			}
 
-			for (int i = 0; i < numPixels; i++)
+			for (const CMImage& mip : mips)
 			{
-				if (isFloat)
+				u32 numPixels = mip.GetWidth() * mip.GetHeight();
+
+				for (int i = 0; i < numPixels; i++)
 				{
-					f32 r = *((f32*)image.GetDataPtr() + channelStride * i + 0);
-					f32 g = 0;
-					if (channelStride >= 2)
-						g = *((f32*)image.GetDataPtr() + channelStride * i + 1);
-					f32 b = 0;
-					if (channelStride >= 3)
-						b = *((f32*)image.GetDataPtr() + channelStride * i + 2);
-					f32 a = 0;
-					if (channelStride >= 4)
-						a = *((f32*)image.GetDataPtr() + channelStride * i + 3);
-
-					if (compressionQuality == TextureCompressionQuality::None) // Store full float32
+					if (isFloat)
+					{
+						f32 r = *((f32*)mip.GetDataPtr() + channelStride * i + 0);
+						f32 g = 0;
+						if (channelStride >= 2)
+							g = *((f32*)mip.GetDataPtr() + channelStride * i + 1);
+						f32 b = 0;
+						if (channelStride >= 3)
+							b = *((f32*)mip.GetDataPtr() + channelStride * i + 2);
+						f32 a = 0;
+						if (channelStride >= 4)
+							a = *((f32*)mip.GetDataPtr() + channelStride * i + 3);
+
+						if (compressionQuality == TextureCompressionQuality::None) // Store full float32
+						{
+							stream << r;
+							if (numChannels >= 2)
+								stream << g;
+							if (numChannels >= 3)
+								stream << b;
+							if (numChannels >= 4)
+								stream << a;
+						}
+						else // Store as float16 (half)
+						{
+							stream << Math::ToFloat16(r);
+							if (numChannels >= 2)
+								stream << Math::ToFloat16(g);
+							if (numChannels >= 3)
+								stream << Math::ToFloat16(b);
+							if (numChannels >= 4)
+								stream << Math::ToFloat16(a);
+						}
+					}
+					else
 					{
+						u8 r = *((u8*)mip.GetDataPtr() + channelStride * i + 0);
+						u8 g = 0;
+						if (channelStride >= 2)
+							g = *((u8*)mip.GetDataPtr() + channelStride * i + 1);
+						u8 b = 0;
+						if (channelStride >= 3)
+							b = *((u8*)mip.GetDataPtr() + channelStride * i + 2);
+						u8 a = 0;
+						if (channelStride >= 4)
+							a = *((u8*)mip.GetDataPtr() + channelStride * i + 3);
+
 						stream << r;
 						if (numChannels >= 2)
 							stream << g;
@@ -421,37 +489,6 @@ namespace CE::Editor
 						if (numChannels >= 4)
 							stream << a;
 					}
-					else // Store as float16 (half)
-					{
-						stream << Math::ToFloat16(r);
-						if (numChannels >= 2)
-							stream << Math::ToFloat16(g);
-						if (numChannels >= 3)
-							stream << Math::ToFloat16(b);
-						if (numChannels >= 4)
-							stream << Math::ToFloat16(a);
-					}
-				}
-				else
-				{
-					u8 r = *((u8*)image.GetDataPtr() + channelStride * i + 0);
-					u8 g = 0;
-					if (channelStride >= 2)
-						g = *((u8*)image.GetDataPtr() + channelStride * i + 1);
-					u8 b = 0;
-					if (channelStride >= 3)
-						b = *((u8*)image.GetDataPtr() + channelStride * i + 2);
-					u8 a = 0;
-					if (channelStride >= 4)
-						a = *((u8*)image.GetDataPtr() + channelStride * i + 3);
-
-					stream << r;
-					if (numChannels >= 2)
-						stream << g;
-					if (numChannels >= 3)
-						stream << b;
-					if (numChannels >= 4)
-						stream << a;
 				}
 			}
 
@@ -13,7 +13,10 @@ namespace CE::Editor
     {
 	    Super::OnBeginDestroy();
 
-
+        if (Ref<FScrollBox> scroll = scrollBox.Lock())
+        {
+            scroll->OnScrollValueChanged().Unbind(scrollHandle);
+        }
     }
 
     void ArrayPropertyEditor::ConstructEditor()
@@ -22,7 +25,95 @@ namespace CE::Editor
 
         expansionArrow->Visible(true);
 
-        
+        // Element rows are kept between the spacers, which stand in for the rows that are scrolled out of view
+        (*expansionStack)
+        (
+            FAssignNew(FWidget, topSpacer)
+            .Height(0),
+
+            FAssignNew(FWidget, bottomSpacer)
+            .Height(0)
+        );
+    }
+
+    void ArrayPropertyEditor::OnPostComputeLayout()
+    {
+        Super::OnPostComputeLayout();
+
+        if (scrollBox.Lock() == nullptr)
+        {
+            for (Ref<FWidget> parent = GetParent(); parent != nullptr; parent = parent->GetParent())
+            {
+                if (parent->IsOfType<FScrollBox>())
+                {
+                    FScrollBox* scroll = static_cast<FScrollBox*>(parent.Get());
+
+                    scroll->OnScrollValueChanged(scrollHandle, [this](FScrollBox*)
+                    {
+                        UpdateVisibleRows(false);
+                    });
+
+                    scrollBox = scroll;
+                    break;
+                }
+            }
+        }
+
+        if (!isExpanded)
+            return;
+
+        if (!rowHeightMeasured)
+        {
+            for (const ElementRow& row : elementRows)
+            {
+                if (row.elementIndex < 0 || row.editor->IsExpanded() || row.editor->GetComputedSize().height <= 0)
+                    continue;
+
+                // Collapsed rows all have the same height, use it for the rows that were never laid out
+                rowHeightMeasured = true;
+                estimatedRowHeight = row.editor->GetComputedSize().height;
+
+                Array<f32> heights;
+                heights.Resize(arraySize);
+                for (int i = 0; i < arraySize; i++)
+                {
+                    heights[i] = estimatedRowHeight;
+                }
+                rowHeights.Build(heights);
+                rowHeightsChanged = true;
+                break;
+            }
+        }
+
+        for (const ElementRow& row : elementRows)
+        {
+            if (row.elementIndex < 0 || row.elementIndex >= (int)rowHeights.GetSize())
+                continue;
+
+            f32 height = row.editor->GetComputedSize().height;
+
+            if (height > 0 && !Math::ApproxEquals(rowHeights.Get(row.elementIndex), height))
+            {
+                rowHeights.Set(row.elementIndex, height);
+                rowHeightsChanged = true;
+            }
+        }
+
+        // Measured heights & the position of the array in the scroll box can both change the visible range.
+        // Nothing is queued if neither changed, otherwise every layout would trigger another one.
+        f32 top = 0, bottom = 0;
+        if (arraySize > 0 && GetVisibleRange(top, bottom) &&
+            (rowHeightsChanged || !Math::ApproxEquals(top, lastVisibleTop) || !Math::ApproxEquals(bottom, lastVisibleBottom)))
+        {
+            QueueVisibleRowsUpdate();
+        }
+    }
+
+    void ArrayPropertyEditor::OnExpand()
+    {
+        Super::OnExpand();
+
+        UpdateValue();
     }
 
     bool ArrayPropertyEditor::IsFieldSupported(FieldType* field) const
@@ -49,9 +140,16 @@ namespace CE::Editor
 
         if (recursively)
         {
-            for (PropertyEditor* elementEditor : elementEditors)
+            // Rows that are bound later pick up the new state when they scroll into view
+            defaultElementExpansion = expanded;
+            elementExpansionOverrides.Clear();
+
+            for (const ElementRow& row : elementRows)
             {
-                elementEditor->ExpandAll(expanded, recursively);
+                if (row.elementIndex >= 0)
+                {
+                    row.editor->ExpandAll(expanded, recursively);
+                }
             }
         }
     }
@@ -145,6 +243,18 @@ namespace CE::Editor
             elementNameOverride = {};
         }
 
+        for (int i = (int)elementRows.GetSize() - 1; i >= 0; i--)
+        {
+            expansionStack->RemoveChild(elementRows[i].editor);
+            elementRows[i].editor->QueueDestroy();
+        }
+
+        elementRows.Clear();
+        elementExpansionOverrides.Clear();
+        defaultElementExpansion = false;
+        rowHeights.Clear();
+        arraySize = 0;
+
         fieldName = field->GetName();
         this->relativeFieldPath = relativeFieldPath;
         this->target = target;
@@ -185,10 +295,10 @@ namespace CE::Editor
             .Enabled(this->arrayEditMode == ArrayEditMode::Default)
         );
 
-        UpdateValue();
-
         isExpanded = PropertyEditorRegistry::Get()->IsExpanded(field);
         UpdateExpansion();
+
+        UpdateValue();
     }
 
     void ArrayPropertyEditor::UpdateTarget(const Array<WeakRef<Object>>& targets, const String& relativeFieldPath)
@@ -201,9 +311,9 @@ namespace CE::Editor
     {
 	    Super::SetSplitRatio(ratio, excluding);
 
-        for (PropertyEditor* elementEditor : elementEditors)
+        for (const ElementRow& row : elementRows)
         {
-            elementEditor->SetSplitRatio(ratio, excluding);
+            row.editor->SetSplitRatio(ratio, excluding);
         }
     }
 
@@ -241,172 +351,405 @@ namespace CE::Editor
 	        return;
         }
 
-        int arraySize = field->GetArraySize(instance);
+        int newArraySize = (int)field->GetArraySize(instance);
+
+        countLabel->Text(String::Format("{} array elements", newArraySize));
+
+        if (newArraySize > (int)rowHeights.GetSize())
+        {
+            Array<f32> heights;
+            heights.Resize(newArraySize - (int)rowHeights.GetSize());
+            for (int i = 0; i < heights.GetSize(); i++)
+            {
+                heights[i] = estimatedRowHeight;
+            }
+            rowHeights.InsertRange(rowHeights.GetSize(), heights);
+        }
+        else if (newArraySize < (int)rowHeights.GetSize())
+        {
+            rowHeights.RemoveRange(newArraySize, rowHeights.GetSize() - newArraySize);
+        }
+
+        arraySize = newArraySize;
 
-        countLabel->Text(String::Format("{} array elements", arraySize));
+        UpdateVisibleRows(true);
+    }
 
-        if (arraySize != arrayElements.GetSize())
+    bool ArrayPropertyEditor::GetVisibleRange(f32& outTop, f32& outBottom)
+    {
+        // Sum the offsets up to the enclosing scroll box, which include its scroll translation
+        f32 offset = 0;
+        FWidget* widget = expansionStack;
+        Ref<FWidget> parent = widget->GetParent();
+
+        while (parent != nullptr)
         {
-	        arrayElements = field->GetArrayFieldListPtr(instance);
+            offset += widget->GetComputedPosition().y + widget->Translation().y;
+
+            if (parent->IsOfType<FScrollBox>())
+                break;
+
+            widget = parent.Get();
+            parent = widget->GetParent();
         }
 
-        bool newElementsCreated = false;
+        f32 viewportHeight = 0;
 
-        static FBrush deleteIcon = FBrush("/Engine/Resources/Icons/Delete");
-        constexpr f32 iconSize = 16;
+        if (parent != nullptr)
+        {
+            viewportHeight = parent->GetComputedSize().height;
+        }
+        else if (Ref<FFusionContext> context = GetContext()) // Not scrollable, the root widget fills the context
+        {
+            viewportHeight = context->GetAvailableSize().height;
+        }
 
-	    for (int i = 0; i < arraySize; ++i)
-	    {
-            const Array<u8>& arrayValue = field->GetFieldValue<Array<u8>>(instance);
-            auto arrayInstance = (void*)arrayValue.GetData();
-            String arrayElementFieldPath = String::Format("{}[{}]", relativeFieldPath, i);
-	        String fieldNameFormat = "Index {}";
+        if (viewportHeight <= 0)
+            return false;
 
-            if (i >= elementEditors.GetSize())
-            {
-	            // Create editor
-                PropertyEditor* propertyEditor = PropertyEditorRegistry::Get()->Create(arrayElements[i], objectEditor);
+        outTop = -offset;
+        outBottom = -offset + viewportHeight;
+        return true;
+    }
 
-                propertyEditor->SetIndentationLevel(GetIndentationLevel() + 1);
+    void ArrayPropertyEditor::UpdateVisibleRows(bool rebindAll)
+    {
+        ZoneScoped;
+
+        Ref<Object> target = this->target.Lock();
+        if (target.IsNull() || expansionStack == nullptr)
+            return;
 
-                Ref<Object> elementTarget = target;
-                if (TypeInfo* underlyingType = field->GetUnderlyingType())
+        int firstElement = 0;
+        int elementCount = 0;
+        f32 top = 0, bottom = 0;
+
+        if (isExpanded && arraySize > 0 && GetVisibleRange(top, bottom) && bottom > 0)
+        {
+            firstElement = Math::Min((int)rowHeights.FindIndex(Math::Max(0.0f, top - RowOverscan)), arraySize);
+            int lastElement = Math::Min((int)rowHeights.FindIndex(bottom + RowOverscan) + 1, arraySize);
+            elementCount = Math::Max(0, lastElement - firstElement);
+        }
+
+        lastVisibleTop = top;
+        lastVisibleBottom = bottom;
+        rowHeightsChanged = false;
+
+        if (rebindAll || firstElement != firstVisibleElement || elementCount != visibleElementCount)
+        {
+            firstVisibleElement = firstElement;
+            visibleElementCount = elementCount;
+
+            for (int i = 0; i < elementRows.GetSize(); i++)
+            {
+                int elementIndex = elementRows[i].elementIndex;
+
+                if (elementIndex >= 0 && (elementIndex < firstElement || elementIndex >= firstElement + elementCount))
                 {
-	                if (underlyingType->IsObject())
-	                {
-		                if (field->IsStrongRefCounted())
-		                {
-                            elementTarget = field->GetArrayElementValueAt<Ref<Object>>(i, instance);
-		                }
-                        else if (field->IsWeakRefCounted())
-                        {
-                            elementTarget = field->GetArrayElementValueAt<WeakRef<Object>>(i, instance).Lock();
-                        }
-                        else
-                        {
-                            elementTarget = field->GetArrayElementValueAt<Object*>(i, instance);
-                        }
-	                }
+                    ReleaseElementRow(i);
                 }
+            }
 
-                propertyEditor->InitTarget({ target }, arrayElementFieldPath);
+            bool newElementsCreated = false;
 
-                FHorizontalStack& left = *propertyEditor->GetLeft();
-            	FHorizontalStack& right = *propertyEditor->GetRight();
+            for (int elementIndex = firstElement; elementIndex < firstElement + elementCount; elementIndex++)
+            {
+                int rowIndex = -1;
+                int freeRowIndex = -1;
 
-                if (arrayElements[i]->IsStructField() && hasElementTypeNameOverride)
+                for (int i = 0; i < elementRows.GetSize(); i++)
                 {
-                    Ref<FLabel> typeLabel = right.FindChildByName<FLabel>("StructTypeLabel");
-                    if (typeLabel)
+                    if (elementRows[i].elementIndex == elementIndex)
                     {
-                        typeLabel->Text(elementTypeNameOverride);
+                        rowIndex = i;
+                        break;
                     }
-                }
 
-                propertyEditor->cachedElementNameFormat = "Index {}";
+                    if (freeRowIndex < 0 && elementRows[i].elementIndex < 0)
+                    {
+                        freeRowIndex = i;
+                    }
+                }
 
-                if (elementNameOverride.NotEmpty())
+                if (rowIndex >= 0)
                 {
-                    String leftName = "";
-
-                    for (int j = 0; j < elementNameOverride.GetLength(); ++j)
+                    if (rebindAll)
                     {
-                        if (elementNameOverride[j] == '.' && arrayElements[i]->IsStructField())
-                        {
-                            String subField = "";
-                            j++;
-                            while (j < elementNameOverride.GetLength())
-                            {
-                                char c = elementNameOverride[j];
-                                if (subField.IsEmpty() && (String::IsAlphabet(c) || c == '_'))
-                                {
-                                    subField.Append(c);
-                                }
-                                else if (String::IsAlphabet(c) || String::IsNumeric(c) || c == '_')
-                                {
-                                    subField.Append(c);
-                                }
-                                else
-                                {
-                                    break;
-                                }
-                                j++;
-                            }
-                            j--;
-
-                            StructType* structType = (StructType*)arrayElements[i]->GetDeclarationType();
-                            void* structInstance = arrayElements[i]->GetFieldInstance(arrayInstance);
-                            Ptr<FieldType> structField = structType->FindField(subField);
-                            if (structField && (structField->GetDeclarationTypeId() == TYPEID(String) || structField->GetDeclarationTypeId() == TYPEID(CE::Name)))
-                            {
-                                leftName += structField->GetFieldValueAsString(structInstance);
-                            }
-                            else
-                            {
-                                leftName += "." + subField;
-                            }
-                        }
-                        else
-                        {
-                            leftName.Append(elementNameOverride[j]);
-                        }
+                        BindElementRow(elementRows[rowIndex].editor, target, elementIndex, false);
+                    }
+                }
+                else
+                {
+                    if (freeRowIndex < 0)
+                    {
+                        PropertyEditor* elementEditor = CreateElementEditor(target, elementIndex);
+                        if (elementEditor == nullptr)
+                            break;
+
+                        freeRowIndex = elementRows.GetSize();
+                        elementRows.Add({ .editor = elementEditor });
+                        newElementsCreated = true;
                     }
 
-                    fieldNameFormat = leftName;
-                    propertyEditor->cachedElementNameFormat = fieldNameFormat;
+                    rowIndex = freeRowIndex;
+                    elementRows[rowIndex].elementIndex = elementIndex;
+                    elementRows[rowIndex].editor->Enabled(true);
+
+                    BindElementRow(elementRows[rowIndex].editor, target, elementIndex, true);
                 }
 
-                u32 curIndex = (u32)i;
+                // Keep the bound rows in element order, right after the top spacer
+                PropertyEditor* elementEditor = elementRows[rowIndex].editor;
+                int childIndex = 1 + elementIndex - firstElement;
 
-                if (fixedInputWidth > 0)
+                if (expansionStack->GetChild(childIndex).Get() != elementEditor)
                 {
-                    propertyEditor->FixedInputWidth(fixedInputWidth);
+                    expansionStack->MoveChildToIndex(elementEditor, childIndex);
                 }
+            }
 
-            	right
-                (
-                    FNew(FImageButton)
-                    .Image(deleteIcon)
-                    .OnClicked([this, curIndex]
+            if (newElementsCreated && objectEditor)
+            {
+                objectEditor->ApplySplitRatio(nullptr);
+            }
+        }
+
+        f32 topHeight = rowHeights.GetPrefixSum(firstElement);
+        f32 bottomHeight = Math::Max(0.0f, rowHeights.GetTotal() - rowHeights.GetPrefixSum(firstElement + elementCount));
+
+        if (!Math::ApproxEquals(topSpacer->MinHeight(), topHeight))
+        {
+            topSpacer->Height(topHeight);
+        }
+
+        if (!Math::ApproxEquals(bottomSpacer->MinHeight(), bottomHeight))
+        {
+            bottomSpacer->Height(bottomHeight);
+        }
+    }
+
+    void ArrayPropertyEditor::QueueVisibleRowsUpdate()
+    {
+        if (visibleRowsUpdateQueued)
+            return;
+
+        FusionApplication* app = FusionApplication::TryGet();
+        if (app == nullptr)
+            return;
+
+        visibleRowsUpdateQueued = true;
+
+        WeakRef<Self> self = this;
+
+        app->DispatchOnMainThread([self]
+        {
+            if (Ref<Self> editor = self.Lock())
+            {
+                editor->visibleRowsUpdateQueued = false;
+                editor->UpdateVisibleRows(false);
+            }
+        });
+    }
+
+    void ArrayPropertyEditor::OnElementDeleted(int index)
+    {
+        // A row keeps its editor's expansion state, so it follows its element instead of being rebound to the next one
+        for (ElementRow& row : elementRows)
+        {
+            if (row.elementIndex == index)
+            {
+                row.editor->Enabled(false);
+                row.elementIndex = -1;
+            }
+            else if (row.elementIndex > index)
+            {
+                row.elementIndex--;
+            }
+        }
+
+        HashSet<int> expansionOverrides;
+        for (int elementIndex : elementExpansionOverrides)
+        {
+            if (elementIndex < index)
+                expansionOverrides.Add(elementIndex);
+            else if (elementIndex > index)
+                expansionOverrides.Add(elementIndex - 1);
+        }
+        elementExpansionOverrides = expansionOverrides;
+
+        if (index < (int)rowHeights.GetSize())
+        {
+            rowHeights.RemoveRange(index, 1);
+        }
+    }
+
+    PropertyEditor* ArrayPropertyEditor::CreateElementEditor(const Ref<Object>& target, int elementIndex)
+    {
+        String elementFieldPath = String::Format("{}[{}]", relativeFieldPath, elementIndex);
+
+        Ptr<FieldType> elementField;
+        void* arrayInstance = nullptr;
+
+        if (!target->GetClass()->FindFieldInstanceRelative(elementFieldPath, target, elementField, arrayInstance))
+            return nullptr;
+
+        // All elements have the same type, so the editor can be rebound to any other element later
+        PropertyEditor* propertyEditor = PropertyEditorRegistry::Get()->Create(elementField, objectEditor);
+        if (propertyEditor == nullptr)
+            return nullptr;
+
+        propertyEditor->SetIndentationLevel(GetIndentationLevel() + 1);
+
+        propertyEditor->InitTarget({ target }, elementFieldPath);
+
+        FHorizontalStack& right = *propertyEditor->GetRight();
+
+        if (elementField->IsStructField() && hasElementTypeNameOverride)
+        {
+            Ref<FLabel> typeLabel = right.FindChildByName<FLabel>("StructTypeLabel");
+            if (typeLabel)
+            {
+                typeLabel->Text(elementTypeNameOverride);
+            }
+        }
+
+        if (fixedInputWidth > 0)
+        {
+            propertyEditor->FixedInputWidth(fixedInputWidth);
+        }
+
+        static FBrush deleteIcon = FBrush("/Engine/Resources/Icons/Delete");
+        constexpr f32 iconSize = 16;
+
+        right
+        (
+            FNew(FImageButton)
+            .Image(deleteIcon)
+            .OnClicked([this, propertyEditor]
+            {
+                for (const ElementRow& row : elementRows)
+                {
+                    if (row.editor == propertyEditor && row.elementIndex >= 0)
                     {
-                        DeleteElement(curIndex);
-                    })
-                    .Width(iconSize)
-                    .Height(iconSize)
-                    .VAlign(VAlign::Center)
-                    .Padding(Vec4(1, 1, 1, 1) * 3)
-                    .Margin(Vec4(5, 0, 5, 0))
-                    .Style("Button.Icon")
-                    .Enabled(this->arrayEditMode == ArrayEditMode::Default)
-                );
+                        DeleteElement((u32)row.elementIndex);
+                        break;
+                    }
+                }
+            })
+            .Width(iconSize)
+            .Height(iconSize)
+            .VAlign(VAlign::Center)
+            .Padding(Vec4(1, 1, 1, 1) * 3)
+            .Margin(Vec4(5, 0, 5, 0))
+            .Style("Button.Icon")
+            .Enabled(this->arrayEditMode == ArrayEditMode::Default)
+        );
 
-                elementEditors.Add(propertyEditor);
+        // The bottom spacer stays last
+        expansionStack->InsertChild((int)expansionStack->GetChildCount() - 1, propertyEditor);
 
-                expansionStack->AddChild(propertyEditor);
+        return propertyEditor;
+    }
 
-                newElementsCreated = true;
+    void ArrayPropertyEditor::BindElementRow(PropertyEditor* elementEditor, const Ref<Object>& target, int elementIndex, bool restoreExpansion)
+    {
+        String elementFieldPath = String::Format("{}[{}]", relativeFieldPath, elementIndex);
+
+        // The editor resolves the element through its field path, so values are only read for bound rows
+        elementEditor->UpdateTarget({ target }, elementFieldPath);
+
+        elementEditor->FieldNameText(GetElementName(target, elementIndex));
+
+        if (restoreExpansion && elementEditor->IsExpandable())
+        {
+            bool expanded = defaultElementExpansion != elementExpansionOverrides.Exists(elementIndex);
+            if (elementEditor->IsExpanded() != expanded)
+            {
+                elementEditor->ExpandAll(expanded);
             }
+        }
+
+        elementEditor->UpdateValue();
+    }
+
+    void ArrayPropertyEditor::ReleaseElementRow(int rowIndex)
+    {
+        ElementRow& row = elementRows[rowIndex];
+
+        if (row.editor->IsExpanded() != defaultElementExpansion)
+        {
+            elementExpansionOverrides.Add(row.elementIndex);
+        }
+        else
+        {
+            elementExpansionOverrides.Remove(row.elementIndex);
+        }
+
+        row.editor->Enabled(false);
+        row.elementIndex = -1;
+    }
 
-            // Use editor
-	    	elementEditors[i]->UpdateTarget({ target }, arrayElementFieldPath);
+    String ArrayPropertyEditor::GetElementName(const Ref<Object>& target, int elementIndex)
+    {
+        String fieldNameFormat = "Index {}";
 
-	        elementEditors[i]->FieldNameText(String::Format(elementEditors[i]->cachedElementNameFormat, i));
+        Ptr<FieldType> elementField;
+        void* arrayInstance = nullptr;
 
-            elementEditors[i]->UpdateValue();
-	    }
+        if (elementNameOverride.IsEmpty() ||
+            !target->GetClass()->FindFieldInstanceRelative(String::Format("{}[{}]", relativeFieldPath, elementIndex), target, elementField, arrayInstance))
+        {
+            return String::Format(fieldNameFormat, elementIndex);
+        }
 
-	    for (int i = (int)elementEditors.GetSize() - 1; i >= arraySize; i--)
-	    {
-            Ref<PropertyEditor> editor = elementEditors[i];
-            expansionStack->RemoveChild(editor.Get());
-            editor->QueueDestroy();
-            elementEditors.RemoveAt(i);
-	    }
+        String leftName = "";
 
-        if (newElementsCreated && objectEditor)
+        for (int j = 0; j < elementNameOverride.GetLength(); ++j)
         {
-            objectEditor->ApplySplitRatio(nullptr);
+            if (elementNameOverride[j] == '.' && elementField->IsStructField())
+            {
+                String subField = "";
+                j++;
+                while (j < elementNameOverride.GetLength())
+                {
+                    char c = elementNameOverride[j];
+                    if (subField.IsEmpty() && (String::IsAlphabet(c) || c == '_'))
+                    {
+                        subField.Append(c);
+                    }
+                    else if (String::IsAlphabet(c) || String::IsNumeric(c) || c == '_')
+                    {
+                        subField.Append(c);
+                    }
+                    else
+                    {
+                        break;
+                    }
+                    j++;
+                }
+                j--;
+
+                StructType* structType = (StructType*)elementField->GetDeclarationType();
+                void* structInstance = elementField->GetFieldInstance(arrayInstance);
+                Ptr<FieldType> structField = structType->FindField(subField);
+                if (structField && (structField->GetDeclarationTypeId() == TYPEID(String) || structField->GetDeclarationTypeId() == TYPEID(CE::Name)))
+                {
+                    leftName += structField->GetFieldValueAsString(structInstance);
+                }
+                else
+                {
+                    leftName += "." + subField;
+                }
+            }
+            else
+            {
+                leftName.Append(elementNameOverride[j]);
+            }
         }
+
+        fieldNameFormat = leftName;
+
+        return String::Format(fieldNameFormat, elementIndex);
     }
 
     PropertyEditor& ArrayPropertyEditor::FixedInputWidth(f32 width)
@@ -415,9 +758,9 @@ namespace CE::Editor
 
         fixedInputWidth = width;
 
-        for (PropertyEditor* elementEditor : elementEditors)
+        for (const ElementRow& row : elementRows)
         {
-            elementEditor->FixedInputWidth(width);
+            row.editor->FixedInputWidth(width);
         }
 
         return *this;
@@ -710,6 +1053,15 @@ namespace CE::Editor
             }
         }
 
+        // arraySize still holds the size from before the deletion
+        Ptr<FieldType> arrayField;
+        void* arrayInstance = nullptr;
+        if (target->GetClass()->FindFieldInstanceRelative(relativeFieldPath, target, arrayField, arrayInstance) &&
+            (int)arrayField->GetArraySize(arrayInstance) < arraySize)
+        {
+            OnElementDeleted((int)index);
+        }
+
         UpdateValue();
     }
 
@@ -501,9 +501,6 @@ namespace CE::Editor
 
     void PropertyEditor::UpdateTarget(const Array<WeakRef<Object>>& targets, const String& relativeFieldPath)
     {
-        if (!editorField)
-            return;
-
         Ref<Object> target;
 
         for (const auto& object : targets)
@@ -515,6 +512,27 @@ namespace CE::Editor
             }
         }
 
+        if (target.IsNull())
+            return;
+
+        this->targets = targets;
+        this->target = target;
+        this->relativeFieldPath = relativeFieldPath;
+
+        // Array element editors are recycled for other elements, so the struct fields have to follow the new path
+        for (const auto& structProperty : structProperties)
+        {
+            structProperty->UpdateTarget(targets, relativeFieldPath + "." + structProperty->GetFieldName().GetString());
+
+            if (structProperty->showCondition.valid)
+            {
+                structProperty->ValidateShowIfCondition(target, relativeFieldPath);
+            }
+        }
+
+        if (!editorField)
+            return;
+
         Ptr<FieldType> field = nullptr;
         Ref<Object> outObject = nullptr;
         void* outInstance = nullptr;
@@ -3,6 +3,7 @@
 namespace CE::Editor
 {
 	class AssetImportJob;
+	class DerivedDataCache;
 
 	struct AssetImportJobResult
 	{
@@ -10,6 +11,9 @@ namespace CE::Editor
 		IO::Path sourcePath{};
 		IO::Path productPath{};
 		String errorMessage{};
+
+		//! @brief Other source files the import read, ex: the headers included by a shader.
+		Array<IO::Path> sourceDependencies{};
 	};
 
 	struct AssetUuidNode
@@ -66,6 +70,12 @@ namespace CE::Editor
 
 		inline void SetTempDirectoryPath(const IO::Path& tempDir) { this->tempDirectory = tempDir; }
 
+		//! @brief Import jobs look up their product in the cache before importing, and store it after a successful import.
+		inline void SetDerivedDataCache(DerivedDataCache* cache) { this->derivedDataCache = cache; }
+
+		//! @brief Version of the asset definition this importer is used for. Part of the derived data cache key.
+		inline void SetAssetDefinitionVersion(u32 version) { this->assetDefinitionVersion = version; }
+
 		virtual Array<Name> GetProductAssetDependencies() { return {}; }
 
 		u32 GetImporterVersion() const { return importerVersion; }
@@ -84,6 +94,9 @@ namespace CE::Editor
 		bool enableLogging = false;
 		IO::Path tempDirectory{};
 
+		DerivedDataCache* derivedDataCache = nullptr;
+		u32 assetDefinitionVersion = 0;
+
 		PlatformName targetPlatform;
 
 		Array<AssetImportJobResult> importResults{};
@@ -116,7 +129,12 @@ namespace CE::Editor
 
 		virtual Array<Name> PrepareProductAssetDependencies();
 
+		//! @brief Override to return the other source files this import reads, ex: included files.
+		//! They are part of the derived data cache key, and the asset is imported again when one of them is modified.
+		virtual Array<IO::Path> PrepareSourceDependencies();
+
 		inline bool Succeeded() const { return success; }
+		inline bool WasFetchedFromCache() const { return fetchedFromCache; }
 		inline const String& GetErrorMessage() const { return errorMessage; }
 
 		inline bool IsGeneratingDistributionAsset() const 
@@ -126,6 +144,7 @@ namespace CE::Editor
 
 		inline const IO::Path& GetSourcePath() const { return sourcePath; }
 		inline const IO::Path& GetProductPath() const { return productPath; }
+		inline const Array<IO::Path>& GetSourceDependencies() const { return sourceDependencies; }
 
 	protected:
 
@@ -140,6 +159,8 @@ namespace CE::Editor
 
 		void BuildUuidTree(Ref<Bundle> bundle);
 
+		String ComputeDerivedDataKey();
+
 		Array<IO::Path> includePaths{};
 
 		PlatformName targetPlatform;
@@ -154,6 +175,8 @@ namespace CE::Editor
 		IO::Path sourcePath{};
 		IO::Path productPath{};
 		IO::Path editorProductPath{};
+
+		Array<IO::Path> sourceDependencies{};
 		
 		String errorMessage = "";
 
@@ -166,6 +189,7 @@ namespace CE::Editor
 	private:
 
 		bool success = false;
+		bool fetchedFromCache = false;
 		AssetUuidNode rootNode{};
 
 		friend class AssetImporter;
@@ -0,0 +1,87 @@
+#pragma once
+
+namespace CE::Editor
+{
+	class AssetImporter;
+
+	/// @brief Content-addressed cache of imported product assets (.casset files).
+	/// Products are stored under a key computed from everything the import depends on: the source bytes, the importer
+	/// class, version & config settings, the asset definition version, the bundle format version and the bytes of every
+	/// product asset dependency. So the same key always maps to the same product, no matter which machine produced it.
+	/// Lookups go to the local cache first, then the optional shared cache (e.g. a network folder). All functions are thread-safe.
+	class EDITORCORE_API DerivedDataCache final
+	{
+	public:
+
+		static constexpr u32 Version = 1;
+
+		struct KeyInputs
+		{
+			AssetImporter* importer = nullptr;
+			u32 assetDefinitionVersion = 0;
+			PlatformName targetPlatform{};
+
+			IO::Path sourcePath{};
+			//! @brief Bundle path & relative source path are stored inside the product, so they are part of the key.
+			String bundlePath{};
+			String sourceAssetRelativePath{};
+
+			//! @brief Existing product that the import reads to preserve object uuids. Empty if there is none.
+			IO::Path existingProductPath{};
+
+			Array<IO::Path> dependencyPaths{};
+		};
+
+		struct Statistics
+		{
+			u32 hits = 0;
+			u32 misses = 0;
+			u32 stores = 0;
+			u64 bytesRead = 0;
+			u64 bytesWritten = 0;
+		};
+
+		DerivedDataCache() = default;
+
+		DerivedDataCache(const DerivedDataCache&) = delete;
+		DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+		//! @brief Enables the cache. sharedCacheDirectory is optional, and is both read from & written to.
+		void Initialize(const IO::Path& localCacheDirectory, const IO::Path& sharedCacheDirectory = {});
+
+		bool IsEnabled() const { return !localCacheDirectory.IsEmpty(); }
+
+		//! @brief Computes the cache key for an import. Returns an empty string if one of the inputs could not be read.
+		static String ComputeKey(const KeyInputs& inputs);
+
+		//! @brief Copies the cached product for key to productPath.
+		//! @return False on a miss.
+		bool Fetch(const String& key, const IO::Path& productPath);
+
+		//! @brief Stores a copy of productPath under key, in both the local and the shared cache.
+		bool Store(const String& key, const IO::Path& productPath);
+
+		Statistics GetStatistics() const;
+
+		void ResetStatistics();
+
+		//! @brief Returns the 128-bit hash of the file's contents as a hex string, or an empty string if it can't be read.
+		static String HashFile(const IO::Path& filePath);
+
+	private:
+
+		static IO::Path GetEntryPath(const IO::Path& cacheDirectory, const String& key);
+
+		static bool CopyFileAtomic(const IO::Path& from, const IO::Path& to, u64& outFileSize);
+
+		IO::Path localCacheDirectory{};
+		IO::Path sharedCacheDirectory{};
+
+		Atomic<u32> hits = 0;
+		Atomic<u32> misses = 0;
+		Atomic<u32> stores = 0;
+		Atomic<u64> bytesRead = 0;
+		Atomic<u64> bytesWritten = 0;
+	};
+
+} // namespace CE::Editor
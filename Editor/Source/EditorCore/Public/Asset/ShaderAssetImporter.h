@@ -2,6 +2,7 @@
 
 namespace CE::Editor
 {
+	struct StageCompileTask;
 
 	CLASS(Config = Editor)
 	class EDITORCORE_API ShaderAssetImporter : public AssetImporter
@@ -30,6 +31,14 @@ namespace CE::Editor
 
 		virtual bool ProcessAsset(const Ref<Bundle>& bundle) override;
 
+		//! @brief Returns every file the shader includes, directly or indirectly.
+		virtual Array<IO::Path> PrepareSourceDependencies() override;
+
+	private:
+
+		//! @brief Compiles every (pass, variant, stage) in its own child job, or inline if this job wasn't started through the job system.
+		void CompileStages(Array<StageCompileTask>& tasks);
+
 	};
     
 } // namespace CE::Editor
@@ -24,6 +24,9 @@ namespace CE::Editor
 		FIELD(Config)
 		u8 anisotropy = 0;
 
+		FIELD(Config)
+		bool generateMipMaps = true;
+
 		FIELD(Config)
 		bool importHdrAsCubemap = false;
 
@@ -71,6 +74,7 @@ namespace CE::Editor
 		Array<String> ignoreCompressionFolders; // Folders where image compression is not applied
 
 		u8 anisotropy = 0;
+		bool generateMipMaps = true;
 		bool importHdrAsCubemap = false;
 		bool convoluteCubemap = false;
 		u32 diffuseConvolutionResolution = 32;
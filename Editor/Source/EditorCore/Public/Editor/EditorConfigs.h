@@ -17,11 +17,22 @@ namespace CE::Editor
         //! @brief Returns the primary font size to use for the editor.
         f32 GetFontSize() const { return Math::Max(MinFontSize, fontSize); }
 
+        bool IsDerivedDataCacheEnabled() const { return useDerivedDataCache; }
+
+        //! @brief Directory shared between machines (e.g. a network folder) to fetch & store imported assets. Empty if not used.
+        const String& GetSharedDerivedDataCachePath() const { return sharedDerivedDataCachePath; }
+
     private:
 
         FIELD(Config)
         f32 fontSize = 10;
 
+        FIELD(Config)
+        bool useDerivedDataCache = true;
+
+        FIELD(Config)
+        String sharedDerivedDataCachePath = "";
+
     };
     
 } // namespace CE
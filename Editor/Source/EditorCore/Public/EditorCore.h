@@ -19,6 +19,7 @@
 #include "Asset/AssetDefinition.h"
 #include "Asset/AssetDefinitionRegistry.h"
 #include "Asset/AssetImporter.h"
+#include "Asset/DerivedDataCache.h"
 
 // Thumbnails
 #include "Asset/Thumbnail/ThumbnailSystem.h"
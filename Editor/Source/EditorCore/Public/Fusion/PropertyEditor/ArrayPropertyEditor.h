@@ -26,6 +26,10 @@ namespace CE::Editor
 
         void UpdateTarget(const Array<WeakRef<Object>>& targets, const String& relativeFieldPath) override;
 
+        void OnPostComputeLayout() override;
+
+        void OnExpand() override;
+
     public: // - Public API -
 
         void SetSplitRatio(f32 ratio, FSplitBox* excluding) override;
@@ -61,8 +65,67 @@ namespace CE::Editor
         bool hasElementTypeNameOverride = false;
         String elementNameOverride = {};
 
-        Array<Ptr<FieldType>> arrayElements;
-        Array<PropertyEditor*> elementEditors;
+        //! @brief Creates, recycles and binds element editors so that only the rows inside the visible scroll area exist.
+        //! @param rebindAll Re-read the values of rows that stay bound to the same element.
+        void UpdateVisibleRows(bool rebindAll);
+
+        //! @brief Runs UpdateVisibleRows() at the start of the next frame, so rows & spacers are never changed during layout.
+        void QueueVisibleRowsUpdate();
+
+        //! @brief Moves the rows, expansion states & heights of the elements after index up by one.
+        void OnElementDeleted(int index);
+
+        //! @brief Returns the part of the expansion stack that is visible in the enclosing scroll box, in the stack's coordinates.
+        bool GetVisibleRange(f32& outTop, f32& outBottom);
+
+        PropertyEditor* CreateElementEditor(const Ref<Object>& target, int elementIndex);
+
+        void BindElementRow(PropertyEditor* elementEditor, const Ref<Object>& target, int elementIndex, bool restoreExpansion);
+
+        void ReleaseElementRow(int rowIndex);
+
+        String GetElementName(const Ref<Object>& target, int elementIndex);
+
+        //! @brief Height used for rows that were never laid out.
+        static constexpr f32 DefaultRowHeight = 30.0f;
+
+        //! @brief Rows this far outside of the visible area are still created, so scrolling doesn't show empty space.
+        static constexpr f32 RowOverscan = 100.0f;
+
+        struct ElementRow
+        {
+            PropertyEditor* editor = nullptr;
+            //! @brief Index of the element bound to this row, or -1 if the row is free.
+            int elementIndex = -1;
+        };
+
+        //! @brief Pool of element editors. Only the rows of visible elements are bound & enabled.
+        Array<ElementRow> elementRows;
+
+        int arraySize = 0;
+        int firstVisibleElement = 0;
+        int visibleElementCount = 0;
+
+        //! @brief Height of every element row, measured when a row is laid out.
+        FenwickTree<f32> rowHeights;
+        f32 estimatedRowHeight = DefaultRowHeight;
+        bool rowHeightMeasured = false;
+        bool rowHeightsChanged = false;
+
+        //! @brief Visible range used by the last UpdateVisibleRows() call.
+        f32 lastVisibleTop = 0;
+        f32 lastVisibleBottom = 0;
+        bool visibleRowsUpdateQueued = false;
+
+        //! @brief Elements whose expansion state differs from defaultElementExpansion.
+        HashSet<int> elementExpansionOverrides;
+        bool defaultElementExpansion = false;
+
+        FWidget* topSpacer = nullptr;
+        FWidget* bottomSpacer = nullptr;
+
+        WeakRef<FScrollBox> scrollBox;
+        DelegateHandle scrollHandle = 0;
 
     public: // - Fusion Properties - 
 
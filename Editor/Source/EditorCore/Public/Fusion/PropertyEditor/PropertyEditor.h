@@ -102,8 +102,6 @@ namespace CE::Editor
         EditorField* editorField = nullptr;
         ObjectEditor* objectEditor = nullptr;
 
-        String cachedElementNameFormat = "Index {}";
-
         ShowCondition showCondition{};
 
         //FieldType* field = nullptr;
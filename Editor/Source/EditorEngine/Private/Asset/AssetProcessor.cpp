@@ -2,7 +2,95 @@
 
 namespace CE
 {
-    constexpr u32 StampFileVersion = 2;
+    constexpr u32 StampFileVersion = 3;
+
+    //! @brief Returns true if the asset whose stamp file this is has to be imported again: its source, one of its
+    //! source dependencies, the bundle format, its asset definition or its importer changed since it was stamped.
+    static bool IsStampOutdated(const IO::Path& stampFilePath, const DateTime& lastWriteTime, const String& extension)
+    {
+        FileStream reader = FileStream(stampFilePath, Stream::Permissions::ReadOnly);
+        reader.SetBinaryMode(true);
+
+        bool needsProcessing = false;
+
+        u32 version = 0;
+        reader >> version;
+
+        if (version != StampFileVersion)
+        {
+            needsProcessing = true;
+        }
+
+        u64 stampedTimeInt = 0;
+        reader >> stampedTimeInt;
+
+        DateTime stampedTime = DateTime::FromNumber(stampedTimeInt);
+        if (lastWriteTime != stampedTime)
+        {
+            needsProcessing = true;
+        }
+
+        if (version >= 1)
+        {
+            u32 major = 0, minor = 0, patch = 0;
+
+            reader >> major;
+            reader >> minor;
+            reader >> patch;
+
+            u32 assetDefinitionVersion = 0;
+            reader >> assetDefinitionVersion;
+
+            AssetDefinition* assetDefinition = GetAssetDefinitionRegistry()->FindAssetDefinition(extension);
+            if (assetDefinition && assetDefinition->GetAssetVersion() != assetDefinitionVersion)
+            {
+                needsProcessing = true;
+            }
+
+            if (major != Bundle::GetCurrentMajor() || minor != Bundle::GetCurrentMinor() || patch != Bundle::GetCurrentPatch())
+            {
+                needsProcessing = true;
+            }
+
+            if (version >= 2)
+            {
+                u32 assetImporterVersion = 0;
+                reader >> assetImporterVersion;
+
+                if (assetDefinition)
+                {
+                    AssetImporter* importerCDI = (AssetImporter*)assetDefinition->GetAssetImporterClass()->GetDefaultInstance();
+                    if (importerCDI != nullptr && importerCDI->GetImporterVersion() != assetImporterVersion)
+                    {
+                        needsProcessing = true;
+                    }
+                }
+            }
+
+            if (version >= 3)
+            {
+                // Files the asset was imported from besides its source, ex: headers included by a shader
+                u32 numSourceDependencies = 0;
+                reader >> numSourceDependencies;
+
+                for (u32 j = 0; j < numSourceDependencies && !needsProcessing; j++)
+                {
+                    String dependencyPath = "";
+                    u64 dependencyTimeInt = 0;
+                    reader >> dependencyPath;
+                    reader >> dependencyTimeInt;
+
+                    IO::Path dependency = dependencyPath;
+                    if (!dependency.Exists() || dependency.GetLastWriteTime() != DateTime::FromNumber(dependencyTimeInt))
+                    {
+                        needsProcessing = true;
+                    }
+                }
+            }
+        }
+
+        return needsProcessing;
+    }
 
     static WeakRef<AssetProcessor> instance = nullptr;
 
@@ -64,6 +152,13 @@ namespace CE
     	includePaths = {
         	EngineDirectories::GetEngineInstallDirectory() / "Engine/Shaders"
     	};
+
+    	const EditorConfigs* editorConfigs = GetDefaults<EditorConfigs>();
+    	if (editorConfigs->IsDerivedDataCacheEnabled())
+    	{
+    		derivedDataCache.Initialize(gProjectPath / "Temp/DerivedDataCache", editorConfigs->GetSharedDerivedDataCachePath());
+    		ShaderCache::Get().Initialize(gProjectPath / "Temp/DerivedDataCache/Shaders");
+    	}
     }
 
     void AssetProcessor::Shutdown()
@@ -78,6 +173,8 @@ namespace CE
     	totalScheduledJobs = 0;
     	totalFinishedJobs = 0;
     	totalSuccessfulJobs = 0;
+    	derivedDataCache.ResetStatistics();
+    	ShaderCache::Get().ResetStatistics();
 
         Array<IO::Path> allSourceAssetPaths{};
         Array<IO::Path> allProductAssetPaths{};
@@ -122,79 +219,11 @@ namespace CE
                 productPath = Bundle::GetAbsoluteBundlePath(productAssetData->bundlePath);
             }
 
-            if (!stampFilePath.Exists() || !productPath.Exists())
+            if (!stampFilePath.Exists() || !productPath.Exists() || IsStampOutdated(stampFilePath, lastWriteTime, extension))
             {
                 allSourceAssetPaths.Add(path);
                 allProductAssetPaths.Add(productPath);
             }
-            else
-            {
-                FileStream reader = FileStream(stampFilePath, Stream::Permissions::ReadOnly);
-                reader.SetBinaryMode(true);
-
-                bool needsProcessing = false;
-
-                u32 version = 0;
-                reader >> version;
-
-                if (version != StampFileVersion)
-                {
-                    needsProcessing = true;
-                }
-
-                u64 stampedTimeInt = 0;
-                reader >> stampedTimeInt;
-
-                DateTime stampedTime = DateTime::FromNumber(stampedTimeInt);
-                if (lastWriteTime != stampedTime)
-                {
-                    needsProcessing = true;
-                }
-
-                if (version >= 1)
-                {
-                    u32 major = 0, minor = 0, patch = 0;
-
-                    reader >> major;
-                    reader >> minor;
-                    reader >> patch;
-
-                    u32 assetDefinitionVersion = 0;
-                    reader >> assetDefinitionVersion;
-
-                    AssetDefinition* assetDefinition = GetAssetDefinitionRegistry()->FindAssetDefinition(extension);
-                    if (assetDefinition && assetDefinition->GetAssetVersion() != assetDefinitionVersion)
-                    {
-                        needsProcessing = true;
-                    }
-
-                    if (major != Bundle::GetCurrentMajor() || minor != Bundle::GetCurrentMinor() || patch != Bundle::GetCurrentPatch())
-                    {
-                        needsProcessing = true;
-                    }
-
-                    if (version >= 2)
-                    {
-                        u32 assetImporterVersion = 0;
-                        reader >> assetImporterVersion;
-
-                        if (assetDefinition)
-                        {
-                            AssetImporter* importerCDI = (AssetImporter*)assetDefinition->GetAssetImporterClass()->GetDefaultInstance();
-                            if (importerCDI != nullptr && importerCDI->GetImporterVersion() != assetImporterVersion)
-                            {
-                                needsProcessing = true;
-                            }
-                        }
-                    }
-                }
-
-                if (needsProcessing)
-                {
-                    allSourceAssetPaths.Add(path);
-                    allProductAssetPaths.Add(productPath);
-                }
-            }
         });
 
         AssetDefinitionRegistry* assetDefRegistry = GetAssetDefinitionRegistry();
@@ -274,6 +303,8 @@ namespace CE
 			assetImporter->SetLogging(true);
 			assetImporter->SetTargetPlatform(PlatformMisc::GetCurrentPlatform());
 			assetImporter->SetTempDirectoryPath(tempPath);
+			assetImporter->SetDerivedDataCache(&derivedDataCache);
+			assetImporter->SetAssetDefinitionVersion(assetDef->GetAssetVersion());
 
 			importers.Add(assetImporter);
 			assetDefinitions.Add(assetDef);
@@ -365,6 +396,8 @@ namespace CE
     	totalScheduledJobs = 0;
     	totalFinishedJobs = 0;
     	totalSuccessfulJobs = 0;
+    	derivedDataCache.ResetStatistics();
+    	ShaderCache::Get().ResetStatistics();
 
     	Array<IO::Path> allSourceAssetPaths{};
     	Array<IO::Path> allProductAssetPaths{};
@@ -409,79 +442,11 @@ namespace CE
                 productPath = Bundle::GetAbsoluteBundlePath(productAssetData->bundlePath);
             }
 
-            if (!stampFilePath.Exists() || !productPath.Exists())
+            if (!stampFilePath.Exists() || !productPath.Exists() || IsStampOutdated(stampFilePath, lastWriteTime, extension))
             {
                 allSourceAssetPaths.Add(path);
                 allProductAssetPaths.Add(productPath);
             }
-            else
-            {
-                FileStream reader = FileStream(stampFilePath, Stream::Permissions::ReadOnly);
-                reader.SetBinaryMode(true);
-
-                bool needsProcessing = false;
-
-                u32 version = 0;
-                reader >> version;
-
-                if (version != StampFileVersion)
-                {
-                    needsProcessing = true;
-                }
-
-                u64 stampedTimeInt = 0;
-                reader >> stampedTimeInt;
-
-                DateTime stampedTime = DateTime::FromNumber(stampedTimeInt);
-                if (lastWriteTime != stampedTime)
-                {
-                    needsProcessing = true;
-                }
-
-                if (version >= 1)
-                {
-                    u32 major = 0, minor = 0, patch = 0;
-
-                    reader >> major;
-                    reader >> minor;
-                    reader >> patch;
-
-                    u32 assetDefinitionVersion = 0;
-                    reader >> assetDefinitionVersion;
-
-                    AssetDefinition* assetDefinition = GetAssetDefinitionRegistry()->FindAssetDefinition(extension);
-                    if (assetDefinition && assetDefinition->GetAssetVersion() != assetDefinitionVersion)
-                    {
-                        needsProcessing = true;
-                    }
-
-                    if (major != Bundle::GetCurrentMajor() || minor != Bundle::GetCurrentMinor() || patch != Bundle::GetCurrentPatch())
-                    {
-                        needsProcessing = true;
-                    }
-
-                    if (version >= 2)
-                    {
-                        u32 assetImporterVersion = 0;
-                        reader >> assetImporterVersion;
-
-                        if (assetDefinition)
-                        {
-                            AssetImporter* importerCDI = (AssetImporter*)assetDefinition->GetAssetImporterClass()->GetDefaultInstance();
-                            if (importerCDI != nullptr && importerCDI->GetImporterVersion() != assetImporterVersion)
-                            {
-                                needsProcessing = true;
-                            }
-                        }
-                    }
-                }
-
-                if (needsProcessing)
-                {
-                    allSourceAssetPaths.Add(path);
-                    allProductAssetPaths.Add(productPath);
-                }
-            }
     	}
 
     	AssetDefinitionRegistry* assetDefRegistry = GetAssetDefinitionRegistry();
@@ -561,6 +526,8 @@ namespace CE
 			assetImporter->SetLogging(true);
 			assetImporter->SetTargetPlatform(PlatformMisc::GetCurrentPlatform());
 			assetImporter->SetTempDirectoryPath(tempPath);
+			assetImporter->SetDerivedDataCache(&derivedDataCache);
+			assetImporter->SetAssetDefinitionVersion(assetDef->GetAssetVersion());
 
 			importers.Add(assetImporter);
 			assetDefinitions.Add(assetDef);
@@ -699,7 +666,7 @@ namespace CE
     		{
     			for (int i = 0; i < assetImportResults.GetSize(); i++)
     			{
-    				const auto& [success, sourcePath, productPath, errorMessage] = assetImportResults[i];
+    				const auto& [success, sourcePath, productPath, errorMessage, sourceDependencies] = assetImportResults[i];
 
     				IO::Path relativePath = IO::Path::GetRelative(sourcePath, inputRoot);
     				IO::Path stampFilePath = tempPath / relativePath.ReplaceExtension(".stamp");
@@ -718,6 +685,13 @@ namespace CE
     					writer << assetDefinitionVersions[i];
 
     					writer << assetImporterVersions[i];
+
+    					writer << (u32)sourceDependencies.GetSize();
+    					for (const IO::Path& dependency : sourceDependencies)
+    					{
+    						writer << dependency.GetString();
+    						writer << dependency.GetLastWriteTime().ToNumber();
+    					}
     				}
     				else
     				{
@@ -726,6 +700,20 @@ namespace CE
     			}
     		}
 
+    		if (derivedDataCache.IsEnabled())
+    		{
+    			DerivedDataCache::Statistics statistics = derivedDataCache.GetStatistics();
+    			CE_LOG(Info, All, "Derived data cache: {} hits, {} misses, {} stored",
+    				statistics.hits, statistics.misses, statistics.stores);
+    		}
+
+    		if (ShaderCache::Get().IsEnabled())
+    		{
+    			ShaderCache::Statistics statistics = ShaderCache::Get().GetStatistics();
+    			CE_LOG(Info, All, "Shader cache: {} hits, {} misses, {} stored",
+    				statistics.hits, statistics.misses, statistics.stores);
+    		}
+
     		totalFinishedJobs = 0;
     		totalScheduledJobs = 0;
     		totalSuccessfulJobs = 0;
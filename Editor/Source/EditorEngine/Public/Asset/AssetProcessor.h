@@ -37,6 +37,8 @@ namespace CE
         int GetSuccessfulJobs() const { return totalSuccessfulJobs; }
         int GetImportQueueSize() const { return importQueue.GetSize(); }
 
+        DerivedDataCache& GetDerivedDataCache() { return derivedDataCache; }
+
         ScriptEvent<void(AssetProcessor*)> onProgressUpdate;
 
     protected:
@@ -53,6 +55,8 @@ namespace CE
 
         Array<IO::Path> includePaths;
 
+        DerivedDataCache derivedDataCache{};
+
         SharedMutex mainThreadDispatcherLock;
         Array<Delegate<void(void)>> mainThreadDispatcher;
 
@@ -24,6 +24,8 @@ void EditorLoop::PreInit(int argc, char** argv)
 
 	options.add_options()
 		("h,help", "Print this help info and exit")
+		("prewarm-types", "Build RTTI field caches of loaded modules on worker threads")
+		("async-log", "Format & write log messages on a dedicated log thread")
 		;
 
 	options.allow_unrecognised_options();
@@ -38,6 +40,9 @@ void EditorLoop::PreInit(int argc, char** argv)
 			exit(0);
 		}
 
+		ModuleManager::Get().SetPrewarmTypesInBackground(result["prewarm-types"].as<bool>());
+		asyncLog = result["async-log"].as<bool>();
+
 		auto positionalArgs = result.unmatched();
 
 		for (const auto& arg : positionalArgs)
@@ -73,6 +78,11 @@ void EditorLoop::PreInit(int argc, char** argv)
 	Logger::Initialize();
 	Logger::SetConsoleLogLevel(LogLevel::Trace);
 	Logger::SetFileDumpLogLevel(LogLevel::Trace);
+
+	if (asyncLog)
+	{
+		Logger::EnableAsync();
+	}
 }
 
 void EditorLoop::LoadStartupCoreModules()
@@ -165,6 +175,11 @@ void EditorLoop::PostInit()
 	LoadEngineModules();
 	LoadEditorModules();
 
+	ModuleManager::Get().LogModuleLoadTimings();
+
+	// Only once every startup module is loaded, so the type registries don't change while the job reads them
+	ModuleManager::Get().PrewarmLoadedModuleTypes();
+
 	EditorCoreModule* editorCore = static_cast<EditorCoreModule*>(ModuleManager::Get().GetLoadedModule("EditorCore"));
 
 	// Load Project
@@ -42,6 +42,7 @@ private:
 	PlatformWindow* mainWindow = nullptr;
 	PlatformWindow* splashWindow = nullptr;
 	bool showSplashScreen = true;
+	bool asyncLog = false;
 
 	IO::Path projectPath{};
 
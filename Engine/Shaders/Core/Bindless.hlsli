@@ -0,0 +1,17 @@
+#ifndef __BINDLESS_HLSL__
+#define __BINDLESS_HLSL__
+
+#include "Macros.hlsli"
+
+// Global bindless table (RHI::BindlessTable). Materials receive indices into these arrays through uint members of
+// their constant buffer, e.g. setting a texture as the value of "_AlbedoTexIndex" writes the texture's table index.
+
+Texture2D _BindlessTextures[] : SRG_Bindless(t0);
+ByteAddressBuffer _BindlessBuffers[] : SRG_Bindless(t1);
+
+#define BINDLESS_INVALID_INDEX 0xFFFFFFFF
+
+#define BINDLESS_TEXTURE(index) _BindlessTextures[NonUniformResourceIndex(index)]
+#define BINDLESS_BUFFER(index) _BindlessBuffers[NonUniformResourceIndex(index)]
+
+#endif // __BINDLESS_HLSL__
@@ -74,6 +74,11 @@
 #define PerDraw_Frequency 6
 #endif
 
+// Global bindless texture & buffer table, see Core/Bindless.hlsli
+#ifndef Bindless_Frequency
+#define Bindless_Frequency 7
+#endif
+
 #endif
 
 #define EXPAND(x) x
@@ -91,6 +96,7 @@
 #define SRG_PerMaterial(type) SRG(type, PerMaterial_Frequency)
 #define SRG_PerObject(type) SRG(type, PerObject_Frequency)
 #define SRG_PerDraw(type) SRG(type, PerDraw_Frequency)
+#define SRG_Bindless(type) SRG(type, Bindless_Frequency)
 
 #ifdef __spirv__ // Vulkan Shader
 
@@ -0,0 +1,45 @@
+#include "Algorithm/Compression.h"
+
+#include <miniz.h>
+
+namespace CE
+{
+
+	CORE_API SIZE_T GetCompressBound(SIZE_T srcSize)
+	{
+		return (SIZE_T)mz_compressBound((mz_ulong)srcSize);
+	}
+
+	CORE_API SIZE_T Compress(const void* src, SIZE_T srcSize, void* dst, SIZE_T dstCapacity, int level)
+	{
+		if (dst == nullptr || (src == nullptr && srcSize > 0))
+			return 0;
+
+		mz_ulong dstSize = (mz_ulong)dstCapacity;
+		if (mz_compress2((unsigned char*)dst, &dstSize, (const unsigned char*)src, (mz_ulong)srcSize, level) != MZ_OK)
+			return 0;
+
+		return (SIZE_T)dstSize;
+	}
+
+	CORE_API bool Decompress(const void* src, SIZE_T srcSize, void* dst, SIZE_T dstSize)
+	{
+		if (src == nullptr || srcSize == 0 || (dst == nullptr && dstSize > 0))
+			return false;
+
+		// miniz fails with MZ_BUF_ERROR when the data is longer than dstSize
+		mz_ulong outSize = (mz_ulong)dstSize;
+
+		if (dstSize == 0)
+		{
+			// Decompress into a scratch byte, so that miniz never gets an empty output buffer
+			u8 scratch = 0;
+			outSize = 1;
+			return mz_uncompress(&scratch, &outSize, (const unsigned char*)src, (mz_ulong)srcSize) == MZ_OK && outSize == 0;
+		}
+
+		return mz_uncompress((unsigned char*)dst, &outSize, (const unsigned char*)src, (mz_ulong)srcSize) == MZ_OK &&
+			outSize == dstSize;
+	}
+
+} // namespace CE
@@ -50,6 +50,8 @@ namespace CE
 
     void CoreModule::ShutdownModule()
     {
+        IO::AsyncIO::Get().Shutdown();
+
 		if (gResourceManager != nullptr)
 		{
 			gResourceManager->BeginDestroy();
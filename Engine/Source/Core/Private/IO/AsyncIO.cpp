@@ -0,0 +1,627 @@
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_LINUX
+#include "PAL/Linux/LinuxIoUring.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+
+namespace CE::IO
+{
+
+    // - AsyncReadRequest -
+
+    AsyncReadRequest::AsyncReadRequest(AsyncIO* owner, const AsyncReadArgs& args)
+        : path(args.path)
+        , offset(args.offset)
+        , size(args.size)
+        , priority(args.priority)
+        , destination(args.destination)
+        , onComplete(args.onComplete)
+        , owner(owner)
+    {
+
+    }
+
+    AsyncReadRequest::~AsyncReadRequest()
+    {
+        if (ownsBuffer && buffer != nullptr)
+        {
+            Memory::Free(buffer);
+        }
+        buffer = nullptr;
+    }
+
+    bool AsyncReadRequest::Wait() const
+    {
+        AsyncIOStatus curStatus = GetStatus();
+
+        while (curStatus == AsyncIOStatus::Pending || curStatus == AsyncIOStatus::InProgress)
+        {
+            status.wait(curStatus, std::memory_order_acquire);
+            curStatus = GetStatus();
+        }
+
+        return curStatus == AsyncIOStatus::Completed;
+    }
+
+    bool AsyncReadRequest::Cancel()
+    {
+        AsyncIOStatus expected = AsyncIOStatus::Pending;
+
+        // The request stays in its queue, and is skipped when an IO thread pops it
+        if (!status.compare_exchange_strong(expected, AsyncIOStatus::InProgress, std::memory_order_acq_rel))
+            return false;
+
+        owner->FinishRequest(this, AsyncIOStatus::Cancelled);
+        return true;
+    }
+
+    bool AsyncReadRequest::PrepareBuffer(u64 fileSize)
+    {
+        if (offset > fileSize)
+            return false;
+
+        const u64 readableSize = fileSize - offset;
+        size = (size == 0) ? readableSize : Math::Min(size, readableSize);
+        bytesRead = 0;
+
+        // A request can be prepared again when its read is retried, see AsyncIO::IoUringLoop()
+        if (ownsBuffer && buffer != nullptr)
+        {
+            Memory::Free(buffer);
+            buffer = nullptr;
+        }
+
+        if (destination != nullptr)
+        {
+            buffer = (u8*)destination;
+            ownsBuffer = false;
+        }
+        else
+        {
+            buffer = (u8*)Memory::Malloc(Math::Max<u64>(size, 1));
+            ownsBuffer = true;
+        }
+
+        return buffer != nullptr;
+    }
+
+    // - AsyncIO -
+
+    AsyncIO& AsyncIO::Get()
+    {
+        static AsyncIO instance{};
+        return instance;
+    }
+
+    AsyncIO::AsyncIO()
+    {
+
+    }
+
+    AsyncIO::~AsyncIO()
+    {
+        Shutdown();
+    }
+
+    void AsyncIO::Initialize(u32 numThreads, bool allowIoUring)
+    {
+        LockGuard lifecycleLock{ lifecycleMutex };
+
+        if (isRunning.load(std::memory_order_acquire))
+            return;
+
+        isRunning.store(true, std::memory_order_release);
+
+#if PLATFORM_LINUX
+        if (allowIoUring)
+        {
+            ioUring = new LinuxIoUring();
+
+            if (ioUring->Initialize(IoUringQueueDepth))
+            {
+                // A single thread keeps the ring full, so there is no need for a thread pool
+                threads.Add(new Thread([this] { IoUringLoop(); }));
+                return;
+            }
+
+            CE_LOG(Info, All, "AsyncIO: io_uring is not available. Falling back to a thread pool.");
+            delete ioUring;
+            ioUring = nullptr;
+        }
+#endif
+
+        if (numThreads == 0)
+        {
+            // Reads spend most of their time waiting on the disk, so a few threads are enough to keep it busy
+            numThreads = Math::Clamp<u32>(Thread::GetHardwareConcurrency() / 2, 2, 8);
+        }
+
+        for (u32 i = 0; i < numThreads; i++)
+        {
+            threads.Add(new Thread([this] { ThreadPoolLoop(); }));
+        }
+    }
+
+    void AsyncIO::Shutdown()
+    {
+        LockGuard lifecycleLock{ lifecycleMutex };
+
+        if (!isRunning.load(std::memory_order_acquire))
+            return;
+
+        {
+            LockGuard lock{ queueMutex };
+            isRunning.store(false, std::memory_order_release);
+        }
+        queueCondition.notify_all();
+
+        for (Thread* thread : threads)
+        {
+            thread->Join();
+            delete thread;
+        }
+        threads.Clear();
+
+#if PLATFORM_LINUX
+        delete ioUring;
+        ioUring = nullptr;
+#endif
+
+        // Cancel the requests that were never picked up
+        Array<Ptr<AsyncReadRequest>> pendingRequests{};
+        {
+            LockGuard lock{ queueMutex };
+
+            for (auto& queue : queues)
+            {
+                for (const Ptr<AsyncReadRequest>& request : queue)
+                {
+                    pendingRequests.Add(request);
+                }
+                queue.clear();
+            }
+        }
+
+        for (const Ptr<AsyncReadRequest>& request : pendingRequests)
+        {
+            request->Cancel();
+        }
+    }
+
+    Ptr<AsyncReadRequest> AsyncIO::Read(const AsyncReadArgs& args)
+    {
+        ASSERT(args.destination == nullptr || args.size > 0, "AsyncIO::Read() called with a destination buffer, but no size!");
+
+        if (!IsInitialized())
+        {
+            Initialize();
+        }
+
+        Ptr<AsyncReadRequest> request = new AsyncReadRequest(this, args);
+        bool queued = false;
+
+        {
+            LockGuard lock{ queueMutex };
+
+            if (isRunning.load(std::memory_order_acquire))
+            {
+                queues[(int)args.priority].push_back(request);
+                queued = true;
+            }
+        }
+
+        if (!queued) // Shut down in the mean time
+        {
+            request->Cancel();
+            return request;
+        }
+
+        queueCondition.notify_one();
+        return request;
+    }
+
+    Array<Ptr<AsyncReadRequest>> AsyncIO::ReadBatch(const Array<AsyncReadArgs>& batch)
+    {
+        Array<Ptr<AsyncReadRequest>> requests{};
+        if (batch.IsEmpty())
+            return requests;
+
+        if (!IsInitialized())
+        {
+            Initialize();
+        }
+
+        requests.Reserve(batch.GetSize());
+        bool queued = false;
+
+        for (const AsyncReadArgs& args : batch)
+        {
+            ASSERT(args.destination == nullptr || args.size > 0, "AsyncIO::ReadBatch() called with a destination buffer, but no size!");
+
+            requests.Add(new AsyncReadRequest(this, args));
+        }
+
+        {
+            LockGuard lock{ queueMutex };
+
+            if (isRunning.load(std::memory_order_acquire))
+            {
+                for (const Ptr<AsyncReadRequest>& request : requests)
+                {
+                    queues[(int)request->priority].push_back(request);
+                }
+                queued = true;
+            }
+        }
+
+        if (!queued)
+        {
+            for (const Ptr<AsyncReadRequest>& request : requests)
+            {
+                request->Cancel();
+            }
+            return requests;
+        }
+
+        queueCondition.notify_all();
+        return requests;
+    }
+
+    bool AsyncIO::ReadFile(const IO::Path& path, Array<u8>& outData, AsyncIOPriority priority)
+    {
+        ZoneScoped;
+
+        std::error_code error{};
+        const u64 fileSize = fs::file_size((fs::path)path, error);
+        if (error)
+            return false;
+
+        outData.Resize(fileSize);
+
+        if (fileSize == 0)
+            return true;
+
+        // Read straight into the output array
+        AsyncReadArgs args{};
+        args.path = path;
+        args.size = fileSize;
+        args.priority = priority;
+        args.destination = outData.GetData();
+
+        Ptr<AsyncReadRequest> request = Get().Read(args);
+
+        if (!request->Wait())
+            return false;
+
+        // The file might have been truncated after we checked its size
+        outData.Resize(request->GetSize());
+        return true;
+    }
+
+    AsyncIO::Statistics AsyncIO::GetStatistics() const
+    {
+        Statistics statistics{};
+        statistics.requestsCompleted = requestsCompleted;
+        statistics.requestsFailed = requestsFailed;
+        statistics.requestsCancelled = requestsCancelled;
+        statistics.bytesRead = bytesRead;
+        return statistics;
+    }
+
+    void AsyncIO::ResetStatistics()
+    {
+        requestsCompleted = 0;
+        requestsFailed = 0;
+        requestsCancelled = 0;
+        bytesRead = 0;
+    }
+
+    Ptr<AsyncReadRequest> AsyncIO::PopRequest(bool wait)
+    {
+        LockGuard lock{ queueMutex };
+
+        while (isRunning.load(std::memory_order_acquire))
+        {
+            for (int i = (int)AsyncIOPriority::COUNT - 1; i >= 0; i--)
+            {
+                auto& queue = queues[i];
+
+                while (!queue.empty())
+                {
+                    Ptr<AsyncReadRequest> request = queue.front();
+                    queue.pop_front();
+
+                    AsyncIOStatus expected = AsyncIOStatus::Pending;
+                    if (request->status.compare_exchange_strong(expected, AsyncIOStatus::InProgress, std::memory_order_acq_rel))
+                    {
+                        return request;
+                    }
+                }
+            }
+
+            if (!wait)
+                break;
+
+            queueCondition.wait(queueMutex);
+        }
+
+        return nullptr;
+    }
+
+    void AsyncIO::FinishRequest(AsyncReadRequest* request, AsyncIOStatus finalStatus)
+    {
+        switch (finalStatus)
+        {
+        case AsyncIOStatus::Completed:
+            requestsCompleted++;
+            bytesRead += request->bytesRead;
+            break;
+        case AsyncIOStatus::Failed:
+            requestsFailed++;
+            break;
+        case AsyncIOStatus::Cancelled:
+            requestsCancelled++;
+            break;
+        default:
+            break;
+        }
+
+        request->status.store(finalStatus, std::memory_order_release);
+        request->status.notify_all();
+
+        request->onComplete.InvokeIfValid(request);
+    }
+
+    void AsyncIO::ThreadPoolLoop()
+    {
+        while (true)
+        {
+            Ptr<AsyncReadRequest> request = PopRequest(true);
+            if (request == nullptr) // Shut down
+                break;
+
+            ReadBlocking(request.Get());
+        }
+    }
+
+    void AsyncIO::ReadBlocking(AsyncReadRequest* request)
+    {
+        ZoneScoped;
+
+        std::error_code error{};
+        const u64 fileSize = fs::file_size((fs::path)request->path, error);
+
+        if (error || !request->PrepareBuffer(fileSize))
+        {
+            FinishRequest(request, AsyncIOStatus::Failed);
+            return;
+        }
+
+        if (request->size > 0)
+        {
+            std::ifstream file{ (fs::path)request->path, std::ios::binary };
+            if (!file.is_open())
+            {
+                FinishRequest(request, AsyncIOStatus::Failed);
+                return;
+            }
+
+            file.seekg((std::streamoff)request->offset);
+            file.read((char*)request->buffer, (std::streamsize)request->size);
+            request->bytesRead = (u64)file.gcount();
+
+            if (request->bytesRead != request->size)
+            {
+                FinishRequest(request, AsyncIOStatus::Failed);
+                return;
+            }
+        }
+
+        FinishRequest(request, AsyncIOStatus::Completed);
+    }
+
+#if PLATFORM_LINUX
+
+    void AsyncIO::IoUringLoop()
+    {
+        struct InFlightRead
+        {
+            Ptr<AsyncReadRequest> request = nullptr;
+            int fd = -1;
+        };
+
+        // The length of a single read is 32 bits
+        constexpr u64 MaxReadLength = 1 << 30;
+
+        // User data of cancel requests. Reads use their slot index.
+        constexpr u64 CancelUserData = NumericLimits<u64>::Max();
+
+        Array<InFlightRead> slots{};
+        slots.Resize(IoUringQueueDepth);
+
+        Array<u32> freeSlots{};
+        for (int i = (int)IoUringQueueDepth - 1; i >= 0; i--)
+        {
+            freeSlots.Add((u32)i);
+        }
+
+        auto queueRead = [&](u32 slotIndex) -> bool
+            {
+                AsyncReadRequest* request = slots[slotIndex].request.Get();
+                const u64 remaining = request->size - request->bytesRead;
+
+                return ioUring->QueueRead(slots[slotIndex].fd, request->buffer + request->bytesRead,
+                    (u32)Math::Min(remaining, MaxReadLength), request->offset + request->bytesRead, slotIndex);
+            };
+
+        auto releaseSlot = [&](u32 slotIndex) -> Ptr<AsyncReadRequest>
+            {
+                InFlightRead& slot = slots[slotIndex];
+                close(slot.fd);
+
+                Ptr<AsyncReadRequest> request = slot.request;
+                slot.request = nullptr;
+                slot.fd = -1;
+                freeSlots.Add(slotIndex);
+                return request;
+            };
+
+        auto finishSlot = [&](u32 slotIndex, AsyncIOStatus finalStatus)
+            {
+                Ptr<AsyncReadRequest> request = releaseSlot(slotIndex);
+                FinishRequest(request.Get(), finalStatus);
+            };
+
+        // Submitted reads write into their buffers until the kernel completes them, even if the ring fails.
+        // So their slots are only released once their completion is reaped, after asking the kernel to cancel them.
+        auto cancelInFlightReads = [&](Array<Ptr<AsyncReadRequest>>& outCancelledRequests)
+            {
+                for (u32 slotIndex = 0; slotIndex < IoUringQueueDepth; slotIndex++)
+                {
+                    if (slots[slotIndex].request != nullptr)
+                    {
+                        // If the queue is full, the read is simply waited for
+                        ioUring->QueueCancel(slotIndex, CancelUserData);
+                    }
+                }
+
+                while (freeSlots.GetSize() < IoUringQueueDepth)
+                {
+                    const int submitResult = ioUring->Submit(1);
+                    if (submitResult < 0 && submitResult != -EAGAIN && submitResult != -EBUSY)
+                    {
+                        // The ring can't wait anymore, but the kernel still posts completions to it
+                        Thread::SleepFor(1);
+                    }
+
+                    u64 userData = 0;
+                    s32 result = 0;
+
+                    while (ioUring->PopCompletion(userData, result))
+                    {
+                        if (userData == CancelUserData || slots[(u32)userData].request == nullptr)
+                            continue;
+
+                        outCancelledRequests.Add(releaseSlot((u32)userData));
+                    }
+                }
+            };
+
+        while (true)
+        {
+            const bool isIdle = freeSlots.GetSize() == IoUringQueueDepth;
+
+            // 1. Fill the ring with new requests, in priority order. Only block for new requests if nothing is in flight.
+            while (!freeSlots.IsEmpty())
+            {
+                const bool wait = isIdle && freeSlots.GetSize() == IoUringQueueDepth;
+
+                Ptr<AsyncReadRequest> request = PopRequest(wait);
+                if (request == nullptr)
+                    break;
+
+                int fd = open(request->path.GetString().GetCString(), O_RDONLY | O_CLOEXEC);
+                struct stat fileStat{};
+
+                if (fd < 0 || fstat(fd, &fileStat) != 0 || !request->PrepareBuffer((u64)fileStat.st_size))
+                {
+                    if (fd >= 0)
+                        close(fd);
+                    FinishRequest(request.Get(), AsyncIOStatus::Failed);
+                    continue;
+                }
+
+                if (request->size == 0)
+                {
+                    close(fd);
+                    FinishRequest(request.Get(), AsyncIOStatus::Completed);
+                    continue;
+                }
+
+                const u32 slotIndex = freeSlots.Top();
+                freeSlots.Pop();
+
+                slots[slotIndex].request = request;
+                slots[slotIndex].fd = fd;
+
+                if (!queueRead(slotIndex))
+                {
+                    finishSlot(slotIndex, AsyncIOStatus::Failed);
+                }
+            }
+
+            if (freeSlots.GetSize() == IoUringQueueDepth)
+            {
+                if (!isRunning.load(std::memory_order_acquire))
+                    break;
+                continue;
+            }
+
+            // 2. Submit everything that was queued in one syscall, and wait for at least one read to complete
+            const int submitResult = ioUring->Submit(1);
+            if (submitResult < 0 && submitResult != -EAGAIN && submitResult != -EBUSY)
+            {
+                CE_LOG(Error, All, "AsyncIO: io_uring_enter failed with error {}. Falling back to blocking reads.", -submitResult);
+
+                Array<Ptr<AsyncReadRequest>> cancelledRequests{};
+                cancelInFlightReads(cancelledRequests);
+
+                ioUring->Shutdown();
+
+                // Restart the interrupted reads, then keep serving requests from this thread with blocking reads
+                for (const Ptr<AsyncReadRequest>& request : cancelledRequests)
+                {
+                    ReadBlocking(request.Get());
+                }
+
+                ThreadPoolLoop();
+                return;
+            }
+
+            // 3. Reap the completed reads
+            u64 userData = 0;
+            s32 result = 0;
+
+            while (ioUring->PopCompletion(userData, result))
+            {
+                const u32 slotIndex = (u32)userData;
+                AsyncReadRequest* request = slots[slotIndex].request.Get();
+
+                if (result == -EAGAIN || result == -EINTR)
+                {
+                    if (!queueRead(slotIndex))
+                        finishSlot(slotIndex, AsyncIOStatus::Failed);
+                    continue;
+                }
+
+                if (result <= 0) // Error, or the file was truncated while reading it
+                {
+                    finishSlot(slotIndex, AsyncIOStatus::Failed);
+                    continue;
+                }
+
+                request->bytesRead += (u64)result;
+
+                if (request->bytesRead < request->size)
+                {
+                    // Short read: queue the rest
+                    if (!queueRead(slotIndex))
+                        finishSlot(slotIndex, AsyncIOStatus::Failed);
+                    continue;
+                }
+
+                finishSlot(slotIndex, AsyncIOStatus::Completed);
+            }
+        }
+    }
+
+#endif
+
+} // namespace CE::IO
@@ -338,6 +338,8 @@ namespace CE
 
     bool JsonSerializer::Deserialize2(Stream* stream, JValue& out)
     {
+		ZoneScoped;
+
 		if (stream == nullptr)
 		{
 			CE_LOG(Error, All, "JSON Deserialize: Input stream is null");
@@ -352,6 +354,27 @@ namespace CE
 
 		out = nullptr;
 
+		const u64 startPosition = stream->GetCurrentPosition();
+
+		JsonDocument document{};
+		if (document.Parse(stream) && document.GetRoot().IsContainerType())
+		{
+			document.GetRoot().ToJValue(out);
+			return true;
+		}
+
+		// Documents with comments or non-standard syntax go through the streaming reader
+		stream->Seek((s64)startPosition, SeekMode::Begin);
+
+		return DeserializeWithReader(stream, out);
+	}
+
+	bool JsonSerializer::DeserializeWithReader(Stream* stream, JValue& out)
+	{
+		ZoneScoped;
+
+		out = nullptr;
+
 		auto reader = JsonReader::Create(stream);
 		JsonReadInstruction instruction = JsonReadInstruction::None;
 
@@ -0,0 +1,697 @@
+#include "CoreMinimal.h"
+
+namespace CE
+{
+    namespace
+    {
+        FORCE_INLINE bool IsJsonDelimiter(char c)
+        {
+            switch (c)
+            {
+            case ' ': case '\n': case '\t': case '\r':
+            case ',': case ':': case '[': case ']': case '{': case '}': case '"':
+                return true;
+            }
+            return false;
+        }
+
+        FORCE_INLINE int HexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            return -1;
+        }
+
+        bool ParseHex4(const char* src, const char* end, u32& outValue)
+        {
+            if (end - src < 4)
+                return false;
+
+            outValue = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                int value = HexValue(src[i]);
+                if (value < 0)
+                    return false;
+                outValue = (outValue << 4) | (u32)value;
+            }
+            return true;
+        }
+
+        u32 EncodeUtf8(u32 codePoint, char* dst)
+        {
+            if (codePoint < 0x80)
+            {
+                dst[0] = (char)codePoint;
+                return 1;
+            }
+            if (codePoint < 0x800)
+            {
+                dst[0] = (char)(0xC0 | (codePoint >> 6));
+                dst[1] = (char)(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+            if (codePoint < 0x10000)
+            {
+                dst[0] = (char)(0xE0 | (codePoint >> 12));
+                dst[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+                dst[2] = (char)(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+            dst[0] = (char)(0xF0 | (codePoint >> 18));
+            dst[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+            dst[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+            dst[3] = (char)(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+
+        //! @brief Unescapes a json string into dst. The output is never longer than the input.
+        u32 UnescapeString(const char* src, u32 length, char* dst)
+        {
+            const char* end = src + length;
+            char* out = dst;
+
+            while (src < end)
+            {
+                const char* backslash = (const char*)memchr(src, '\\', end - src);
+                if (backslash == nullptr)
+                {
+                    memcpy(out, src, end - src);
+                    out += end - src;
+                    break;
+                }
+
+                memcpy(out, src, backslash - src);
+                out += backslash - src;
+                src = backslash + 1;
+
+                if (src >= end)
+                    break;
+
+                const char c = *src++;
+
+                switch (c)
+                {
+                case 'n': *out++ = '\n'; break;
+                case 't': *out++ = '\t'; break;
+                case 'r': *out++ = '\r'; break;
+                case 'b': *out++ = '\b'; break;
+                case 'f': *out++ = '\f'; break;
+                case 'u':
+                {
+                    u32 codePoint = 0;
+                    if (!ParseHex4(src, end, codePoint))
+                    {
+                        *out++ = c;
+                        break;
+                    }
+                    src += 4;
+
+                    // Surrogate pair
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF && end - src >= 6 && src[0] == '\\' && src[1] == 'u')
+                    {
+                        u32 low = 0;
+                        if (ParseHex4(src + 2, end, low) && low >= 0xDC00 && low <= 0xDFFF)
+                        {
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                            src += 6;
+                        }
+                    }
+
+                    out += EncodeUtf8(codePoint, out);
+                    break;
+                }
+                default: // \" \\ \/ and unknown escapes
+                    *out++ = c;
+                    break;
+                }
+            }
+
+            *out = 0;
+            return (u32)(out - dst);
+        }
+    }
+
+    const JsonMember& JsonNode::GetMember(u32 index) const
+    {
+        return members[index];
+    }
+
+    const JsonNode* JsonNode::Find(const char* key, u32 length) const
+    {
+        if (!IsObjectValue())
+            return nullptr;
+
+        for (u32 i = 0; i < size; i++)
+        {
+            const JsonKey* memberKey = members[i].key;
+            if (memberKey->length == length && memcmp(memberKey->data, key, length) == 0)
+            {
+                return &members[i].value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JsonNode::ToJValue(JValue& out) const
+    {
+        switch (type)
+        {
+        case JsonValueType::Boolean:
+            out = JValue(boolean);
+            break;
+        case JsonValueType::Number:
+            out = JValue(number);
+            break;
+        case JsonValueType::String:
+            out = JValue(String(StringView(string, size)));
+            break;
+        case JsonValueType::Array:
+        {
+            out = JValue(JArray());
+            JArray& array = out.GetArrayValue();
+            array.Resize(size);
+
+            for (u32 i = 0; i < size; i++)
+            {
+                elements[i].ToJValue(array[i]);
+            }
+            break;
+        }
+        case JsonValueType::Object:
+        {
+            out = JValue(JObject());
+            JObject& object = out.GetObjectValue();
+
+            for (u32 i = 0; i < size; i++)
+            {
+                const SIZE_T prevSize = object.GetSize();
+                JValue& value = object[members[i].key->ToString()];
+
+                // First entry wins on duplicate keys, same as JsonSerializer::Deserialize2
+                if (object.GetSize() != prevSize)
+                {
+                    members[i].value.ToJValue(value);
+                }
+            }
+            break;
+        }
+        default:
+            out = JValue();
+            break;
+        }
+    }
+
+    JsonDocument::JsonDocument()
+    {
+
+    }
+
+    JsonDocument::~JsonDocument()
+    {
+        Clear();
+    }
+
+    void JsonDocument::Clear()
+    {
+        root = JsonNode();
+        arena.FreeAll();
+
+        keyTable.Clear();
+        keyCount = 0;
+        structurals.Clear();
+        elementStack.Clear();
+        memberStack.Clear();
+
+        parsedLength = 0;
+        parseError = JsonParseError::None;
+        errorMessage = "";
+    }
+
+    bool JsonDocument::Parse(Stream* stream)
+    {
+        if (stream == nullptr || !stream->CanRead())
+        {
+            return SetError(JsonParseError::OutOfBounds, "Input stream is null or cannot be read");
+        }
+
+        const u64 start = stream->GetCurrentPosition();
+        const u64 length = stream->GetLength() > start ? stream->GetLength() - start : 0;
+
+        if (const char* rawData = (const char*)stream->GetRawDataPtr())
+        {
+            // Memory streams can be parsed in place
+            bool success = Parse(rawData + start, length);
+            stream->Seek((s64)(start + parsedLength), SeekMode::Begin);
+            return success;
+        }
+
+        // Strings are copied into the arena, so the buffer is not needed after parsing
+        Array<char> buffer{};
+        buffer.Resize((u32)length);
+
+        s64 bytesRead = length > 0 ? stream->Read(buffer.GetData(), length) : 0;
+        if (bytesRead < 0)
+        {
+            return SetError(JsonParseError::OutOfBounds, "Failed to read input stream");
+        }
+
+        return Parse(buffer.GetData(), (SIZE_T)bytesRead);
+    }
+
+    bool JsonDocument::Parse(const char* json, SIZE_T length)
+    {
+        ZoneScoped;
+
+        Clear();
+
+        // Null terminated buffers are common, ignore the terminators
+        while (length > 0 && json[length - 1] == 0)
+        {
+            length--;
+        }
+
+        input = json;
+        inputLength = length;
+        cursor = 0;
+
+        defer(&)
+        {
+            input = nullptr;
+            inputLength = 0;
+        };
+
+        parseError = JsonStructuralIndexer::Build(json, length, structurals);
+        if (parseError == JsonParseError::CommentNotSupported)
+        {
+            errorMessage = "Comments are not supported";
+            return false;
+        }
+        if (parseError != JsonParseError::None)
+        {
+            errorMessage = "Failed to build structural index";
+            return false;
+        }
+
+        if (structurals.IsEmpty())
+        {
+            return SetError(JsonParseError::OutOfBounds, "Input is empty");
+        }
+
+        if (!ParseValue(root, 0))
+        {
+            root = JsonNode();
+            return false;
+        }
+
+        if (cursor != structurals.GetSize())
+        {
+            root = JsonNode();
+            return SetError(JsonParseError::UnexpectedToken, "Unexpected data after root value");
+        }
+
+        // The last structural is the closing bracket or quote of the root, or the start of a root scalar
+        parsedLength = (SIZE_T)structurals.GetLast() + 1;
+        if (!root.IsContainerType() && !root.IsStringValue())
+        {
+            while (parsedLength < length && !IsJsonDelimiter(json[parsedLength]))
+            {
+                parsedLength++;
+            }
+        }
+
+        return true;
+    }
+
+    bool JsonDocument::SetError(JsonParseError error, const String& message)
+    {
+        parseError = error;
+        errorMessage = message;
+        return false;
+    }
+
+    char JsonDocument::PeekStructural() const
+    {
+        if (cursor >= structurals.GetSize())
+            return 0;
+        return input[structurals[cursor]];
+    }
+
+    bool JsonDocument::ParseValue(JsonNode& out, int depth)
+    {
+        if (cursor >= structurals.GetSize())
+        {
+            return SetError(JsonParseError::OutOfBounds, "Unexpected end of input");
+        }
+
+        const u32 position = structurals[cursor++];
+
+        switch (input[position])
+        {
+        case '{':
+            return ParseObject(out, depth + 1);
+        case '[':
+            return ParseArray(out, depth + 1);
+        case '"':
+        {
+            const char* begin = nullptr;
+            u32 length = 0;
+            bool hasEscapes = false;
+
+            if (!ParseStringToken(position, begin, length, hasEscapes))
+                return false;
+
+            out.type = JsonValueType::String;
+
+            if (!hasEscapes)
+            {
+                out.string = arena.CopyString(begin, length);
+                out.size = length;
+            }
+            else
+            {
+                char* dst = (char*)arena.Allocate(length + 1, 1);
+                out.size = UnescapeString(begin, length, dst);
+                out.string = dst;
+            }
+            return true;
+        }
+        case ',': case ':': case ']': case '}':
+            return SetError(JsonParseError::UnexpectedToken, String::Format("Unexpected character '{}' at {}", input[position], position));
+        default:
+            return ParseScalar(position, out);
+        }
+    }
+
+    bool JsonDocument::ParseObject(JsonNode& out, int depth)
+    {
+        if (depth > MaxDepth)
+        {
+            return SetError(JsonParseError::DepthLimitExceeded, "Maximum nesting depth exceeded");
+        }
+
+        const u32 memberStart = (u32)memberStack.GetSize();
+
+        if (PeekStructural() == '}')
+        {
+            cursor++;
+        }
+        else
+        {
+            while (true)
+            {
+                if (cursor >= structurals.GetSize())
+                {
+                    return SetError(JsonParseError::InvalidObject, "Object is not closed");
+                }
+
+                const u32 position = structurals[cursor++];
+                if (input[position] != '"')
+                {
+                    return SetError(JsonParseError::InvalidObject, String::Format("Identifier not found in object at {}", position));
+                }
+
+                const char* begin = nullptr;
+                u32 length = 0;
+                bool hasEscapes = false;
+
+                if (!ParseStringToken(position, begin, length, hasEscapes))
+                    return false;
+
+                if (hasEscapes)
+                {
+                    scratch.Resize(length + 1);
+                    length = UnescapeString(begin, length, scratch.GetData());
+                    begin = scratch.GetData();
+                }
+
+                JsonMember member{};
+                member.key = InternKey(begin, length);
+
+                if (PeekStructural() != ':')
+                {
+                    return SetError(JsonParseError::InvalidObject, "Identifier not followed by a colon: " + member.key->ToString());
+                }
+                cursor++;
+
+                if (!ParseValue(member.value, depth))
+                    return false;
+
+                memberStack.Add(member);
+
+                const char next = PeekStructural();
+                cursor++;
+
+                if (next == '}')
+                    break;
+                if (next != ',')
+                {
+                    return SetError(JsonParseError::InvalidObject, "Expected ',' or '}' after entry: " + member.key->ToString());
+                }
+
+                // Allow trailing commas
+                if (PeekStructural() == '}')
+                {
+                    cursor++;
+                    break;
+                }
+            }
+        }
+
+        const u32 count = (u32)memberStack.GetSize() - memberStart;
+
+        out.type = JsonValueType::Object;
+        out.size = count;
+        out.members = arena.AllocateArray<JsonMember>(count);
+
+        if (count > 0)
+        {
+            memcpy((void*)out.members, memberStack.GetData() + memberStart, sizeof(JsonMember) * count);
+        }
+
+        memberStack.Resize(memberStart);
+        return true;
+    }
+
+    bool JsonDocument::ParseArray(JsonNode& out, int depth)
+    {
+        if (depth > MaxDepth)
+        {
+            return SetError(JsonParseError::DepthLimitExceeded, "Maximum nesting depth exceeded");
+        }
+
+        const u32 elementStart = (u32)elementStack.GetSize();
+
+        if (PeekStructural() == ']')
+        {
+            cursor++;
+        }
+        else
+        {
+            while (true)
+            {
+                JsonNode element{};
+                if (!ParseValue(element, depth))
+                    return false;
+
+                elementStack.Add(element);
+
+                const char next = PeekStructural();
+                cursor++;
+
+                if (next == ']')
+                    break;
+                if (next != ',')
+                {
+                    return SetError(JsonParseError::InvalidArray, "Expected ',' or ']' after array element");
+                }
+
+                // Allow trailing commas
+                if (PeekStructural() == ']')
+                {
+                    cursor++;
+                    break;
+                }
+            }
+        }
+
+        const u32 count = (u32)elementStack.GetSize() - elementStart;
+
+        out.type = JsonValueType::Array;
+        out.size = count;
+        out.elements = arena.AllocateArray<JsonNode>(count);
+
+        if (count > 0)
+        {
+            memcpy((void*)out.elements, elementStack.GetData() + elementStart, sizeof(JsonNode) * count);
+        }
+
+        elementStack.Resize(elementStart);
+        return true;
+    }
+
+    bool JsonDocument::ParseStringToken(u32 position, const char*& outBegin, u32& outLength, bool& outHasEscapes)
+    {
+        // Stage 1 records both the opening and the closing quote
+        if (cursor >= structurals.GetSize() || input[structurals[cursor]] != '"')
+        {
+            return SetError(JsonParseError::InvalidString, "Could not find end of string");
+        }
+
+        const u32 end = structurals[cursor++];
+
+        outBegin = input + position + 1;
+        outLength = end - position - 1;
+        outHasEscapes = outLength > 0 && memchr(outBegin, '\\', outLength) != nullptr;
+        return true;
+    }
+
+    bool JsonDocument::ParseScalar(u32 position, JsonNode& out)
+    {
+        const char* begin = input + position;
+        u32 length = 0;
+        while (position + length < inputLength && !IsJsonDelimiter(begin[length]))
+        {
+            length++;
+        }
+
+        switch (begin[0])
+        {
+        case 't':
+            if (length == 4 && memcmp(begin, "true", 4) == 0)
+            {
+                out.type = JsonValueType::Boolean;
+                out.boolean = true;
+                return true;
+            }
+            break;
+        case 'f':
+            if (length == 5 && memcmp(begin, "false", 5) == 0)
+            {
+                out.type = JsonValueType::Boolean;
+                out.boolean = false;
+                return true;
+            }
+            break;
+        case 'n':
+            if (length == 4 && memcmp(begin, "null", 4) == 0)
+            {
+                out.type = JsonValueType::Null;
+                return true;
+            }
+            break;
+        case '-':
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+        {
+            // Fast path for small integers, which are exactly representable
+            {
+                const bool negative = begin[0] == '-';
+                u32 i = negative ? 1 : 0;
+                u64 integer = 0;
+
+                while (i < length && begin[i] >= '0' && begin[i] <= '9')
+                {
+                    integer = integer * 10 + (u64)(begin[i] - '0');
+                    i++;
+                }
+
+                if (i == length && length > (negative ? 1u : 0u) && length <= 15)
+                {
+                    out.type = JsonValueType::Number;
+                    out.number = negative ? -(f64)integer : (f64)integer;
+                    return true;
+                }
+            }
+
+            char buffer[64];
+            if (length >= sizeof(buffer))
+            {
+                return SetError(JsonParseError::InvalidNumber, "Number is too long");
+            }
+
+            memcpy(buffer, begin, length);
+            buffer[length] = 0;
+
+            char* numberEnd = nullptr;
+            f64 value = strtod(buffer, &numberEnd);
+            if (numberEnd != buffer + length)
+            {
+                return SetError(JsonParseError::InvalidNumber, "Failed to parse number: " + String(buffer));
+            }
+
+            out.type = JsonValueType::Number;
+            out.number = value;
+            return true;
+        }
+        }
+
+        return SetError(JsonParseError::InvalidKeyword, "Invalid keyword: " + String(StringView(begin, length)));
+    }
+
+    const JsonKey* JsonDocument::InternKey(const char* data, u32 length)
+    {
+        if ((keyCount + 1) * 2 > keyTable.GetSize())
+        {
+            GrowKeyTable();
+        }
+
+        const SIZE_T hash = CalculateHash(data, length);
+        const SIZE_T mask = keyTable.GetSize() - 1;
+
+        for (SIZE_T i = hash & mask; ; i = (i + 1) & mask)
+        {
+            JsonKey* key = keyTable[i];
+
+            if (key == nullptr)
+            {
+                key = (JsonKey*)arena.Allocate(sizeof(JsonKey), alignof(JsonKey));
+                key->data = arena.CopyString(data, length);
+                key->length = length;
+                key->hash = hash;
+
+                keyTable[i] = key;
+                keyCount++;
+                return key;
+            }
+
+            if (key->hash == hash && key->length == length && memcmp(key->data, data, length) == 0)
+            {
+                return key;
+            }
+        }
+    }
+
+    void JsonDocument::GrowKeyTable()
+    {
+        const u32 newSize = keyTable.IsEmpty() ? 64 : (u32)keyTable.GetSize() * 2;
+
+        Array<JsonKey*> oldTable = keyTable;
+        keyTable.Resize(newSize);
+        for (u32 i = 0; i < newSize; i++)
+        {
+            keyTable[i] = nullptr;
+        }
+
+        const SIZE_T mask = newSize - 1;
+
+        for (JsonKey* key : oldTable)
+        {
+            if (key == nullptr)
+                continue;
+
+            SIZE_T i = key->hash & mask;
+            while (keyTable[i] != nullptr)
+            {
+                i = (i + 1) & mask;
+            }
+            keyTable[i] = key;
+        }
+    }
+
+} // namespace CE
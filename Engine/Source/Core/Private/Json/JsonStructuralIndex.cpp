@@ -0,0 +1,244 @@
+#include "CoreMinimal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define CE_JSON_SSE2 1
+#	include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#	define CE_JSON_NEON 1
+#	include <arm_neon.h>
+#endif
+
+#include <bit>
+
+namespace CE
+{
+    namespace
+    {
+        struct JsonBlockMasks
+        {
+            u64 backslash = 0;
+            u64 quote = 0;
+            u64 structural = 0;
+            u64 whitespace = 0;
+            u64 slash = 0;
+        };
+
+#if CE_JSON_SSE2
+
+        FORCE_INLINE u64 MoveMask(__m128i value)
+        {
+            return (u64)(u32)_mm_movemask_epi8(value);
+        }
+
+        FORCE_INLINE __m128i Equals(__m128i chunk, char c)
+        {
+            return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c));
+        }
+
+        void ClassifyBlock(const u8* block, JsonBlockMasks& out)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                const __m128i chunk = _mm_loadu_si128((const __m128i*)(block + i * 16));
+                const int shift = i * 16;
+
+                __m128i structural = _mm_or_si128(Equals(chunk, '{'), Equals(chunk, '}'));
+                structural = _mm_or_si128(structural, _mm_or_si128(Equals(chunk, '['), Equals(chunk, ']')));
+                structural = _mm_or_si128(structural, _mm_or_si128(Equals(chunk, ':'), Equals(chunk, ',')));
+
+                __m128i whitespace = _mm_or_si128(Equals(chunk, ' '), Equals(chunk, '\n'));
+                whitespace = _mm_or_si128(whitespace, _mm_or_si128(Equals(chunk, '\t'), Equals(chunk, '\r')));
+
+                out.backslash |= MoveMask(Equals(chunk, '\\')) << shift;
+                out.quote |= MoveMask(Equals(chunk, '"')) << shift;
+                out.slash |= MoveMask(Equals(chunk, '/')) << shift;
+                out.structural |= MoveMask(structural) << shift;
+                out.whitespace |= MoveMask(whitespace) << shift;
+            }
+        }
+
+#elif CE_JSON_NEON
+
+        FORCE_INLINE u64 MoveMask(uint8x16_t value)
+        {
+            static const uint8x16_t bitMask = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+            const uint8x16_t masked = vandq_u8(value, bitMask);
+            const u64 low = vaddv_u8(vget_low_u8(masked));
+            const u64 high = vaddv_u8(vget_high_u8(masked));
+            return low | (high << 8);
+        }
+
+        FORCE_INLINE uint8x16_t Equals(uint8x16_t chunk, char c)
+        {
+            return vceqq_u8(chunk, vdupq_n_u8((u8)c));
+        }
+
+        void ClassifyBlock(const u8* block, JsonBlockMasks& out)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                const uint8x16_t chunk = vld1q_u8(block + i * 16);
+                const int shift = i * 16;
+
+                uint8x16_t structural = vorrq_u8(Equals(chunk, '{'), Equals(chunk, '}'));
+                structural = vorrq_u8(structural, vorrq_u8(Equals(chunk, '['), Equals(chunk, ']')));
+                structural = vorrq_u8(structural, vorrq_u8(Equals(chunk, ':'), Equals(chunk, ',')));
+
+                uint8x16_t whitespace = vorrq_u8(Equals(chunk, ' '), Equals(chunk, '\n'));
+                whitespace = vorrq_u8(whitespace, vorrq_u8(Equals(chunk, '\t'), Equals(chunk, '\r')));
+
+                out.backslash |= MoveMask(Equals(chunk, '\\')) << shift;
+                out.quote |= MoveMask(Equals(chunk, '"')) << shift;
+                out.slash |= MoveMask(Equals(chunk, '/')) << shift;
+                out.structural |= MoveMask(structural) << shift;
+                out.whitespace |= MoveMask(whitespace) << shift;
+            }
+        }
+
+#else
+
+        void ClassifyBlock(const u8* block, JsonBlockMasks& out)
+        {
+            for (int i = 0; i < 64; i++)
+            {
+                const u64 bit = (u64)1 << i;
+
+                switch (block[i])
+                {
+                case '{': case '}': case '[': case ']': case ':': case ',':
+                    out.structural |= bit;
+                    break;
+                case ' ': case '\n': case '\t': case '\r':
+                    out.whitespace |= bit;
+                    break;
+                case '\\':
+                    out.backslash |= bit;
+                    break;
+                case '"':
+                    out.quote |= bit;
+                    break;
+                case '/':
+                    out.slash |= bit;
+                    break;
+                }
+            }
+        }
+
+#endif
+
+        //! @brief Returns a mask of the characters that are escaped by an odd-length run of backslashes.
+        FORCE_INLINE u64 FindEscaped(u64 backslash, u64& prevEndsOddBackslash)
+        {
+            constexpr u64 evenBits = 0x5555555555555555ULL;
+            constexpr u64 oddBits = ~evenBits;
+
+            const u64 startEdges = backslash & ~(backslash << 1);
+            const u64 evenStartMask = evenBits ^ prevEndsOddBackslash;
+            const u64 evenStarts = startEdges & evenStartMask;
+            const u64 oddStarts = startEdges & ~evenStartMask;
+
+            const u64 evenCarries = backslash + evenStarts;
+            u64 oddCarries = backslash + oddStarts;
+            const bool endsOddBackslash = oddCarries < backslash;
+
+            oddCarries |= prevEndsOddBackslash;
+            prevEndsOddBackslash = endsOddBackslash ? 1 : 0;
+
+            const u64 evenCarryEnds = evenCarries & ~backslash;
+            const u64 oddCarryEnds = oddCarries & ~backslash;
+
+            return (evenCarryEnds & oddBits) | (oddCarryEnds & evenBits);
+        }
+
+        //! @brief Each bit is set to the XOR of all the bits at or below it.
+        FORCE_INLINE u64 PrefixXor(u64 bits)
+        {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+    }
+
+    bool JsonStructuralIndexer::IsSimdAccelerated()
+    {
+#if CE_JSON_SSE2 || CE_JSON_NEON
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    JsonParseError JsonStructuralIndexer::Build(const char* json, SIZE_T length, Array<u32>& outIndices)
+    {
+        ZoneScoped;
+
+        outIndices.Clear();
+
+        if (json == nullptr || length == 0)
+            return JsonParseError::None;
+        if (length >= (SIZE_T)0xFFFFFFFF)
+            return JsonParseError::OutOfBounds;
+
+        // Typical json has a structural character every 4-8 bytes
+        outIndices.Reserve((u32)(length / 4 + 16));
+
+        u64 prevEndsOddBackslash = 0;
+        u64 prevInString = 0;
+        u64 prevScalar = 0;
+
+        alignas(16) u8 tail[64];
+
+        for (SIZE_T offset = 0; offset < length; offset += 64)
+        {
+            const u8* block = (const u8*)json + offset;
+
+            if (offset + 64 > length)
+            {
+                // Pad the last block with whitespace
+                memset(tail, ' ', sizeof(tail));
+                memcpy(tail, block, length - offset);
+                block = tail;
+            }
+
+            JsonBlockMasks masks{};
+            ClassifyBlock(block, masks);
+
+            const u64 escaped = FindEscaped(masks.backslash, prevEndsOddBackslash);
+            const u64 quotes = masks.quote & ~escaped;
+
+            // Set for the opening quote and every character of a string, clear for the closing quote
+            const u64 inString = PrefixXor(quotes) ^ prevInString;
+            prevInString = (u64)((s64)inString >> 63);
+
+            if ((masks.slash & ~inString) != 0)
+            {
+                return JsonParseError::CommentNotSupported;
+            }
+
+            const u64 structural = masks.structural & ~inString;
+            const u64 scalar = ~(masks.structural | masks.whitespace | quotes | inString);
+            const u64 scalarStarts = scalar & ~((scalar << 1) | prevScalar);
+            prevScalar = scalar >> 63;
+
+            u64 bits = structural | quotes | scalarStarts;
+
+            while (bits != 0)
+            {
+                outIndices.Add((u32)(offset + std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+
+        if (prevInString != 0)
+        {
+            return JsonParseError::InvalidString;
+        }
+
+        return JsonParseError::None;
+    }
+
+} // namespace CE
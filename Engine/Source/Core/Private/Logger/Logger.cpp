@@ -14,6 +14,10 @@
 
 #include "PAL/Common/PlatformDirectories.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace CE
 {
@@ -29,6 +33,86 @@ namespace CE
     static CE::LogLevel GConsoleLogLevel = CE::LogLevel::Trace;
     static CE::LogLevel GFileDumpLogLevel = CE::LogLevel::Trace;
 
+    /*
+    *   Single producer, single consumer ring of log records. Owned by one logging thread, drained by the log thread.
+    */
+    struct LogRingBuffer
+    {
+        LogRingBuffer(u32 capacity) : capacity(capacity), records(new LogRecord[capacity])
+        {}
+
+        ~LogRingBuffer()
+        {
+            delete[] records;
+        }
+
+        bool IsEmpty() const
+        {
+            return readIndex.load(std::memory_order_relaxed) == writeIndex.load(std::memory_order_acquire);
+        }
+
+        const u32 capacity;
+        LogRecord* const records;
+
+        alignas(64) std::atomic<u64> writeIndex = 0;
+        //! @brief Last read index seen by the producer, so it only touches the consumer's cache line when the buffer looks full.
+        u64 cachedReadIndex = 0;
+
+        alignas(64) std::atomic<u64> readIndex = 0;
+
+        //! @brief Set when the owning thread exits. The log thread deletes the buffer once it is drained.
+        std::atomic<bool> isOrphaned = false;
+    };
+
+    struct ThreadLogRingBuffer
+    {
+        ~ThreadLogRingBuffer();
+
+        LogRingBuffer* ringBuffer = nullptr;
+        u32 generation = 0;
+    };
+
+    static constexpr auto LogThreadIdleWait = std::chrono::milliseconds(5);
+
+    static std::atomic<bool> GIsAsync = false;
+    static AsyncLogSettings GAsyncSettings{};
+    //! @brief Read by every logging thread, incremented by EnableAsync() & DisableAsync().
+    static std::atomic<u32> GAsyncGeneration = 0;
+    //! @brief Threads that are writing to their ring buffer, from BeginAsyncRecord() to CommitAsyncRecord(), or orphaning it.
+    //! DisableAsync() waits for them before deleting the buffers.
+    static std::atomic<u32> GNumAsyncProducers = 0;
+
+    static std::mutex GRingBuffersMutex{};
+    static Array<LogRingBuffer*> GRingBuffers{};
+
+    static std::thread GLogThread{};
+    static std::thread::id GLogThreadId{};
+    static std::atomic<bool> GStopLogThread = false;
+    static std::atomic<bool> GLogThreadSleeping = false;
+    static std::mutex GLogThreadWakeMutex{};
+    static std::condition_variable GLogThreadWakeSignal{};
+
+    static std::atomic<u64> GNumAsyncWritten = 0;
+    static std::atomic<u64> GNumAsyncDropped = 0;
+    //! @brief Protected by GRingBuffersMutex. Orphaned buffers aren't deleted while a Flush() may be reading them.
+    static u32 GNumFlushWaiters = 0;
+
+    static thread_local ThreadLogRingBuffer GThreadRingBuffer{};
+
+    ThreadLogRingBuffer::~ThreadLogRingBuffer()
+    {
+        if (ringBuffer == nullptr)
+            return;
+
+        // Buffers of a previous EnableAsync() call are already deleted, or about to be if DisableAsync() is running
+        GNumAsyncProducers.fetch_add(1, std::memory_order_seq_cst);
+        if (GIsAsync.load(std::memory_order_seq_cst) && generation == GAsyncGeneration.load(std::memory_order_seq_cst))
+        {
+            ringBuffer->isOrphaned.store(true, std::memory_order_release);
+        }
+        GNumAsyncProducers.fetch_sub(1, std::memory_order_release);
+    }
+
     void Logger::SetConsoleLogLevel(LogLevel level)
     {
         GConsoleLogLevel = level;
@@ -79,6 +163,8 @@ namespace CE
 
     void Logger::Shutdown()
     {
+        DisableAsync();
+
         GSystemConsoleSink.reset();
         GLogFileSink.reset();
         GConsoleLogger.reset();
@@ -87,30 +173,53 @@ namespace CE
         GIsLoggerInitialized = false;
     }
 
-    void Logger::Log(LogLevel level, StringView message, LogTarget target)
+    static spdlog::source_loc GetSourceLocation(const char* fileName, int line)
     {
-        if (!GIsLoggerInitialized)
-            return;
+        if (fileName == nullptr)
+            return {};
+        return spdlog::source_loc(fileName, line, "");
+    }
 
+    static void WriteMessage(LogLevel level, LogTarget target, spdlog::string_view_t message, spdlog::log_clock::time_point time, const spdlog::source_loc& location)
+    {
         if (EnumHasAnyFlags(target, LogTarget::Console))
         {
-            GConsoleLogger->log((spdlog::level::level_enum)level, message.GetCString());
+            GConsoleLogger->log(time, location, (spdlog::level::level_enum)level, message);
 
             if (EditorLoggers.GetSize() > 0)
             {
                 for (auto editorLogger : EditorLoggers)
                 {
-                    editorLogger->log((spdlog::level::level_enum)level, message.GetCString());
+                    editorLogger->log(time, location, (spdlog::level::level_enum)level, message);
                 }
             }
         }
 
         if (EnumHasAnyFlags(target, LogTarget::LogFile))
         {
-            GFileLogger->log((spdlog::level::level_enum)level, message.GetCString());
+            GFileLogger->log(time, location, (spdlog::level::level_enum)level, message);
         }
     }
 
+    static void LogSynchronously(LogLevel level, StringView message, const spdlog::source_loc& location, LogTarget target)
+    {
+        if (!GIsLoggerInitialized)
+            return;
+
+        // Keep the order of the messages that are already queued
+        if (GIsAsync.load(std::memory_order_acquire) && std::this_thread::get_id() != GLogThreadId)
+        {
+            Logger::Flush();
+        }
+
+        WriteMessage(level, target, spdlog::string_view_t(message.GetCString(), message.GetSize()), spdlog::log_clock::now(), location);
+    }
+
+    void Logger::Log(LogLevel level, StringView message, LogTarget target)
+    {
+        LogSynchronously(level, message, {}, target);
+    }
+
     void Logger::Log(LogLevel level, StringView message, const char* fileName, int line, LogTarget target)
     {
         if (!GIsLoggerInitialized)
@@ -121,17 +230,329 @@ namespace CE
         {
             //fullMsg = String::Format("{}\n{} Line {}", message, fileName, line);
             String fullMessage = String::Format("{}\n{}", message.GetCString(), cpptrace::generate_trace().to_string());
-            Log(level, fullMessage, target);
+            LogSynchronously(level, fullMessage, GetSourceLocation(fileName, line), target);
         }
         else
         {
-            Log(level, message, target);
+            LogSynchronously(level, message, GetSourceLocation(fileName, line), target);
         }
 #else
-        Log(level, message, target);
+        LogSynchronously(level, message, GetSourceLocation(fileName, line), target);
 #endif
     }
 
+    bool Logger::IsLevelEnabled(LogLevel level, LogTarget target)
+    {
+        if (!GIsLoggerInitialized || level == LogLevel::Off)
+            return false;
+
+        if (EnumHasAnyFlags(target, LogTarget::Console) && (level >= GConsoleLogLevel || EditorLoggers.GetSize() > 0))
+            return true;
+
+        return EnumHasAnyFlags(target, LogTarget::LogFile) && level >= GFileDumpLogLevel;
+    }
+
+    static LogRingBuffer* GetThreadRingBuffer(u32 generation)
+    {
+        ThreadLogRingBuffer& threadRingBuffer = GThreadRingBuffer;
+
+        if (threadRingBuffer.ringBuffer == nullptr || threadRingBuffer.generation != generation)
+        {
+            threadRingBuffer.ringBuffer = new LogRingBuffer(GAsyncSettings.bufferCapacity);
+            threadRingBuffer.generation = generation;
+
+            std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+            GRingBuffers.Add(threadRingBuffer.ringBuffer);
+        }
+
+        return threadRingBuffer.ringBuffer;
+    }
+
+
+    //! @brief Writes the queued records of all threads in timestamp order.
+    //! @return False if there was nothing to write.
+    static bool DrainRingBuffers()
+    {
+        static Array<LogRingBuffer*> ringBuffers{};
+        {
+            std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+            ringBuffers = GRingBuffers;
+        }
+
+        bool wroteAny = false;
+        String message{};
+
+        while (true)
+        {
+            // Merge the threads' buffers by timestamp: each one is already in order
+            LogRingBuffer* next = nullptr;
+            LogRecord* nextRecord = nullptr;
+
+            for (LogRingBuffer* ringBuffer : ringBuffers)
+            {
+                u64 readIndex = ringBuffer->readIndex.load(std::memory_order_relaxed);
+                if (readIndex == ringBuffer->writeIndex.load(std::memory_order_acquire))
+                    continue;
+
+                LogRecord* record = &ringBuffer->records[readIndex & (ringBuffer->capacity - 1)];
+                if (nextRecord == nullptr || record->timestamp < nextRecord->timestamp)
+                {
+                    next = ringBuffer;
+                    nextRecord = record;
+                }
+            }
+
+            if (next == nullptr)
+                break;
+
+            nextRecord->formatFunc(nextRecord, &message);
+
+            auto time = spdlog::log_clock::time_point(spdlog::log_clock::duration(nextRecord->timestamp));
+            WriteMessage(nextRecord->level, nextRecord->target, spdlog::string_view_t(message.GetCString(), message.GetSize()), time,
+                GetSourceLocation(nextRecord->fileName, nextRecord->line));
+
+            next->readIndex.store(next->readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            GNumAsyncWritten.fetch_add(1, std::memory_order_relaxed);
+            wroteAny = true;
+        }
+
+        // Only touched by the log thread
+        static u64 numDroppedReported = 0;
+
+        u64 numDropped = GNumAsyncDropped.load(std::memory_order_relaxed);
+        if (numDropped > numDroppedReported)
+        {
+            String warning = String::Format("Async logger dropped {} messages", numDropped - numDroppedReported);
+            numDroppedReported = numDropped;
+            WriteMessage(LogLevel::Warn, LogTarget::All, spdlog::string_view_t(warning.GetCString(), warning.GetSize()), spdlog::log_clock::now(), {});
+        }
+
+        // Buffers of threads that exited are deleted once empty
+        bool hasOrphans = false;
+        for (LogRingBuffer* ringBuffer : ringBuffers)
+        {
+            hasOrphans |= ringBuffer->isOrphaned.load(std::memory_order_acquire) && ringBuffer->IsEmpty();
+        }
+
+        if (hasOrphans)
+        {
+            std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+
+            for (int i = (int)GRingBuffers.GetSize() - 1; i >= 0 && GNumFlushWaiters == 0; i--)
+            {
+                LogRingBuffer* ringBuffer = GRingBuffers[i];
+                if (ringBuffer->isOrphaned.load(std::memory_order_acquire) && ringBuffer->IsEmpty())
+                {
+                    GRingBuffers.RemoveAt(i);
+                    delete ringBuffer;
+                }
+            }
+        }
+
+        ringBuffers.Clear();
+        return wroteAny;
+    }
+
+    static void LogThreadMain()
+    {
+        while (true)
+        {
+            if (DrainRingBuffers())
+                continue;
+
+            if (GStopLogThread.load(std::memory_order_acquire))
+                break;
+
+            // A producer only signals when this flag is set. A wake up that is missed in between is caught by the timeout.
+            std::unique_lock<std::mutex> lock{ GLogThreadWakeMutex };
+            GLogThreadSleeping.store(true, std::memory_order_seq_cst);
+            GLogThreadWakeSignal.wait_for(lock, LogThreadIdleWait);
+            GLogThreadSleeping.store(false, std::memory_order_relaxed);
+        }
+
+        DrainRingBuffers();
+    }
+
+    void Logger::EnableAsync(const AsyncLogSettings& settings)
+    {
+        if (!GIsLoggerInitialized || GIsAsync.load())
+            return;
+
+        GAsyncSettings = settings;
+
+        u32 capacity = 2;
+        while (capacity < settings.bufferCapacity && capacity < (1u << 24))
+        {
+            capacity <<= 1;
+        }
+        GAsyncSettings.bufferCapacity = capacity;
+
+        GAsyncGeneration.fetch_add(1, std::memory_order_release);
+        GStopLogThread = false;
+
+        GLogThread = std::thread(LogThreadMain);
+        GLogThreadId = GLogThread.get_id();
+
+        GIsAsync.store(true, std::memory_order_release);
+    }
+
+    void Logger::DisableAsync()
+    {
+        if (!GIsAsync.load())
+            return;
+
+        // New records are logged synchronously from here on. Threads still hold pointers to the buffers that are deleted below,
+        // the new generation makes them allocate new ones on the next EnableAsync().
+        GIsAsync.store(false, std::memory_order_seq_cst);
+        GAsyncGeneration.fetch_add(1, std::memory_order_seq_cst);
+
+        // The log thread keeps draining meanwhile, so that a producer blocked on a full buffer can finish
+        while (GNumAsyncProducers.load(std::memory_order_acquire) > 0)
+        {
+            std::this_thread::yield();
+        }
+
+        GStopLogThread.store(true, std::memory_order_release);
+        GLogThreadWakeSignal.notify_one();
+        GLogThread.join();
+        GLogThreadId = {};
+
+        std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+        for (LogRingBuffer* ringBuffer : GRingBuffers)
+        {
+            delete ringBuffer;
+        }
+        GRingBuffers.Clear();
+
+        if (GConsoleLogger)
+            GConsoleLogger->flush();
+        if (GFileLogger)
+            GFileLogger->flush();
+    }
+
+    bool Logger::IsAsync()
+    {
+        return GIsAsync.load(std::memory_order_relaxed);
+    }
+
+    void Logger::Flush()
+    {
+        if (!GIsLoggerInitialized)
+            return;
+
+        if (GIsAsync.load(std::memory_order_acquire) && std::this_thread::get_id() != GLogThreadId)
+        {
+            Array<std::pair<LogRingBuffer*, u64>> targets{};
+            {
+                std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+                GNumFlushWaiters++;
+                for (LogRingBuffer* ringBuffer : GRingBuffers)
+                {
+                    targets.Add({ ringBuffer, ringBuffer->writeIndex.load(std::memory_order_acquire) });
+                }
+            }
+
+            for (const auto& [ringBuffer, writeIndex] : targets)
+            {
+                while (ringBuffer->readIndex.load(std::memory_order_acquire) < writeIndex)
+                {
+                    GLogThreadWakeSignal.notify_one();
+                    std::this_thread::yield();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+            GNumFlushWaiters--;
+        }
+
+        GConsoleLogger->flush();
+        GFileLogger->flush();
+    }
+
+    AsyncLogStatistics Logger::GetAsyncStatistics()
+    {
+        AsyncLogStatistics statistics{};
+        statistics.numWritten = GNumAsyncWritten.load();
+        statistics.numDropped = GNumAsyncDropped.load();
+
+        std::lock_guard<std::mutex> lock{ GRingBuffersMutex };
+        statistics.numThreadBuffers = (u32)GRingBuffers.GetSize();
+        return statistics;
+    }
+
+    LogRecord* Logger::BeginAsyncRecord(LogLevel level, LogTarget target, const char* fileName, int line)
+    {
+        // The generation is read before GIsAsync: if async is still enabled, it is the generation of the buffers
+        // DisableAsync() is going to delete, and not the new one.
+        GNumAsyncProducers.fetch_add(1, std::memory_order_seq_cst);
+        u32 generation = GAsyncGeneration.load(std::memory_order_seq_cst);
+
+        if (!GIsAsync.load(std::memory_order_seq_cst)) // Raced with DisableAsync()
+        {
+            GNumAsyncProducers.fetch_sub(1, std::memory_order_release);
+            return nullptr;
+        }
+
+        LogRingBuffer* ringBuffer = GetThreadRingBuffer(generation);
+
+        u64 writeIndex = ringBuffer->writeIndex.load(std::memory_order_relaxed);
+
+        if (writeIndex - ringBuffer->cachedReadIndex >= ringBuffer->capacity)
+        {
+            ringBuffer->cachedReadIndex = ringBuffer->readIndex.load(std::memory_order_acquire);
+
+            if (writeIndex - ringBuffer->cachedReadIndex >= ringBuffer->capacity)
+            {
+                LogOverflowPolicy policy = GAsyncSettings.overflowPolicy;
+
+                // The log thread can't wait on itself
+                bool canBlock = std::this_thread::get_id() != GLogThreadId;
+
+                if (policy == LogOverflowPolicy::DropNewest || !canBlock ||
+                    (policy == LogOverflowPolicy::DropLowPriority && level < LogLevel::Warn))
+                {
+                    GNumAsyncDropped.fetch_add(1, std::memory_order_relaxed);
+                    GNumAsyncProducers.fetch_sub(1, std::memory_order_release);
+                    return nullptr;
+                }
+
+                while (writeIndex - ringBuffer->cachedReadIndex >= ringBuffer->capacity)
+                {
+                    GLogThreadWakeSignal.notify_one();
+                    std::this_thread::yield();
+                    ringBuffer->cachedReadIndex = ringBuffer->readIndex.load(std::memory_order_acquire);
+                }
+            }
+        }
+
+        LogRecord* record = &ringBuffer->records[writeIndex & (ringBuffer->capacity - 1)];
+        record->level = level;
+        record->target = target;
+        record->fileName = fileName;
+        record->line = line;
+        record->timestamp = spdlog::log_clock::now().time_since_epoch().count();
+        return record;
+    }
+
+    void Logger::CommitAsyncRecord(LogRecord* record)
+    {
+        LogRingBuffer* ringBuffer = GThreadRingBuffer.ringBuffer;
+
+        u64 writeIndex = ringBuffer->writeIndex.load(std::memory_order_relaxed) + 1;
+        ringBuffer->writeIndex.store(writeIndex, std::memory_order_release);
+
+        // Waking the log thread costs a syscall, so an idle one is only woken for warnings & errors, or when the buffer fills up.
+        // Otherwise it picks the messages up within LogThreadIdleWait.
+        if (GLogThreadSleeping.load(std::memory_order_relaxed) &&
+            (record->level >= LogLevel::Warn || writeIndex - ringBuffer->cachedReadIndex >= ringBuffer->capacity / 4) &&
+            GLogThreadSleeping.exchange(false, std::memory_order_relaxed))
+        {
+            GLogThreadWakeSignal.notify_one();
+        }
+
+        GNumAsyncProducers.fetch_sub(1, std::memory_order_release);
+    }
+
     std::shared_ptr<spdlog::logger> Logger::GetConsoleLogger()
     {
         return GConsoleLogger;
@@ -144,7 +565,7 @@ namespace CE
 
     void Logger::RemoveEditorLogger(spdlog::logger* logger)
     {
-        EditorLoggers.Add(logger);
+        EditorLoggers.Remove(logger);
     }
 
 } // namespace CE
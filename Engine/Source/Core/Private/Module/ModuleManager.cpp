@@ -20,10 +20,51 @@ namespace CE
 		return instance;
 	}
 
+	using ModuleLoadClock = std::chrono::steady_clock;
+
+	static f64 GetElapsedMilliseconds(ModuleLoadClock::time_point start)
+	{
+		return std::chrono::duration<f64, std::milli>(ModuleLoadClock::now() - start).count();
+	}
+
 	Module* ModuleManager::LoadModule(const String& moduleName, ModuleLoadResult& result)
 	{
 		ZoneScoped;
+		ZoneText(moduleName.GetCString(), moduleName.GetLength());
+
+		CompleteTypePrewarm();
+
+		ModuleLoadTiming timing{};
+		timing.moduleName = moduleName;
+
+		nestedLoadTimeStack.Add(0);
+
+		const auto startTime = ModuleLoadClock::now();
+		result = ModuleLoadResult::Success;
+
+		Module* modulePtr = LoadModuleInternal(moduleName, result, timing);
+
+		timing.totalTime = GetElapsedMilliseconds(startTime);
+		timing.selfTime = timing.totalTime - nestedLoadTimeStack.Top();
+		nestedLoadTimeStack.Pop();
+
+		if (nestedLoadTimeStack.NotEmpty())
+		{
+			nestedLoadTimeStack.Top() += timing.totalTime;
+		}
 
+		if (modulePtr != nullptr && result == ModuleLoadResult::Success)
+		{
+			moduleLoadTimings.Add(timing);
+
+			CE_LOG(Info, All, "Loaded Module: {} in {:.2f} ms ({:.2f} ms self)", moduleName, timing.totalTime, timing.selfTime);
+		}
+
+		return modulePtr;
+	}
+
+	Module* ModuleManager::LoadModuleInternal(const String& moduleName, ModuleLoadResult& result, ModuleLoadTiming& timing)
+	{
 		TypeInfo::currentlyLoadingModuleStack.Push(moduleName);
 		auto info = FindModuleInfo(moduleName);
 
@@ -38,7 +79,9 @@ namespace CE
 
 		if (info == nullptr)
 		{
+			const auto dllLoadStart = ModuleLoadClock::now();
 			info = AddModule(moduleName, result);
+			timing.dllLoadTime = GetElapsedMilliseconds(dllLoadStart);
 
 			if (info == nullptr)
 			{
@@ -71,30 +114,41 @@ namespace CE
 		if (moduleName != "Core")
 			transient = CreateObject<Bundle>(nullptr, "/" + moduleName + "/Transient", OF_Transient);
 
+		auto phaseStart = ModuleLoadClock::now();
+
 		// Register manually reflected types
 		modulePtr->RegisterTypes();
 
 		// Register AutoRTTI reflected types
 		info->loadTypesFuncPtr();
 
+		timing.registerTypesTime = GetElapsedMilliseconds(phaseStart);
+		phaseStart = ModuleLoadClock::now();
+
 		// Startup module
 		modulePtr->StartupModule();
 
+		timing.startupTime = GetElapsedMilliseconds(phaseStart);
+
 		if (moduleName == "Core")
 			transient = CreateObject<Bundle>(nullptr, "/" + moduleName + "/Transient", OF_Transient);
 
 		transient->AddToRoot();
 		info->transientBundle = transient.Get();
 
-		// RTTI setup
+		phaseStart = ModuleLoadClock::now();
+
+		// RTTI setup. Class default instances are created lazily on first use.
 		ClassType::CacheTypesForCurrentModule();
-		ClassType::CreateDefaultInstancesForCurrentModule();
 		TypeInfo::FireTypeRegistrationEventsForCurrentModule();
 
+		timing.rttiSetupTime = GetElapsedMilliseconds(phaseStart);
+		phaseStart = ModuleLoadClock::now();
+
 		// Register resources
 		info->loadResourcesFuncPtr();
 
-		CE_LOG(Info, All, "Loaded Module: {}", moduleName);
+		timing.resourcesTime = GetElapsedMilliseconds(phaseStart);
 
 		CoreDelegates::onAfterModuleLoad.Broadcast(info);
 
@@ -102,6 +156,37 @@ namespace CE
 		return modulePtr;
 	}
 
+	void ModuleManager::PrewarmLoadedModuleTypes()
+	{
+		if (!prewarmTypesInBackground || JobContext::GetGlobalContext() == nullptr)
+			return;
+
+		CompleteTypePrewarm();
+
+		Array<Name> moduleNames{};
+
+		for (auto& [moduleName, info] : ModuleMap)
+		{
+			if (info.isLoaded && !info.typesPrewarmed)
+			{
+				info.typesPrewarmed = true;
+				moduleNames.Add(moduleName);
+			}
+		}
+
+		typePrewarmJob = ClassType::PrewarmTypesForModules(moduleNames, JobContext::GetGlobalContext());
+	}
+
+	void ModuleManager::CompleteTypePrewarm()
+	{
+		if (typePrewarmJob == nullptr)
+			return;
+
+		typePrewarmJob->Complete();
+		delete typePrewarmJob;
+		typePrewarmJob = nullptr;
+	}
+
 	void ModuleManager::UnloadModule(const String& moduleName)
 	{
 		auto info = FindModuleInfo(moduleName);
@@ -113,6 +198,9 @@ namespace CE
 
 		TypeInfo::currentlyUnloadingModuleStack.Push(moduleName);
 
+		CompleteTypePrewarm();
+		info->typesPrewarmed = false;
+
 		ClassType::ClearDefaultInstancesForModule(moduleName);
 
 		// Deregister resources
@@ -201,6 +289,30 @@ namespace CE
 		return info->transientBundle;
 	}
 
+	void ModuleManager::LogModuleLoadTimings()
+	{
+		Array<ModuleLoadTiming> sortedTimings = moduleLoadTimings;
+		sortedTimings.Sort([](const ModuleLoadTiming& lhs, const ModuleLoadTiming& rhs)
+			{
+				return lhs.selfTime > rhs.selfTime;
+			});
+
+		f64 totalSelfTime = 0;
+		for (const ModuleLoadTiming& timing : sortedTimings)
+		{
+			totalSelfTime += timing.selfTime;
+		}
+
+		CE_LOG(Info, All, "Module load timings ({} modules, {:.2f} ms):", sortedTimings.GetSize(), totalSelfTime);
+
+		for (const ModuleLoadTiming& timing : sortedTimings)
+		{
+			CE_LOG(Info, All, "  {}: {:.2f} ms self, {:.2f} ms total [dll {:.2f}, types {:.2f}, startup {:.2f}, rtti {:.2f}, resources {:.2f}]",
+				timing.moduleName, timing.selfTime, timing.totalTime, timing.dllLoadTime, timing.registerTypesTime,
+				timing.startupTime, timing.rttiSetupTime, timing.resourcesTime);
+		}
+	}
+
 	ModuleInfo* ModuleManager::AddModule(const String& moduleName, ModuleLoadResult& result)
 	{
 		IO::Path moduleDllPath = PlatformProcess::GetModuleDllPath(moduleName);
@@ -275,10 +275,26 @@ namespace CE
             return nullptr;
         }
 
-        FileStream stream = FileStream(absolutePath, Stream::Permissions::ReadOnly);
-        stream.SetBinaryMode(true);
+        Ref<Bundle> bundle = nullptr;
+        Array<u8> bundleData{};
+
+        if (loadArgs.loadFully && ReadBundleFile(absolutePath, bundleData))
+        {
+            // Every object is going to be deserialized, so read the whole file at once on an IO thread
+            MemoryStream stream = MemoryStream(bundleData.GetData(), (u32)bundleData.GetSize(), Stream::Permissions::ReadOnly);
+            stream.SetBinaryMode(true);
+
+            bundle = LoadBundle(outer, &stream, outResult, loadArgs);
+        }
+        else
+        {
+            FileStream fileStream = FileStream(absolutePath, Stream::Permissions::ReadOnly);
+            fileStream.SetBinaryMode(true);
+            BufferedStream stream = BufferedStream(&fileStream);
+
+            bundle = LoadBundle(outer, &stream, outResult, loadArgs);
+        }
 
-        Ref<Bundle> bundle = LoadBundle(outer, &stream, outResult, loadArgs);
         if (bundle.IsValid())
         {
             bundle->absoluteBundlePath = absolutePath;
@@ -368,10 +384,13 @@ namespace CE
         bundle->absoluteBundlePath = path;
         bundle->bundlePath = Bundle::GetBundlePath(path);
 
-        FileStream stream = FileStream(path, Stream::Permissions::WriteOnly, true, true);
-        stream.SetBinaryMode(true);
+        FileStream fileStream = FileStream(path, Stream::Permissions::WriteOnly, true, true);
+        fileStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&fileStream);
 
-        return SaveToDisk(bundle, asset, &stream);
+        BundleSaveResult result = SaveToDisk(bundle, asset, &stream);
+        stream.Flush();
+        return result;
     }
 
     void Bundle::LoadFully()
@@ -381,10 +400,43 @@ namespace CE
 
         LockGuard lock{ bundleMutex };
 
+        // Read the file once for all the objects, instead of once per object.
+        // Files that don't fit in a MemoryStream are streamed by each LoadObject() call instead.
+        Array<u8> bundleData{};
+        MemoryStream stream{};
+
+        if (readerStream == nullptr && ReadBundleFile(absoluteBundlePath, bundleData))
+        {
+            stream = MemoryStream(bundleData.GetData(), (u32)bundleData.GetSize(), Stream::Permissions::ReadOnly);
+            stream.SetBinaryMode(true);
+
+            readerStream = &stream;
+        }
+
         for (const auto& serializedObject : serializedObjectEntries)
         {
             LoadObject(serializedObject.instanceUuid);
         }
+
+        if (readerStream == &stream)
+        {
+            readerStream = nullptr;
+        }
+    }
+
+    bool Bundle::ReadBundleFile(const IO::Path& absolutePath, Array<u8>& outData)
+    {
+        ZoneScoped;
+
+        if (absolutePath.IsEmpty() || !absolutePath.Exists())
+            return false;
+
+        // MemoryStream is limited to 32-bit lengths
+        std::error_code error{};
+        if (fs::file_size((fs::path)absolutePath, error) > NumericLimits<u32>::Max() || error)
+            return false;
+
+        return IO::AsyncIO::ReadFile(absolutePath, outData, IO::AsyncIOPriority::Critical);
     }
 
     Ref<Object> Bundle::LoadObject(Uuid objectUuid)
@@ -416,8 +468,11 @@ namespace CE
 
         if (absoluteBundlePath.Exists())
         {
-            FileStream stream = FileStream(absoluteBundlePath, Stream::Permissions::ReadOnly);
-            stream.SetBinaryMode(true);
+            // Only this object and the objects it references are read, so seek in the file instead of reading all of it.
+            // Referenced objects can be anywhere in the bundle, and are loaded through the readerStream.
+            FileStream fileStream = FileStream(absoluteBundlePath, Stream::Permissions::ReadOnly);
+            fileStream.SetBinaryMode(true);
+            BufferedStream stream = BufferedStream(&fileStream);
 
             readerStream = &stream;
 
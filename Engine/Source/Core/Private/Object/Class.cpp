@@ -284,16 +284,21 @@ namespace CE
 	                return false;
                 }
 
-                Array<Ptr<FieldType>> arrayFields = curField->GetArrayFieldListPtr(curInstance);
+                // Only create the field of the requested element, property editors resolve elements of large arrays one by one
+                if (arrayIndex >= (int)curField->GetArraySize(curInstance))
+                {
+	                return false;
+                }
 
-                if (arrayIndex >= arrayFields.GetSize() || arrayFields.IsEmpty())
+                Ptr<FieldType> elementField = curField->GetArrayFieldElementPtr(curInstance, arrayIndex);
+                if (elementField == nullptr)
                 {
 	                return false;
                 }
 
                 const Array<u8>& rawArray = curField->GetFieldValue<Array<u8>>(curInstance);
                 curInstance = (void*)rawArray.GetData();
-                curField = arrayFields[arrayIndex];
+                curField = elementField;
 
                 if (isLast)
                 {
@@ -488,9 +493,12 @@ namespace CE
 
         LockGuard lock{ cachedFieldsMutex };
 
-        fieldsCached = true;
+        // Another thread might have built the cache while we were waiting on the lock
+        if (fieldsCached)
+            return;
 
         cachedFields.Clear();
+        cachedFieldsMap.Clear();
 
         for (int i = 0; i < superTypeIds.GetSize(); i++)
         {
@@ -548,7 +556,9 @@ namespace CE
 
 			cachedFieldsMap[cachedFields[i]->GetName()] = cachedFields[i];
         }
-		
+
+        // Publish only after the cache is complete, so lock-free readers never see a partial field list
+        fieldsCached = true;
     }
 
     void StructType::CacheAllFunctions()
@@ -558,7 +568,8 @@ namespace CE
 
 	    LockGuard lock{ cachedFunctionsMutex };
 
-        functionsCached = true;
+        if (functionsCached)
+            return;
 
         cachedFunctions.Clear();
 		cachedFunctionsMap.Clear();
@@ -622,6 +633,8 @@ namespace CE
 			else
 				cachedFunctionsMap.Add({ cachedFunctions[i].GetName(), { &cachedFunctions[i] } });
 		}
+
+		functionsCached = true;
     }
 
     void StructType::RegisterStructType(StructType* type)
@@ -751,6 +764,7 @@ namespace CE
 
                 if (clazz->defaultInstance != nullptr)
 				{
+					clazz->defaultInstancePtr = nullptr;
 					clazz->defaultInstance->BeginDestroy();
                 	clazz->defaultInstance = nullptr;
 				}
@@ -783,8 +797,19 @@ namespace CE
 	{
 		// TODO: In runtime builds, CDI's should be serialized directly instead of loading config files
 
-		if (defaultInstance == nullptr && CanBeInstantiated())
+		if (!CanBeInstantiated())
+			return nullptr;
+
+		if (Object* instance = defaultInstancePtr)
+			return instance;
+
+		// Recursive, because constructing the CDI may query the CDI of the same class
+		LockGuard lock{ defaultInstanceMutex };
+
+		if (defaultInstance == nullptr)
 		{
+			ZoneScoped;
+
 			auto nameString = GetName().GetLastComponent();
 
 			auto moduleName = GetOwnerModuleName().GetString();
@@ -793,6 +818,7 @@ namespace CE
 				transientBundle = GetGlobalTransient();
 			
 			defaultInstance = CreateObject<Object>(transientBundle, "CDI_" + nameString, OF_ClassDefaultInstance, this, nullptr);
+			defaultInstancePtr = defaultInstance.Get();
 		}
 		
 		return defaultInstance.Get();
@@ -826,6 +852,7 @@ namespace CE
 
         CoreObjectDelegates::onClassDeregistered.Broadcast(type);
 
+        type->defaultInstancePtr = nullptr;
         type->defaultInstance = nullptr;
         type->fieldsCached = false;
         type->attributesCached = false;
@@ -841,42 +868,66 @@ namespace CE
         }
     }
 
-	void ClassType::CreateDefaultInstancesForCurrentModule()
+	void ClassType::CacheTypesForCurrentModule()
 	{
 		if (TypeInfo::currentlyLoadingModuleStack.IsEmpty())
 			return;
 
 		const auto& typesInThisModule = TypeInfo::registeredTypesByModuleName[TypeInfo::currentlyLoadingModuleStack.Top()];
 
+		// Fields & functions are cached lazily on first use (or prewarmed in background), because cloning
+		// every inherited field of every type is the most expensive part of loading a module.
 		for (auto type : typesInThisModule)
 		{
+			if (type->IsClass() || type->IsStruct())
+			{
+				((StructType*)type)->CacheAllAttributes();
+			}
 			if (type->IsClass())
 			{
-				((ClassType*)type)->GetDefaultInstance();
+				((ClassType*)type)->CacheSuperTypes();
 			}
 		}
 	}
 
-	void ClassType::CacheTypesForCurrentModule()
+	Job* ClassType::PrewarmTypesForModules(const Array<Name>& moduleNames, JobContext* context)
 	{
-		if (TypeInfo::currentlyLoadingModuleStack.IsEmpty())
-			return;
+		if (moduleNames.IsEmpty() || context == nullptr)
+			return nullptr;
 
-		const auto& typesInThisModule = TypeInfo::registeredTypesByModuleName[TypeInfo::currentlyLoadingModuleStack.Top()];
+		Array<StructType*> structTypes{};
 
-		for (auto type : typesInThisModule)
+		for (const Name& moduleName : moduleNames)
 		{
-			if (type->IsClass() || type->IsStruct())
-			{
-				((StructType*)type)->CacheAllFields();
-				((StructType*)type)->CacheAllAttributes();
-				((StructType*)type)->CacheAllFunctions();
-			}
-			if (type->IsClass())
+			if (!TypeInfo::registeredTypesByModuleName.KeyExists(moduleName))
+				continue;
+
+			for (auto type : TypeInfo::registeredTypesByModuleName[moduleName])
 			{
-				((ClassType*)type)->CacheSuperTypes();
+				if (type->IsClass() || type->IsStruct())
+				{
+					structTypes.Add((StructType*)type);
+				}
 			}
 		}
+
+		if (structTypes.IsEmpty())
+			return nullptr;
+
+		// CDIs are not prewarmed: constructing objects is not safe outside the main thread
+		Job* job = new JobFunction([structTypes](Job*)
+			{
+				ZoneScopedN("PrewarmTypes");
+
+				for (StructType* structType : structTypes)
+				{
+					structType->CacheAllFields();
+					structType->CacheAllFunctions();
+				}
+			}, false, context);
+
+		job->Start();
+		return job;
 	}
 
     ClassType* ClassType::FindClassByName(const Name& className)
@@ -0,0 +1,232 @@
+
+#include "CoreMinimal.h"
+
+#include "PAL/Linux/LinuxIoUring.h"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace CE
+{
+
+    LinuxIoUring::~LinuxIoUring()
+    {
+        Shutdown();
+    }
+
+    bool LinuxIoUring::Initialize(u32 queueDepth)
+    {
+        Shutdown();
+
+        io_uring_params params{};
+
+        ringFd = (int)syscall(__NR_io_uring_setup, queueDepth, &params);
+        if (ringFd < 0)
+        {
+            ringFd = -1;
+            return false;
+        }
+
+        // IORING_OP_READ was added after io_uring itself, so make sure the kernel supports it
+        {
+            constexpr u32 numOps = 64;
+            u8 probeData[sizeof(io_uring_probe) + numOps * sizeof(io_uring_probe_op)] = {};
+            io_uring_probe* probe = (io_uring_probe*)probeData;
+
+            int result = (int)syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, numOps);
+
+            if (result < 0 || probe->last_op < IORING_OP_READ || (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) == 0)
+            {
+                Shutdown();
+                return false;
+            }
+        }
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMmap)
+        {
+            sqRingSize = cqRingSize = Math::Max(sqRingSize, cqRingSize);
+        }
+
+        sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        if (sqRing == MAP_FAILED)
+        {
+            sqRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMmap)
+        {
+            cqRing = sqRing;
+        }
+        else
+        {
+            cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+            if (cqRing == MAP_FAILED)
+            {
+                cqRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqesPtr = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+        if (sqesPtr == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        sqes = (io_uring_sqe*)sqesPtr;
+
+        u8* sq = (u8*)sqRing;
+        sqHead = (u32*)(sq + params.sq_off.head);
+        sqTail = (u32*)(sq + params.sq_off.tail);
+        sqMask = (u32*)(sq + params.sq_off.ring_mask);
+        sqArray = (u32*)(sq + params.sq_off.array);
+        sqEntries = params.sq_entries;
+
+        u8* cq = (u8*)cqRing;
+        cqHead = (u32*)(cq + params.cq_off.head);
+        cqTail = (u32*)(cq + params.cq_off.tail);
+        cqMask = (u32*)(cq + params.cq_off.ring_mask);
+        cqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+        numToSubmit = 0;
+        return true;
+    }
+
+    void LinuxIoUring::Shutdown()
+    {
+        if (sqes != nullptr)
+        {
+            munmap(sqes, sqesSize);
+            sqes = nullptr;
+        }
+
+        if (cqRing != nullptr && cqRing != sqRing)
+        {
+            munmap(cqRing, cqRingSize);
+        }
+        cqRing = nullptr;
+
+        if (sqRing != nullptr)
+        {
+            munmap(sqRing, sqRingSize);
+            sqRing = nullptr;
+        }
+
+        if (ringFd >= 0)
+        {
+            close(ringFd);
+            ringFd = -1;
+        }
+
+        sqHead = sqTail = sqMask = sqArray = nullptr;
+        cqHead = cqTail = cqMask = nullptr;
+        cqes = nullptr;
+        sqEntries = 0;
+        numToSubmit = 0;
+    }
+
+    io_uring_sqe* LinuxIoUring::GetNextSqe()
+    {
+        // Only this thread writes the tail, but the kernel moves the head
+        const u32 tail = *sqTail;
+        const u32 head = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+
+        if (tail - head >= sqEntries)
+            return nullptr;
+
+        io_uring_sqe* sqe = &sqes[tail & *sqMask];
+        memset(sqe, 0, sizeof(io_uring_sqe));
+        return sqe;
+    }
+
+    void LinuxIoUring::CommitSqe()
+    {
+        const u32 tail = *sqTail;
+        const u32 index = tail & *sqMask;
+
+        sqArray[index] = index;
+
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        numToSubmit++;
+    }
+
+    bool LinuxIoUring::QueueRead(int fd, void* buffer, u32 length, u64 offset, u64 userData)
+    {
+        io_uring_sqe* sqe = GetNextSqe();
+        if (sqe == nullptr)
+            return false;
+
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = fd;
+        sqe->addr = (u64)buffer;
+        sqe->len = length;
+        sqe->off = offset;
+        sqe->user_data = userData;
+
+        CommitSqe();
+        return true;
+    }
+
+    bool LinuxIoUring::QueueCancel(u64 targetUserData, u64 userData)
+    {
+        io_uring_sqe* sqe = GetNextSqe();
+        if (sqe == nullptr)
+            return false;
+
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = targetUserData;
+        sqe->user_data = userData;
+
+        CommitSqe();
+        return true;
+    }
+
+    int LinuxIoUring::Submit(u32 waitCount)
+    {
+        const u32 flags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+        while (true)
+        {
+            int result = (int)syscall(__NR_io_uring_enter, ringFd, numToSubmit, waitCount, flags, nullptr, 0);
+
+            if (result >= 0)
+            {
+                numToSubmit -= Math::Min<u32>((u32)result, numToSubmit);
+                return result;
+            }
+
+            if (errno != EINTR)
+                return -errno;
+        }
+    }
+
+    bool LinuxIoUring::PopCompletion(u64& outUserData, s32& outResult)
+    {
+        // Only this thread writes the head, but the kernel moves the tail
+        const u32 head = *cqHead;
+        const u32 tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+
+        if (head == tail)
+            return false;
+
+        const io_uring_cqe* cqe = &cqes[head & *cqMask];
+        outUserData = cqe->user_data;
+        outResult = cqe->res;
+
+        __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+} // namespace CE
@@ -0,0 +1,80 @@
+#pragma once
+
+#if PLATFORM_LINUX
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace CE
+{
+    /*
+     *  Minimal io_uring wrapper, using the raw syscalls so it doesn't need liburing.
+     *  Only used for file reads, and only from a single thread.
+     */
+    class LinuxIoUring final
+    {
+    public:
+
+        LinuxIoUring() = default;
+        ~LinuxIoUring();
+
+        LinuxIoUring(const LinuxIoUring&) = delete;
+        LinuxIoUring& operator=(const LinuxIoUring&) = delete;
+
+        //! @brief Creates the ring. Fails if io_uring is not supported by the kernel, or blocked.
+        bool Initialize(u32 queueDepth);
+
+        void Shutdown();
+
+        bool IsValid() const { return ringFd >= 0; }
+
+        //! @brief Adds a read to the submission queue. Returns false if the queue is full.
+        bool QueueRead(int fd, void* buffer, u32 length, u64 offset, u64 userData);
+
+        //! @brief Adds a request to cancel the read submitted with `targetUserData`. The cancelled read still
+        //! completes, with -ECANCELED if it was cancelled in time. Returns false if the queue is full.
+        bool QueueCancel(u64 targetUserData, u64 userData);
+
+        //! @brief Submits all the queued reads, and waits till at least `waitCount` reads have completed.
+        //! @return Number of submitted reads, or a negative errno.
+        int Submit(u32 waitCount);
+
+        //! @brief Pops a completed read, if there is one. `outResult` is the number of bytes read, or a negative errno.
+        bool PopCompletion(u64& outUserData, s32& outResult);
+
+    private:
+
+        //! @brief Returns the next free submission queue entry, cleared, or nullptr if the queue is full.
+        //! It is submitted by the next CommitSqe().
+        io_uring_sqe* GetNextSqe();
+
+        void CommitSqe();
+
+        int ringFd = -1;
+
+        void* sqRing = nullptr;
+        void* cqRing = nullptr;
+        SIZE_T sqRingSize = 0;
+        SIZE_T cqRingSize = 0;
+
+        io_uring_sqe* sqes = nullptr;
+        SIZE_T sqesSize = 0;
+
+        u32* sqHead = nullptr;
+        u32* sqTail = nullptr;
+        u32* sqMask = nullptr;
+        u32* sqArray = nullptr;
+        u32 sqEntries = 0;
+
+        u32* cqHead = nullptr;
+        u32* cqTail = nullptr;
+        u32* cqMask = nullptr;
+        io_uring_cqe* cqes = nullptr;
+
+        //! @brief Number of reads added to the queue, that haven't been submitted yet.
+        u32 numToSubmit = 0;
+    };
+
+} // namespace CE
+
+#endif
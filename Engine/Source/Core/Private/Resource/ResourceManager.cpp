@@ -37,13 +37,51 @@ namespace CE
 		pathTree.RemovePath(path);
 	}
 
+	void ResourceManager::RegisterResourceIndex(const String& moduleName, const ResourceIndexEntry* entries, u32 numEntries)
+	{
+		LockGuard lock{ mutex };
+
+		ModuleResourceIndex index{};
+		index.entries = entries;
+		index.numEntries = numEntries;
+
+		moduleIndices[moduleName] = index;
+	}
+
+	void ResourceManager::DeregisterResourceIndex(const String& moduleName)
+	{
+		LockGuard lock{ mutex };
+
+		auto it = moduleIndices.Find(moduleName);
+		if (it == moduleIndices.end())
+			return;
+
+		// Drop the decompressed data of the module, as the module's memory is about to be unloaded
+		const ModuleResourceIndex& index = it->second;
+		for (u32 i = 0; i < index.numEntries; i++)
+		{
+			auto cacheIt = decompressedResources.Find(index.entries[i].data);
+			if (cacheIt != decompressedResources.end())
+			{
+				cacheSize -= cacheIt->second.data.GetSize();
+				decompressedResources.Remove(index.entries[i].data);
+			}
+		}
+
+		moduleIndices.Remove(moduleName);
+	}
+
 	Resource* ResourceManager::LoadResource(const Name& path, Object* outer)
 	{
-		PathTreeNode* node = pathTree.GetNode(path);
-		if (node == nullptr || node->userData == nullptr || node->userDataSize == 0)
-			return nullptr;
+		String fileName = path.GetString();
+		int lastSlash = fileName.GetLength() - 1;
+		while (lastSlash >= 0 && fileName[lastSlash] != '/')
+		{
+			lastSlash--;
+		}
+		fileName = fileName.GetSubstring(lastSlash + 1);
 
-		auto components = node->name.GetString().Split('.');
+		auto components = fileName.Split('.');
 		if (components.GetSize() < 2)
 			return nullptr;
 
@@ -59,10 +97,24 @@ namespace CE
 
 		name = name.Replace({ '.', ':', ' ' }, '_');
 
+		u8* data = nullptr;
+		u32 dataSize = 0;
+
+		{
+			LockGuard lock{ mutex };
+
+			const u8* resourceData = nullptr;
+			if (!GetResourceData(path, false, resourceData, dataSize))
+				return nullptr;
+
+			// The resource owns a copy, so the decompressed data can be evicted right after
+			data = (u8*)malloc(dataSize);
+			memcpy(data, resourceData, dataSize);
+		}
+
 		Resource* resource = CreateObject<Resource>(outer, name);
-		resource->dataSize = node->userDataSize;
-		resource->data = (u8*)malloc(node->userDataSize);
-		memcpy(resource->data, node->userData, node->userDataSize);
+		resource->dataSize = dataSize;
+		resource->data = data;
 		resource->extension = components.GetLast();
 		resource->fullPath = path;
 
@@ -71,24 +123,186 @@ namespace CE
 
 	RawData ResourceManager::GetRawData(const Name& path)
 	{
-		PathTreeNode* node = pathTree.GetNode(path);
-		if (node == nullptr || node->userData == nullptr || node->userDataSize == 0)
+		LockGuard lock{ mutex };
+
+		const u8* data = nullptr;
+		u32 dataSize = 0;
+		if (!GetResourceData(path, true, data, dataSize))
 			return {};
 
-		return { .data = (u8*)node->userData, .dataSize = node->userDataSize };
+		return { .data = (u8*)data, .dataSize = dataSize };
+	}
+
+	StringView ResourceManager::LoadTextResource(const Name& path)
+	{
+		LockGuard lock{ mutex };
+
+		const u8* data = nullptr;
+		u32 dataSize = 0;
+		if (!GetResourceData(path, true, data, dataSize))
+			return StringView();
+
+		// Text resources are embedded with their null terminator
+		while (dataSize > 0 && data[dataSize - 1] == 0)
+		{
+			dataSize--;
+		}
+
+		return StringView((const char*)data, dataSize);
+	}
+
+	void ResourceManager::ReleaseResourceView(const Name& path)
+	{
+		LockGuard lock{ mutex };
+
+		const ResourceIndexEntry* entry = FindIndexEntry(path);
+		if (entry == nullptr || entry->uncompressedSize == 0)
+			return;
+
+		auto it = decompressedResources.Find(entry->data);
+		if (it == decompressedResources.end() || it->second.pinCount == 0)
+			return;
+
+		it->second.pinCount--;
+		EvictCache(nullptr);
+	}
+
+	void ResourceManager::SetCacheBudget(u64 budgetInBytes)
+	{
+		LockGuard lock{ mutex };
+
+		cacheBudget = budgetInBytes;
+		EvictCache(nullptr);
+	}
+
+	u64 ResourceManager::GetCacheSize()
+	{
+		LockGuard lock{ mutex };
+		return cacheSize;
 	}
 
-	String ResourceManager::LoadTextResource(const Name& path)
+	const ResourceIndexEntry* ResourceManager::FindIndexEntry(const Name& path)
+	{
+		// Paths look like: /<ModuleName>/Resources/<Relative path>
+		const String& pathString = path.GetString();
+		const char* cPath = pathString.GetCString();
+		if (cPath == nullptr || cPath[0] != '/')
+			return nullptr;
+
+		const char* moduleEnd = strchr(cPath + 1, '/');
+		if (moduleEnd == nullptr)
+			return nullptr;
+
+		static constexpr const char ResourcesDirectory[] = "/Resources/";
+		static constexpr SIZE_T ResourcesDirectoryLength = sizeof(ResourcesDirectory) - 1;
+
+		if (strncmp(moduleEnd, ResourcesDirectory, ResourcesDirectoryLength) != 0)
+			return nullptr;
+
+		auto it = moduleIndices.Find(Name(String(StringView(cPath + 1, moduleEnd - cPath - 1))));
+		if (it == moduleIndices.end())
+			return nullptr;
+
+		const char* relativePath = moduleEnd + ResourcesDirectoryLength;
+		const ModuleResourceIndex& index = it->second;
+
+		// The index is sorted with strcmp() by the ResourceCompiler
+		s64 low = 0;
+		s64 high = (s64)index.numEntries - 1;
+
+		while (low <= high)
+		{
+			s64 mid = low + (high - low) / 2;
+			int comparison = strcmp(index.entries[mid].path, relativePath);
+
+			if (comparison == 0)
+				return &index.entries[mid];
+			if (comparison < 0)
+				low = mid + 1;
+			else
+				high = mid - 1;
+		}
+
+		return nullptr;
+	}
+
+	bool ResourceManager::GetResourceData(const Name& path, bool pin, const u8*& outData, u32& outDataSize)
 	{
 		PathTreeNode* node = pathTree.GetNode(path);
-		if (node == nullptr || node->userData == nullptr || node->userDataSize == 0)
-			return String();
-
-		String string = String(node->userDataSize);
-		memcpy(string.GetData(), node->userData, node->userDataSize);
-		string[node->userDataSize] = 0;
-		string.UpdateLength();
-		return string;
+		if (node != nullptr && node->userData != nullptr && node->userDataSize > 0)
+		{
+			outData = (const u8*)node->userData;
+			outDataSize = node->userDataSize;
+			return true;
+		}
+
+		const ResourceIndexEntry* entry = FindIndexEntry(path);
+		if (entry == nullptr || entry->data == nullptr || entry->dataSize == 0)
+			return false;
+
+		if (entry->uncompressedSize == 0)
+		{
+			outData = entry->data;
+			outDataSize = entry->dataSize;
+			return true;
+		}
+
+		auto it = decompressedResources.Find(entry->data);
+		if (it == decompressedResources.end())
+		{
+			DecompressedResource decompressed{};
+			decompressed.data.Resize(entry->uncompressedSize);
+
+			if (!Decompress(entry->data, entry->dataSize, decompressed.data.GetData(), entry->uncompressedSize))
+			{
+				CE_LOG(Error, All, "Failed to decompress resource: {}", path);
+				return false;
+			}
+
+			cacheSize += entry->uncompressedSize;
+			decompressedResources[entry->data] = std::move(decompressed);
+			it = decompressedResources.Find(entry->data);
+		}
+
+		DecompressedResource& decompressed = it->second;
+		decompressed.lastAccess = ++accessCounter;
+		if (pin)
+		{
+			decompressed.pinCount++;
+		}
+
+		outData = decompressed.data.GetData();
+		outDataSize = (u32)decompressed.data.GetSize();
+
+		EvictCache(entry->data);
+		return true;
+	}
+
+	void ResourceManager::EvictCache(const u8* keepEntry)
+	{
+		while (cacheSize > cacheBudget)
+		{
+			const u8* oldestEntry = nullptr;
+			u64 oldestAccess = 0;
+
+			for (const auto& [compressedData, decompressed] : decompressedResources)
+			{
+				if (decompressed.pinCount > 0 || compressedData == keepEntry)
+					continue;
+
+				if (oldestEntry == nullptr || decompressed.lastAccess < oldestAccess)
+				{
+					oldestEntry = compressedData;
+					oldestAccess = decompressed.lastAccess;
+				}
+			}
+
+			if (oldestEntry == nullptr)
+				break;
+
+			cacheSize -= decompressedResources[oldestEntry].data.GetSize();
+			decompressedResources.Remove(oldestEntry);
+		}
 	}
 
 } // namespace CE
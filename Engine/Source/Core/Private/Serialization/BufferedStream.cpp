@@ -0,0 +1,406 @@
+#include "CoreMinimal.h"
+
+namespace CE
+{
+    BufferedStream::BufferedStream(Stream* stream, u32 bufferSize)
+        : stream(stream)
+        , bufferSize(Math::Max<u32>(bufferSize, 64))
+    {
+        ASSERT(stream != nullptr, "BufferedStream constructed with a NULL stream!");
+
+        buffer = (u8*)Memory::Malloc(this->bufferSize);
+
+        isBinaryMode = stream->IsBinaryMode();
+        bufferStart = stream->GetCurrentPosition();
+
+        if (stream->IsOpen() && stream->CanRead())
+        {
+            streamLength = stream->GetLength();
+        }
+    }
+
+    BufferedStream::~BufferedStream()
+    {
+        Flush();
+
+        Memory::Free(buffer);
+        buffer = nullptr;
+    }
+
+#define BUFFERED_STREAM_PRIMITIVE(Type)\
+    Stream& BufferedStream::operator<<(Type value)\
+    {\
+        if (!IsBinaryMode())\
+            return Stream::operator<<(value);\
+        WritePrimitive(value);\
+        return *this;\
+    }\
+    Stream& BufferedStream::operator>>(Type& value)\
+    {\
+        if (!IsBinaryMode())\
+            return Stream::operator>>(value);\
+        ReadPrimitive(value);\
+        return *this;\
+    }
+
+    BUFFERED_STREAM_PRIMITIVE(u8)
+    BUFFERED_STREAM_PRIMITIVE(u16)
+    BUFFERED_STREAM_PRIMITIVE(u32)
+    BUFFERED_STREAM_PRIMITIVE(u64)
+    BUFFERED_STREAM_PRIMITIVE(s8)
+    BUFFERED_STREAM_PRIMITIVE(s16)
+    BUFFERED_STREAM_PRIMITIVE(s32)
+    BUFFERED_STREAM_PRIMITIVE(s64)
+    BUFFERED_STREAM_PRIMITIVE(f32)
+    BUFFERED_STREAM_PRIMITIVE(f64)
+
+#undef BUFFERED_STREAM_PRIMITIVE
+
+    Stream& BufferedStream::operator<<(bool boolean)
+    {
+        if (!IsBinaryMode())
+            return Stream::operator<<(boolean);
+
+        WritePrimitive<u8>(boolean ? 1 : 0);
+        return *this;
+    }
+
+    Stream& BufferedStream::operator>>(bool& boolean)
+    {
+        if (!IsBinaryMode())
+            return Stream::operator>>(boolean);
+
+        u8 value = 0;
+        ReadPrimitive(value);
+        boolean = (value > 0);
+        return *this;
+    }
+
+    Stream& BufferedStream::operator<<(const String& string)
+    {
+        if (!IsBinaryMode())
+            return Stream::operator<<(string);
+
+        Write(string.GetCString(), string.GetLength());
+        WritePrimitive<u8>(0); // null terminator
+        return *this;
+    }
+
+    Stream& BufferedStream::operator>>(String& string)
+    {
+        if (!IsBinaryMode())
+            return Stream::operator>>(string);
+
+        if (isWriting || bufferCursor >= bufferLength)
+        {
+            Refill();
+        }
+
+        // Fast path: the whole string, including the null terminator, is already in the buffer
+        const u8* start = buffer + bufferCursor;
+        const u8* terminator = (const u8*)memchr(start, 0, bufferLength - bufferCursor);
+
+        if (terminator != nullptr)
+        {
+            u32 length = (u32)(terminator - start);
+            string.Reserve(length + 1);
+            memcpy(string.GetCString(), start, length);
+            string.GetCString()[length] = 0;
+            string.UpdateLength();
+
+            bufferCursor += length + 1;
+            return *this;
+        }
+
+        // Slow path: the string continues past the end of the buffer
+        stringScratch.Clear();
+
+        while (true)
+        {
+            start = buffer + bufferCursor;
+            u32 available = bufferLength - bufferCursor;
+            terminator = (const u8*)memchr(start, 0, available);
+
+            u32 count = terminator != nullptr ? (u32)(terminator - start) : available;
+            u32 offset = stringScratch.GetSize();
+            stringScratch.Resize(offset + count);
+            memcpy(stringScratch.GetData() + offset, start, count);
+
+            if (terminator != nullptr)
+            {
+                bufferCursor += count + 1;
+                break;
+            }
+
+            bufferCursor += count;
+
+            if (Refill() == 0) // Reached the end without a null terminator
+                break;
+        }
+
+        stringScratch.Add(0);
+        string.Reserve(stringScratch.GetSize());
+        memcpy(string.GetCString(), stringScratch.GetData(), stringScratch.GetSize());
+        string.UpdateLength();
+
+        return *this;
+    }
+
+    void BufferedStream::Write(const void* inData, u64 length)
+    {
+        if (isWriting && bufferCursor + length <= bufferSize)
+        {
+            memcpy(buffer + bufferCursor, inData, length);
+            bufferCursor += (u32)length;
+            return;
+        }
+
+        WriteSlow(inData, length);
+    }
+
+    s64 BufferedStream::Read(void* outData, u64 length)
+    {
+        if (!isWriting && bufferCursor + length <= bufferLength)
+        {
+            memcpy(outData, buffer + bufferCursor, length);
+            bufferCursor += (u32)length;
+            return (s64)length;
+        }
+
+        u64 startPosition = GetCurrentPosition();
+        ReadSlow(outData, length);
+
+        if (startPosition >= streamLength)
+            return 0;
+        return (s64)Math::Min(length, streamLength - startPosition);
+    }
+
+    void BufferedStream::ReadSlow(void* outData, u64 length)
+    {
+        if (isWriting)
+        {
+            Flush();
+        }
+
+        u8* dst = (u8*)outData;
+
+        // 1. Drain whatever is left in the buffer
+        u32 available = bufferLength - bufferCursor;
+        u32 count = (u32)Math::Min<u64>(available, length);
+
+        memcpy(dst, buffer + bufferCursor, count);
+        bufferCursor += count;
+        dst += count;
+        length -= count;
+
+        if (length == 0)
+            return;
+
+        u64 position = GetCurrentPosition();
+        u64 readable = position < streamLength ? Math::Min(length, streamLength - position) : 0;
+
+        if (readable >= bufferSize)
+        {
+            // 2. Large reads (ex: binary blobs) bypass the buffer
+            stream->Seek((s64)position, SeekMode::Begin);
+            stream->Read(dst, readable);
+
+            dst += readable;
+            length -= readable;
+
+            bufferStart = position + readable;
+            bufferCursor = bufferLength = 0;
+        }
+        else if (readable > 0)
+        {
+            // 3. Small reads refill the buffer
+            Refill();
+
+            count = (u32)Math::Min<u64>(bufferLength, length);
+            memcpy(dst, buffer, count);
+            bufferCursor = count;
+
+            dst += count;
+            length -= count;
+        }
+
+        if (length > 0)
+        {
+            // Reading past the end: zero the rest and advance anyway, like FileStream does
+            memset(dst, 0, length);
+
+            bufferStart = GetCurrentPosition() + length;
+            bufferCursor = bufferLength = 0;
+        }
+    }
+
+    void BufferedStream::WriteSlow(const void* inData, u64 length)
+    {
+        if (!isWriting)
+        {
+            // Discard the read buffer, and start writing at the current position
+            bufferStart = GetCurrentPosition();
+            bufferCursor = bufferLength = 0;
+            isWriting = true;
+        }
+
+        if (bufferCursor + length > bufferSize)
+        {
+            Flush();
+            isWriting = true;
+        }
+
+        if (length >= bufferSize)
+        {
+            // Large writes go directly to the wrapped stream
+            stream->Seek((s64)bufferStart, SeekMode::Begin);
+            stream->Write(inData, length);
+
+            bufferStart += length;
+            streamLength = Math::Max(streamLength, bufferStart);
+            return;
+        }
+
+        memcpy(buffer + bufferCursor, inData, length);
+        bufferCursor += (u32)length;
+    }
+
+    u32 BufferedStream::Refill()
+    {
+        if (isWriting)
+        {
+            Flush();
+        }
+
+        bufferStart = GetCurrentPosition();
+        bufferCursor = 0;
+        bufferLength = 0;
+
+        if (bufferStart >= streamLength)
+            return 0;
+
+        u32 count = (u32)Math::Min<u64>(bufferSize, streamLength - bufferStart);
+
+        stream->Seek((s64)bufferStart, SeekMode::Begin);
+        stream->Read(buffer, count);
+
+        bufferLength = count;
+        return count;
+    }
+
+    void BufferedStream::Flush()
+    {
+        if (!isWriting)
+            return;
+
+        if (bufferCursor > 0)
+        {
+            stream->Seek((s64)bufferStart, SeekMode::Begin);
+            stream->Write(buffer, bufferCursor);
+
+            bufferStart += bufferCursor;
+            streamLength = Math::Max(streamLength, bufferStart);
+        }
+
+        bufferCursor = 0;
+        bufferLength = 0;
+        isWriting = false;
+    }
+
+    void BufferedStream::Seek(s64 seekPos, SeekMode seekMode)
+    {
+        u64 target = 0;
+
+        switch (seekMode)
+        {
+        case SeekMode::Begin: target = (u64)seekPos; break;
+        case SeekMode::Current: target = (u64)((s64)GetCurrentPosition() + seekPos); break;
+        case SeekMode::End:
+            // End-relative semantics are defined by the wrapped stream
+            Flush();
+            stream->Seek(seekPos, SeekMode::End);
+            target = stream->GetCurrentPosition();
+            break;
+        }
+
+        if (!isWriting && target >= bufferStart && target <= bufferStart + bufferLength)
+        {
+            // Seeking inside the read buffer doesn't touch the wrapped stream
+            bufferCursor = (u32)(target - bufferStart);
+            return;
+        }
+
+        Flush();
+
+        bufferStart = target;
+        bufferCursor = bufferLength = 0;
+    }
+
+    bool BufferedStream::IsOutOfBounds()
+    {
+        if (isWriting)
+        {
+            // Writes grow the wrapped stream, unless it has a hard size limit
+            if (!stream->HasHardSizeLimit() || stream->CanResize())
+                return false;
+
+            return GetCurrentPosition() >= stream->GetCapacity();
+        }
+
+        return GetCurrentPosition() >= streamLength;
+    }
+
+    void BufferedStream::SetOutOfBounds()
+    {
+        Flush();
+
+        bufferStart = streamLength;
+        bufferCursor = bufferLength = 0;
+    }
+
+    bool BufferedStream::IsOpen()
+    {
+        return stream->IsOpen();
+    }
+
+    void BufferedStream::Close()
+    {
+        Flush();
+        stream->Close();
+    }
+
+    bool BufferedStream::CanRead()
+    {
+        return stream->CanRead();
+    }
+
+    bool BufferedStream::CanWrite()
+    {
+        return stream->CanWrite();
+    }
+
+    u64 BufferedStream::GetLength()
+    {
+        Flush();
+
+        streamLength = stream->GetLength();
+        return streamLength;
+    }
+
+    u64 BufferedStream::GetCapacity()
+    {
+        return stream->GetCapacity();
+    }
+
+    bool BufferedStream::HasHardSizeLimit()
+    {
+        return stream->HasHardSizeLimit();
+    }
+
+    void BufferedStream::SetBinaryMode(bool setBinaryMode)
+    {
+        Stream::SetBinaryMode(setBinaryMode);
+        stream->SetBinaryMode(setBinaryMode);
+    }
+
+} // namespace CE
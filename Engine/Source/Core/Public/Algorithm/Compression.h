@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Types/CoreTypeDefs.h"
+
+namespace CE
+{
+	//! @brief Maximum size of the data produced by Compress() for srcSize bytes of input.
+	CORE_API SIZE_T GetCompressBound(SIZE_T srcSize);
+
+	//! @brief Compresses data in the zlib format (miniz). Use a high level for offline tools: decompression speed
+	//! doesn't depend on it.
+	//! @param level 0 (no compression) to 10 (best compression).
+	//! @return The compressed size, or 0 if it doesn't fit in dstCapacity.
+	CORE_API SIZE_T Compress(const void* src, SIZE_T srcSize, void* dst, SIZE_T dstCapacity, int level = 6);
+
+	//! @brief Decompresses data produced by Compress(). dstSize must be the exact uncompressed size.
+	//! @return False if the compressed data is corrupt, or doesn't decompress to exactly dstSize bytes.
+	CORE_API bool Decompress(const void* src, SIZE_T srcSize, void* dst, SIZE_T dstSize);
+
+} // namespace CE
@@ -772,6 +772,12 @@ namespace CE
         {
             Super::Impl.erase(Super::Impl.begin() + index);
         }
+
+        //! @brief Removes `count` elements starting at `index`.
+        CE_INLINE void RemoveRange(SIZE_T index, SIZE_T count)
+        {
+            Super::Impl.erase(Super::Impl.begin() + index, Super::Impl.begin() + index + count);
+        }
         
         CE_INLINE void Clear()
         {
@@ -0,0 +1,132 @@
+#pragma once
+
+namespace CE
+{
+
+    /// @brief Binary indexed tree (Fenwick tree) over a list of non-negative values.
+    /// Provides O(log N) point updates, prefix sums and lookup of the element containing a given offset.
+    /// Useful for virtualized lists where each row has a variable height.
+    template<typename T>
+    class FenwickTree
+    {
+    public:
+
+        FenwickTree() = default;
+
+        inline u32 GetSize() const { return (u32)values.GetSize(); }
+
+        inline bool IsEmpty() const { return values.IsEmpty(); }
+
+        inline void Clear()
+        {
+            values.Clear();
+            tree.Clear();
+        }
+
+        /// @brief Rebuilds the tree from the given values in O(N).
+        void Build(const Array<T>& newValues)
+        {
+            values = newValues;
+            Rebuild();
+        }
+
+        /// @brief Rebuilds the tree in O(N) from the values already stored.
+        void Rebuild()
+        {
+            const u32 count = (u32)values.GetSize();
+            tree.Resize(count + 1);
+            tree[0] = T();
+
+            for (u32 i = 1; i <= count; i++)
+            {
+                tree[i] = values[i - 1];
+            }
+
+            for (u32 i = 1; i <= count; i++)
+            {
+                u32 parent = i + (i & (~i + 1));
+                if (parent <= count)
+                {
+                    tree[parent] += tree[i];
+                }
+            }
+        }
+
+        /// @brief Inserts values before the given index. Costs O(N), because the tree has to be rebuilt.
+        void InsertRange(u32 index, const Array<T>& newValues)
+        {
+            values.InsertRange(index, newValues);
+            Rebuild();
+        }
+
+        /// @brief Removes the values in range [index, index + count). Costs O(N), because the tree has to be rebuilt.
+        void RemoveRange(u32 index, u32 count)
+        {
+            values.RemoveRange(index, count);
+            Rebuild();
+        }
+
+        inline const T& Get(u32 index) const { return values[index]; }
+
+        void Set(u32 index, const T& value)
+        {
+            T delta = value - values[index];
+            values[index] = value;
+
+            for (u32 i = index + 1; i < (u32)tree.GetSize(); i += (i & (~i + 1)))
+            {
+                tree[i] += delta;
+            }
+        }
+
+        /// @brief Returns the sum of the first `count` values.
+        T GetPrefixSum(u32 count) const
+        {
+            T sum = T();
+            if (count > GetSize())
+                count = GetSize();
+
+            for (u32 i = count; i > 0; i -= (i & (~i + 1)))
+            {
+                sum += tree[i];
+            }
+
+            return sum;
+        }
+
+        inline T GetTotal() const { return GetPrefixSum(GetSize()); }
+
+        /// @brief Returns the index of the element that contains the given offset, i.e. the largest index
+        /// for which GetPrefixSum(index) <= offset. Returns GetSize() if the offset is past the total.
+        u32 FindIndex(T offset) const
+        {
+            const u32 count = (u32)values.GetSize();
+            u32 pos = 0;
+            u32 bitMask = 1;
+
+            while ((bitMask << 1) <= count)
+            {
+                bitMask <<= 1;
+            }
+
+            for (; bitMask > 0; bitMask >>= 1)
+            {
+                u32 next = pos + bitMask;
+                if (next <= count && tree[next] <= offset)
+                {
+                    pos = next;
+                    offset -= tree[next];
+                }
+            }
+
+            return pos;
+        }
+
+    private:
+
+        Array<T> values{};
+        /// 1-based tree storage
+        Array<T> tree{};
+    };
+
+} // namespace CE
@@ -90,6 +90,11 @@ namespace CE
             return Impl.find(key);
 		}
 
+        inline auto Find(const KeyType& key) const
+        {
+            return Impl.find(key);
+        }
+
         inline auto Begin()
         {
             return Impl.begin();
@@ -12,6 +12,7 @@
 #include "Containers/HashSet.h"
 #include "Containers/Queue.h"
 #include "Containers/StableDynamicArray.h"
+#include "Containers/FenwickTree.h"
 
 #include "Types/Name.h"
 #include "Types/DateTime.h"
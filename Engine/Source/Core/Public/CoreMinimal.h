@@ -19,11 +19,14 @@
 #include "Misc/Defer.h"
 #include "Misc/Random.h"
 #include "Misc/Platform.h"
+#include "Algorithm/Compression.h"
 #include "Memory/Memory.h"
 #include "Memory/IAllocator.h"
 #include "Memory/SystemAllocator.h"
 #include "Memory/FixedSizeAllocator.h"
+#include "Memory/ArenaAllocator.h"
 #include "Logger/Logger.h"
+#include "Logger/AsyncLog.h"
 #include "PAL/Common/PlatformMisc.h"
 #include "PAL/Common/PlatformDirectories.h"
 #include "PAL/Common/PlatformProcess.h"
@@ -60,6 +63,7 @@
 #include "Threading/Thread.h"
 #include "Threading/ThreadLocalContext.h"
 #include "Threading/Async.h"
+#include "IO/AsyncIO.h"
 
 // ******************************************************
 // Math
@@ -78,6 +82,7 @@
 #include "Jobs/WorkQueue.h"
 #include "Jobs/WorkThread.h"
 #include "Jobs/JobManager.h"
+#include "Jobs/ParallelFor.h"
 
 // Config INI
 #include "Config/ConfigTypes.h"
@@ -91,6 +96,7 @@
 #include "Serialization/Stream.h"
 #include "Serialization/MemoryStream.h"
 #include "Serialization/FileStream.h"
+#include "Serialization/BufferedStream.h"
 #include "Serialization/ArchiveStream.h"
 
 // Json
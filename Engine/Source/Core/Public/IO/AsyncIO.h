@@ -0,0 +1,200 @@
+#pragma once
+
+#include <deque>
+
+namespace CE
+{
+    class LinuxIoUring;
+}
+
+namespace CE::IO
+{
+    class AsyncIO;
+    class AsyncReadRequest;
+
+    enum class AsyncIOPriority : u8
+    {
+        Low = 0,
+        Normal,
+        High,
+        //! @brief For reads that a thread is blocked on right now, ex: a synchronous Bundle load.
+        Critical,
+        COUNT
+    };
+
+    enum class AsyncIOStatus : u8
+    {
+        Pending = 0,
+        InProgress,
+        Completed,
+        Failed,
+        Cancelled
+    };
+
+    struct AsyncReadArgs
+    {
+        IO::Path path{};
+
+        //! @brief Offset in the file to start reading from.
+        u64 offset = 0;
+
+        //! @brief Number of bytes to read. Set it to 0 to read till the end of the file.
+        //! Reads are clamped to the end of the file.
+        u64 size = 0;
+
+        AsyncIOPriority priority = AsyncIOPriority::Normal;
+
+        //! @brief Optional buffer to read into, which should stay alive till the request is done.
+        //! If it is null, the request allocates and owns the buffer.
+        void* destination = nullptr;
+
+        //! @brief Called on an IO thread (or the cancelling thread) once the request is done.
+        Delegate<void(AsyncReadRequest*)> onComplete{};
+    };
+
+    class CORE_API AsyncReadRequest final : public IntrusiveBase
+    {
+    public:
+
+        ~AsyncReadRequest();
+
+        AsyncIOStatus GetStatus() const { return status.load(std::memory_order_acquire); }
+
+        bool IsDone() const
+        {
+            AsyncIOStatus curStatus = GetStatus();
+            return curStatus != AsyncIOStatus::Pending && curStatus != AsyncIOStatus::InProgress;
+        }
+
+        bool Succeeded() const { return GetStatus() == AsyncIOStatus::Completed; }
+
+        //! @brief Blocks the calling thread till the request is done.
+        //! @return True if the request succeeded.
+        bool Wait() const;
+
+        //! @brief Cancels the request if no IO thread has picked it up yet.
+        //! @return False if the request is already in progress or done.
+        bool Cancel();
+
+        //! @brief The data that was read. Only valid once the request has succeeded.
+        u8* GetData() const { return buffer; }
+
+        //! @brief Number of bytes that were read.
+        u64 GetSize() const { return bytesRead; }
+
+        const IO::Path& GetPath() const { return path; }
+
+        AsyncIOPriority GetPriority() const { return priority; }
+
+    private:
+
+        AsyncReadRequest(AsyncIO* owner, const AsyncReadArgs& args);
+
+        //! @brief Clamps the read to the file size, and sets up the buffer to read into.
+        bool PrepareBuffer(u64 fileSize);
+
+        IO::Path path{};
+        u64 offset = 0;
+        u64 size = 0;
+        AsyncIOPriority priority = AsyncIOPriority::Normal;
+        void* destination = nullptr;
+        Delegate<void(AsyncReadRequest*)> onComplete{};
+
+        AsyncIO* owner = nullptr;
+
+        mutable Atomic<AsyncIOStatus> status = AsyncIOStatus::Pending;
+
+        u8* buffer = nullptr;
+        bool ownsBuffer = false;
+        u64 bytesRead = 0;
+
+        friend class AsyncIO;
+    };
+
+    /*
+     *  Asynchronous file reads, used for streaming assets.
+     *  On Linux, reads are submitted in batches to an io_uring from a single IO thread. Everywhere else (or when
+     *  io_uring is not available, ex: blocked by a container's seccomp profile), a small pool of threads does blocking reads.
+     *  Requests are always picked up in priority order.
+     */
+    class CORE_API AsyncIO final
+    {
+    public:
+
+        static constexpr u32 IoUringQueueDepth = 64;
+
+        struct Statistics
+        {
+            u64 requestsCompleted = 0;
+            u64 requestsFailed = 0;
+            u64 requestsCancelled = 0;
+            u64 bytesRead = 0;
+        };
+
+        static AsyncIO& Get();
+
+        AsyncIO();
+        ~AsyncIO();
+
+        AsyncIO(const AsyncIO&) = delete;
+        AsyncIO& operator=(const AsyncIO&) = delete;
+
+        //! @brief Starts the IO threads. It is called automatically by the first request.
+        //! @param numThreads Number of threads used by the thread pool fallback. Set it to 0 to pick automatically.
+        //! @param allowIoUring Set it to false to always use the thread pool.
+        void Initialize(u32 numThreads = 0, bool allowIoUring = true);
+
+        //! @brief Waits for the reads that are in progress, and cancels all the pending ones.
+        void Shutdown();
+
+        bool IsInitialized() const { return isRunning.load(std::memory_order_acquire); }
+
+        bool IsUsingIoUring() const { return ioUring != nullptr; }
+
+        Ptr<AsyncReadRequest> Read(const AsyncReadArgs& args);
+
+        //! @brief Queues all the reads at once, so they can be submitted to the kernel together.
+        Array<Ptr<AsyncReadRequest>> ReadBatch(const Array<AsyncReadArgs>& batch);
+
+        //! @brief Reads a whole file on an IO thread, and blocks till it is done.
+        static bool ReadFile(const IO::Path& path, Array<u8>& outData, AsyncIOPriority priority = AsyncIOPriority::Critical);
+
+        Statistics GetStatistics() const;
+
+        void ResetStatistics();
+
+    private:
+
+        //! @brief Returns the pending request with the highest priority, and marks it as in progress.
+        //! @param wait If true, blocks till a request is queued or the service is shut down.
+        Ptr<AsyncReadRequest> PopRequest(bool wait);
+
+        void FinishRequest(AsyncReadRequest* request, AsyncIOStatus finalStatus);
+
+        void ThreadPoolLoop();
+
+        void ReadBlocking(AsyncReadRequest* request);
+
+#if PLATFORM_LINUX
+        void IoUringLoop();
+#endif
+
+        Mutex lifecycleMutex{};
+        Atomic<bool> isRunning = false;
+
+        Mutex queueMutex{};
+        std::condition_variable_any queueCondition{};
+        std::deque<Ptr<AsyncReadRequest>> queues[(int)AsyncIOPriority::COUNT]{};
+
+        Array<Thread*> threads{};
+        LinuxIoUring* ioUring = nullptr;
+
+        Atomic<u64> requestsCompleted = 0;
+        Atomic<u64> requestsFailed = 0;
+        Atomic<u64> requestsCancelled = 0;
+        Atomic<u64> bytesRead = 0;
+
+        friend class AsyncReadRequest;
+    };
+
+} // namespace CE::IO
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Containers/String.h"
+#include "Logger/AsyncLog.h"
 
 #include <filesystem>
 #include <fstream>
@@ -218,6 +219,11 @@ template <> struct fmt::formatter<CE::IO::Path> {
 
 namespace CE
 {
+    namespace Internal
+    {
+        template<> struct TLogArgument<IO::Path> { static constexpr bool IsDeferrable = true; using StorageType = IO::Path; };
+    }
+
     template<>
     inline SIZE_T GetHash<IO::Path>(const IO::Path& value)
     {
@@ -0,0 +1,66 @@
+#pragma once
+
+namespace CE
+{
+
+	/// @brief Runs task(index) for every index in [0, count) using the workers of the global job context.
+	/// The calling thread takes part in the work and never waits on jobs that haven't started yet, so it is
+	/// safe to call from inside a job, even when every worker is busy. Runs serially if there is no job context.
+	template<typename TFunc>
+	void ParallelFor(u32 count, const TFunc& task)
+	{
+		JobContext* jobContext = JobContext::GetGlobalContext();
+		int numHelpers = 0;
+		if (jobContext != nullptr && jobContext->GetJobManager() != nullptr)
+		{
+			numHelpers = jobContext->GetJobManager()->GetNumThreads();
+		}
+		numHelpers = numHelpers < (int)count - 1 ? numHelpers : (int)count - 1;
+
+		if (numHelpers <= 0)
+		{
+			for (u32 i = 0; i < count; i++)
+			{
+				task(i);
+			}
+			return;
+		}
+
+		struct SharedState
+		{
+			std::atomic<u32> next = 0;
+			std::atomic<u32> active = 0;
+		};
+
+		// Jobs may start after this function returns, so they must not reference its stack
+		std::shared_ptr<SharedState> state = std::make_shared<SharedState>();
+
+		auto work = [state, count, &task](Job*)
+			{
+				state->active.fetch_add(1, std::memory_order_acq_rel);
+
+				u32 index;
+				while ((index = state->next.fetch_add(1, std::memory_order_acq_rel)) < count)
+				{
+					task(index);
+				}
+
+				state->active.fetch_sub(1, std::memory_order_acq_rel);
+			};
+
+		for (int i = 0; i < numHelpers; i++)
+		{
+			Job* job = new JobFunction(work, true, jobContext);
+			job->Start();
+		}
+
+		work(nullptr);
+
+		// Helpers that start after this point find no work left and never touch the task
+		while (state->active.load(std::memory_order_acquire) != 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+} // namespace CE
@@ -2,5 +2,7 @@
 
 #include "JsonTypes.h"
 #include "JsonReader.h"
+#include "JsonStructuralIndex.h"
+#include "JsonDocument.h"
 #include "JsonWriter.h"
 #include "JsonSerializer.h"
@@ -0,0 +1,170 @@
+#pragma once
+
+namespace CE
+{
+    class Stream;
+    struct JsonMember;
+
+    /// @brief Object key interned by a JsonDocument. Equal keys within a document share the same JsonKey.
+    struct JsonKey
+    {
+        const char* data = nullptr;
+        u32 length = 0;
+        SIZE_T hash = 0;
+
+        String ToString() const { return String(StringView(data, length)); }
+    };
+
+    /// @brief Read-only json value stored in a JsonDocument's arena. Strings are null terminated.
+    struct CORE_API JsonNode
+    {
+        JsonNode() : number(0)
+        {}
+
+        FORCE_INLINE JsonValueType GetValueType() const { return type; }
+
+        FORCE_INLINE bool IsArrayValue() const { return type == JsonValueType::Array; }
+        FORCE_INLINE bool IsObjectValue() const { return type == JsonValueType::Object; }
+        FORCE_INLINE bool IsStringValue() const { return type == JsonValueType::String; }
+        FORCE_INLINE bool IsNumberValue() const { return type == JsonValueType::Number; }
+        FORCE_INLINE bool IsBoolValue() const { return type == JsonValueType::Boolean; }
+        FORCE_INLINE bool IsNullValue() const { return type == JsonValueType::Null; }
+
+        FORCE_INLINE bool IsContainerType() const { return IsArrayValue() || IsObjectValue(); }
+
+        FORCE_INLINE f64 GetNumberValue() const { return number; }
+        FORCE_INLINE bool GetBoolValue() const { return boolean; }
+
+        FORCE_INLINE const char* GetCString() const { return IsStringValue() ? string : ""; }
+        FORCE_INLINE u32 GetStringLength() const { return IsStringValue() ? size : 0; }
+
+        //! @brief Returns number of elements in an array, or members in an object.
+        FORCE_INLINE u32 GetSize() const { return IsContainerType() ? size : 0; }
+
+        FORCE_INLINE const JsonNode& operator[](u32 index) const { return elements[index]; }
+
+        const JsonMember& GetMember(u32 index) const;
+
+        //! @brief Returns the value of the given key, or nullptr if this is not an object or the key doesn't exist.
+        const JsonNode* Find(const char* key, u32 length) const;
+
+        const JsonNode* Find(const String& key) const
+        {
+            return Find(key.GetCString(), key.GetLength());
+        }
+
+        FORCE_INLINE bool KeyExists(const String& key) const { return Find(key) != nullptr; }
+
+        //! @brief Converts this value and all its children to a heap allocated JValue.
+        void ToJValue(JValue& out) const;
+
+    private:
+
+        JsonValueType type = JsonValueType::Null;
+
+        //! String length or element/member count.
+        u32 size = 0;
+
+        union
+        {
+            f64 number;
+            bool boolean;
+            const char* string;
+            JsonNode* elements;
+            JsonMember* members;
+        };
+
+        friend class JsonDocument;
+    };
+
+    struct JsonMember
+    {
+        const JsonKey* key = nullptr;
+        JsonNode value{};
+    };
+
+    /// @brief Immutable json DOM. All nodes, strings and interned keys live in a single arena that is released
+    /// when the document is destroyed or cleared, so parsing does not allocate per value.
+    /// Parsing runs in two stages: JsonStructuralIndexer finds all structural characters using SIMD, then the
+    /// tree is built by walking the structural index. Comments are not supported.
+    class CORE_API JsonDocument final
+    {
+    public:
+
+        JsonDocument();
+        ~JsonDocument();
+
+        JsonDocument(const JsonDocument&) = delete;
+        JsonDocument& operator=(const JsonDocument&) = delete;
+
+        bool Parse(const char* json, SIZE_T length);
+
+        bool Parse(const String& json)
+        {
+            return Parse(json.GetCString(), json.GetLength());
+        }
+
+        //! @brief Parses the remaining contents of the stream.
+        bool Parse(Stream* stream);
+
+        void Clear();
+
+        FORCE_INLINE const JsonNode& GetRoot() const { return root; }
+
+        FORCE_INLINE JsonParseError GetError() const { return parseError; }
+
+        FORCE_INLINE const String& GetErrorMessage() const { return errorMessage; }
+
+        //! @brief Number of unique object keys in the document.
+        FORCE_INLINE u32 GetKeyCount() const { return keyCount; }
+
+        //! @brief Number of bytes reserved by the arena.
+        FORCE_INLINE SIZE_T GetMemoryUsage() const { return arena.GetTotalReserved(); }
+
+        //! @brief Number of bytes of input consumed by the last successful Parse() call.
+        FORCE_INLINE SIZE_T GetParsedLength() const { return parsedLength; }
+
+        static constexpr int MaxDepth = 1024;
+
+    private:
+
+        bool ParseValue(JsonNode& out, int depth);
+
+        bool ParseObject(JsonNode& out, int depth);
+
+        bool ParseArray(JsonNode& out, int depth);
+
+        bool ParseStringToken(u32 position, const char*& outBegin, u32& outLength, bool& outHasEscapes);
+
+        bool ParseScalar(u32 position, JsonNode& out);
+
+        const JsonKey* InternKey(const char* data, u32 length);
+
+        void GrowKeyTable();
+
+        char PeekStructural() const;
+
+        bool SetError(JsonParseError error, const String& message);
+
+        ArenaAllocator arena;
+        JsonNode root{};
+
+        // Parse state
+        const char* input = nullptr;
+        SIZE_T inputLength = 0;
+        SIZE_T parsedLength = 0;
+        u32 cursor = 0;
+        Array<u32> structurals{};
+        Array<JsonNode> elementStack{};
+        Array<JsonMember> memberStack{};
+        Array<char> scratch{};
+
+        // Open addressing hash table of interned keys
+        Array<JsonKey*> keyTable{};
+        u32 keyCount = 0;
+
+        JsonParseError parseError = JsonParseError::None;
+        String errorMessage = "";
+    };
+
+} // namespace CE
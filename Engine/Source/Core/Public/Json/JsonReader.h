@@ -15,6 +15,9 @@ namespace CE
         OutOfBounds,
         InvalidObject,
         InvalidArray,
+        UnexpectedToken,
+        CommentNotSupported,
+        DepthLimitExceeded,
     };
 
     class CORE_API JsonReader
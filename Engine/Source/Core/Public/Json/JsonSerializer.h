@@ -85,6 +85,9 @@ namespace CE
         
     private:
 
+		//! @brief Character-by-character fallback used when JsonDocument cannot parse the input, e.g. due to comments.
+		static bool DeserializeWithReader(Stream* stream, JValue& out);
+
         template<typename WritePolicy = JsonPrettyPrintPolicy>
         static void SerializeInternal(JsonWriter<WritePolicy>& writer, const JsonValue* parent)
         {
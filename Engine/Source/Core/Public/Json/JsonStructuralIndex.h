@@ -0,0 +1,23 @@
+#pragma once
+
+namespace CE
+{
+
+    /// @brief First stage of the JsonDocument parser.
+    /// Scans the input 64 bytes at a time (using SSE2/NEON where available) and records the offsets of
+    /// every structural character ({ } [ ] : ,), every unescaped quote and the first character of every
+    /// number/keyword that lies outside of a string.
+    class CORE_API JsonStructuralIndexer
+    {
+    public:
+        CE_STATIC_CLASS(JsonStructuralIndexer);
+
+        /// @brief Builds the structural index of the given json text.
+        /// @return JsonParseError::CommentNotSupported if the input contains comments outside of strings,
+        /// JsonParseError::InvalidString if a string is not terminated. JsonParseError::None on success.
+        static JsonParseError Build(const char* json, SIZE_T length, Array<u32>& outIndices);
+
+        static bool IsSimdAccelerated();
+    };
+
+} // namespace CE
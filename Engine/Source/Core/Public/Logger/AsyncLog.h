@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Logger/Logger.h"
+#include "Containers/String.h"
+#include "Containers/StringView.h"
+#include "Types/Name.h"
+
+#include <cstring>
+#include <exception>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+namespace CE::Internal
+{
+    /// Decides whether a CE_LOG argument can be copied into the async log buffer & formatted later on the log thread,
+    /// and the type it is stored as. Pointers and references to objects that may not outlive the call are never deferred.
+    template<typename T>
+    struct TLogArgument
+    {
+        static constexpr bool IsDeferrable = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+        using StorageType = T;
+    };
+
+    template<> struct TLogArgument<String> { static constexpr bool IsDeferrable = true; using StorageType = String; };
+    template<> struct TLogArgument<Name> { static constexpr bool IsDeferrable = true; using StorageType = Name; };
+    template<> struct TLogArgument<StringView> { static constexpr bool IsDeferrable = true; using StorageType = String; };
+    template<> struct TLogArgument<const char*> { static constexpr bool IsDeferrable = true; using StorageType = String; };
+    template<> struct TLogArgument<char*> { static constexpr bool IsDeferrable = true; using StorageType = String; };
+
+    template<typename T>
+    using TLogArgumentOf = TLogArgument<std::decay_t<T>>;
+
+    template<typename ArgsTuple>
+    void FormatLogRecord(LogRecord* record, String* outMessage)
+    {
+        ArgsTuple* arguments = std::launder(reinterpret_cast<ArgsTuple*>(record->arguments));
+
+        if (outMessage != nullptr)
+        {
+            // Runs on the log thread, a bad format string must not take it down
+            try
+            {
+                *outMessage = std::apply([record](const auto&... args)
+                    {
+                        return String::Format(record->format, args...);
+                    }, *arguments);
+            }
+            catch (const std::exception& exception)
+            {
+                *outMessage = String::Format("Invalid log format \"{}\": {}", record->format, exception.what());
+            }
+        }
+
+        arguments->~ArgsTuple();
+    }
+
+    //! @brief Queues the arguments and a copy of the format, so the format doesn't have to outlive the call.
+    template<SIZE_T FormatSize, typename... Args>
+    bool PushAsyncLogRecord(LogLevel level, LogTarget target, const char* fileName, int line, const char (&format)[FormatSize], const Args&... args)
+    {
+        using ArgsTuple = std::tuple<typename TLogArgumentOf<Args>::StorageType...>;
+
+        // +1 for a null terminator, in case the format is a full char buffer rather than a literal
+        static_assert(sizeof(ArgsTuple) + FormatSize + 1 <= LogRecord::MaxArgumentsSize && alignof(ArgsTuple) <= LogRecord::ArgumentAlignment);
+
+        LogRecord* record = Logger::BeginAsyncRecord(level, target, fileName, line);
+        if (record == nullptr) // Dropped
+            return false;
+
+        char* formatCopy = reinterpret_cast<char*>(record->arguments + sizeof(ArgsTuple));
+        memcpy(formatCopy, format, FormatSize);
+        formatCopy[FormatSize] = 0;
+
+        record->format = formatCopy;
+        record->formatFunc = &FormatLogRecord<ArgsTuple>;
+        new(record->arguments) ArgsTuple(typename TLogArgumentOf<Args>::StorageType(args)...);
+
+        Logger::CommitAsyncRecord(record);
+        return true;
+    }
+
+    /// Entry point of CE_LOG. Messages that no sink wants are never formatted. In async mode, a char array format (usually
+    /// a string literal) with deferrable arguments is queued as is, anything else is formatted on the calling thread and
+    /// queued as a single string.
+    template<typename TFormat, typename... Args>
+    void LogFormatted(LogLevel level, LogTarget target, const char* fileName, int line, TFormat&& format, const Args&... args)
+    {
+        if (!Logger::IsLevelEnabled(level, target))
+            return;
+
+        if (level < LogLevel::Critical && Logger::IsAsync())
+        {
+            using FormatType = std::remove_reference_t<TFormat>;
+
+            // The size of a char array is known at compile time, so it can be copied into the record.
+            // A char pointer or a String is formatted right away.
+            constexpr bool isCharArrayFormat = std::is_array_v<FormatType> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<FormatType>>, char>;
+
+            if constexpr (isCharArrayFormat && (TLogArgumentOf<Args>::IsDeferrable && ...))
+            {
+                using ArgsTuple = std::tuple<typename TLogArgumentOf<Args>::StorageType...>;
+
+                if constexpr (sizeof(ArgsTuple) + std::extent_v<FormatType> + 1 <= LogRecord::MaxArgumentsSize && alignof(ArgsTuple) <= LogRecord::ArgumentAlignment)
+                {
+                    // A record that raced with DisableAsync() is logged synchronously below
+                    if (PushAsyncLogRecord(level, target, fileName, line, format, args...) || Logger::IsAsync())
+                        return;
+                }
+            }
+
+            if (PushAsyncLogRecord(level, target, fileName, line, "{}", String::Format(format, args...)) || Logger::IsAsync())
+                return;
+        }
+
+#if CE_BUILD_RELEASE
+        Logger::Log(level, String::Format(format, args...), target);
+#else
+        Logger::Log(level, String::Format(format, args...), fileName, line, target);
+#endif
+    }
+
+} // namespace CE::Internal
@@ -1,7 +1,8 @@
 #pragma once
 
+// Arguments are only formatted if a sink wants the message. See CE::Internal::LogFormatted() for the async mode.
 #if CE_BUILD_RELEASE // Don't show line no. & file name in Release build logs
-#   define CE_LOG(logLevel, target, msg, ...) CE::Logger::Log(CE::LogLevel::logLevel, CE::String::Format(msg, ##__VA_ARGS__), CE::LogTarget::target)
+#   define CE_LOG(logLevel, target, msg, ...) CE::Internal::LogFormatted(CE::LogLevel::logLevel, CE::LogTarget::target, nullptr, 0, msg, ##__VA_ARGS__)
 #else
-#   define CE_LOG(logLevel, target, msg, ...) CE::Logger::Log(CE::LogLevel::logLevel, CE::String::Format(msg, ##__VA_ARGS__), __FILE__, __LINE__, CE::LogTarget::target)
+#   define CE_LOG(logLevel, target, msg, ...) CE::Internal::LogFormatted(CE::LogLevel::logLevel, CE::LogTarget::target, __FILE__, __LINE__, msg, ##__VA_ARGS__)
 #endif
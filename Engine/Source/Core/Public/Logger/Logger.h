@@ -1,6 +1,7 @@
 #pragma once
 
 #include "LogMacros.h"
+#include "Types/CoreTypeDefs.h"
 #include "Misc/CoreDefines.h"
 #include "Misc/EnumClass.h"
 
@@ -35,6 +36,67 @@ namespace CE
 
     ENUM_CLASS_FLAGS(LogTarget);
 
+    //! @brief What a thread does when its async log buffer is full.
+    enum class LogOverflowPolicy
+    {
+        //! @brief Wait for the log thread to make room. Nothing is lost.
+        Block = 0,
+        //! @brief Drop the new message.
+        DropNewest,
+        //! @brief Drop Trace, Debug & Info messages, and wait for room for the others.
+        DropLowPriority,
+    };
+
+    struct AsyncLogSettings
+    {
+        //! @brief Number of messages each logging thread can queue. Rounded up to a power of two.
+        u32 bufferCapacity = 1024;
+
+        LogOverflowPolicy overflowPolicy = LogOverflowPolicy::DropLowPriority;
+    };
+
+    //! @brief Message counts are totals since the process started.
+    struct AsyncLogStatistics
+    {
+        u64 numWritten = 0;
+        u64 numDropped = 0;
+        u32 numThreadBuffers = 0;
+    };
+
+    struct LogRecord;
+
+    namespace Internal
+    {
+        //! @brief Formats the message from the arguments stored in the record (if outMessage isn't null), and destroys them.
+        typedef void (*LogRecordFormatFunc)(LogRecord* record, String* outMessage);
+    }
+
+    /*
+    *   One queued message of the async logger: a copy of the raw arguments followed by a copy of the format string.
+    *   Formatting happens on the log thread.
+    */
+    struct alignas(64) LogRecord
+    {
+        static constexpr SIZE_T Size = 256;
+        static constexpr SIZE_T ArgumentAlignment = 16;
+        static constexpr SIZE_T MaxArgumentsSize = Size - 48;
+
+        Internal::LogRecordFormatFunc formatFunc = nullptr;
+        //! @brief Points into arguments, after the stored arguments.
+        const char* format = nullptr;
+        //! @brief __FILE__ of the CE_LOG call, or null in Release builds.
+        const char* fileName = nullptr;
+        //! @brief system_clock ticks
+        s64 timestamp = 0;
+        LogLevel level = LogLevel::Info;
+        LogTarget target = LogTarget::All;
+        int line = 0;
+
+        alignas(ArgumentAlignment) u8 arguments[MaxArgumentsSize];
+    };
+
+    static_assert(sizeof(LogRecord) == LogRecord::Size);
+
     class CORE_API Logger
     {
     public:
@@ -49,14 +111,37 @@ namespace CE
         static void Log(LogLevel level, StringView message, LogTarget target = LogTarget::All);
         static void Log(LogLevel level, StringView message, const char* fileName, int line, LogTarget target = LogTarget::All);
 
+        //! @brief False if no sink would write the message, so CE_LOG can skip formatting it.
+        static bool IsLevelEnabled(LogLevel level, LogTarget target);
+
+        //! @brief Starts the log thread. From now on, CE_LOG copies the arguments into a lock-free buffer of the calling thread
+        //! and returns, formatting & writing happen on the log thread. Critical messages are still written synchronously.
+        static void EnableAsync(const AsyncLogSettings& settings = {});
+
+        //! @brief Writes all the queued messages and stops the log thread. Threads that log meanwhile fall back to synchronous
+        //! logging, a record that is being queued is waited for.
+        static void DisableAsync();
+
+        static bool IsAsync();
+
+        //! @brief Waits until every message queued before the call is written, then flushes the sinks.
+        static void Flush();
+
+        static AsyncLogStatistics GetAsyncStatistics();
+
+        //! @brief Reserves a record in the calling thread's buffer, and fills in the level, target, source location & timestamp.
+        //! @param fileName Must have static storage, like __FILE__.
+        //! @return Null if the message was dropped by the overflow policy, or if DisableAsync() was called meanwhile.
+        static LogRecord* BeginAsyncRecord(LogLevel level, LogTarget target, const char* fileName, int line);
+
+        //! @brief Publishes the record returned by BeginAsyncRecord() to the log thread.
+        static void CommitAsyncRecord(LogRecord* record);
+
         static std::shared_ptr<spdlog::logger> GetConsoleLogger();
 
         static void AddEditorLogger(spdlog::logger* logger);
         static void RemoveEditorLogger(spdlog::logger* logger);
-        
-    private:
-        
-        
+
     };
 
 } // namespace CE
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Memory.h"
+
+namespace CE
+{
+
+    /// @brief Bump allocator that hands out memory from large blocks and releases all of it at once.
+    /// Individual allocations cannot be freed. Not thread safe.
+    class ArenaAllocator
+    {
+    public:
+
+        static constexpr SIZE_T DefaultBlockSize = 64 * 1024;
+
+        explicit ArenaAllocator(SIZE_T blockSize = DefaultBlockSize) : blockSize(blockSize)
+        {}
+
+        ~ArenaAllocator()
+        {
+            FreeAll();
+        }
+
+        ArenaAllocator(const ArenaAllocator&) = delete;
+        ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+        ArenaAllocator(ArenaAllocator&& move) noexcept
+            : blockSize(move.blockSize), head(move.head), current(move.current), end(move.end)
+            , totalReserved(move.totalReserved), totalAllocated(move.totalAllocated)
+        {
+            move.head = nullptr;
+            move.current = move.end = nullptr;
+            move.totalReserved = move.totalAllocated = 0;
+        }
+
+        void* Allocate(SIZE_T size, SIZE_T alignment = alignof(std::max_align_t))
+        {
+            UintPtr aligned = ((UintPtr)current + alignment - 1) & ~(UintPtr)(alignment - 1);
+
+            if (current == nullptr || aligned + size > (UintPtr)end)
+            {
+                Grow(size + alignment);
+                aligned = ((UintPtr)current + alignment - 1) & ~(UintPtr)(alignment - 1);
+            }
+
+            current = (u8*)(aligned + size);
+            totalAllocated += size;
+            return (void*)aligned;
+        }
+
+        template<typename T>
+        T* AllocateArray(SIZE_T count)
+        {
+            if (count == 0)
+                return nullptr;
+            return (T*)Allocate(sizeof(T) * count, alignof(T));
+        }
+
+        /// @brief Copies the given characters into the arena and null terminates them.
+        char* CopyString(const char* string, SIZE_T length)
+        {
+            char* copy = (char*)Allocate(length + 1, 1);
+            if (length > 0)
+            {
+                memcpy(copy, string, length);
+            }
+            copy[length] = 0;
+            return copy;
+        }
+
+        /// @brief Releases every block owned by the arena.
+        void FreeAll()
+        {
+            while (head != nullptr)
+            {
+                Block* next = head->next;
+                Memory::SystemFree(head);
+                head = next;
+            }
+
+            current = end = nullptr;
+            totalReserved = totalAllocated = 0;
+        }
+
+        SIZE_T GetTotalReserved() const { return totalReserved; }
+
+        SIZE_T GetTotalAllocated() const { return totalAllocated; }
+
+    private:
+
+        struct Block
+        {
+            Block* next = nullptr;
+            SIZE_T capacity = 0;
+        };
+
+        void Grow(SIZE_T minSize)
+        {
+            SIZE_T capacity = minSize > blockSize ? minSize : blockSize;
+
+            Block* block = (Block*)Memory::SystemMalloc(sizeof(Block) + capacity);
+            block->next = head;
+            block->capacity = capacity;
+            head = block;
+
+            current = (u8*)(block + 1);
+            end = current + capacity;
+            totalReserved += capacity;
+        }
+
+        SIZE_T blockSize = DefaultBlockSize;
+        Block* head = nullptr;
+        u8* current = nullptr;
+        u8* end = nullptr;
+
+        SIZE_T totalReserved = 0;
+        SIZE_T totalAllocated = 0;
+    };
+
+} // namespace CE
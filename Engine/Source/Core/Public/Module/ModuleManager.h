@@ -3,6 +3,7 @@
 #include "Misc/CoreDefines.h"
 #include "Containers/String.h"
 #include "Containers/HashMap.h"
+#include "Containers/Array.h"
 
 #include "Module.h"
 
@@ -17,6 +18,7 @@ namespace CE
 	typedef void (*LoadTypesFunc)();
 
 	class Bundle;
+	class Job;
 
     struct ModuleInfo
     {
@@ -36,8 +38,28 @@ namespace CE
         Module* moduleImpl; // nullptr if not loaded
 
         Bundle* transientBundle = nullptr;
+
+		/// True once the field & function caches of this module's types were queued for prewarming.
+		bool typesPrewarmed = false;
     };
 
+	/// Time spent in ModuleManager::LoadModule() for a single module, in milliseconds.
+	struct ModuleLoadTiming
+	{
+		Name moduleName;
+
+		/// Includes the time spent loading other modules from within this module's load.
+		f64 totalTime = 0;
+		/// Excludes the time spent loading other modules from within this module's load.
+		f64 selfTime = 0;
+
+		f64 dllLoadTime = 0;
+		f64 registerTypesTime = 0;
+		f64 startupTime = 0;
+		f64 rttiSetupTime = 0;
+		f64 resourcesTime = 0;
+	};
+
     enum class ModuleLoadResult
     {
         Success = 0,
@@ -83,13 +105,44 @@ namespace CE
 		/// Returns the transient bundle of a loaded module. Returns nullptr if module is not loaded or not found.
 		Bundle* GetLoadedModuleTransientBundle(const String& moduleName);
 
+		/// Timings of every module loaded so far, in load order.
+		const Array<ModuleLoadTiming>& GetModuleLoadTimings() const { return moduleLoadTimings; }
+
+		/// Logs the module load timings, slowest module first.
+		void LogModuleLoadTimings();
+
+		/// If enabled, PrewarmLoadedModuleTypes() builds the field & function caches of the loaded modules' types
+		/// on the global JobContext, instead of on first use.
+		void SetPrewarmTypesInBackground(bool enabled) { prewarmTypesInBackground = enabled; }
+
+		bool IsPrewarmingTypesInBackground() const { return prewarmTypesInBackground; }
+
+		/// Starts prewarming the types of every loaded module that wasn't prewarmed yet. Call it once the startup
+		/// modules are loaded: loading or unloading a module waits for the prewarm job first, because it modifies the
+		/// type registries the job reads. Does nothing if prewarming is disabled or there is no global JobContext.
+		void PrewarmLoadedModuleTypes();
+
     private:
 
+		Module* LoadModuleInternal(const String& moduleName, ModuleLoadResult& result, ModuleLoadTiming& timing);
+
+		/// Waits for the type prewarm job, if any.
+		void CompleteTypePrewarm();
+
         ModuleInfo* AddModule(const String& moduleName, ModuleLoadResult& result);
 
         ModuleInfo* FindModuleInfo(const String& moduleName);
 
         HashMap<Name, ModuleInfo> ModuleMap{};
+
+		Array<ModuleLoadTiming> moduleLoadTimings{};
+
+		/// Time spent loading nested modules, one entry per LoadModule() call on the stack.
+		Array<f64> nestedLoadTimeStack{};
+
+		bool prewarmTypesInBackground = false;
+
+		Job* typePrewarmJob = nullptr;
     };
 
 } // namespace CE
@@ -146,6 +146,10 @@ namespace CE
 
         void OnObjectUnloaded(Object* object);
 
+        //! @brief Reads the whole bundle file through AsyncIO, for loads that deserialize every object.
+        //! Returns false if the file is too large for a MemoryStream, callers then stream it from disk.
+        static bool ReadBundleFile(const IO::Path& absolutePath, Array<u8>& outData);
+
         static bool IsFieldSerialized(const Ptr<FieldType>& field, StructType* schemaType);
 
         static void SerializeSchemaTable(const Ref<Bundle>& bundle, Stream* stream, const Array<TypeInfo*>& schemaTypes,
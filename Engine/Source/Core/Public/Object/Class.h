@@ -23,6 +23,9 @@ namespace CE
 
 	class BinaryBlob;
 
+	class Job;
+	class JobContext;
+
 	template<typename ElementType>
 	class Array;
 
@@ -617,6 +620,9 @@ namespace CE
 			return Impl->GetClassModule();
 		}
 
+		//! @brief Returns the class default instance, creating it on first use.
+		//! The first call constructs an object, so it must happen on the main thread. Once it exists, the default
+		//! instance can be read from any thread without locking.
 		const Object* GetDefaultInstance();
 
         // For internal use only!
@@ -624,9 +630,13 @@ namespace CE
         // For internal use only!
         static void DeregisterClassType(ClassType* type);
 
-		static void CreateDefaultInstancesForCurrentModule();
 		static void CacheTypesForCurrentModule();
 
+		//! @brief Starts a job that builds the field & function caches of every struct and class in the given
+		//! modules, so they're ready before first use. Returns nullptr if there's nothing to do.
+		//! The type registries must not change while the job runs. The returned job is not auto-deleted.
+		static Job* PrewarmTypesForModules(const Array<Name>& moduleNames, JobContext* context);
+
 		static bool GetTotalRegisteredClasses()
 		{
 			return registeredClasses.GetSize();
@@ -674,6 +684,9 @@ namespace CE
 		Internal::IClassTypeImpl* Impl = nullptr;
 
 		Ref<Object> defaultInstance = nullptr;
+		//! @brief Published once defaultInstance is fully constructed, so GetDefaultInstance() can skip the lock.
+		Atomic<Object*> defaultInstancePtr = nullptr;
+		RecursiveMutex defaultInstanceMutex{};
 
 		bool superTypesCached = false;
 		Array<ClassType*> superClasses{};
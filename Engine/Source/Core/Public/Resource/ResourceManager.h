@@ -9,11 +9,26 @@ namespace CE
 		u8* data = nullptr;
 		u32 dataSize = 0;
 	};
+
+	//! @brief An entry of the resource index that the ResourceCompiler generates for a module. Entries are sorted by path.
+	struct ResourceIndexEntry
+	{
+		//! @brief Path relative to the module's Resources directory, with '/' separators.
+		const char* path = nullptr;
+		const u8* data = nullptr;
+		u32 dataSize = 0;
+		//! @brief Size of the data after decompression. 0 if the data is stored uncompressed.
+		u32 uncompressedSize = 0;
+	};
     
 	class CORE_API ResourceManager : public Object
 	{
 		CE_CLASS(ResourceManager, Object)
 	public:
+
+		//! @brief Default memory budget of the decompressed resources.
+		static constexpr u64 DefaultCacheBudget = 32_MB;
+
 		ResourceManager();
 		virtual ~ResourceManager();
 
@@ -21,15 +36,66 @@ namespace CE
 
 		void DeregisterResource(const String& moduleName, const String& pathToResource);
 
+		//! @brief Registers every embedded resource of a module at once. Neither the index nor the data is copied,
+		//! and compressed resources are only decompressed when they're loaded.
+		void RegisterResourceIndex(const String& moduleName, const ResourceIndexEntry* entries, u32 numEntries);
+
+		void DeregisterResourceIndex(const String& moduleName);
+
 		CE::Resource* LoadResource(const Name& path, Object* outer = GetGlobalTransient());
 
+		//! @brief Returns the data without copying it. The data of a compressed resource is pinned in memory until
+		//! ReleaseResourceView() is called for every view of it, or until it is deregistered.
 		RawData GetRawData(const Name& path);
 
-		String LoadTextResource(const Name& path);
+		//! @brief Returns the text without copying it. The text of a compressed resource is pinned in memory until
+		//! ReleaseResourceView() is called for every view of it, or until it is deregistered.
+		StringView LoadTextResource(const Name& path);
+
+		//! @brief Releases a view returned by GetRawData() or LoadTextResource(), so that the decompressed data can be
+		//! evicted once no view references it. The view must not be used afterwards.
+		void ReleaseResourceView(const Name& path);
+
+		//! @brief Decompressed resources that are not referenced by a view are evicted, least recently used first, above this size.
+		void SetCacheBudget(u64 budgetInBytes);
+
+		u64 GetCacheSize();
 
 	protected:
 
+		struct ModuleResourceIndex
+		{
+			const ResourceIndexEntry* entries = nullptr;
+			u32 numEntries = 0;
+		};
+
+		struct DecompressedResource
+		{
+			Array<u8> data{};
+			u64 lastAccess = 0;
+			//! @brief Number of views that reference the data and weren't released. Pinned data can't be evicted.
+			u32 pinCount = 0;
+		};
+
+		const ResourceIndexEntry* FindIndexEntry(const Name& path);
+
+		//! @brief Finds the data of a resource, decompressing it if needed. Has to be called with the mutex locked.
+		bool GetResourceData(const Name& path, bool pin, const u8*& outData, u32& outDataSize);
+
+		void EvictCache(const u8* keepEntry);
+
 		PathTree pathTree{};
+
+		HashMap<Name, ModuleResourceIndex> moduleIndices{};
+
+		//! @brief Decompressed data, by the compressed data pointer of its index entry.
+		HashMap<const u8*, DecompressedResource> decompressedResources{};
+
+		u64 cacheSize = 0;
+		u64 cacheBudget = DefaultCacheBudget;
+		u64 accessCounter = 0;
+
+		Mutex mutex{};
 	};
 
 } // namespace CE
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Stream.h"
+
+namespace CE
+{
+    /*
+     *  Adds a large read/write buffer on top of another stream, ex: a FileStream.
+     *  Binary primitives are read & written with an inline memcpy from the buffer, and only go through the
+     *  wrapped stream when the buffer has to be refilled or flushed. Positions are always 64-bit.
+     *  The wrapped stream is not owned, and should not be used directly while the buffered stream is alive.
+     */
+    class CORE_API BufferedStream final : public Stream
+    {
+    public:
+
+        static constexpr u32 DefaultBufferSize = 64 * 1024;
+
+        BufferedStream(Stream* stream, u32 bufferSize = DefaultBufferSize);
+
+        //! @brief Flushes any pending writes to the wrapped stream.
+        virtual ~BufferedStream();
+
+        BufferedStream(const BufferedStream&) = delete;
+        BufferedStream& operator=(const BufferedStream&) = delete;
+
+        // - Inline fast paths -
+
+        template<typename T> requires TIsNumericType<T>::Value
+        FORCE_INLINE void ReadPrimitive(T& out)
+        {
+            if (!isWriting && bufferCursor + sizeof(T) <= bufferLength)
+            {
+                memcpy(&out, buffer + bufferCursor, sizeof(T));
+                bufferCursor += sizeof(T);
+                return;
+            }
+
+            ReadSlow(&out, sizeof(T));
+        }
+
+        template<typename T> requires TIsNumericType<T>::Value
+        FORCE_INLINE void WritePrimitive(T value)
+        {
+            if (isWriting && bufferCursor + sizeof(T) <= bufferSize)
+            {
+                memcpy(buffer + bufferCursor, &value, sizeof(T));
+                bufferCursor += sizeof(T);
+                return;
+            }
+
+            WriteSlow(&value, sizeof(T));
+        }
+
+        // - Stream -
+
+        using Stream::operator<<;
+        using Stream::operator>>;
+        using Stream::Write;
+
+        Stream& operator<<(const String& string) override;
+        Stream& operator>>(String& string) override;
+
+        Stream& operator<<(u8 byte) override;
+        Stream& operator>>(u8& byte) override;
+
+        Stream& operator<<(bool boolean) override;
+        Stream& operator>>(bool& boolean) override;
+
+        Stream& operator<<(u16 integer) override;
+        Stream& operator>>(u16& integer) override;
+
+        Stream& operator<<(u32 integer) override;
+        Stream& operator>>(u32& integer) override;
+
+        Stream& operator<<(u64 integer) override;
+        Stream& operator>>(u64& integer) override;
+
+        Stream& operator<<(s8 integer) override;
+        Stream& operator>>(s8& integer) override;
+
+        Stream& operator<<(s16 integer) override;
+        Stream& operator>>(s16& integer) override;
+
+        Stream& operator<<(s32 integer) override;
+        Stream& operator>>(s32& integer) override;
+
+        Stream& operator<<(s64 integer) override;
+        Stream& operator>>(s64& integer) override;
+
+        Stream& operator<<(f32 single) override;
+        Stream& operator>>(f32& single) override;
+
+        Stream& operator<<(f64 decimal) override;
+        Stream& operator>>(f64& decimal) override;
+
+        void Write(const void* inData, u64 length) override;
+
+        void Write(u8 inByte) override
+        {
+            WritePrimitive(inByte);
+        }
+
+        s64 Read(void* outData, u64 length) override;
+
+        u8 Read() override
+        {
+            u8 byte = 0;
+            ReadPrimitive(byte);
+            return byte;
+        }
+
+        u8 ReadByte() override { return Read(); }
+
+        u64 GetCurrentPosition() override { return bufferStart + bufferCursor; }
+
+        void Seek(s64 seekPos, SeekMode seekMode = SeekMode::Begin) override;
+
+        bool IsOutOfBounds() override;
+
+        void SetOutOfBounds() override;
+
+        bool IsOpen() override;
+
+        //! @brief Flushes pending writes and closes the wrapped stream.
+        void Close() override;
+
+        bool CanRead() override;
+
+        bool CanWrite() override;
+
+        u64 GetLength() override;
+
+        u64 GetCapacity() override;
+
+        bool HasHardSizeLimit() override;
+
+        void SetBinaryMode(bool setBinaryMode) override;
+
+        //! @brief Writes all buffered data to the wrapped stream.
+        void Flush();
+
+        Stream* GetWrappedStream() const { return stream; }
+
+    private:
+
+        void ReadSlow(void* outData, u64 length);
+
+        void WriteSlow(const void* inData, u64 length);
+
+        //! @brief Discards the buffer and fills it from the wrapped stream, starting at the current position.
+        u32 Refill();
+
+        Stream* stream = nullptr;
+
+        u8* buffer = nullptr;
+        u32 bufferSize = 0;
+
+        //! @brief Position of buffer[0] in the wrapped stream.
+        u64 bufferStart = 0;
+        u32 bufferCursor = 0;
+        //! @brief Number of valid bytes in the buffer, when reading.
+        u32 bufferLength = 0;
+
+        //! @brief Length of the wrapped stream, so reads never go past its end.
+        u64 streamLength = 0;
+
+        //! @brief True if the buffer holds data that hasn't been written to the wrapped stream yet.
+        bool isWriting = false;
+
+        Array<char> stringScratch{};
+    };
+
+} // namespace CE
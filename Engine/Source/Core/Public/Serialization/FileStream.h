@@ -44,7 +44,7 @@ namespace CE
     protected:
         IO::Path filePath;
         std::fstream impl;
-        u32 offset = 0;
+        u64 offset = 0;
 
         Permissions openMode = Permissions::ReadOnly;
     };
@@ -3,6 +3,17 @@
 
 #include "Include.h"
 
+#include <chrono>
+#include <sstream>
+
+#include "spdlog/logger.h"
+#include "spdlog/sinks/ostream_sink.h"
+
+#if PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #pragma region Registration
 
 CE_RTTI_STRUCT_IMPL(, VariantTests, VariantStruct)
@@ -134,6 +145,19 @@ TEST(Performance, Module_Load_10x)
     TEST_END;
 }
 
+TEST(Performance, Module_Load_Timings)
+{
+    TEST_BEGIN;
+
+    const Array<ModuleLoadTiming>& timings = ModuleManager::Get().GetModuleLoadTimings();
+    EXPECT_TRUE(timings.NotEmpty());
+    EXPECT_EQ(timings.Top().moduleName, Name("Core"));
+    EXPECT_GE(timings.Top().totalTime, timings.Top().selfTime);
+    EXPECT_GE(timings.Top().totalTime, timings.Top().startupTime);
+
+    TEST_END;
+}
+
 #pragma endregion
 
 
@@ -1099,6 +1123,72 @@ TEST(Containers, PagedDynamicArray)
 	TEST_END;
 }
 
+TEST(Containers, FenwickTree)
+{
+	TEST_BEGIN;
+
+	FenwickTree<int> tree{};
+	EXPECT_TRUE(tree.IsEmpty());
+	EXPECT_EQ(tree.GetTotal(), 0);
+	EXPECT_EQ(tree.FindIndex(10), 0);
+
+	tree.Build({ 10, 20, 30, 40, 50 });
+	EXPECT_EQ(tree.GetSize(), 5);
+	EXPECT_EQ(tree.GetPrefixSum(0), 0);
+	EXPECT_EQ(tree.GetPrefixSum(1), 10);
+	EXPECT_EQ(tree.GetPrefixSum(3), 60);
+	EXPECT_EQ(tree.GetTotal(), 150);
+
+	EXPECT_EQ(tree.FindIndex(0), 0);
+	EXPECT_EQ(tree.FindIndex(9), 0);
+	EXPECT_EQ(tree.FindIndex(10), 1);
+	EXPECT_EQ(tree.FindIndex(59), 2);
+	EXPECT_EQ(tree.FindIndex(60), 3);
+	EXPECT_EQ(tree.FindIndex(149), 4);
+	EXPECT_EQ(tree.FindIndex(150), 5);
+
+	tree.Set(1, 5);
+	EXPECT_EQ(tree.Get(1), 5);
+	EXPECT_EQ(tree.GetPrefixSum(2), 15);
+	EXPECT_EQ(tree.GetTotal(), 135);
+	EXPECT_EQ(tree.FindIndex(15), 2);
+
+	tree.InsertRange(1, { 1, 2 });
+	EXPECT_EQ(tree.GetSize(), 7);
+	EXPECT_EQ(tree.GetPrefixSum(3), 13);
+	EXPECT_EQ(tree.GetTotal(), 138);
+
+	tree.RemoveRange(1, 3);
+	EXPECT_EQ(tree.GetSize(), 4);
+	EXPECT_EQ(tree.Get(1), 30);
+	EXPECT_EQ(tree.GetTotal(), 130);
+
+	// Large uniform list
+	{
+		constexpr int count = 100000;
+		Array<int> values{};
+		values.Resize(count);
+		for (int i = 0; i < count; ++i)
+		{
+			values[i] = 25;
+		}
+
+		tree.Build(values);
+		EXPECT_EQ(tree.GetTotal(), count * 25);
+
+		for (int i = 0; i < count; i += 997)
+		{
+			EXPECT_EQ(tree.GetPrefixSum(i), i * 25);
+			EXPECT_EQ(tree.FindIndex(i * 25 + 12), i);
+		}
+	}
+
+	tree.Clear();
+	EXPECT_TRUE(tree.IsEmpty());
+
+	TEST_END;
+}
+
 #pragma endregion
 
 
@@ -1617,6 +1707,63 @@ TEST(Reflection, Fields)
 	TEST_END;
 }
 
+TEST(Reflection, Lazy_Type_Caches)
+{
+	TEST_BEGIN;
+	CE_REGISTER_TYPES(ReflectionFieldElement, ReflectionFieldTest, ReflectionFieldClass);
+	CERegisterModuleTypes();
+
+	ClassType* clazz = ReflectionFieldClass::StaticClass();
+	StructType* structType = ReflectionFieldTest::StaticStruct();
+
+	// Field caches are built on first use, from whichever thread gets there first.
+	// The CDI is created on the main thread, and then only read by the other threads.
+	const Object* defaultInstance = clazz->GetDefaultInstance();
+	ASSERT_NE(defaultInstance, nullptr);
+
+	Array<u32> classFieldCounts{};
+	Array<u32> structFieldCounts{};
+	Array<const Object*> defaultInstances{};
+	classFieldCounts.Resize(4);
+	structFieldCounts.Resize(4);
+	defaultInstances.Resize(4);
+
+	{
+		Array<Thread> threads{};
+		threads.Resize(4);
+
+		for (int i = 0; i < threads.GetSize(); i++)
+		{
+			threads[i] = Thread([&, i]
+				{
+					classFieldCounts[i] = clazz->GetFieldCount();
+					structFieldCounts[i] = structType->GetFieldCount();
+					defaultInstances[i] = clazz->GetDefaultInstance();
+				});
+		}
+
+		for (Thread& thread : threads)
+		{
+			thread.Join();
+		}
+	}
+
+	for (int i = 0; i < 4; i++)
+	{
+		EXPECT_GT(classFieldCounts[i], 0u);
+		EXPECT_EQ(classFieldCounts[i], classFieldCounts[0]);
+		EXPECT_EQ(structFieldCounts[i], structFieldCounts[0]);
+		EXPECT_EQ(defaultInstances[i], defaultInstance);
+	}
+
+	EXPECT_NE(clazz->FindField("structArray"), nullptr);
+	EXPECT_NE(structType->FindField("testString"), nullptr);
+
+	CEDeregisterModuleTypes();
+	CE_DEREGISTER_TYPES(ReflectionFieldElement, ReflectionFieldTest, ReflectionFieldClass);
+	TEST_END;
+}
+
 #pragma endregion
 
 
@@ -2870,6 +3017,113 @@ TEST(JSON, Manipulation)
 	TEST_END;
 }
 
+TEST(JSON, Document)
+{
+	TEST_BEGIN;
+
+	// 1. Parse into arena DOM
+
+	JsonDocument document{};
+	EXPECT_TRUE(document.Parse(String(JSON_Writer_Test2_Comparison)));
+
+	const JsonNode& root = document.GetRoot();
+	EXPECT_TRUE(root.IsArrayValue());
+	EXPECT_EQ(root.GetSize(), 3);
+	{
+		EXPECT_TRUE(root[0].IsObjectValue());
+		EXPECT_EQ(root[0].GetSize(), 2);
+
+		const JsonNode* someArray = root[0].Find("some_array");
+		EXPECT_NE(someArray, nullptr);
+		EXPECT_TRUE(someArray->IsArrayValue());
+		EXPECT_EQ(someArray->GetSize(), 4);
+		EXPECT_EQ(String((*someArray)[0].GetCString()), "child0");
+		EXPECT_EQ((*someArray)[1].GetNumberValue(), 123);
+		EXPECT_EQ((*someArray)[2].GetNumberValue(), 42.212);
+		EXPECT_TRUE((*someArray)[3].IsBoolValue());
+		EXPECT_FALSE((*someArray)[3].GetBoolValue());
+
+		const JsonNode* name = root[0].Find("name");
+		EXPECT_NE(name, nullptr);
+		EXPECT_EQ(String(name->GetCString()), "Some name");
+
+		EXPECT_EQ(String(root[1].GetCString()), "item0");
+		EXPECT_EQ(root[2].GetNumberValue(), 42.212);
+	}
+
+	// 2. Escapes, interned keys and trailing commas
+
+	EXPECT_TRUE(document.Parse(R"([ { "key": "a\n\"b\u00e9", "value": -1.5e2 }, { "key": null, "value": true, }, ])"));
+	EXPECT_EQ(document.GetRoot().GetSize(), 2);
+	EXPECT_EQ(document.GetKeyCount(), 2);
+	EXPECT_EQ(document.GetRoot()[0].GetMember(0).key, document.GetRoot()[1].GetMember(0).key);
+	EXPECT_EQ(String(document.GetRoot()[0].Find("key")->GetCString()), "a\n\"b\xC3\xA9");
+	EXPECT_EQ(document.GetRoot()[0].Find("value")->GetNumberValue(), -150.0);
+	EXPECT_TRUE(document.GetRoot()[1].Find("key")->IsNullValue());
+
+	// 3. Errors
+
+	EXPECT_FALSE(document.Parse("[1 2]"));
+	EXPECT_EQ(document.GetError(), JsonParseError::InvalidArray);
+	EXPECT_FALSE(document.Parse("{ \"unterminated: 1 }"));
+	EXPECT_FALSE(document.Parse("// comment\n{}"));
+	EXPECT_EQ(document.GetError(), JsonParseError::CommentNotSupported);
+
+	// 4. Deserialize2 falls back to the streaming reader for comments
+
+	JValue json = nullptr;
+	EXPECT_TRUE(JsonSerializer::Deserialize2(String(JSON_Writer_Test2_Comment_Comparison), json));
+	EXPECT_TRUE(json.IsArrayValue());
+	EXPECT_EQ(json.GetSize(), 3);
+	EXPECT_EQ(json[0]["name"].GetStringValue(), "Some name");
+
+	TEST_END;
+}
+
+TEST(JSON, ParseThroughput)
+{
+	TEST_BEGIN;
+
+	String json = "[";
+	for (int i = 0; i < 20000; i++)
+	{
+		if (i > 0)
+			json += ",";
+		json += String::Format(R"({{"id": {}, "name": "Item {}", "enabled": true, "tags": ["a", "b\tc"], "position": [1.5, -2.25, 3e2]}})", i, i);
+	}
+	json += "]";
+
+	const f64 sizeInMB = (f64)json.GetLength() / (1024.0 * 1024.0);
+	constexpr int iterations = 5;
+
+	JsonDocument document{};
+
+	auto prev = clock();
+	for (int i = 0; i < iterations; i++)
+	{
+		EXPECT_TRUE(document.Parse(json));
+	}
+	f64 documentTime = (f64)(clock() - prev) / CLOCKS_PER_SEC / iterations;
+
+	EXPECT_EQ(document.GetRoot().GetSize(), 20000);
+	EXPECT_EQ(document.GetKeyCount(), 5);
+
+	prev = clock();
+	for (int i = 0; i < iterations; i++)
+	{
+		MemoryStream stream = MemoryStream(json.GetData(), json.GetLength(), Stream::Permissions::ReadOnly);
+		JsonReader reader = JsonReader::Create(&stream);
+		JsonReadInstruction instruction = JsonReadInstruction::None;
+		while (reader.ParseNext(instruction)) {}
+	}
+	f64 readerTime = (f64)(clock() - prev) / CLOCKS_PER_SEC / iterations;
+
+	LOG("JSON " << sizeInMB << " MB. JsonDocument: " << sizeInMB / Math::Max(documentTime, 1e-9) << " MB/s, JsonReader: "
+		<< sizeInMB / Math::Max(readerTime, 1e-9) << " MB/s, SIMD: " << JsonStructuralIndexer::IsSimdAccelerated());
+
+	TEST_END;
+}
+
 #pragma endregion
 
 /**********************************************
@@ -3019,6 +3273,494 @@ TEST(Serialization, BasicStreams)
     TEST_END;
 }
 
+TEST(Serialization, BufferedStream_OutOfBounds)
+{
+    TEST_BEGIN;
+
+    auto path = PlatformDirectories::GetLaunchDir() / "BufferedBoundsTestFile.bin";
+    if (path.Exists())
+        IO::Path::Remove(path);
+
+    // Writing to a file is never out of bounds: the file grows
+    {
+        FileStream fileStream = FileStream(path, Stream::Permissions::WriteOnly);
+        fileStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&fileStream, 64);
+
+        for (int i = 0; i < 100; i++)
+        {
+            stream << (u32)i;
+            EXPECT_FALSE(stream.IsOutOfBounds());
+        }
+    }
+
+    IO::Path::Remove(path);
+
+    // A fixed size memory stream is out of bounds once its capacity is reached
+    {
+        u8 data[16] = {};
+        MemoryStream memoryStream = MemoryStream(data, sizeof(data), Stream::Permissions::ReadWrite);
+        memoryStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&memoryStream, 64);
+
+        stream << (u64)1;
+        EXPECT_FALSE(stream.IsOutOfBounds());
+        stream << (u64)2;
+        EXPECT_TRUE(stream.IsOutOfBounds());
+    }
+
+    TEST_END;
+}
+
+TEST(Serialization, BufferedStream)
+{
+    TEST_BEGIN;
+
+    auto path = PlatformDirectories::GetLaunchDir() / "BufferedTestFile.bin";
+    if (path.Exists())
+        IO::Path::Remove(path);
+
+    String longString = "";
+    for (int i = 0; i < 100; i++)
+    {
+        longString += "0123456789";
+    }
+
+    // Write with a tiny buffer, so strings & primitives straddle the buffer boundary
+    {
+        FileStream fileStream = FileStream(path, Stream::Permissions::WriteOnly);
+        fileStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&fileStream, 64);
+
+        stream << (u64)0; // Patched below
+        for (int i = 0; i < 500; i++)
+        {
+            stream << (u32)i;
+            stream << String::Format("String {}", i);
+            stream << (f64)i * 0.5;
+        }
+        stream << longString;
+        stream << Name("Some::Name");
+
+        u64 endPosition = stream.GetCurrentPosition();
+        stream.Seek(0);
+        stream << endPosition;
+        stream.Seek(endPosition);
+    }
+
+    {
+        FileStream fileStream = FileStream(path, Stream::Permissions::ReadOnly);
+        fileStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&fileStream, 64);
+
+        u64 endPosition = 0;
+        stream >> endPosition;
+        EXPECT_EQ(endPosition, stream.GetLength());
+
+        bool valid = true;
+        for (int i = 0; i < 500; i++)
+        {
+            u32 integer = 0;
+            String str = "";
+            f64 decimal = 0;
+            stream >> integer;
+            stream >> str;
+            stream >> decimal;
+
+            valid = valid && integer == (u32)i && str == String::Format("String {}", i) && decimal == (f64)i * 0.5;
+        }
+        EXPECT_TRUE(valid);
+
+        String str = "";
+        stream >> str;
+        EXPECT_EQ(str, longString);
+        Name name{};
+        stream >> name;
+        EXPECT_EQ(name, Name("Some::Name"));
+
+        EXPECT_EQ(stream.GetCurrentPosition(), endPosition);
+        EXPECT_TRUE(stream.IsOutOfBounds());
+
+        // Seek back into the data
+        stream.Seek(sizeof(u64));
+        u32 integer = 100;
+        stream >> integer;
+        EXPECT_EQ(integer, 0u);
+
+        // Reading past the end gives zeroes, and the position still advances
+        stream.Seek(endPosition);
+        u64 value = 1;
+        stream >> value;
+        EXPECT_EQ(value, 0u);
+        EXPECT_GT(stream.GetCurrentPosition(), stream.GetLength());
+    }
+
+    IO::Path::Remove(path);
+
+    TEST_END;
+}
+
+TEST(Serialization, ReadThroughput)
+{
+    TEST_BEGIN;
+
+    auto path = PlatformDirectories::GetLaunchDir() / "ReadThroughputTestFile.bin";
+    if (path.Exists())
+        IO::Path::Remove(path);
+
+    constexpr int count = 200000;
+
+    {
+        FileStream fileStream = FileStream(path, Stream::Permissions::WriteOnly);
+        fileStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&fileStream);
+
+        for (int i = 0; i < count; i++)
+        {
+            stream << (u32)i;
+            stream << (f32)i;
+            stream << String::Format("Field_{}", i);
+        }
+    }
+
+    auto readAll = [&](Stream* stream) -> u64
+        {
+            u64 sum = 0;
+            String str = "";
+            for (int i = 0; i < count; i++)
+            {
+                u32 integer = 0;
+                f32 single = 0;
+                *stream >> integer;
+                *stream >> single;
+                *stream >> str;
+                sum += integer + str.GetLength();
+            }
+            return sum;
+        };
+
+    u64 fileSize = 0;
+    u64 fileSum = 0, bufferedSum = 0;
+
+    auto prev = clock();
+    {
+        FileStream fileStream = FileStream(path, Stream::Permissions::ReadOnly);
+        fileStream.SetBinaryMode(true);
+        fileSize = fileStream.GetLength();
+        fileSum = readAll(&fileStream);
+    }
+    f64 fileTime = (f64)(clock() - prev) / CLOCKS_PER_SEC;
+
+    prev = clock();
+    {
+        FileStream fileStream = FileStream(path, Stream::Permissions::ReadOnly);
+        fileStream.SetBinaryMode(true);
+        BufferedStream stream = BufferedStream(&fileStream);
+        bufferedSum = readAll(&stream);
+    }
+    f64 bufferedTime = (f64)(clock() - prev) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(fileSum, bufferedSum);
+
+    const f64 sizeInMB = (f64)fileSize / (1024.0 * 1024.0);
+    LOG("Stream read " << sizeInMB << " MB. FileStream: " << sizeInMB / Math::Max(fileTime, 1e-9) << " MB/s, BufferedStream: "
+        << sizeInMB / Math::Max(bufferedTime, 1e-9) << " MB/s");
+
+    IO::Path::Remove(path);
+
+    TEST_END;
+}
+
+TEST(IO, AsyncRead)
+{
+    TEST_BEGIN;
+
+    auto dir = PlatformDirectories::GetLaunchDir() / "AsyncReadTest";
+    if (dir.Exists())
+        IO::Path::RemoveRecursively(dir);
+    IO::Path::CreateDirectories(dir);
+
+    constexpr int fileCount = 16;
+    Array<IO::Path> paths{};
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        IO::Path path = dir / String::Format("File_{}.bin", i);
+        paths.Add(path);
+
+        FileStream stream = FileStream(path, Stream::Permissions::WriteOnly);
+        stream.SetBinaryMode(true);
+        for (u32 j = 0; j < 10000 + (u32)i; j++)
+        {
+            stream << (u8)(j * 7 + i);
+        }
+    }
+
+    IO::AsyncIO& asyncIO = IO::AsyncIO::Get();
+    asyncIO.ResetStatistics();
+
+    // Batch reads with completion callbacks
+    {
+        Atomic<int> numCallbacks = 0;
+        Array<IO::AsyncReadArgs> batch{};
+
+        for (const IO::Path& path : paths)
+        {
+            IO::AsyncReadArgs args{};
+            args.path = path;
+            args.onComplete = [&numCallbacks](IO::AsyncReadRequest* request)
+                {
+                    numCallbacks++;
+                };
+            batch.Add(args);
+        }
+
+        Array<Ptr<IO::AsyncReadRequest>> requests = asyncIO.ReadBatch(batch);
+        EXPECT_EQ(requests.GetSize(), fileCount);
+
+        for (int i = 0; i < requests.GetSize(); i++)
+        {
+            EXPECT_TRUE(requests[i]->Wait());
+            EXPECT_EQ(requests[i]->GetSize(), 10000 + i);
+
+            bool matches = true;
+            for (u32 j = 0; j < requests[i]->GetSize(); j++)
+            {
+                matches = matches && requests[i]->GetData()[j] == (u8)(j * 7 + i);
+            }
+            EXPECT_TRUE(matches);
+        }
+
+        while (numCallbacks < fileCount)
+        {
+            Thread::SleepFor(1);
+        }
+        EXPECT_EQ(numCallbacks.load(), fileCount);
+    }
+
+    // Partial reads into a destination buffer, and reads clamped to the end of the file
+    {
+        u8 buffer[16] = {};
+
+        IO::AsyncReadArgs args{};
+        args.path = paths[3];
+        args.offset = 100;
+        args.size = 16;
+        args.destination = buffer;
+
+        Ptr<IO::AsyncReadRequest> request = asyncIO.Read(args);
+        EXPECT_TRUE(request->Wait());
+        EXPECT_EQ(request->GetSize(), 16);
+        EXPECT_EQ(request->GetData(), &buffer[0]);
+        EXPECT_EQ(buffer[0], (u8)(100 * 7 + 3));
+        EXPECT_EQ(buffer[15], (u8)(115 * 7 + 3));
+
+        args.offset = 10000;
+        args.size = 100;
+        args.destination = nullptr;
+        request = asyncIO.Read(args);
+        EXPECT_TRUE(request->Wait());
+        EXPECT_EQ(request->GetSize(), 3);
+    }
+
+    // Failures
+    {
+        IO::AsyncReadArgs args{};
+        args.path = dir / "DoesNotExist.bin";
+
+        Ptr<IO::AsyncReadRequest> request = asyncIO.Read(args);
+        EXPECT_FALSE(request->Wait());
+        EXPECT_EQ(request->GetStatus(), IO::AsyncIOStatus::Failed);
+
+        Array<u8> data{};
+        EXPECT_FALSE(IO::AsyncIO::ReadFile(args.path, data));
+        EXPECT_TRUE(IO::AsyncIO::ReadFile(paths[0], data));
+        EXPECT_EQ(data.GetSize(), 10000);
+    }
+
+    // Cancellation: requests that have not been picked up yet can be cancelled
+    {
+        Array<IO::AsyncReadArgs> batch{};
+        for (int i = 0; i < 8; i++)
+        {
+            for (const IO::Path& path : paths)
+            {
+                IO::AsyncReadArgs args{};
+                args.path = path;
+                args.priority = IO::AsyncIOPriority::Low;
+                batch.Add(args);
+            }
+        }
+
+        Array<Ptr<IO::AsyncReadRequest>> requests = asyncIO.ReadBatch(batch);
+
+        int numCancelled = 0;
+        for (int i = (int)requests.GetSize() - 1; i >= 0; i--)
+        {
+            if (requests[i]->Cancel())
+                numCancelled++;
+        }
+
+        int numCompleted = 0;
+        for (const auto& request : requests)
+        {
+            bool succeeded = request->Wait();
+            if (succeeded)
+                numCompleted++;
+            else
+                EXPECT_EQ(request->GetStatus(), IO::AsyncIOStatus::Cancelled);
+        }
+
+        EXPECT_EQ(numCompleted + numCancelled, (int)requests.GetSize());
+        EXPECT_FALSE(requests[0]->Cancel()); // Already done
+
+        IO::AsyncIO::Statistics statistics = asyncIO.GetStatistics();
+        EXPECT_EQ(statistics.requestsCancelled, (u64)numCancelled);
+        EXPECT_EQ(statistics.requestsFailed, 1);
+    }
+
+    // Shutting down cancels pending requests, and the next request starts the service again
+    {
+        asyncIO.Shutdown();
+        EXPECT_FALSE(asyncIO.IsInitialized());
+
+        Array<u8> data{};
+        EXPECT_TRUE(IO::AsyncIO::ReadFile(paths[1], data));
+        EXPECT_EQ(data.GetSize(), 10001);
+        EXPECT_TRUE(asyncIO.IsInitialized());
+    }
+
+    IO::Path::RemoveRecursively(dir);
+
+    TEST_END;
+}
+
+TEST(IO, AsyncReadThroughput)
+{
+    TEST_BEGIN;
+
+    auto dir = PlatformDirectories::GetLaunchDir() / "AsyncReadThroughputTest";
+    if (dir.Exists())
+        IO::Path::RemoveRecursively(dir);
+    IO::Path::CreateDirectories(dir);
+
+    // A directory of bundle sized files
+    constexpr int fileCount = 128;
+    constexpr u32 fileSize = 512 * 1024;
+
+    Array<IO::Path> paths{};
+    Array<u8> fileData{};
+    fileData.Resize(fileSize);
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        for (u32 j = 0; j < fileSize; j++)
+        {
+            fileData[j] = (u8)(j + i);
+        }
+
+        IO::Path path = dir / String::Format("Bundle_{}.casset", i);
+        paths.Add(path);
+
+        FileStream stream = FileStream(path, Stream::Permissions::WriteOnly);
+        stream.SetBinaryMode(true);
+        stream.Write(fileData.GetData(), fileSize);
+    }
+
+    // Evict the files from the page cache, so the reads actually hit the disk
+    auto dropPageCache = [&]() -> bool
+        {
+#if PLATFORM_LINUX
+            bool dropped = true;
+            for (const IO::Path& path : paths)
+            {
+                int fd = open(path.GetString().GetCString(), O_RDONLY);
+                if (fd < 0)
+                {
+                    dropped = false;
+                    continue;
+                }
+                fdatasync(fd);
+                dropped = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0 && dropped;
+                close(fd);
+            }
+            return dropped;
+#else
+            return false;
+#endif
+        };
+
+    auto elapsedSeconds = [](std::chrono::steady_clock::time_point start) -> f64
+        {
+            return Math::Max(std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count(), 1e-9);
+        };
+
+    const f64 totalMB = (f64)fileCount * fileSize / (1024.0 * 1024.0);
+
+    // 1. Synchronous FileStream reads, one file after another
+    bool coldCache = dropPageCache();
+    auto start = std::chrono::steady_clock::now();
+    u64 syncBytes = 0;
+    {
+        for (const IO::Path& path : paths)
+        {
+            FileStream stream = FileStream(path, Stream::Permissions::ReadOnly);
+            stream.SetBinaryMode(true);
+            syncBytes += (u64)stream.Read(fileData.GetData(), stream.GetLength());
+        }
+    }
+    f64 syncTime = elapsedSeconds(start);
+
+    auto readAllAsync = [&](IO::AsyncIO& asyncIO) -> u64
+        {
+            Array<IO::AsyncReadArgs> batch{};
+            for (const IO::Path& path : paths)
+            {
+                IO::AsyncReadArgs args{};
+                args.path = path;
+                batch.Add(args);
+            }
+
+            u64 bytes = 0;
+            for (const auto& request : asyncIO.ReadBatch(batch))
+            {
+                if (request->Wait())
+                    bytes += request->GetSize();
+            }
+            return bytes;
+        };
+
+    // 2. AsyncIO with the default backend (io_uring on Linux)
+    coldCache = dropPageCache() && coldCache;
+    start = std::chrono::steady_clock::now();
+    u64 asyncBytes = readAllAsync(IO::AsyncIO::Get());
+    f64 asyncTime = elapsedSeconds(start);
+
+    // 3. AsyncIO with the thread pool fallback
+    IO::AsyncIO threadPoolIO{};
+    threadPoolIO.Initialize(0, false);
+
+    coldCache = dropPageCache() && coldCache;
+    start = std::chrono::steady_clock::now();
+    u64 threadPoolBytes = readAllAsync(threadPoolIO);
+    f64 threadPoolTime = elapsedSeconds(start);
+
+    threadPoolIO.Shutdown();
+
+    EXPECT_EQ(syncBytes, (u64)fileCount * fileSize);
+    EXPECT_EQ(asyncBytes, syncBytes);
+    EXPECT_EQ(threadPoolBytes, syncBytes);
+
+    LOG("Read " << fileCount << " bundles (" << totalMB << " MB) with " << (coldCache ? "a cold" : "a warm") << " page cache. "
+        << "FileStream: " << totalMB / syncTime << " MB/s, "
+        << "AsyncIO (" << (IO::AsyncIO::Get().IsUsingIoUring() ? "io_uring" : "thread pool") << "): " << totalMB / asyncTime << " MB/s, "
+        << "AsyncIO (thread pool): " << totalMB / threadPoolTime << " MB/s");
+
+    IO::Path::RemoveRecursively(dir);
+
+    TEST_END;
+}
+
 const char Serialization_StructuredStream_Test_Json[] = R"([
 	{
 		"some_array": 
@@ -3740,6 +4482,121 @@ TEST(Resource, Manipulation)
 	TEST_END;
 }
 
+TEST(Resource, CompressionRoundTrip)
+{
+	TEST_BEGIN;
+
+	Array<u8> source{};
+	for (int i = 0; i < 20000; i++)
+	{
+		// Repetitive data with some noise, and overlapping matches
+		source.Add((i % 97 == 0) ? (u8)(i * 31) : (u8)((i / 5) % 13));
+	}
+
+	Array<u8> compressed{};
+	compressed.Resize(GetCompressBound(source.GetSize()));
+	SIZE_T compressedSize = Compress(source.GetData(), source.GetSize(), compressed.GetData(), compressed.GetSize());
+	EXPECT_GT(compressedSize, 0);
+	EXPECT_LT(compressedSize, source.GetSize() / 4);
+
+	Array<u8> decompressed{};
+	decompressed.Resize(source.GetSize());
+	EXPECT_TRUE(Decompress(compressed.GetData(), compressedSize, decompressed.GetData(), decompressed.GetSize()));
+	EXPECT_EQ(memcmp(source.GetData(), decompressed.GetData(), source.GetSize()), 0);
+
+	// A wrong size or truncated data is rejected
+	EXPECT_FALSE(Decompress(compressed.GetData(), compressedSize, decompressed.GetData(), decompressed.GetSize() - 1));
+	EXPECT_FALSE(Decompress(compressed.GetData(), compressedSize / 2, decompressed.GetData(), decompressed.GetSize()));
+
+	// Empty and incompressible inputs
+	u8 empty = 0;
+	compressedSize = Compress(&empty, 0, compressed.GetData(), compressed.GetSize());
+	EXPECT_GT(compressedSize, 0);
+	EXPECT_TRUE(Decompress(compressed.GetData(), compressedSize, decompressed.GetData(), 0));
+
+	u8 noise[64];
+	for (int i = 0; i < COUNTOF(noise); i++)
+		noise[i] = (u8)(i * 151 + 7);
+	compressedSize = Compress(noise, sizeof(noise), compressed.GetData(), compressed.GetSize());
+	EXPECT_TRUE(Decompress(compressed.GetData(), compressedSize, decompressed.GetData(), sizeof(noise)));
+	EXPECT_EQ(memcmp(noise, decompressed.GetData(), sizeof(noise)), 0);
+
+	TEST_END;
+}
+
+TEST(Resource, ResourceIndex)
+{
+	TEST_BEGIN;
+
+	static const char styleText[] = "* { padding: 5px 5px; } * { padding: 5px 5px; } * { padding: 5px 5px; } * { padding: 5px 5px; }";
+
+	Array<u8> compressedStyle{};
+	compressedStyle.Resize(GetCompressBound(sizeof(styleText)));
+	u32 compressedStyleSize = (u32)Compress(styleText, sizeof(styleText), compressedStyle.GetData(), compressedStyle.GetSize());
+	EXPECT_GT(compressedStyleSize, 0);
+
+	// Sorted by path, the same way the ResourceCompiler generates it
+	ResourceIndexEntry entries[] = {
+		{ "CSS/Style.css", compressedStyle.GetData(), compressedStyleSize, (u32)sizeof(styleText) },
+		{ "Text/Entry0.txt", (const u8*)Resource_Text_Entry0, (u32)sizeof(Resource_Text_Entry0), 0 },
+	};
+
+	GetResourceManager()->RegisterResourceIndex("Core_IndexTest", entries, COUNTOF(entries));
+
+	// Uncompressed text is a view of the embedded data
+	StringView text = GetResourceManager()->LoadTextResource("/Core_IndexTest/Resources/Text/Entry0.txt");
+	EXPECT_EQ(String(text), "resource_text");
+	EXPECT_EQ((const void*)text.GetCString(), (const void*)Resource_Text_Entry0);
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), 0);
+
+	Resource* styleResource = GetResourceManager()->LoadResource("/Core_IndexTest/Resources/CSS/Style.css");
+	EXPECT_NE(styleResource, nullptr);
+	EXPECT_EQ(styleResource->GetDataSize(), sizeof(styleText));
+	EXPECT_EQ(strcmp((const char*)styleResource->GetData(), styleText), 0);
+	EXPECT_EQ(styleResource->GetExtension(), "css");
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), sizeof(styleText));
+
+	// Unpinned data is evicted when the budget shrinks
+	GetResourceManager()->SetCacheBudget(0);
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), 0);
+
+	// Views of compressed text are pinned
+	StringView styleView = GetResourceManager()->LoadTextResource("/Core_IndexTest/Resources/CSS/Style.css");
+	EXPECT_EQ(String(styleView), styleText);
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), sizeof(styleText));
+
+	RawData styleData = GetResourceManager()->GetRawData("/Core_IndexTest/Resources/CSS/Style.css");
+	EXPECT_EQ((const void*)styleData.data, (const void*)styleView.GetCString());
+
+	// ...until every view is released
+	GetResourceManager()->ReleaseResourceView("/Core_IndexTest/Resources/CSS/Style.css");
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), sizeof(styleText));
+
+	GetResourceManager()->ReleaseResourceView("/Core_IndexTest/Resources/CSS/Style.css");
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), 0);
+
+	// Releasing more views than were returned does nothing
+	GetResourceManager()->ReleaseResourceView("/Core_IndexTest/Resources/CSS/Style.css");
+
+	styleView = GetResourceManager()->LoadTextResource("/Core_IndexTest/Resources/CSS/Style.css");
+	EXPECT_EQ(String(styleView), styleText);
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), sizeof(styleText));
+
+	EXPECT_EQ(GetResourceManager()->LoadResource("/Core_IndexTest/Resources/CSS/Missing.css"), nullptr);
+	EXPECT_EQ(GetResourceManager()->LoadTextResource("/Core_IndexTest/Other/Text/Entry0.txt").GetSize(), 0);
+
+	styleResource->BeginDestroy();
+	styleResource = nullptr;
+
+	GetResourceManager()->DeregisterResourceIndex("Core_IndexTest");
+	EXPECT_EQ(GetResourceManager()->GetCacheSize(), 0);
+	EXPECT_EQ(GetResourceManager()->LoadResource("/Core_IndexTest/Resources/Text/Entry0.txt"), nullptr);
+
+	GetResourceManager()->SetCacheBudget(ResourceManager::DefaultCacheBudget);
+
+	TEST_END;
+}
+
 #pragma endregion
 
 
@@ -4183,3 +5040,197 @@ TEST(JobSystem, Performance)
 
 #pragma endregion
 
+
+#pragma region Logger
+
+TEST(Logger, AsyncOrdering)
+{
+	TEST_BEGIN;
+
+	Logger::Initialize();
+	Logger::SetConsoleLogLevel(LogLevel::Off);
+	Logger::SetFileDumpLogLevel(LogLevel::Off);
+
+	// Console messages always reach the editor loggers, regardless of the console log level
+	std::ostringstream output{};
+	auto outputSink = std::make_shared<spdlog::sinks::ostream_sink_mt>(output);
+	outputSink->set_pattern("%v");
+	spdlog::logger outputLogger{ "Output", outputSink };
+	Logger::AddEditorLogger(&outputLogger);
+
+	AsyncLogSettings settings{};
+	settings.bufferCapacity = 64; // Small enough to overflow
+	settings.overflowPolicy = LogOverflowPolicy::Block;
+	Logger::EnableAsync(settings);
+	EXPECT_TRUE(Logger::IsAsync());
+
+	constexpr int NumThreads = 4;
+	constexpr int NumMessages = 1000;
+
+	Array<Thread*> threads{};
+	for (int t = 0; t < NumThreads; t++)
+	{
+		threads.Add(new Thread([t]
+			{
+				String name = String::Format("Thread{}", t);
+				for (int i = 0; i < NumMessages; i++)
+				{
+					CE_LOG(Info, Console, "{} {}", name, i);
+				}
+			}));
+	}
+
+	for (Thread* thread : threads)
+	{
+		thread->Join();
+		delete thread;
+	}
+
+	Logger::Flush();
+
+	AsyncLogStatistics statistics = Logger::GetAsyncStatistics();
+	EXPECT_EQ(statistics.numDropped, 0u);
+	EXPECT_GE(statistics.numWritten, (u64)(NumThreads * NumMessages));
+
+	// Every message is written once, and each thread's messages stay in order
+	int lastIndex[NumThreads] = { -1, -1, -1, -1 };
+	int numLines = 0;
+
+	std::istringstream input{ output.str() };
+	std::string line{};
+	while (std::getline(input, line))
+	{
+		int thread = -1, index = -1;
+		if (sscanf(line.c_str(), "Thread%d %d", &thread, &index) != 2 || thread < 0 || thread >= NumThreads)
+			continue;
+
+		EXPECT_EQ(index, lastIndex[thread] + 1);
+		lastIndex[thread] = index;
+		numLines++;
+	}
+
+	EXPECT_EQ(numLines, NumThreads * NumMessages);
+
+	Logger::DisableAsync();
+	EXPECT_FALSE(Logger::IsAsync());
+
+	Logger::RemoveEditorLogger(&outputLogger);
+	Logger::Shutdown();
+
+	TEST_END;
+}
+
+TEST(Logger, AsyncRecordContents)
+{
+	TEST_BEGIN;
+
+	Logger::Initialize();
+	Logger::SetConsoleLogLevel(LogLevel::Off);
+	Logger::SetFileDumpLogLevel(LogLevel::Off);
+
+	std::ostringstream output{};
+	auto outputSink = std::make_shared<spdlog::sinks::ostream_sink_mt>(output);
+	outputSink->set_pattern("%s:%# %v");
+	spdlog::logger outputLogger{ "Output", outputSink };
+	Logger::AddEditorLogger(&outputLogger);
+
+	Logger::EnableAsync();
+
+	// The format is copied into the record, so a char buffer can be reused right after the call
+	char format[32] = "Value {}";
+	const int logLine = __LINE__ + 1;
+	CE_LOG(Info, Console, format, 42);
+	strcpy(format, "Reused {}");
+
+	Logger::Flush();
+
+	std::string message = output.str();
+	EXPECT_NE(message.find("Value 42"), std::string::npos);
+	EXPECT_EQ(message.find("Reused"), std::string::npos);
+
+#if !CE_BUILD_RELEASE
+	EXPECT_NE(message.find(String::Format("Main.cpp:{} ", logLine).ToStdString()), std::string::npos);
+#else
+	(void)logLine;
+#endif
+
+	Logger::DisableAsync();
+
+	Logger::RemoveEditorLogger(&outputLogger);
+	Logger::Shutdown();
+
+	TEST_END;
+}
+
+TEST(Logger, AsyncLatency)
+{
+	TEST_BEGIN;
+
+	Logger::Initialize();
+	Logger::SetConsoleLogLevel(LogLevel::Off);
+	Logger::SetFileDumpLogLevel(LogLevel::Trace);
+
+	constexpr int NumThreads = 4;
+	constexpr int NumMessages = 2000;
+
+	// Per call latency of CE_LOG on threads that log in a tight loop
+	auto measure = [&]() -> Array<s64>
+		{
+			Array<s64> latencies{};
+			latencies.Resize(NumThreads * NumMessages);
+
+			Array<Thread*> threads{};
+			for (int t = 0; t < NumThreads; t++)
+			{
+				threads.Add(new Thread([t, &latencies]
+					{
+						String name = "Latency";
+						for (int i = 0; i < NumMessages; i++)
+						{
+							auto start = std::chrono::steady_clock::now();
+							CE_LOG(Info, LogFile, "{} thread {} message {} value {}", name, t, i, i * 0.5f);
+							auto end = std::chrono::steady_clock::now();
+
+							latencies[t * NumMessages + i] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+						}
+					}));
+			}
+
+			for (Thread* thread : threads)
+			{
+				thread->Join();
+				delete thread;
+			}
+
+			latencies.Sort([](s64 a, s64 b) { return a < b; });
+			return latencies;
+		};
+
+	Array<s64> syncLatencies = measure();
+	Logger::Flush();
+
+	AsyncLogSettings settings{};
+	settings.bufferCapacity = NumMessages * 2;
+	Logger::EnableAsync(settings);
+
+	Array<s64> asyncLatencies = measure();
+	Logger::Flush();
+
+	AsyncLogStatistics statistics = Logger::GetAsyncStatistics();
+	EXPECT_EQ(statistics.numDropped, 0u);
+
+	auto percentile = [](const Array<s64>& latencies, int percent)
+		{
+			return latencies[latencies.GetSize() * percent / 100];
+		};
+
+	LOG("CE_LOG latency on " << NumThreads << " threads (ns): sync p50 " << percentile(syncLatencies, 50) << " p99 " << percentile(syncLatencies, 99)
+		<< ", async p50 " << percentile(asyncLatencies, 50) << " p99 " << percentile(asyncLatencies, 99));
+
+	Logger::DisableAsync();
+	Logger::Shutdown();
+
+	TEST_END;
+}
+
+#pragma endregion
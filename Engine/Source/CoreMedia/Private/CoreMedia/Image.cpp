@@ -313,33 +313,34 @@ namespace CE
             return image;
         }
 
-		auto filePathStr = filePath.GetString();
-		FileStream stream = FileStream(filePath, Stream::Permissions::ReadOnly);
-		stream.SetBinaryMode(true);
-		
-		if (stream.GetLength() < 10)
+		// Read the file on an IO thread, and decode it from memory
+		Array<u8> fileData{};
+		if (!IO::AsyncIO::ReadFile(filePath, fileData, IO::AsyncIOPriority::High))
+		{
+			image.failureReason = "Failed to read file";
+			return image;
+		}
+
+		if (fileData.GetSize() < 10)
 		{
 			image.failureReason = "Invalid file";
 			return image;
 		}
 
-		u8 bytes[10] = {};
-		stream.Read(bytes, 10);
-		stream.Seek(0);
+		const stbi_uc* fileBytes = (const stbi_uc*)fileData.GetData();
+		const int fileLength = (int)fileData.GetSize();
 
-		auto sourceType = GetSourceFormatFromHeader(bytes);
+		auto sourceType = GetSourceFormatFromHeader(fileData.GetData());
 
 		if (sourceType == CMImageSourceFormat::PNG) // Is PNG
 		{
-			stream.Close(); // Close the stream
-
 			int x = 0, y = 0, channels = 0;
-			stbi_info(filePathStr.GetCString(), &x, &y, &channels);
+			stbi_info_from_memory(fileBytes, fileLength, &x, &y, &channels);
 			int desiredChannels = channels;
 			if (desiredChannels == 3) // Never load image as 3 channels. Use either 1, 2 or 4 channels.
 				desiredChannels = 4;
 
-			unsigned char* imageData = stbi_load(filePathStr.GetCString(), &x, &y, &channels, desiredChannels);
+			unsigned char* imageData = stbi_load_from_memory(fileBytes, fileLength, &x, &y, &channels, desiredChannels);
 
 #if PLATFORM_WINDOWS
 			// To check allocated size only on windows
@@ -370,12 +371,10 @@ namespace CE
 		}
 		else if (sourceType == CMImageSourceFormat::JPG) // Is JPG
 		{
-			stream.Close(); // Close the stream
-
 			int x = 0, y = 0, channels = 0;
-			stbi_info(filePathStr.GetCString(), &x, &y, &channels);
+			stbi_info_from_memory(fileBytes, fileLength, &x, &y, &channels);
 
-			unsigned char* imageData = stbi_load(filePathStr.GetCString(), &x, &y, &channels, STBI_rgb_alpha);
+			unsigned char* imageData = stbi_load_from_memory(fileBytes, fileLength, &x, &y, &channels, STBI_rgb_alpha);
 
 			if (channels == 1)
 				image.format = CMImageFormat::R8;
@@ -398,12 +397,10 @@ namespace CE
 		}
 		else if (sourceType == CMImageSourceFormat::HDR)
 		{
-			stream.Close();
-
 			int x = 0, y = 0, channels = 0;
-			stbi_info(filePathStr.GetCString(), &x, &y, &channels);
+			stbi_info_from_memory(fileBytes, fileLength, &x, &y, &channels);
 
-			float* imageData = stbi_loadf(filePathStr.GetCString(), &x, &y, &channels, STBI_rgb_alpha);
+			float* imageData = stbi_loadf_from_memory(fileBytes, fileLength, &x, &y, &channels, STBI_rgb_alpha);
 
 			if (channels == 1)
 				image.format = CMImageFormat::R32;
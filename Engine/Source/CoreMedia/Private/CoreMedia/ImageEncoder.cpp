@@ -114,6 +114,8 @@ namespace CE
 
 	bool CMImageEncoder::EncodeToBCn(const CMImage& image, void* outData, CMImageSourceFormat destFormat, Quality quality)
 	{
+		ZoneScoped;
+
 #if PLATFORM_DESKTOP
 		errorMessage = "";
 
@@ -159,7 +161,6 @@ namespace CE
 		surface.height = image.GetHeight();
 		surface.stride = surface.width * pixelStride;
 
-		u32 destSize = 0;
 		bc6h_enc_settings bc6Settings{};
 		bc7_enc_settings bc7Settings{};
 		bool useAlpha = false;
@@ -168,39 +169,67 @@ namespace CE
 			image.format == CMImageFormat::RGBA16 ||
 			image.format == CMImageFormat::RGBA32)
 			useAlpha = true;
-		
+
+		u32 blockSize = 16;
+
 		switch (destFormat)
 		{
 		case CMImageSourceFormat::BC1:
-			destSize = surface.width * surface.height / 2;
-			CompressBlocksBC1(&surface, (uint8_t*)outData);
-			break;
-		case CMImageSourceFormat::BC3:
-			destSize = surface.width * surface.height;
-			CompressBlocksBC3(&surface, (uint8_t*)outData);
-			break;
 		case CMImageSourceFormat::BC4:
-			destSize = surface.width * surface.height / 2;
-			CompressBlocksBC4(&surface, (uint8_t*)outData);
+			blockSize = 8;
 			break;
+		case CMImageSourceFormat::BC3:
 		case CMImageSourceFormat::BC5:
-			destSize = surface.width * surface.height;
-			CompressBlocksBC5(&surface, (uint8_t*)outData);
 			break;
 		case CMImageSourceFormat::BC6H:
-			destSize = surface.width * surface.height;
 			qualityMap[quality].second.GetBC6()(&bc6Settings);
-			CompressBlocksBC6H(&surface, (uint8_t*)outData, &bc6Settings);
 			break;
 		case CMImageSourceFormat::BC7:
-			destSize = surface.width * surface.height;
 			qualityMap[quality].second.GetBC7(!useAlpha)(&bc7Settings);
-			CompressBlocksBC7(&surface, (uint8_t*)outData, &bc7Settings);
 			break;
 		default:
 			return false; // Should never happen
 		}
 
+		// Blocks are independent, so the surface is split into bands of block rows that are encoded in parallel
+		const u32 blockRowCount = surface.height / 4;
+		const u32 blockRowByteSize = surface.width / 4 * blockSize;
+		const u32 bandCount = (blockRowCount + BlockRowsPerBand - 1) / BlockRowsPerBand;
+
+		ParallelFor(bandCount, [&](u32 band)
+			{
+				const u32 firstBlockRow = band * BlockRowsPerBand;
+				const u32 numBlockRows = Math::Min(BlockRowsPerBand, blockRowCount - firstBlockRow);
+
+				rgba_surface bandSurface = surface;
+				bandSurface.ptr = surface.ptr + (u64)firstBlockRow * 4 * surface.stride;
+				bandSurface.height = numBlockRows * 4;
+
+				uint8_t* bandOutput = (uint8_t*)outData + (u64)firstBlockRow * blockRowByteSize;
+
+				switch (destFormat)
+				{
+				case CMImageSourceFormat::BC1:
+					CompressBlocksBC1(&bandSurface, bandOutput);
+					break;
+				case CMImageSourceFormat::BC3:
+					CompressBlocksBC3(&bandSurface, bandOutput);
+					break;
+				case CMImageSourceFormat::BC4:
+					CompressBlocksBC4(&bandSurface, bandOutput);
+					break;
+				case CMImageSourceFormat::BC5:
+					CompressBlocksBC5(&bandSurface, bandOutput);
+					break;
+				case CMImageSourceFormat::BC6H:
+					CompressBlocksBC6H(&bandSurface, bandOutput, &bc6Settings);
+					break;
+				case CMImageSourceFormat::BC7:
+					CompressBlocksBC7(&bandSurface, bandOutput, &bc7Settings);
+					break;
+				}
+			});
+
 		return true;
 #else // !PLATFORM_DESKTOP
 		errorMessage = "Unsupported Platform";
@@ -0,0 +1,486 @@
+#include "CoreMedia.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define CE_MIPGEN_SSE2 1
+#	include <emmintrin.h>
+#endif
+
+namespace CE
+{
+	namespace
+	{
+		constexpr f32 KaiserAlpha = 4.0f;
+		constexpr f32 KaiserRadius = 3.0f;
+		constexpr f32 BoxRadius = 0.5f;
+
+		//! Number of rows of a mip filtered by one ParallelFor task.
+		constexpr u32 RowsPerTask = 16;
+
+		//! Iterations of the binary search that finds the alpha scale of a mip.
+		constexpr u32 AlphaCoverageIterations = 10;
+
+		//! Weights of all the source texels that contribute to a single destination texel along one axis.
+		struct FilterTaps
+		{
+			u32 first = 0;
+			u32 count = 0;
+		};
+
+		//! Polyphase filter of one axis. Every destination texel has its own taps, so the weights are computed once
+		//! per mip instead of once per texel.
+		struct FilterKernel
+		{
+			Array<FilterTaps> taps{};
+			Array<u32> indices{};
+			Array<f32> weights{};
+		};
+
+		f32 BesselI0(f32 x)
+		{
+			// Power series, converges quickly for the small arguments used by the window
+			f32 sum = 1.0f;
+			f32 term = 1.0f;
+			f32 halfX = x * 0.5f;
+			for (int k = 1; k < 32; k++)
+			{
+				term *= (halfX / (f32)k) * (halfX / (f32)k);
+				sum += term;
+				if (term < sum * 1e-7f)
+					break;
+			}
+			return sum;
+		}
+
+		f32 EvaluateFilter(CMMipFilter filter, f32 t)
+		{
+			if (filter == CMMipFilter::Box)
+			{
+				return Math::Abs(t) <= BoxRadius ? 1.0f : 0.0f;
+			}
+
+			f32 x = t / KaiserRadius;
+			if (x <= -1.0f || x >= 1.0f)
+				return 0.0f;
+
+			f32 sinc = 1.0f;
+			if (Math::Abs(t) > 1e-5f)
+			{
+				f32 piT = Math::PI * t;
+				sinc = std::sin(piT) / piT;
+			}
+
+			f32 window = BesselI0(KaiserAlpha * std::sqrt(1.0f - x * x)) / BesselI0(KaiserAlpha);
+			return sinc * window;
+		}
+
+		void BuildFilterKernel(CMMipFilter filter, bool wrapEdges, u32 srcSize, u32 dstSize, FilterKernel& out)
+		{
+			const f32 scale = (f32)srcSize / (f32)dstSize;
+			const f32 radius = (filter == CMMipFilter::Box ? BoxRadius : KaiserRadius) * scale;
+
+			out.taps.Resize(dstSize);
+			out.indices.Clear();
+			out.weights.Clear();
+
+			for (u32 i = 0; i < dstSize; i++)
+			{
+				const f32 center = ((f32)i + 0.5f) * scale;
+				const int begin = (int)std::floor(center - radius);
+				const int end = (int)std::ceil(center + radius);
+
+				FilterTaps& taps = out.taps[i];
+				taps.first = (u32)out.weights.GetSize();
+
+				f32 totalWeight = 0;
+
+				for (int j = begin; j <= end; j++)
+				{
+					f32 weight = EvaluateFilter(filter, ((f32)j + 0.5f - center) / scale);
+					if (weight == 0.0f)
+						continue;
+
+					int index = j;
+					if (wrapEdges)
+						index = ((index % (int)srcSize) + (int)srcSize) % (int)srcSize;
+					else
+						index = Math::Clamp(index, 0, (int)srcSize - 1);
+
+					out.indices.Add((u32)index);
+					out.weights.Add(weight);
+					totalWeight += weight;
+				}
+
+				taps.count = (u32)out.weights.GetSize() - taps.first;
+
+				if (taps.count == 0 || totalWeight == 0.0f)
+				{
+					// Degenerate filter: fall back to point sampling
+					out.weights.Resize(taps.first);
+					out.indices.Resize(taps.first);
+					out.indices.Add(Math::Min((u32)center, srcSize - 1));
+					out.weights.Add(1.0f);
+					taps.count = 1;
+					continue;
+				}
+
+				for (u32 t = taps.first; t < taps.first + taps.count; t++)
+				{
+					out.weights[t] /= totalWeight;
+				}
+			}
+		}
+
+		//! Filters one RGBA texel: out = sum(weights[t] * src[indices[t] * step]).
+		inline void FilterTexel(const f32* src, SIZE_T step, const FilterKernel& kernel, u32 index, f32* out)
+		{
+			const FilterTaps& taps = kernel.taps[index];
+			const u32* indices = kernel.indices.GetData() + taps.first;
+			const f32* weights = kernel.weights.GetData() + taps.first;
+
+#if CE_MIPGEN_SSE2
+			__m128 acc = _mm_setzero_ps();
+			for (u32 t = 0; t < taps.count; t++)
+			{
+				__m128 texel = _mm_loadu_ps(src + (SIZE_T)indices[t] * step);
+				acc = _mm_add_ps(acc, _mm_mul_ps(texel, _mm_set1_ps(weights[t])));
+			}
+			_mm_storeu_ps(out, acc);
+#else
+			f32 acc[4] = { 0, 0, 0, 0 };
+			for (u32 t = 0; t < taps.count; t++)
+			{
+				const f32* texel = src + (SIZE_T)indices[t] * step;
+				acc[0] += texel[0] * weights[t];
+				acc[1] += texel[1] * weights[t];
+				acc[2] += texel[2] * weights[t];
+				acc[3] += texel[3] * weights[t];
+			}
+			out[0] = acc[0]; out[1] = acc[1]; out[2] = acc[2]; out[3] = acc[3];
+#endif
+		}
+
+		template<typename TFunc>
+		void ParallelForRows(u32 rowCount, const TFunc& rowTask)
+		{
+			const u32 taskCount = (rowCount + RowsPerTask - 1) / RowsPerTask;
+
+			ParallelFor(taskCount, [&](u32 taskIndex)
+				{
+					const u32 firstRow = taskIndex * RowsPerTask;
+					const u32 lastRow = Math::Min(firstRow + RowsPerTask, rowCount);
+					for (u32 row = firstRow; row < lastRow; row++)
+					{
+						rowTask(row);
+					}
+				});
+		}
+
+		//! Downsamples an RGBA float image with a separable filter: horizontal pass first, then vertical.
+		void Downsample(const Array<f32>& src, u32 srcWidth, u32 srcHeight, Array<f32>& dst, u32 dstWidth, u32 dstHeight,
+			const CMMipGenerationSettings& settings, Array<f32>& scratch)
+		{
+			FilterKernel kernelX{};
+			FilterKernel kernelY{};
+			BuildFilterKernel(settings.filter, settings.wrapEdges, srcWidth, dstWidth, kernelX);
+			BuildFilterKernel(settings.filter, settings.wrapEdges, srcHeight, dstHeight, kernelY);
+
+			scratch.Resize(dstWidth * srcHeight * 4);
+			dst.Resize(dstWidth * dstHeight * 4);
+
+			const f32* srcData = src.GetData();
+			f32* scratchData = scratch.GetData();
+			f32* dstData = dst.GetData();
+
+			ParallelForRows(srcHeight, [&](u32 y)
+				{
+					const f32* srcRow = srcData + (SIZE_T)y * srcWidth * 4;
+					f32* outRow = scratchData + (SIZE_T)y * dstWidth * 4;
+					for (u32 x = 0; x < dstWidth; x++)
+					{
+						FilterTexel(srcRow, 4, kernelX, x, outRow + x * 4);
+					}
+				});
+
+			ParallelForRows(dstHeight, [&](u32 y)
+				{
+					f32* outRow = dstData + (SIZE_T)y * dstWidth * 4;
+					for (u32 x = 0; x < dstWidth; x++)
+					{
+						FilterTexel(scratchData + x * 4, (SIZE_T)dstWidth * 4, kernelY, y, outRow + x * 4);
+					}
+				});
+		}
+
+		f32 SRGBToLinear(f32 value)
+		{
+			return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+
+		f32 LinearToSRGB(f32 value)
+		{
+			return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+		}
+
+		//! Fraction of texels whose scaled alpha is above the cutoff.
+		f32 CalculateAlphaCoverage(const f32* pixels, SIZE_T numPixels, f32 alphaScale, f32 alphaCutoff)
+		{
+			SIZE_T count = 0;
+			for (SIZE_T i = 0; i < numPixels; i++)
+			{
+				if (pixels[i * 4 + 3] * alphaScale > alphaCutoff)
+					count++;
+			}
+			return numPixels > 0 ? (f32)count / (f32)numPixels : 0.0f;
+		}
+
+		f32 FindAlphaScale(const f32* pixels, SIZE_T numPixels, f32 targetCoverage, f32 alphaCutoff)
+		{
+			f32 minScale = 0.0f;
+			f32 maxScale = 4.0f;
+			f32 scale = 1.0f;
+
+			// Coverage is a step function of the scale, so keep the closest match rather than the last guess
+			f32 bestScale = 1.0f;
+			f32 bestError = 2.0f;
+
+			for (u32 i = 0; i < AlphaCoverageIterations; i++)
+			{
+				f32 coverage = CalculateAlphaCoverage(pixels, numPixels, scale, alphaCutoff);
+				f32 error = Math::Abs(coverage - targetCoverage);
+				if (error < bestError)
+				{
+					bestError = error;
+					bestScale = scale;
+				}
+
+				if (coverage < targetCoverage)
+					minScale = scale;
+				else if (coverage > targetCoverage)
+					maxScale = scale;
+				else
+					break;
+
+				scale = (minScale + maxScale) * 0.5f;
+			}
+
+			return bestScale;
+		}
+	}
+
+	CMImageMipGenerator::CMImageMipGenerator()
+	{
+
+	}
+
+	CMImageMipGenerator::~CMImageMipGenerator()
+	{
+
+	}
+
+	u32 CMImageMipGenerator::GetMipLevelCount(u32 width, u32 height, const CMMipGenerationSettings& settings)
+	{
+		const u32 minResolution = Math::Max<u32>(settings.minResolution, 1);
+		if (width < minResolution || height < minResolution)
+			return 1;
+
+		u32 mipLevels = 1;
+
+		while (settings.maxMipLevels == 0 || mipLevels < settings.maxMipLevels)
+		{
+			u32 mipWidth = width / 2;
+			u32 mipHeight = height / 2;
+
+			if (mipWidth < minResolution || mipHeight < minResolution)
+				break;
+			if (mipWidth % minResolution != 0 || mipHeight % minResolution != 0)
+				break;
+
+			width = mipWidth;
+			height = mipHeight;
+			mipLevels++;
+		}
+
+		return mipLevels;
+	}
+
+	bool CMImageMipGenerator::Generate(const CMImage& source, const CMMipGenerationSettings& settings, BinaryBlob& outStorage, Array<CMImage>& outMips)
+	{
+		ZoneScoped;
+
+		errorMessage = "";
+		outMips.Clear();
+
+		if (!source.IsValid())
+		{
+			errorMessage = "Invalid source image";
+			return false;
+		}
+
+		bool isFloat = false;
+
+		switch (source.GetFormat())
+		{
+		case CMImageFormat::R8:
+		case CMImageFormat::RG8:
+		case CMImageFormat::RGB8:
+		case CMImageFormat::RGBA8:
+			break;
+		case CMImageFormat::R32:
+		case CMImageFormat::RG32:
+		case CMImageFormat::RGB32:
+		case CMImageFormat::RGBA32:
+			isFloat = true;
+			break;
+		default:
+			errorMessage = "Unsupported pixel format";
+			return false;
+		}
+
+		const u32 width = source.GetWidth();
+		const u32 height = source.GetHeight();
+		const u32 numChannels = source.GetNumChannels();
+
+		// Input image is always in either layouts: 1, 2 or 4 channels
+		const u32 channelStride = numChannels == 3 ? 4 : numChannels;
+		const u32 bytesPerChannel = isFloat ? sizeof(f32) : sizeof(u8);
+		const u32 pixelStride = channelStride * bytesPerChannel;
+
+		// Alpha and single/dual channel data (masks, normals, etc.) are always filtered as is
+		const bool convertSRGB = settings.gammaCorrect && !isFloat && numChannels >= 3;
+		const u32 numColorChannels = convertSRGB ? 3 : 0;
+		const bool hasAlpha = numChannels == 4;
+
+		const u32 mipLevels = GetMipLevelCount(width, height, settings);
+
+		outStorage.Free();
+
+		outMips.Add(CMImage::LoadRawImageFromMemory((unsigned char*)source.GetDataPtr(), width, height,
+			source.GetFormat(), source.GetSourceFormat(), source.GetBitDepth(), source.GetBitsPerPixel()));
+
+		if (mipLevels <= 1)
+			return true;
+
+		u64 storageSize = 0;
+		for (u32 mip = 1; mip < mipLevels; mip++)
+		{
+			storageSize += (u64)(width >> mip) * (height >> mip) * pixelStride;
+		}
+
+		outStorage.Reserve(storageSize);
+
+		f32 srgbToLinear[256];
+		if (convertSRGB)
+		{
+			for (int i = 0; i < 256; i++)
+			{
+				srgbToLinear[i] = SRGBToLinear((f32)i / 255.0f);
+			}
+		}
+
+		// Work on RGBA float texels in linear space
+		Array<f32> buffers[2]{};
+		Array<f32> scratch{};
+		Array<f32>* current = &buffers[0];
+		Array<f32>* next = &buffers[1];
+
+		current->Resize(width * height * 4);
+
+		ParallelForRows(height, [&](u32 y)
+			{
+				const u8* srcRow = (const u8*)source.GetDataPtr() + (SIZE_T)y * width * pixelStride;
+				f32* dstRow = current->GetData() + (SIZE_T)y * width * 4;
+
+				for (u32 x = 0; x < width; x++)
+				{
+					f32* texel = dstRow + x * 4;
+					texel[0] = texel[1] = texel[2] = texel[3] = 0.0f;
+
+					for (u32 c = 0; c < numChannels; c++)
+					{
+						if (isFloat)
+						{
+							texel[c] = *((const f32*)srcRow + x * channelStride + c);
+						}
+						else
+						{
+							u8 value = *(srcRow + x * channelStride + c);
+							texel[c] = c < numColorChannels ? srgbToLinear[value] : (f32)value / 255.0f;
+						}
+					}
+				}
+			});
+
+		f32 targetCoverage = 0.0f;
+		const bool preserveCoverage = settings.preserveAlphaCoverage && hasAlpha;
+		if (preserveCoverage)
+		{
+			targetCoverage = CalculateAlphaCoverage(current->GetData(), (SIZE_T)width * height, 1.0f, settings.alphaCutoff);
+		}
+
+		u32 srcWidth = width;
+		u32 srcHeight = height;
+		u64 offset = 0;
+
+		for (u32 mip = 1; mip < mipLevels; mip++)
+		{
+			const u32 mipWidth = srcWidth / 2;
+			const u32 mipHeight = srcHeight / 2;
+			const SIZE_T numPixels = (SIZE_T)mipWidth * mipHeight;
+
+			Downsample(*current, srcWidth, srcHeight, *next, mipWidth, mipHeight, settings, scratch);
+
+			// The scale only affects this mip's output, the next mip is filtered from the unscaled alpha
+			f32 alphaScale = 1.0f;
+			if (preserveCoverage)
+			{
+				alphaScale = FindAlphaScale(next->GetData(), numPixels, targetCoverage, settings.alphaCutoff);
+			}
+
+			u8* mipData = outStorage.GetDataPtr() + offset;
+
+			ParallelForRows(mipHeight, [&](u32 y)
+				{
+					const f32* srcRow = next->GetData() + (SIZE_T)y * mipWidth * 4;
+					u8* dstRow = mipData + (SIZE_T)y * mipWidth * pixelStride;
+
+					for (u32 x = 0; x < mipWidth; x++)
+					{
+						const f32* texel = srcRow + x * 4;
+
+						for (u32 c = 0; c < channelStride; c++)
+						{
+							f32 value = c < numChannels ? texel[c] : 0.0f;
+							if (hasAlpha && c == 3)
+								value *= alphaScale;
+
+							if (isFloat)
+							{
+								*((f32*)dstRow + x * channelStride + c) = value;
+							}
+							else
+							{
+								value = Math::Clamp01(value);
+								if (c < numColorChannels)
+									value = LinearToSRGB(value);
+								*(dstRow + x * channelStride + c) = (u8)(value * 255.0f + 0.5f);
+							}
+						}
+					}
+				});
+
+			outMips.Add(CMImage::LoadRawImageFromMemory(mipData, mipWidth, mipHeight,
+				source.GetFormat(), source.GetSourceFormat(), source.GetBitDepth(), source.GetBitsPerPixel()));
+
+			offset += (u64)numPixels * pixelStride;
+
+			std::swap(current, next);
+			srcWidth = mipWidth;
+			srcHeight = mipHeight;
+		}
+
+		return true;
+	}
+
+} // namespace CE
@@ -7,6 +7,7 @@
 #include "CoreMedia/CubeMap.h"
 
 #include "CoreMedia/ImageEncoder.h"
+#include "CoreMedia/ImageMipGenerator.h"
 
 #include "CoreMedia/Font.h"
 
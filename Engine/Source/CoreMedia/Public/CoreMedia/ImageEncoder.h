@@ -22,8 +22,12 @@ namespace CE
 
         u64 GetCompressedSizeRequirement(const CMImage& image, CMImageSourceFormat destBCnFormat);
 
+        //! @brief Encodes the image in bands of 4x4 block rows, in parallel on the global job context if there is one.
         bool EncodeToBCn(const CMImage& image, void* outData, CMImageSourceFormat destBCnFormat, Quality quality = Quality_Normal);
 
+        //! Number of 4x4 block rows encoded by each job.
+        static constexpr u32 BlockRowsPerBand = 4;
+
     private:
 
         String errorMessage = "";
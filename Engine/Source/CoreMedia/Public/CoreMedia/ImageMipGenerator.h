@@ -0,0 +1,62 @@
+#pragma once
+
+namespace CE
+{
+	class BinaryBlob;
+
+	enum class CMMipFilter
+	{
+		//! 2x2 average. Fast, slightly blurry.
+		Box = 0,
+		//! Kaiser windowed sinc. Sharper mips with less aliasing.
+		Kaiser
+	};
+
+	struct CMMipGenerationSettings
+	{
+		CMMipFilter filter = CMMipFilter::Kaiser;
+
+		//! Filter 8 bit color channels in linear space. Should be enabled for sRGB color textures.
+		bool gammaCorrect = true;
+
+		//! Wrap around the edges instead of clamping. Use for tiling textures.
+		bool wrapEdges = true;
+
+		//! Scale the alpha of each mip so that the fraction of texels above alphaCutoff matches mip 0.
+		//! Keeps alpha tested foliage, fences, etc. from fading out in the distance.
+		bool preserveAlphaCoverage = false;
+		f32 alphaCutoff = 0.5f;
+
+		//! Stop before a mip gets smaller than this in either dimension. Use 4 for BCn formats.
+		u32 minResolution = 1;
+
+		//! Maximum number of mips including mip 0. Use 0 for a full chain.
+		u32 maxMipLevels = 0;
+	};
+
+	/// @brief Generates mip chains on the CPU. Rows of every mip are filtered in parallel on the global job context.
+	/// Supports 8 bit unorm (R8, RG8, RGB8, RGBA8) and 32 bit float (R32, RG32, RGB32, RGBA32) images.
+	class COREMEDIA_API CMImageMipGenerator final
+	{
+	public:
+
+		CMImageMipGenerator();
+		~CMImageMipGenerator();
+
+		inline const String& GetErrorMessage() const { return errorMessage; }
+
+		/// @brief Returns the number of mips (including mip 0) of a width x height image for the given settings.
+		static u32 GetMipLevelCount(u32 width, u32 height, const CMMipGenerationSettings& settings);
+
+		/// @brief Generates the mip chain of the source image.
+		/// @param outStorage Receives the pixels of mip 1 and below, tightly packed in the same layout as the source.
+		/// @param outMips Receives one image per mip that point into the source (mip 0) and outStorage. They don't own
+		/// their memory and must not be freed.
+		bool Generate(const CMImage& source, const CMMipGenerationSettings& settings, BinaryBlob& outStorage, Array<CMImage>& outMips);
+
+	private:
+
+		String errorMessage = "";
+	};
+
+} // namespace CE
@@ -56,3 +56,85 @@ TEST(CoreMedia, Font)
 	TEST_END;
 }
 
+
+TEST(CoreMedia, MipGeneration)
+{
+	TEST_BEGIN;
+
+	constexpr u32 width = 64;
+	constexpr u32 height = 32;
+
+	// Constant color: every mip must keep the same color
+	Array<u8> pixels{};
+	pixels.Resize(width * height * 4);
+	for (u32 i = 0; i < width * height; i++)
+	{
+		pixels[i * 4 + 0] = 200;
+		pixels[i * 4 + 1] = 50;
+		pixels[i * 4 + 2] = 128;
+		pixels[i * 4 + 3] = 255;
+	}
+
+	CMImage image = CMImage::LoadRawImageFromMemory(pixels.GetData(), width, height,
+		CMImageFormat::RGBA8, CMImageSourceFormat::None, 8, 32);
+
+	CMMipGenerationSettings settings{};
+	EXPECT_EQ(CMImageMipGenerator::GetMipLevelCount(width, height, settings), 6);
+
+	settings.minResolution = 4;
+	EXPECT_EQ(CMImageMipGenerator::GetMipLevelCount(width, height, settings), 4);
+
+	CMImageMipGenerator generator{};
+	BinaryBlob storage{};
+	Array<CMImage> mips{};
+
+	EXPECT_TRUE(generator.Generate(image, settings, storage, mips));
+	EXPECT_EQ(mips.GetSize(), 4);
+	EXPECT_EQ(storage.GetDataSize(), (32 * 16 + 16 * 8 + 8 * 4) * 4);
+
+	for (int mip = 0; mip < mips.GetSize(); mip++)
+	{
+		EXPECT_EQ(mips[mip].GetWidth(), width >> mip);
+		EXPECT_EQ(mips[mip].GetHeight(), height >> mip);
+		EXPECT_EQ(mips[mip].GetFormat(), CMImageFormat::RGBA8);
+
+		const u8* data = (const u8*)mips[mip].GetDataPtr();
+		for (u32 i = 0; i < mips[mip].GetWidth() * mips[mip].GetHeight(); i++)
+		{
+			EXPECT_NEAR(data[i * 4 + 0], 200, 1);
+			EXPECT_NEAR(data[i * 4 + 1], 50, 1);
+			EXPECT_NEAR(data[i * 4 + 2], 128, 1);
+			EXPECT_EQ(data[i * 4 + 3], 255);
+		}
+	}
+
+	// Box filtering a float checker board averages it out
+	Array<f32> checker{};
+	checker.Resize(8 * 8);
+	for (u32 y = 0; y < 8; y++)
+	{
+		for (u32 x = 0; x < 8; x++)
+		{
+			checker[y * 8 + x] = (x + y) % 2 == 0 ? 1.0f : 0.0f;
+		}
+	}
+
+	CMImage checkerImage = CMImage::LoadRawImageFromMemory((u8*)checker.GetData(), 8, 8,
+		CMImageFormat::R32, CMImageSourceFormat::None, 32, 32);
+
+	settings = {};
+	settings.filter = CMMipFilter::Box;
+	EXPECT_TRUE(generator.Generate(checkerImage, settings, storage, mips));
+	EXPECT_EQ(mips.GetSize(), 4);
+
+	for (int mip = 1; mip < mips.GetSize(); mip++)
+	{
+		const f32* data = (const f32*)mips[mip].GetDataPtr();
+		for (u32 i = 0; i < mips[mip].GetWidth() * mips[mip].GetHeight(); i++)
+		{
+			EXPECT_NEAR(data[i], 0.5f, 0.001f);
+		}
+	}
+
+	TEST_END;
+}
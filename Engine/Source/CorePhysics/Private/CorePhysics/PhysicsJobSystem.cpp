@@ -0,0 +1,98 @@
+#include "CorePhysicsPrivate.h"
+
+namespace CE
+{
+
+	PhysicsJobSystem::PhysicsJobSystem(u32 maxJobs, u32 maxBarriers)
+		: JobSystemWithBarrier(maxBarriers)
+	{
+		jobs.Init(maxJobs, maxJobs);
+	}
+
+	PhysicsJobSystem::~PhysicsJobSystem()
+	{
+		// Queued engine jobs hold a reference to a job in the free list, wait for them to release it
+		while (numEngineJobsInFlight > 0)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+	}
+
+	int PhysicsJobSystem::GetMaxConcurrency() const
+	{
+		JobContext* jobContext = JobContext::GetGlobalContext();
+		if (jobContext == nullptr || jobContext->GetJobManager() == nullptr)
+			return 1;
+
+		// Workers + the thread that waits on the barrier
+		return jobContext->GetJobManager()->GetNumThreads() + 1;
+	}
+
+	PhysicsJobSystem::JobHandle PhysicsJobSystem::CreateJob(const char* jobName, JPH::ColorArg color, const JobFunction& jobFunction, JPH::uint32 numDependencies)
+	{
+		JPH::uint32 index;
+
+		while (true)
+		{
+			index = jobs.ConstructObject(jobName, color, this, jobFunction, numDependencies);
+			if (index != AvailableJobs::cInvalidObjectIndex)
+				break;
+
+			// Wait for jobs to finish and free up space
+			JPH_ASSERT(false, "No physics jobs available!");
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		Job* job = &jobs.Get(index);
+
+		// Hold a reference before queueing, the job may finish and release itself immediately
+		JobHandle handle(job);
+
+		if (numDependencies == 0)
+		{
+			QueueJob(job);
+		}
+
+		return handle;
+	}
+
+	void PhysicsJobSystem::QueueJob(Job* job)
+	{
+		JobContext* jobContext = JobContext::GetGlobalContext();
+
+		if (jobContext == nullptr || jobContext->GetJobManager() == nullptr)
+		{
+			job->Execute();
+			return;
+		}
+
+		// Released when the engine job has run. If a barrier already executed the job, Execute() does nothing.
+		job->AddRef();
+		numEngineJobsInFlight++;
+
+		CE::Job* engineJob = new CE::JobFunction([this, job](CE::Job*)
+			{
+				job->Execute();
+				job->Release();
+
+				// Last access to the job system, it may be destroyed right after this
+				numEngineJobsInFlight--;
+			}, true, jobContext);
+
+		engineJob->Start();
+	}
+
+	void PhysicsJobSystem::QueueJobs(Job** jobs, JPH::uint numJobs)
+	{
+		for (JPH::uint i = 0; i < numJobs; i++)
+		{
+			QueueJob(jobs[i]);
+		}
+	}
+
+	void PhysicsJobSystem::FreeJob(Job* job)
+	{
+		jobs.DestructObject(job);
+	}
+
+} // namespace CE
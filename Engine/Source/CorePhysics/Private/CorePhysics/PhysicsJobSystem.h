@@ -0,0 +1,39 @@
+#pragma once
+
+namespace CE
+{
+
+	//! @brief Runs Jolt jobs on the workers of the engine's JobManager, so physics doesn't need its own thread pool.
+	//! Barriers come from JPH::JobSystemWithBarrier: a thread waiting on a barrier executes the barrier's pending
+	//! jobs itself, so physics updates make progress even when every worker is busy.
+	class PhysicsJobSystem final : public JPH::JobSystemWithBarrier
+	{
+	public:
+
+		PhysicsJobSystem(u32 maxJobs, u32 maxBarriers);
+
+		~PhysicsJobSystem() override;
+
+		int GetMaxConcurrency() const override;
+
+		JobHandle CreateJob(const char* jobName, JPH::ColorArg color, const JobFunction& jobFunction, JPH::uint32 numDependencies = 0) override;
+
+	protected:
+
+		void QueueJob(Job* job) override;
+
+		void QueueJobs(Job** jobs, JPH::uint numJobs) override;
+
+		void FreeJob(Job* job) override;
+
+	private:
+
+		using AvailableJobs = JPH::FixedSizeFreeList<Job>;
+
+		AvailableJobs jobs{};
+
+		//! @brief Engine jobs that were queued and haven't released their physics job yet.
+		Atomic<u32> numEngineJobsInFlight = 0;
+	};
+
+} // namespace CE
@@ -25,10 +25,14 @@ namespace CE
 		JPH::Factory::sInstance = new JPH::Factory();
 
 		JPH::RegisterTypes();
+
+		jobSystem = new PhysicsJobSystem(MaxPhysicsJobs, MaxPhysicsBarriers);
     }
 
     void PhysicsSystem::Shutdown()
     {
+		delete jobSystem; jobSystem = nullptr;
+
 		JPH::UnregisterTypes();
 
 		for (int i = 0; i < physicsLayers.GetCapacity(); ++i)
@@ -155,13 +155,13 @@ namespace CE
 			delete physicsSystem; physicsSystem = nullptr;
 			delete contactListener; contactListener = nullptr;
 			delete tempAllocator; tempAllocator = nullptr;
-			delete jobSystem; jobSystem = nullptr;
 	    }
 
         JPH::PhysicsSystem* physicsSystem = nullptr;
 
 		JPH::TempAllocator* tempAllocator = nullptr;
-		JPH::JobSystemThreadPool* jobSystem = nullptr;
+		// Shared by all scenes, owned by PhysicsSystem
+		JPH::JobSystem* jobSystem = nullptr;
 		BPLayerInterfaceImpl broadPhaseInterface;
 		ObjectVsBroadPhaseLayerFilterImpl objectVsBroadPhaseLayerFilter;
 		ObjectLayerPairFilterImpl objectVsObjectLayerFilter;
@@ -184,7 +184,7 @@ namespace CE
 		
 		impl = new Impl();
 		impl->tempAllocator = new JPH::TempAllocatorImpl(TempAllocatorSize);
-		impl->jobSystem = new JPH::JobSystemThreadPool(MaxPhysicsJobs, MaxPhysicsBarriers, NumPhysicsThreads);
+		impl->jobSystem = physicsSystem.GetJobSystem();
 
         impl->physicsSystem = new JPH::PhysicsSystem();
 		impl->contactListener = new CE::ContactListener();
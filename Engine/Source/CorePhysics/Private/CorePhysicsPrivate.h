@@ -13,7 +13,8 @@
 #include <Jolt/ObjectStream/SerializableAttributeTyped.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/PhysicsScene.h>
@@ -68,3 +69,5 @@ namespace JPH
 
 	};
 }
+
+#include "CorePhysics/PhysicsJobSystem.h"
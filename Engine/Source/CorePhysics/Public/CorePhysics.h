@@ -7,7 +7,7 @@ namespace JPH
 	class PhysicsSystem;
 	class Shape;
 	class TempAllocator;
-	class JobSystemThreadPool;
+	class JobSystem;
 	class BroadPhaseLayerInterface;
 	class ObjectVsBroadPhaseLayerFilter;
 	class ObjectLayerPairFilter;
@@ -19,6 +19,7 @@ namespace JPH
 namespace CE
 {
 	class PhysicsScene;
+	class PhysicsJobSystem;
 }
 
 #include "CorePhysics/PhysicsLayers.h"
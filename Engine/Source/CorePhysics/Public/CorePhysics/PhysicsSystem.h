@@ -48,6 +48,9 @@ namespace CE
         void RegisterScene(PhysicsScene* physicsScene);
 		void DeregisterScene(PhysicsScene* physicsScene);
 
+        //! @brief Job system shared by all physics scenes. Runs physics jobs on the engine's JobManager workers.
+        PhysicsJobSystem* GetJobSystem() const { return jobSystem; }
+
     private:
 
         void RegisterBuiltinLayers();
@@ -58,6 +61,8 @@ namespace CE
         HashMap<Vec2i, bool> collisionsDisabledByLayerPair;
 
 		Array<Ref<PhysicsScene>> physicsScenes;
+
+        PhysicsJobSystem* jobSystem = nullptr;
     };
     
 } // namespace CE
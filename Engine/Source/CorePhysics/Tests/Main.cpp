@@ -89,3 +89,81 @@ TEST(CorePhysics, MainTest)
 	TEST_END;
 }
 
+
+TEST(CorePhysics, JobSystem)
+{
+	TEST_BEGIN;
+
+	{
+		JobManagerDesc desc{};
+		desc.totalThreads = 4;
+
+		JobManager manager{ "PhysicsTest", desc };
+		JobContext context{ &manager };
+		JobContext::PushGlobalContext(&context);
+
+		Ref<Object> transient = GetTransient("CorePhysics");
+
+		Ref<PhysicsScene> scene = CreateObject<PhysicsScene>(transient.Get(), "PhysicsScene");
+
+		BoxShapeSettings boxShapeSettings{ Vec3(10, 0.5f, 10), scene };
+		Ref<BoxShape> groundShape = BoxShape::Create(boxShapeSettings, scene);
+
+		PhysicsBodyInitInfo groundInit{};
+		groundInit.objectName = "Ground";
+		groundInit.ownerScene = scene;
+		groundInit.layer = BuiltinPhysicsLayer::Default;
+		groundInit.motionType = PhysicsMotionType::Static;
+		groundInit.position = Vec3(0, 0, 0);
+		groundInit.shape = groundShape;
+		Ref<PhysicsBody> ground = scene->AddBody(groundInit);
+
+		BoxShapeSettings cubeShapeSettings{ Vec3(1, 1, 1), scene };
+		Ref<BoxShape> cubeShape = BoxShape::Create(cubeShapeSettings, scene);
+
+		// Enough bodies to split the update into several jobs
+		Array<Ref<PhysicsBody>> cubes{};
+		for (int i = 0; i < 16; i++)
+		{
+			PhysicsBodyInitInfo cubeInit{};
+			cubeInit.objectName = String::Format("Cube{}", i);
+			cubeInit.ownerScene = scene;
+			cubeInit.layer = BuiltinPhysicsLayer::Default;
+			cubeInit.motionType = PhysicsMotionType::Dynamic;
+			cubeInit.position = Vec3((f32)(i % 4) * 4 - 6, 20, (f32)(i / 4) * 4 - 6);
+			cubeInit.shape = cubeShape;
+			cubes.Add(scene->AddBody(cubeInit));
+		}
+
+		scene->SetSimulationEnabled(true);
+
+		for (int i = 0; i < 600; i++)
+		{
+			PhysicsSystem::Get().Tick(1 / 60.0f);
+		}
+
+		// Every cube fell & came to rest on the ground
+		for (const Ref<PhysicsBody>& cube : cubes)
+		{
+			Vec3 position = cube->GetPosition();
+			EXPECT_GT(position.y, 1.0f);
+			EXPECT_LT(position.y, 2.0f);
+		}
+
+		for (const Ref<PhysicsBody>& cube : cubes)
+		{
+			scene->RemoveBody(cube);
+		}
+		scene->RemoveBody(ground);
+
+		scene->BeginDestroy();
+		scene = nullptr;
+
+		// Wait for jobs to complete & worker threads to deactivate
+		manager.Complete();
+
+		JobContext::PopGlobalContext();
+	}
+
+	TEST_END;
+}
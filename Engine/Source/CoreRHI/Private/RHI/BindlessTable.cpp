@@ -0,0 +1,141 @@
+#include "CoreRHI.h"
+
+namespace CE::RHI
+{
+
+	BindlessTable::BindlessTable(const BindlessTableDescriptor& desc) : RHIResource(ResourceType::BindlessTable)
+	{
+		textureSlots.capacity = desc.textureCapacity;
+		bufferSlots.capacity = desc.bufferCapacity;
+	}
+
+	BindlessTable::~BindlessTable()
+	{
+
+	}
+
+	u32 BindlessTable::AddTexture(RHI::Texture* texture)
+	{
+		if (texture == nullptr)
+			return InvalidIndex;
+
+		// The descriptor write is done under the lock too, descriptor updates of the same set must not overlap
+		LockGuard lock{ mutex };
+
+		u32 index = textureSlots.Allocate();
+		if (index != InvalidIndex)
+		{
+			WriteTexture(index, texture, nullptr);
+		}
+		return index;
+	}
+
+	u32 BindlessTable::AddTexture(RHI::TextureView* textureView)
+	{
+		if (textureView == nullptr)
+			return InvalidIndex;
+
+		// The descriptor write is done under the lock too, descriptor updates of the same set must not overlap
+		LockGuard lock{ mutex };
+
+		u32 index = textureSlots.Allocate();
+		if (index != InvalidIndex)
+		{
+			WriteTexture(index, textureView->GetTexture(), textureView);
+		}
+		return index;
+	}
+
+	void BindlessTable::RemoveTexture(u32 index)
+	{
+		if (index == InvalidIndex)
+			return;
+
+		LockGuard lock{ mutex };
+		textureSlots.Free(index, frameNumber);
+	}
+
+	u32 BindlessTable::AddBuffer(const RHI::BufferView& bufferView)
+	{
+		if (bufferView.GetBuffer() == nullptr)
+			return InvalidIndex;
+
+		// The descriptor write is done under the lock too, descriptor updates of the same set must not overlap
+		LockGuard lock{ mutex };
+
+		u32 index = bufferSlots.Allocate();
+		if (index != InvalidIndex)
+		{
+			WriteBuffer(index, bufferView);
+		}
+		return index;
+	}
+
+	void BindlessTable::RemoveBuffer(u32 index)
+	{
+		if (index == InvalidIndex)
+			return;
+
+		LockGuard lock{ mutex };
+		bufferSlots.Free(index, frameNumber);
+	}
+
+	void BindlessTable::AdvanceFrame()
+	{
+		LockGuard lock{ mutex };
+
+		frameNumber++;
+
+		textureSlots.Reclaim(frameNumber);
+		bufferSlots.Reclaim(frameNumber);
+	}
+
+	u32 BindlessTable::SlotAllocator::Allocate()
+	{
+		if (freeSlots.NotEmpty())
+		{
+			u32 index = freeSlots.Top();
+			freeSlots.Pop();
+			usedCount++;
+			return index;
+		}
+
+		if (highWaterMark >= capacity)
+		{
+			return InvalidIndex;
+		}
+
+		usedCount++;
+		return highWaterMark++;
+	}
+
+	void BindlessTable::SlotAllocator::Free(u32 index, u64 frameNumber)
+	{
+		if (index >= highWaterMark)
+			return;
+
+		usedCount--;
+		pendingFrees.Add({ index, frameNumber });
+	}
+
+	void BindlessTable::SlotAllocator::Reclaim(u64 frameNumber)
+	{
+		// pendingFrees is ordered by frame number
+		int reclaimCount = 0;
+
+		for (const auto& [index, freedFrame] : pendingFrees)
+		{
+			if (frameNumber - freedFrame < FrameLatency)
+				break;
+
+			freeSlots.Add(index);
+			reclaimCount++;
+		}
+
+		if (reclaimCount > 0)
+		{
+			pendingFrees.RemoveRange(0, reclaimCount);
+		}
+	}
+
+} // namespace CE::RHI
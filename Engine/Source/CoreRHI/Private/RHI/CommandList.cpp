@@ -0,0 +1,37 @@
+#include "CoreRHI.h"
+
+namespace CE::RHI
+{
+	static Mutex gFrameBindingStatsMutex{};
+	static CommandListBindingStats gFrameBindingStats{};
+
+	CommandListBindingStats& CommandListBindingStats::operator+=(const CommandListBindingStats& rhs)
+	{
+		pipelineBinds += rhs.pipelineBinds;
+		pipelineBindsSkipped += rhs.pipelineBindsSkipped;
+		vertexBufferBinds += rhs.vertexBufferBinds;
+		vertexBufferBindsSkipped += rhs.vertexBufferBindsSkipped;
+		indexBufferBinds += rhs.indexBufferBinds;
+		indexBufferBindsSkipped += rhs.indexBufferBindsSkipped;
+		descriptorSetBinds += rhs.descriptorSetBinds;
+		descriptorSetBindsSkipped += rhs.descriptorSetBindsSkipped;
+		return *this;
+	}
+
+	CommandListBindingStats CommandList::ConsumeFrameBindingStats()
+	{
+		LockGuard guard{ gFrameBindingStatsMutex };
+
+		CommandListBindingStats stats = gFrameBindingStats;
+		gFrameBindingStats = {};
+		return stats;
+	}
+
+	void CommandList::SubmitBindingStats()
+	{
+		LockGuard guard{ gFrameBindingStatsMutex };
+
+		gFrameBindingStats += bindingStats;
+	}
+
+} // namespace CE::RHI
@@ -14,6 +14,7 @@ namespace CE::RHI
 
 		compiler = RHI::gDynamicRHI->CreateFrameGraphCompiler();
 		executer = RHI::gDynamicRHI->CreateFrameGraphExecuter();
+		executer->SetDrawListChunkSize(descriptor.drawListChunkSize);
 	}
 
 	FrameScheduler* FrameScheduler::Create(const FrameSchedulerDescriptor& descriptor)
@@ -112,6 +113,16 @@ namespace CE::RHI
 		scope->drawList = drawList;
 	}
 
+	void FrameScheduler::SetDrawListChunkSize(u32 chunkSize)
+	{
+		executer->SetDrawListChunkSize(chunkSize);
+	}
+
+	u32 FrameScheduler::GetDrawListChunkSize() const
+	{
+		return executer->GetDrawListChunkSize();
+	}
+
 	RHI::Scope* FrameScheduler::FindScope(const ScopeId& scopeId)
 	{
 		return frameGraph->scopesById[scopeId];
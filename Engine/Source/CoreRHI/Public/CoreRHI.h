@@ -29,6 +29,7 @@
 #include "RHI/GraphicsPipelineCollection.h"
 #include "RHI/Shader.h"
 #include "RHI/ShaderResourceGroup.h"
+#include "RHI/BindlessTable.h"
 #include "RHI/IndexBufferView.h"
 #include "RHI/VertexBufferView.h"
 #include "RHI/TextureView.h"
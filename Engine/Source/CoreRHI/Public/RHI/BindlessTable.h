@@ -0,0 +1,84 @@
+#pragma once
+
+namespace CE::RHI
+{
+	class Texture;
+	class TextureView;
+
+	struct BindlessTableDescriptor
+	{
+		u32 textureCapacity = 16384;
+		u32 bufferCapacity = 4096;
+	};
+
+	//! @brief Global table of texture and buffer descriptors that shaders index with plain integers.
+	//! Shaders access it through the SRG_Bindless set (see Core/Bindless.hlsli). Every pipeline that uses it binds the
+	//! same descriptor set, so draws that only differ by the resources they read no longer need separate SRGs.
+	//!
+	//! Slots are allocated from a free list. A removed slot is only reused after FrameLatency frames, because command
+	//! buffers that are still in flight may index it.
+	class CORERHI_API BindlessTable : public RHIResource
+	{
+	protected:
+		BindlessTable(const BindlessTableDescriptor& desc);
+
+	public:
+
+		static constexpr u32 InvalidIndex = NumericLimits<u32>::Max();
+
+		//! @brief Number of frames a removed slot stays reserved before it can be reused.
+		static constexpr u32 FrameLatency = RHI::Limits::MaxSwapChainImageCount + 1;
+
+		virtual ~BindlessTable();
+
+		//! @return Index of the texture in the table, or InvalidIndex if the table is full.
+		u32 AddTexture(RHI::Texture* texture);
+		u32 AddTexture(RHI::TextureView* textureView);
+
+		void RemoveTexture(u32 index);
+
+		//! @return Index of the buffer in the table, or InvalidIndex if the table is full.
+		u32 AddBuffer(const RHI::BufferView& bufferView);
+
+		void RemoveBuffer(u32 index);
+
+		//! @brief Makes slots that were removed FrameLatency frames ago available again. Called once per frame by the backend.
+		void AdvanceFrame();
+
+		u32 GetTextureCapacity() const { return textureSlots.capacity; }
+		u32 GetBufferCapacity() const { return bufferSlots.capacity; }
+
+		u32 GetTextureCount() const { return textureSlots.usedCount; }
+		u32 GetBufferCount() const { return bufferSlots.usedCount; }
+
+	protected:
+
+		virtual void WriteTexture(u32 index, RHI::Texture* texture, RHI::TextureView* textureView) = 0;
+
+		virtual void WriteBuffer(u32 index, const RHI::BufferView& bufferView) = 0;
+
+	private:
+
+		struct SlotAllocator
+		{
+			u32 Allocate();
+
+			void Free(u32 index, u64 frameNumber);
+
+			void Reclaim(u64 frameNumber);
+
+			u32 capacity = 0;
+			u32 highWaterMark = 0;
+			u32 usedCount = 0;
+			Array<u32> freeSlots{};
+			Array<Pair<u32, u64>> pendingFrees{};
+		};
+
+		SlotAllocator textureSlots{};
+		SlotAllocator bufferSlots{};
+
+		u64 frameNumber = 0;
+		Mutex mutex{};
+	};
+
+} // namespace CE::RHI
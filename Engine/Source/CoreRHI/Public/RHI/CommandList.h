@@ -79,6 +79,14 @@ namespace CE::RHI
 		u16 mipSlice = 0;
 		u16 baseArrayLayer = 0;
 		u16 layerCount = 1;
+
+		//! @brief Row pitch and image height of the buffer data in texels. 0 means tightly packed.
+		u32 bufferRowLength = 0;
+		u32 bufferImageHeight = 0;
+
+		//! @brief Sub-region of the texture to write. A zero extent copies the whole mip.
+		Vec3i dstOffset{};
+		Vec3i dstExtent{};
 	};
 
 	struct BufferCopy
@@ -101,6 +109,25 @@ namespace CE::RHI
 		u64 bufferOffset = 0;
 	};
 
+	//! @brief Number of state bindings a command list recorded, and how many were skipped because the state
+	//! was already bound.
+	struct CommandListBindingStats
+	{
+		u32 pipelineBinds = 0;
+		u32 pipelineBindsSkipped = 0;
+
+		u32 vertexBufferBinds = 0;
+		u32 vertexBufferBindsSkipped = 0;
+
+		u32 indexBufferBinds = 0;
+		u32 indexBufferBindsSkipped = 0;
+
+		u32 descriptorSetBinds = 0;
+		u32 descriptorSetBindsSkipped = 0;
+
+		CommandListBindingStats& operator+=(const CommandListBindingStats& rhs);
+	};
+
 	class CORERHI_API CommandList : public RHIResource
 	{
 	protected:
@@ -167,8 +194,22 @@ namespace CE::RHI
 
 		virtual void CopyBufferRegion(const BufferCopy& copy) = 0;
 
+		// - Stats -
+
+		//! @brief Binding stats of the commands recorded since the last Begin().
+		const CommandListBindingStats& GetBindingStats() const { return bindingStats; }
+
+		//! @brief Returns the binding stats of all command lists that ended since the last call, and resets them.
+		//! Called once per frame by the renderer.
+		static CommandListBindingStats ConsumeFrameBindingStats();
+
 	protected:
 
+		//! @brief Adds the stats of this command list to the frame totals. Backends call this from End().
+		void SubmitBindingStats();
+
+		CommandListBindingStats bindingStats{};
+
 		u32 currentImageIndex = 0;
 
 		RHI::CommandListType commandListType = RHI::CommandListType::Direct;
@@ -24,6 +24,9 @@ namespace CE::RHI
         inline u64 GetMaxConstantBufferRange() const { return maxConstantBufferRange; }
         inline u64 GetMaxStructuredBufferRange() const { return maxStructuredBufferRange; }
 
+        //! @brief Dynamic offsets and offsets of constant buffer views must be a multiple of this value.
+        inline u64 GetConstantBufferOffsetAlignment() const { return constantBufferOffsetAlignment; }
+
         bool IsSparseBindingSupported() const { return sparseBinding; }
 
         bool IsSparseTexture2DResidencySupported(u32 sampleCount)
@@ -60,6 +63,7 @@ namespace CE::RHI
 
         u32 maxConstantBufferRange = 0;
         u32 maxStructuredBufferRange = 0;
+        u64 constantBufferOffsetAlignment = 256;
 
         bool sparseBinding = false;
         bool sparseResidency2D = false;
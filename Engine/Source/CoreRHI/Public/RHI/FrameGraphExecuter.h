@@ -29,9 +29,17 @@ namespace CE::RHI
 
 		virtual void ResetFramesInFlight() = 0;
 
+		//! @brief Sets the number of draw items recorded by a single job when a scope's draw list is recorded in parallel.
+		//! Draw lists that are not larger than the chunk size are recorded inline. Set it to 0 to disable parallel recording.
+		inline void SetDrawListChunkSize(u32 chunkSize) { drawListChunkSize = chunkSize; }
+
+		inline u32 GetDrawListChunkSize() const { return drawListChunkSize; }
+
 	protected:
 		FrameGraphExecuter() = default;
 
+		u32 drawListChunkSize = 0;
+
 	private:
 
 		virtual bool ExecuteInternal(const FrameGraphExecuteRequest& executeRequest) = 0;
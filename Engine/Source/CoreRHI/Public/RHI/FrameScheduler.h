@@ -10,6 +10,10 @@ namespace CE::RHI
 	{
 		//! @brief Number of frames being rendered simultaneously (ex: triple buffering = 3).
 		u32 numFramesInFlight = 2;
+
+		//! @brief Number of draw items recorded per job when recording a scope's draw list in parallel.
+		//! Set it to 0 to record all draw lists on the thread executing the frame graph.
+		u32 drawListChunkSize = 0;
 	};
 
 	//! FrameScheduler provides user facing API to construct, compile and execute FrameGraph.
@@ -47,6 +51,10 @@ namespace CE::RHI
 
 		void SetScopeDrawList(const ScopeId& scopeId, DrawList* drawList);
 
+		void SetDrawListChunkSize(u32 chunkSize);
+
+		u32 GetDrawListChunkSize() const;
+
 		RHI::Scope* FindScope(const ScopeId& scopeId);
         
         FrameAttachment* GetFrameAttachment(AttachmentID id) const;
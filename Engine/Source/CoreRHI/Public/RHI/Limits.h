@@ -48,6 +48,9 @@ namespace CE::RHI
 
 			/// @brief Max byte size of root constants
 			constexpr u8 MaxRootConstantSize = 128;
+
+			/// @brief Max number of dynamic buffer offsets in a single shader resource group
+			constexpr u32 MaxDynamicOffsetCount = 8;
 		}
 	}
 } // namespace CE::RPI
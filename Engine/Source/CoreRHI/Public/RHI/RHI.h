@@ -147,6 +147,9 @@ namespace CE::RHI
 		virtual RHI::ShaderResourceGroup* CreateShaderResourceGroup(const RHI::ShaderResourceGroupLayout& srgLayout) = 0;
 		virtual void DestroyShaderResourceGroup(RHI::ShaderResourceGroup* shaderResourceGroup) = 0;
 
+		//! @brief Returns the global bindless table, or nullptr if the device doesn't support bindless resources.
+		virtual RHI::BindlessTable* GetBindlessTable() = 0;
+
 		// - Pipeline State -
 
 		virtual RHI::PipelineState* CreateGraphicsPipeline(const RHI::GraphicsPipelineDescriptor& desc) = 0;
@@ -23,6 +23,7 @@ namespace CE::RHI
         Pipeline,
         PipelineState,
 		ShaderResourceGroup,
+		BindlessTable,
 
 		MemoryHeap,
         RenderTarget,
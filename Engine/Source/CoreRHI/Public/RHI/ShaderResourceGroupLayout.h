@@ -12,6 +12,8 @@ namespace CE::RHI
 		PerMaterial,
 		PerObject,
 		PerDraw,
+		//! @brief Global bindless texture & buffer table. Never instantiated as an SRG, see RHI::BindlessTable.
+		Bindless,
         COUNT
 	};
 	ENUM_CLASS(SRGType);
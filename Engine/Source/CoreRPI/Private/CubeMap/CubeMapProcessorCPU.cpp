@@ -0,0 +1,749 @@
+#include "CoreRPI.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define CE_IBL_SSE2 1
+#	include <emmintrin.h>
+#endif
+
+namespace CE::RPI
+{
+	namespace
+	{
+		// GGX samples per specular texel. Lower than the GPU pass because every sample reads
+		// the source mip that matches its solid angle, which hides the undersampling.
+		constexpr u32 SpecularSampleCount = 512;
+
+		// Number of samples transformed together by the specular kernel
+		constexpr u32 LaneCount = 4;
+
+		// 16 bit float cannot store values larger than 65,000
+		constexpr f32 MaxHalfValue = 65000.0f;
+
+		// Source rows per SH9 projection job
+		constexpr u32 ProjectionRowsPerJob = 16;
+
+		struct Float3
+		{
+			f32 x = 0, y = 0, z = 0;
+		};
+
+		FORCE_INLINE Float3 Normalize(const Float3& v)
+		{
+			f32 invLength = 1.0f / sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+			return { v.x * invLength, v.y * invLength, v.z * invLength };
+		}
+
+		FORCE_INLINE Float3 Cross(const Float3& a, const Float3& b)
+		{
+			return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+		}
+
+		//! @brief Equirectangular HDR image with a full box filtered mip chain. 3 floats per pixel.
+		struct EquirectImage
+		{
+			struct Level
+			{
+				u32 width = 0;
+				u32 height = 0;
+				Array<f32> pixels{};
+			};
+
+			Array<Level> levels{};
+		};
+
+		//! @brief GGX samples of one specular mip in tangent space (N = V = +Z). Only samples with NoL > 0 are kept,
+		//! padded with zero weight samples to a multiple of LaneCount.
+		struct SpecularSampleTable
+		{
+			Array<f32> x{}, y{}, z{};
+			Array<f32> weight{};
+			Array<f32> lod{};
+			f32 totalWeight = 0;
+		};
+
+		f32 RadicalInverse(u32 bits)
+		{
+			bits = (bits << 16u) | (bits >> 16u);
+			bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+			bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+			bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+			bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+			return (f32)bits * 2.3283064365386963e-10f; // / 0x100000000
+		}
+
+		//! @brief Direction of the center of a texel in cubemap face order +X, -X, +Y, -Y, +Z, -Z.
+		Float3 GetCubeMapDirection(u32 face, u32 x, u32 y, u32 resolution)
+		{
+			f32 u = 2.0f * ((f32)x + 0.5f) / (f32)resolution - 1.0f;
+			f32 v = 2.0f * ((f32)y + 0.5f) / (f32)resolution - 1.0f;
+
+			switch (face)
+			{
+			case 0: return Normalize({ 1.0f, -v, -u });
+			case 1: return Normalize({ -1.0f, -v, u });
+			case 2: return Normalize({ u, 1.0f, v });
+			case 3: return Normalize({ u, -1.0f, -v });
+			case 4: return Normalize({ u, -v, 1.0f });
+			default: return Normalize({ -u, -v, -1.0f });
+			}
+		}
+
+		//! @brief Same as SampleSphericalMap() in the Equirectangular shader.
+		FORCE_INLINE void CubeMapDirectionToEquirect(const Float3& dir, f32& u, f32& v)
+		{
+			u = atan2(dir.z, dir.x) * 0.1591f + 0.5f;
+			v = asin(Math::Clamp(dir.y, -1.0f, 1.0f)) * 0.3183f + 0.5f;
+		}
+
+		//! @brief Same as SphericalEnvmapToDirection() in the IBL Convolution shader.
+		FORCE_INLINE Float3 EquirectToEnvMapDirection(f32 u, f32 v)
+		{
+			const f32 theta = Math::PI * (1.0f - v);
+			const f32 phi = 2.0f * Math::PI * (0.5f - u);
+			const f32 sinTheta = sin(theta);
+
+			Float3 dir;
+			dir.x = sinTheta * cos(phi);
+			dir.y = sinTheta * sin(phi);
+			dir.z = cos(theta);
+			return dir;
+		}
+
+		//! @brief Environment direction the GPU path convolves for the given cubemap texel.
+		FORCE_INLINE Float3 GetEnvMapNormal(u32 face, u32 x, u32 y, u32 resolution)
+		{
+			f32 u, v;
+			CubeMapDirectionToEquirect(GetCubeMapDirection(face, x, y, resolution), u, v);
+			return EquirectToEnvMapDirection(u, v);
+		}
+
+		FORCE_INLINE void SampleBilinear(const EquirectImage::Level& level, f32 u, f32 v, f32* outColor)
+		{
+			const s32 width = (s32)level.width;
+			const s32 height = (s32)level.height;
+
+			f32 x = u * width - 0.5f;
+			f32 y = v * height - 0.5f;
+			f32 x0f = floor(x);
+			f32 y0f = floor(y);
+			f32 tx = x - x0f;
+			f32 ty = y - y0f;
+
+			// Wrap horizontally, clamp vertically
+			s32 x0 = (s32)x0f % width;
+			if (x0 < 0)
+				x0 += width;
+			s32 x1 = x0 + 1 == width ? 0 : x0 + 1;
+			s32 y0 = Math::Clamp((s32)y0f, 0, height - 1);
+			s32 y1 = Math::Clamp((s32)y0f + 1, 0, height - 1);
+
+			const f32* p00 = level.pixels.GetData() + 3 * (y0 * width + x0);
+			const f32* p10 = level.pixels.GetData() + 3 * (y0 * width + x1);
+			const f32* p01 = level.pixels.GetData() + 3 * (y1 * width + x0);
+			const f32* p11 = level.pixels.GetData() + 3 * (y1 * width + x1);
+
+			for (int c = 0; c < 3; c++)
+			{
+				f32 top = p00[c] + (p10[c] - p00[c]) * tx;
+				f32 bottom = p01[c] + (p11[c] - p01[c]) * tx;
+				outColor[c] = top + (bottom - top) * ty;
+			}
+		}
+
+		FORCE_INLINE void SampleTrilinear(const EquirectImage& image, f32 u, f32 v, f32 lod, f32* outColor)
+		{
+			const f32 maxLod = (f32)(image.levels.GetSize() - 1);
+			lod = Math::Clamp(lod, 0.0f, maxLod);
+
+			u32 lod0 = (u32)lod;
+			f32 t = lod - (f32)lod0;
+
+			SampleBilinear(image.levels[lod0], u, v, outColor);
+
+			if (t > 0.0f && lod0 + 1 < image.levels.GetSize())
+			{
+				f32 next[3];
+				SampleBilinear(image.levels[lod0 + 1], u, v, next);
+
+				for (int c = 0; c < 3; c++)
+				{
+					outColor[c] += (next[c] - outColor[c]) * t;
+				}
+			}
+		}
+
+		FORCE_INLINE void WriteHalfPixel(u8* dst, f32 r, f32 g, f32 b)
+		{
+			u16* pixel = (u16*)dst;
+			pixel[0] = Math::ToFloat16(Math::Min(r, MaxHalfValue));
+			pixel[1] = Math::ToFloat16(Math::Min(g, MaxHalfValue));
+			pixel[2] = Math::ToFloat16(Math::Min(b, MaxHalfValue));
+			pixel[3] = Math::ToFloat16(1.0f);
+		}
+
+		// - Vectorized atan2 -
+		// Polynomial approximation, max error ~1e-6 radians. Far below the angular size of a source texel.
+
+		constexpr f32 AtanC0 = 0.99997726f;
+		constexpr f32 AtanC1 = -0.33262347f;
+		constexpr f32 AtanC2 = 0.19354346f;
+		constexpr f32 AtanC3 = -0.11643287f;
+		constexpr f32 AtanC4 = 0.05265332f;
+		constexpr f32 AtanC5 = -0.01172120f;
+
+#if CE_IBL_SSE2
+
+		FORCE_INLINE __m128 Select(__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		FORCE_INLINE __m128 FastAtan2(__m128 y, __m128 x)
+		{
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 ax = _mm_andnot_ps(signMask, x);
+			const __m128 ay = _mm_andnot_ps(signMask, y);
+
+			const __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(_mm_max_ps(ax, ay), _mm_set1_ps(1e-30f)));
+			const __m128 s = _mm_mul_ps(a, a);
+
+			__m128 r = _mm_set1_ps(AtanC5);
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(AtanC4));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(AtanC3));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(AtanC2));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(AtanC1));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(AtanC0));
+			r = _mm_mul_ps(r, a);
+
+			r = Select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(Math::PI * 0.5f), r), r);
+			r = Select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(Math::PI), r), r);
+			return _mm_or_ps(r, _mm_and_ps(y, signMask));
+		}
+
+#else
+
+		FORCE_INLINE f32 FastAtan2(f32 y, f32 x)
+		{
+			const f32 ax = Math::Abs(x);
+			const f32 ay = Math::Abs(y);
+
+			const f32 a = Math::Min(ax, ay) / Math::Max(Math::Max(ax, ay), 1e-30f);
+			const f32 s = a * a;
+
+			f32 r = ((((AtanC5 * s + AtanC4) * s + AtanC3) * s + AtanC2) * s + AtanC1) * s + AtanC0;
+			r *= a;
+
+			if (ay > ax)
+				r = Math::PI * 0.5f - r;
+			if (x < 0)
+				r = Math::PI - r;
+			return y < 0 ? -r : r;
+		}
+
+#endif
+
+		/// @brief Converts LaneCount tangent space samples to world space around N and returns their
+		/// equirect coordinates, matching DirectionToSphericalEnvmap() in the IBL Convolution shader.
+		FORCE_INLINE void TransformSampleLanes(const Float3& tangentX, const Float3& tangentY, const Float3& normal,
+			const f32* sampleX, const f32* sampleY, const f32* sampleZ, f32* outU, f32* outV)
+		{
+#if CE_IBL_SSE2
+			const __m128 lx = _mm_loadu_ps(sampleX);
+			const __m128 ly = _mm_loadu_ps(sampleY);
+			const __m128 lz = _mm_loadu_ps(sampleZ);
+
+			const __m128 wx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(tangentX.x), lx), _mm_mul_ps(_mm_set1_ps(tangentY.x), ly)),
+				_mm_mul_ps(_mm_set1_ps(normal.x), lz));
+			const __m128 wy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(tangentX.y), lx), _mm_mul_ps(_mm_set1_ps(tangentY.y), ly)),
+				_mm_mul_ps(_mm_set1_ps(normal.y), lz));
+			const __m128 wz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(tangentX.z), lx), _mm_mul_ps(_mm_set1_ps(tangentY.z), ly)),
+				_mm_mul_ps(_mm_set1_ps(normal.z), lz));
+
+			const __m128 phi = FastAtan2(wy, wx);
+			const __m128 theta = FastAtan2(_mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(wx, wx), _mm_mul_ps(wy, wy))), wz);
+
+			_mm_storeu_ps(outU, _mm_sub_ps(_mm_set1_ps(0.5f), _mm_mul_ps(phi, _mm_set1_ps(0.5f / Math::PI))));
+			_mm_storeu_ps(outV, _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(theta, _mm_set1_ps(1.0f / Math::PI))));
+#else
+			for (u32 lane = 0; lane < LaneCount; lane++)
+			{
+				const f32 wx = tangentX.x * sampleX[lane] + tangentY.x * sampleY[lane] + normal.x * sampleZ[lane];
+				const f32 wy = tangentX.y * sampleX[lane] + tangentY.y * sampleY[lane] + normal.y * sampleZ[lane];
+				const f32 wz = tangentX.z * sampleX[lane] + tangentY.z * sampleY[lane] + normal.z * sampleZ[lane];
+
+				const f32 phi = FastAtan2(wy, wx);
+				const f32 theta = FastAtan2(sqrt(wx * wx + wy * wy), wz);
+
+				outU[lane] = 0.5f - phi * (0.5f / Math::PI);
+				outV[lane] = 1.0f - theta * (1.0f / Math::PI);
+			}
+#endif
+		}
+
+		/// @brief Builds the sample table for the given roughness. Mirrors PreFilterEnvMapSpecular() in the
+		/// IBL Convolution shader: since V = N, every sample's direction, weight and lod is independent of N.
+		void BuildSpecularSampleTable(f32 roughness, u32 sourceHeight, f32 maxLod, SpecularSampleTable& table)
+		{
+			roughness = Math::Clamp01(roughness);
+			const f32 alpha = roughness * roughness;
+			const f32 alpha2 = alpha * alpha;
+			const f32 solidAngleTexel = 4.0f * Math::PI / (6.0f * (f32)sourceHeight * (f32)sourceHeight);
+
+			for (u32 n = 0; n < SpecularSampleCount; n++)
+			{
+				const f32 xiX = (f32)n / (f32)SpecularSampleCount;
+				const f32 xiY = RadicalInverse(n);
+
+				const f32 phi = 2.0f * Math::PI * xiX;
+				const f32 cosTheta = sqrt((1.0f - xiY) / (1.0f + (alpha2 - 1.0f) * xiY));
+				const f32 sinTheta = sqrt(Math::Max(0.0f, 1.0f - cosTheta * cosTheta));
+
+				// L = 2 * dot(V, H) * H - V, with V = N = +Z
+				const f32 hx = sinTheta * cos(phi);
+				const f32 hy = sinTheta * sin(phi);
+				const f32 lz = 2.0f * cosTheta * cosTheta - 1.0f;
+
+				const f32 NoL = Math::Clamp01(lz);
+				if (NoL <= 0.0f)
+					continue;
+
+				const f32 NoH = cosTheta;
+				const f32 VoH = cosTheta;
+
+				const f32 r2 = roughness * roughness;
+				const f32 NoH2 = NoH * NoH;
+				const f32 Dh = 1.0f / (3.14159f * r2 * pow(NoH, 4.0f)) * exp((NoH2 - 1.0f) / r2 * NoH2);
+
+				const f32 num = cosTheta * cosTheta * (alpha2 - 1.0f) + 1.0f;
+				f32 pdf = alpha2 * cosTheta * sinTheta / (Math::PI * num * num);
+				const f32 pdf2 = Dh * NoH / (4.0f * VoH);
+				pdf = pdf + (pdf2 - pdf) * alpha;
+
+				f32 lod = 0.0f;
+				if (roughness > 1e-8f && pdf > 0.0f)
+				{
+					const f32 solidAngleSample = 1.0f / ((f32)SpecularSampleCount * pdf);
+					lod = 0.5f * log2(4.0f * solidAngleSample / solidAngleTexel);
+				}
+				else if (roughness > 1e-8f)
+				{
+					lod = maxLod;
+				}
+
+				table.x.Add(2.0f * cosTheta * hx);
+				table.y.Add(2.0f * cosTheta * hy);
+				table.z.Add(lz);
+				table.weight.Add(NoL);
+				table.lod.Add(Math::Clamp(lod, 0.0f, maxLod));
+				table.totalWeight += NoL;
+			}
+
+			while (table.weight.GetSize() % LaneCount != 0)
+			{
+				table.x.Add(0.0f);
+				table.y.Add(0.0f);
+				table.z.Add(1.0f);
+				table.weight.Add(0.0f);
+				table.lod.Add(0.0f);
+			}
+		}
+
+		void PrefilterSpecular(const EquirectImage& source, const SpecularSampleTable& table, const Float3& normal, f32* outColor)
+		{
+			// Same tangent frame as ImportanceSampleGGX() in the shader
+			const Float3 up = Math::Abs(normal.z) < 0.999f ? Float3{ 0, 0, 1 } : Float3{ 1, 0, 0 };
+			const Float3 tangentX = Normalize(Cross(up, normal));
+			const Float3 tangentY = Cross(normal, tangentX);
+
+			f32 result[3] = { 0, 0, 0 };
+			alignas(16) f32 u[LaneCount];
+			alignas(16) f32 v[LaneCount];
+
+			for (u32 i = 0; i < table.weight.GetSize(); i += LaneCount)
+			{
+				TransformSampleLanes(tangentX, tangentY, normal,
+					table.x.GetData() + i, table.y.GetData() + i, table.z.GetData() + i, u, v);
+
+				for (u32 lane = 0; lane < LaneCount; lane++)
+				{
+					const f32 weight = table.weight[i + lane];
+					if (weight <= 0.0f)
+						continue;
+
+					f32 color[3];
+					SampleTrilinear(source, u[lane], v[lane], table.lod[i + lane], color);
+
+					result[0] += color[0] * weight;
+					result[1] += color[1] * weight;
+					result[2] += color[2] * weight;
+				}
+			}
+
+			const f32 invWeight = table.totalWeight > 0.0f ? 1.0f / table.totalWeight : 0.0f;
+			outColor[0] = result[0] * invWeight;
+			outColor[1] = result[1] * invWeight;
+			outColor[2] = result[2] * invWeight;
+		}
+
+		// - SH9 -
+
+		FORCE_INLINE void EvaluateSH9(const Float3& n, f32* outBasis)
+		{
+			outBasis[0] = 0.282095f;
+			outBasis[1] = 0.488603f * n.y;
+			outBasis[2] = 0.488603f * n.z;
+			outBasis[3] = 0.488603f * n.x;
+			outBasis[4] = 1.092548f * n.x * n.y;
+			outBasis[5] = 1.092548f * n.y * n.z;
+			outBasis[6] = 0.315392f * (3.0f * n.z * n.z - 1.0f);
+			outBasis[7] = 1.092548f * n.x * n.z;
+			outBasis[8] = 0.546274f * (n.x * n.x - n.y * n.y);
+		}
+
+		/// @brief Projects the environment radiance onto 9 spherical harmonics coefficients per channel.
+		void ProjectSH9(const EquirectImage::Level& level, f32* outCoefficients)
+		{
+			const u32 width = level.width;
+			const u32 height = level.height;
+			const u32 numJobs = (height + ProjectionRowsPerJob - 1) / ProjectionRowsPerJob;
+
+			Array<f64> partialSums{};
+			partialSums.Resize(numJobs * 27);
+
+			ParallelFor(numJobs, [&](u32 job)
+				{
+					f64* sums = partialSums.GetData() + job * 27;
+					const u32 endRow = Math::Min(height, (job + 1) * ProjectionRowsPerJob);
+
+					for (u32 y = job * ProjectionRowsPerJob; y < endRow; y++)
+					{
+						const f32 v = ((f32)y + 0.5f) / (f32)height;
+						const f32 theta = Math::PI * (1.0f - v);
+						const f32 solidAngle = (2.0f * Math::PI / width) * (Math::PI / height) * sin(theta);
+
+						for (u32 x = 0; x < width; x++)
+						{
+							const f32 u = ((f32)x + 0.5f) / (f32)width;
+							const f32* color = level.pixels.GetData() + 3 * (y * width + x);
+
+							f32 basis[9];
+							EvaluateSH9(EquirectToEnvMapDirection(u, v), basis);
+
+							for (int i = 0; i < 9; i++)
+							{
+								const f64 weight = basis[i] * solidAngle;
+								sums[i * 3 + 0] += color[0] * weight;
+								sums[i * 3 + 1] += color[1] * weight;
+								sums[i * 3 + 2] += color[2] * weight;
+							}
+						}
+					}
+				});
+
+			for (int i = 0; i < 27; i++)
+			{
+				f64 sum = 0;
+				for (u32 job = 0; job < numJobs; job++)
+				{
+					sum += partialSums[job * 27 + i];
+				}
+				outCoefficients[i] = (f32)sum;
+			}
+		}
+
+		/// @brief Returns irradiance / PI for the given normal, which is what the diffuse convolution shader outputs.
+		FORCE_INLINE void EvaluateIrradianceSH9(const f32* coefficients, const Float3& n, f32* outColor)
+		{
+			// Cosine lobe convolution (Ramamoorthi & Hanrahan), pre-divided by PI
+			static constexpr f32 bandScale[9] = {
+				1.0f,
+				2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f,
+				0.25f, 0.25f, 0.25f, 0.25f, 0.25f
+			};
+
+			f32 basis[9];
+			EvaluateSH9(n, basis);
+
+			outColor[0] = outColor[1] = outColor[2] = 0;
+
+			for (int i = 0; i < 9; i++)
+			{
+				const f32 weight = basis[i] * bandScale[i];
+				outColor[0] += coefficients[i * 3 + 0] * weight;
+				outColor[1] += coefficients[i * 3 + 1] * weight;
+				outColor[2] += coefficients[i * 3 + 2] * weight;
+			}
+
+			outColor[0] = Math::Max(outColor[0], 0.0f);
+			outColor[1] = Math::Max(outColor[1], 0.0f);
+			outColor[2] = Math::Max(outColor[2], 0.0f);
+		}
+
+		bool LoadEquirectImage(const CMImage& sourceImage, u32 mipLevelCount, EquirectImage& out)
+		{
+			const CMImageFormat format = sourceImage.GetFormat();
+			const u32 width = sourceImage.GetWidth();
+			const u32 height = sourceImage.GetHeight();
+
+			// 3 channel images are stored with 4 channels per pixel, like the GPU path expects
+			constexpr u32 pixelStride = 4;
+			bool isFloat = false;
+
+			switch (format)
+			{
+			case CMImageFormat::RGBA32:
+			case CMImageFormat::RGB32:
+				isFloat = true;
+				break;
+			case CMImageFormat::RGBA8:
+			case CMImageFormat::RGB8:
+				break;
+			default:
+				return false;
+			}
+
+			out.levels.Resize(mipLevelCount);
+
+			EquirectImage::Level& base = out.levels[0];
+			base.width = width;
+			base.height = height;
+			base.pixels.Resize(width * height * 3);
+
+			const void* srcPtr = sourceImage.GetDataPtr();
+
+			ParallelFor(height, [&](u32 y)
+				{
+					for (u32 x = 0; x < width; x++)
+					{
+						const u32 pixel = y * width + x;
+						f32* dst = base.pixels.GetData() + pixel * 3;
+
+						for (u32 c = 0; c < 3; c++)
+						{
+							f32 value = isFloat
+								? *((const f32*)srcPtr + pixelStride * pixel + c)
+								: (f32)*((const u8*)srcPtr + pixelStride * pixel + c) / 255.0f;
+							dst[c] = Math::Min(value, MaxHalfValue);
+						}
+					}
+				});
+
+			for (u32 mip = 1; mip < mipLevelCount; mip++)
+			{
+				const EquirectImage::Level& src = out.levels[mip - 1];
+				EquirectImage::Level& dst = out.levels[mip];
+
+				dst.width = Math::Max(1u, src.width / 2);
+				dst.height = Math::Max(1u, src.height / 2);
+				dst.pixels.Resize(dst.width * dst.height * 3);
+
+				ParallelFor(dst.height, [&](u32 y)
+					{
+						const u32 y0 = Math::Min(y * 2, src.height - 1);
+						const u32 y1 = Math::Min(y * 2 + 1, src.height - 1);
+
+						for (u32 x = 0; x < dst.width; x++)
+						{
+							const u32 x0 = Math::Min(x * 2, src.width - 1);
+							const u32 x1 = Math::Min(x * 2 + 1, src.width - 1);
+
+							for (u32 c = 0; c < 3; c++)
+							{
+								dst.pixels[3 * (y * dst.width + x) + c] = 0.25f * (
+									src.pixels[3 * (y0 * src.width + x0) + c] + src.pixels[3 * (y0 * src.width + x1) + c] +
+									src.pixels[3 * (y1 * src.width + x0) + c] + src.pixels[3 * (y1 * src.width + x1) + c]);
+							}
+						}
+					});
+			}
+
+			return true;
+		}
+	}
+
+	bool CubeMapProcessor::ProcessCubeMapOfflineCPU(const CubeMapOfflineProcessInfo& desc, BinaryBlob& output, u32& outMipLevels)
+	{
+		ZoneScoped;
+
+		if (!desc.sourceImage.IsValid())
+			return false;
+		if (desc.sourceImage.GetWidth() != desc.sourceImage.GetHeight() * 2)
+			return false;
+
+		u32 cubeMapRes = desc.cubeMapResolution;
+		if (cubeMapRes == 0)
+			cubeMapRes = desc.sourceImage.GetHeight();
+
+		const int totalHdriInputMipLevels = ceil(log2(Math::Max(desc.sourceImage.GetWidth(), desc.sourceImage.GetHeight()))) + 1;
+
+		// Same mip count rules as the GPU path
+		int specularCubeMapMipLevels = 1;
+		if (desc.specularConvolution)
+		{
+			specularCubeMapMipLevels = ceil(log2(cubeMapRes)) + 1;
+			specularCubeMapMipLevels = Math::Min(specularCubeMapMipLevels, 10); // 10 mip levels max
+			if (specularCubeMapMipLevels > totalHdriInputMipLevels)
+				specularCubeMapMipLevels = totalHdriInputMipLevels;
+
+			for (int mip = 0; desc.useCompression && mip < specularCubeMapMipLevels; mip++)
+			{
+				u32 currentRes = cubeMapRes / (u32)pow(2, mip);
+				if (currentRes < 4)
+				{
+					specularCubeMapMipLevels = mip;
+					break;
+				}
+			}
+		}
+
+		EquirectImage source{};
+		if (!LoadEquirectImage(desc.sourceImage, totalHdriInputMipLevels, source))
+			return false;
+
+		outMipLevels = specularCubeMapMipLevels;
+
+		constexpr u32 bitsPerPixel = 64; // R16G16B16A16_SFLOAT
+		constexpr u32 bytesPerPixel = bitsPerPixel / 8;
+
+		/////////////////////////////////////////////
+		// - CubeMap & Specular Convolution -
+
+		const u64 cubeMapByteSize = CalculateTotalTextureSize(cubeMapRes, cubeMapRes, bitsPerPixel, 6, specularCubeMapMipLevels);
+
+		BinaryBlob uncompressedCubeMap{};
+		BinaryBlob& cubeMapData = desc.useCompression ? uncompressedCubeMap : output;
+		cubeMapData.Reserve(cubeMapByteSize);
+
+		const f32 maxSourceLod = (f32)(source.levels.GetSize() - 1);
+
+		for (int mip = 0; mip < specularCubeMapMipLevels; mip++)
+		{
+			const u32 mipRes = cubeMapRes >> mip;
+			u8* mipData = cubeMapData.GetDataPtr() + CalculateTotalTextureSize(cubeMapRes, cubeMapRes, bitsPerPixel, 6, mip);
+
+			if (mip == 0)
+			{
+				// Equirect to cube resampling
+				ParallelFor(6 * mipRes, [&](u32 row)
+					{
+						const u32 face = row / mipRes;
+						const u32 y = row % mipRes;
+						u8* dst = mipData + ((u64)face * mipRes * mipRes + (u64)y * mipRes) * bytesPerPixel;
+
+						for (u32 x = 0; x < mipRes; x++)
+						{
+							f32 u, v;
+							CubeMapDirectionToEquirect(GetCubeMapDirection(face, x, y, mipRes), u, v);
+
+							f32 color[3];
+							SampleBilinear(source.levels[0], u, v, color);
+							WriteHalfPixel(dst + x * bytesPerPixel, color[0], color[1], color[2]);
+						}
+					});
+
+				continue;
+			}
+
+			SpecularSampleTable sampleTable{};
+			BuildSpecularSampleTable((f32)mip / (specularCubeMapMipLevels - 1), source.levels[0].height, maxSourceLod, sampleTable);
+
+			ParallelFor(6 * mipRes, [&](u32 row)
+				{
+					const u32 face = row / mipRes;
+					const u32 y = row % mipRes;
+					u8* dst = mipData + ((u64)face * mipRes * mipRes + (u64)y * mipRes) * bytesPerPixel;
+
+					for (u32 x = 0; x < mipRes; x++)
+					{
+						f32 color[3];
+						PrefilterSpecular(source, sampleTable, GetEnvMapNormal(face, x, y, mipRes), color);
+						WriteHalfPixel(dst + x * bytesPerPixel, color[0], color[1], color[2]);
+					}
+				});
+		}
+
+		if (desc.useCompression)
+		{
+			// BC6H uses 1 byte (8 bits) per pixel
+			output.Reserve(CalculateTotalTextureSize(cubeMapRes, cubeMapRes, 8, 6, specularCubeMapMipLevels));
+			CompressBC6H(uncompressedCubeMap.GetDataPtr(), cubeMapRes, specularCubeMapMipLevels, output.GetDataPtr());
+		}
+
+		/////////////////////////////////////////////
+		// - Diffuse Irradiance (SH9) -
+
+		const u32 irradianceRes = desc.diffuseIrradianceResolution;
+
+		if (irradianceRes > 0 && desc.diffuseIrradianceOutput != nullptr)
+		{
+			// SH9 only captures low frequencies, a small source mip is more than enough
+			u32 projectionLevel = 0;
+			while (projectionLevel + 1 < source.levels.GetSize() && source.levels[projectionLevel].height > 256)
+			{
+				projectionLevel++;
+			}
+
+			f32 coefficients[27];
+			ProjectSH9(source.levels[projectionLevel], coefficients);
+
+			BinaryBlob uncompressedIrradiance{};
+			BinaryBlob& irradianceData = desc.compressDiffuseIrradiance ? uncompressedIrradiance : *desc.diffuseIrradianceOutput;
+			irradianceData.Reserve((u64)irradianceRes * irradianceRes * bytesPerPixel * 6);
+
+			ParallelFor(6 * irradianceRes, [&](u32 row)
+				{
+					const u32 face = row / irradianceRes;
+					const u32 y = row % irradianceRes;
+					u8* dst = irradianceData.GetDataPtr() + ((u64)face * irradianceRes * irradianceRes + (u64)y * irradianceRes) * bytesPerPixel;
+
+					for (u32 x = 0; x < irradianceRes; x++)
+					{
+						f32 color[3];
+						EvaluateIrradianceSH9(coefficients, GetEnvMapNormal(face, x, y, irradianceRes), color);
+						WriteHalfPixel(dst + x * bytesPerPixel, color[0], color[1], color[2]);
+					}
+				});
+
+			if (desc.compressDiffuseIrradiance)
+			{
+				desc.diffuseIrradianceOutput->Reserve((u64)irradianceRes * irradianceRes * 6); // BC6H uses 1 byte per pixel
+				CompressBC6H(uncompressedIrradiance.GetDataPtr(), irradianceRes, 1, desc.diffuseIrradianceOutput->GetDataPtr());
+			}
+		}
+
+		return true;
+	}
+
+	void CubeMapProcessor::CompressBC6H(const u8* sourceData, u32 resolution, u32 mipLevelCount, u8* outputData)
+	{
+		ZoneScoped;
+
+		constexpr u32 bitsPerPixel = 64; // R16G16B16A16_SFLOAT
+
+		ParallelFor(6 * mipLevelCount, [&](u32 index)
+			{
+				const u32 mip = index / 6;
+				const u32 face = index % 6;
+				const u32 currentResolution = resolution >> mip;
+
+				const u64 sourceOffset = CalculateTotalTextureSize(resolution, resolution, bitsPerPixel, 6, mip) +
+					(u64)face * currentResolution * currentResolution * bitsPerPixel / 8;
+				// BC6H uses 8 bits per pixel
+				const u64 outputOffset = CalculateTotalTextureSize(resolution, resolution, 8, 6, mip) +
+					(u64)face * currentResolution * currentResolution;
+
+				CMImage image = CMImage::LoadRawImageFromMemory((unsigned char*)sourceData + sourceOffset,
+					currentResolution, currentResolution,
+					CMImageFormat::RGBA16, CMImageSourceFormat::None, bitsPerPixel / 4, bitsPerPixel);
+
+				CMImageEncoder encoder{};
+
+				bool result = encoder.EncodeToBCn(image, outputData + outputOffset, CMImageSourceFormat::BC6H);
+				if (!result)
+				{
+					CE_LOG(Error, All, "BC6H encoding failed: {}", encoder.GetErrorMessage());
+				}
+			});
+	}
+
+} // namespace CE::RPI
@@ -3,7 +3,7 @@
 namespace CE::RPI
 {
 
-	static u64 CalculateTotalTextureSize(u32 width, u32 height, u32 bitsPerPixel, u32 arrayCount = 1, u32 mipLevelCount = 1)
+	u64 CubeMapProcessor::CalculateTotalTextureSize(u32 width, u32 height, u32 bitsPerPixel, u32 arrayCount, u32 mipLevelCount)
 	{
 		u64 size = 0;
 
@@ -19,6 +19,11 @@ namespace CE::RPI
 
 	bool CubeMapProcessor::ProcessCubeMapOffline(const CubeMapOfflineProcessInfo& desc, BinaryBlob& output, u32& outMipLevels)
 	{
+		if (desc.useCpu || RHI::gDynamicRHI == nullptr)
+		{
+			return ProcessCubeMapOfflineCPU(desc, output, outMipLevels);
+		}
+
 #if !PLATFORM_DESKTOP
 		return false; // Only for desktop platforms
 #endif
@@ -1507,48 +1512,7 @@ namespace CE::RPI
 				output.Reserve(totalCompressedSize);
 				void* outputDataPtr = output.GetDataPtr();
 
-				Array<Thread> threads{};
-
-				for (int mip = 0; mip < cubeMap->GetMipLevelCount(); mip++)
-				{
-					for (int face = 0; face < 6; face++)
-					{
-						threads.EmplaceBack([dataPtr, mip, face, outputDataPtr, cubeMapRes, cubeMapDesc]
-							{
-								u64 totalSizeTillCurrentMipLevel = 
-									CalculateTotalTextureSize(cubeMapRes, cubeMapRes, GetBitsPerPixelForFormat(cubeMapDesc.format), 6, mip);
-								u32 currentResolution = cubeMapRes / (u32)pow(2, mip);
-
-								u32 compressedByteSizePerFace = currentResolution * currentResolution * 8 / 8; // BC6H uses 8 bits per pixel
-								u64 totalCompressedSizeTillCurrentMipLevel =
-									CalculateTotalTextureSize(cubeMapRes, cubeMapRes, 8, 6, mip); // BC6H uses 8 bits per pixel
-
-								CMImage image =
-									CMImage::LoadRawImageFromMemory((unsigned char*)dataPtr + totalSizeTillCurrentMipLevel +
-											face * currentResolution * currentResolution * GetBitsPerPixelForFormat(cubeMapDesc.format) / 8,
-										currentResolution, currentResolution,
-										CMImageFormat::RGBA16, CMImageSourceFormat::None, 
-										GetBitsPerPixelForFormat(cubeMapDesc.format) / 4, 
-										GetBitsPerPixelForFormat(cubeMapDesc.format));
-
-								CMImageEncoder encoder{};
-
-								bool result = encoder.EncodeToBCn(image, (u8*)outputDataPtr + totalCompressedSizeTillCurrentMipLevel +
-									compressedByteSizePerFace * face,
-									CMImageSourceFormat::BC6H);
-								if (!result)
-								{
-									CE_LOG(Error, All, "BC6H encoding failed: {}", encoder.GetErrorMessage());
-								}
-							});
-					}
-				}
-
-				for (int i = 0; i < threads.GetSize(); i++)
-				{
-					if (threads[i].IsJoinable())
-						threads[i].Join();
-				}
+				CompressBC6H((const u8*)dataPtr, cubeMapRes, cubeMap->GetMipLevelCount(), (u8*)outputDataPtr);
 			}
 		}
 		outputBuffer->Unmap();
@@ -1569,32 +1533,7 @@ namespace CE::RPI
 					desc.diffuseIrradianceOutput->Reserve(compressedByteSizePerFace * 6);
 					void* outputDataPtr = desc.diffuseIrradianceOutput->GetDataPtr();
 
-					Array<Thread> threads{};
-
-					for (int face = 0; face < 6; face++)
-					{
-						threads.EmplaceBack([outputDataPtr, dataPtr, compressedByteSizePerFace, face, numPixelsPerFace, diffuseIrradianceCubeMap, cubeMapDesc]
-							{
-								CMImage image =
-									CMImage::LoadRawImageFromMemory((unsigned char*)dataPtr + face * numPixelsPerFace * GetBitsPerPixelForFormat(cubeMapDesc.format) / 8,
-										diffuseIrradianceCubeMap->GetWidth(), diffuseIrradianceCubeMap->GetHeight(),
-										CMImageFormat::RGBA16, CMImageSourceFormat::None, 16, 64);
-
-								CMImageEncoder encoder{};
-
-								bool result = encoder.EncodeToBCn(image, (u8*)outputDataPtr + compressedByteSizePerFace * face, CMImageSourceFormat::BC6H);
-								if (!result)
-								{
-									CE_LOG(Error, All, "BC6H encoding failed: {}", encoder.GetErrorMessage());
-								}
-							});
-					}
-
-					for (int face = 0; face < 6; face++)
-					{
-						if (threads[face].IsJoinable())
-							threads[face].Join();
-					}
+					CompressBC6H((const u8*)dataPtr, diffuseIrradianceCubeMap->GetWidth(), 1, (u8*)outputDataPtr);
 				}
 			}
 			diffuseIrradianceOutputBuffer->Unmap();
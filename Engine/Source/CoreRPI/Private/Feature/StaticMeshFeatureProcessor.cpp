@@ -27,6 +27,74 @@ namespace CE::RPI
 				it->Deinit(this);
 			}
 		}
+
+		for (ObjectDataPage& page : objectDataPages)
+		{
+			for (RHI::Buffer*& buffer : page.buffers)
+			{
+				RPISystem::Get().QueueDestroy(buffer);
+				buffer = nullptr;
+			}
+		}
+
+		objectDataPages.Clear();
+	}
+
+	u32 StaticMeshFeatureProcessor::AllocateObjectData(StaticArray<RHI::Buffer*, RHI::Limits::MaxSwapChainImageCount>& outBuffers, u64& outOffset)
+	{
+		LockGuard lock{ objectDataMutex };
+
+		if (objectDataStride == 0)
+		{
+			u64 alignment = Math::Max<u64>(RHI::gDynamicRHI->GetDeviceLimits()->GetConstantBufferOffsetAlignment(), 16);
+			objectDataStride = Memory::GetAlignedSize(sizeof(Matrix4x4), alignment);
+		}
+
+		u32 slot = 0;
+
+		if (freeObjectDataSlots.NotEmpty())
+		{
+			slot = freeObjectDataSlots.Top();
+			freeObjectDataSlots.Pop();
+		}
+		else
+		{
+			slot = objectDataSlotCount++;
+		}
+
+		u32 pageIndex = slot / ObjectDataSlotsPerPage;
+
+		while (pageIndex >= objectDataPages.GetSize())
+		{
+			ObjectDataPage& page = objectDataPages.EmplaceBack();
+
+			for (int i = 0; i < page.buffers.GetSize(); ++i)
+			{
+				RHI::BufferDescriptor bufferDescriptor{};
+				bufferDescriptor.name = String::Format("ObjectDataPage {} ({})", objectDataPages.GetSize() - 1, i);
+				bufferDescriptor.bindFlags = RHI::BufferBindFlags::ConstantBuffer;
+				bufferDescriptor.bufferSize = objectDataStride * ObjectDataSlotsPerPage;
+				bufferDescriptor.defaultHeapType = RHI::MemoryHeapType::Upload;
+				bufferDescriptor.structureByteStride = sizeof(Matrix4x4);
+
+				page.buffers[i] = RHI::gDynamicRHI->CreateBuffer(bufferDescriptor);
+			}
+		}
+
+		outBuffers = objectDataPages[pageIndex].buffers;
+		outOffset = (slot % ObjectDataSlotsPerPage) * objectDataStride;
+
+		return slot;
+	}
+
+	void StaticMeshFeatureProcessor::FreeObjectData(u32 slot)
+	{
+		if (slot == NumericLimits<u32>::Max())
+			return;
+
+		LockGuard lock{ objectDataMutex };
+
+		freeObjectDataSlots.Add(slot);
 	}
 
 	void ModelDataInstance::Init(StaticMeshFeatureProcessor* fp)
@@ -36,20 +104,13 @@ namespace CE::RPI
 		
 		flags.initialized = true;
 
+		objectDataSlot = fp->AllocateObjectData(objectBuffers, objectDataOffset);
+
 		for (int i = 0; i < objectBuffers.GetSize(); ++i)
 		{
-			RHI::BufferDescriptor bufferDescriptor{};
-			bufferDescriptor.name = "ObjectBuffer " + debugName.GetString();
-			bufferDescriptor.bindFlags = RHI::BufferBindFlags::ConstantBuffer;
-			bufferDescriptor.bufferSize = sizeof(Matrix4x4);
-			bufferDescriptor.defaultHeapType = RHI::MemoryHeapType::Upload;
-			bufferDescriptor.structureByteStride = sizeof(Matrix4x4);
-
-			objectBuffers[i] = RHI::gDynamicRHI->CreateBuffer(bufferDescriptor);
-
 			Matrix4x4 defaultValue = Matrix4x4::Identity();
 
-			objectBuffers[i]->UploadData(&defaultValue, sizeof(defaultValue));
+			objectBuffers[i]->UploadData(&defaultValue, sizeof(defaultValue), objectDataOffset);
 		}
 
 		for (int i = 0; i < model->GetModelLodCount(); ++i)
@@ -62,10 +123,13 @@ namespace CE::RPI
 	{
 		for (auto& objectBuffer : objectBuffers)
 		{
-			RPISystem::Get().QueueDestroy(objectBuffer);
 			objectBuffer = nullptr;
 		}
 
+		fp->FreeObjectData(objectDataSlot);
+		objectDataSlot = NumericLimits<u32>::Max();
+		objectDataOffset = 0;
+
 		for (auto& srg : objectSrgList)
 		{
 			delete srg; srg = nullptr;
@@ -115,7 +179,7 @@ namespace CE::RPI
 
 			for (int j = 0; j < objectBuffers.GetSize(); ++j)
 			{
-				objectSrg->Bind(j, "_ObjectData", objectBuffers[j]);
+				objectSrg->Bind(j, "_ObjectData", RHI::BufferView(objectBuffers[j], objectDataOffset, sizeof(Matrix4x4)));
 			}
 
 			objectSrg->FlushBindings();
@@ -150,7 +214,7 @@ namespace CE::RPI
 
 	void ModelDataInstance::UpdateSrgs(int imageIndex)
 	{
-		objectBuffers[imageIndex]->UploadData(&localToWorldTransform, sizeof(Matrix4x4));
+		objectBuffers[imageIndex]->UploadData(&localToWorldTransform, sizeof(Matrix4x4), objectDataOffset);
 	}
 
 	ModelHandle StaticMeshFeatureProcessor::AcquireMesh(const ModelHandleDescriptor& modelHandleDescriptor, const CustomMaterialMap& materialMap)
@@ -27,6 +27,8 @@ namespace CE::RPI
 
 		delete shaderResourceGroup; shaderResourceGroup = nullptr;
 
+        ReleaseBindlessIndices();
+
         for (int i = 0; i < buffersByVariableNamePerImage.GetSize(); i++)
         {
             for (auto [name, buffer] : buffersByVariableNamePerImage[i])
@@ -290,6 +292,8 @@ namespace CE::RPI
                                         *((u32*)ptr) = value.GetValue<u32>();
                                     else if (value.IsOfType<s32>())
                                         *((u32*)ptr) = (u32)value.GetValue<s32>();
+                                    else
+                                        WriteBindlessIndex(propertyName, value, (u32*)ptr);
                                     break;
                                 case RHI::ShaderStructMemberType::Int:
                                     if (value.IsOfType<s32>())
@@ -334,6 +338,8 @@ namespace CE::RPI
                                     *((u32*)ptr) = value.GetValue<u32>();
                                 else if (value.IsOfType<s32>())
                                     *((u32*)ptr) = (u32)value.GetValue<s32>();
+                                else
+                                    WriteBindlessIndex(propertyName, value, (u32*)ptr);
                                 break;
                             case RHI::ShaderStructMemberType::Int:
                                 if (value.IsOfType<s32>())
@@ -522,6 +528,78 @@ namespace CE::RPI
         shaderResourceGroup->FlushBindings();
     }
 
+    bool Material::WriteBindlessIndex(Name propertyName, const MaterialPropertyValue& value, u32* outIndex)
+    {
+        RHI::BindlessTable* bindlessTable = RHI::gDynamicRHI->GetBindlessTable();
+
+        switch (value.GetValueType())
+        {
+        case MaterialPropertyDataType::Texture:
+        {
+            RPI::Texture* texture = value.GetValue<RPI::Texture*>();
+            *outIndex = texture != nullptr ? texture->GetBindlessIndex() : RHI::BindlessTable::InvalidIndex;
+            return true;
+        }
+        case MaterialPropertyDataType::TextureView:
+        case MaterialPropertyDataType::Buffer:
+            break;
+        default:
+            return false;
+        }
+
+        *outIndex = RHI::BindlessTable::InvalidIndex;
+        if (bindlessTable == nullptr)
+            return true;
+
+        bool isBuffer = value.GetValueType() == MaterialPropertyDataType::Buffer;
+        RHI::BufferView bufferView = isBuffer ? value.GetValue<RHI::BufferView>() : RHI::BufferView();
+        RHI::TextureView* textureView = isBuffer ? nullptr : value.GetValue<RHI::TextureView*>();
+        void* resource = isBuffer ? (void*)bufferView.GetBuffer() : (void*)textureView;
+
+        BindlessEntry& entry = bindlessEntriesByProperty[propertyName];
+
+        if (entry.resource != resource || entry.isBuffer != isBuffer ||
+            entry.byteOffset != bufferView.GetByteOffset() || entry.byteCount != bufferView.GetByteCount())
+        {
+            if (entry.isBuffer)
+                bindlessTable->RemoveBuffer(entry.index);
+            else
+                bindlessTable->RemoveTexture(entry.index);
+
+            entry.resource = resource;
+            entry.isBuffer = isBuffer;
+            entry.byteOffset = bufferView.GetByteOffset();
+            entry.byteCount = bufferView.GetByteCount();
+            entry.index = RHI::BindlessTable::InvalidIndex;
+
+            if (resource != nullptr)
+            {
+                entry.index = isBuffer ? bindlessTable->AddBuffer(bufferView) : bindlessTable->AddTexture(textureView);
+            }
+        }
+
+        *outIndex = entry.index;
+        return true;
+    }
+
+    void Material::ReleaseBindlessIndices()
+    {
+        RHI::BindlessTable* bindlessTable = RHI::gDynamicRHI->GetBindlessTable();
+
+        if (bindlessTable != nullptr)
+        {
+            for (const auto& [propertyName, entry] : bindlessEntriesByProperty)
+            {
+                if (entry.isBuffer)
+                    bindlessTable->RemoveBuffer(entry.index);
+                else
+                    bindlessTable->RemoveTexture(entry.index);
+            }
+        }
+
+        bindlessEntriesByProperty.Clear();
+    }
+
 	void Material::RecreateShaderResourceGroup()
 	{
         if (!currentShader)
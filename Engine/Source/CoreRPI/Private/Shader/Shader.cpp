@@ -40,4 +40,14 @@ namespace CE::RPI
 		return variant;
 	}
 
+	RPI::ShaderVariant* Shader::FindVariant(SIZE_T variantId) const
+	{
+		for (RPI::ShaderVariant* variant : variants)
+		{
+			if (variant->GetVariantId() == variantId)
+				return variant;
+		}
+		return nullptr;
+	}
+
 } // namespace CE::RPI
@@ -6,7 +6,8 @@ namespace CE::RPI
 	ShaderVariant::ShaderVariant(const ShaderVariantDescriptor& desc)
 		: reflectionInfo(desc.reflectionInfo)
 	{
-		variantId = 0;
+		variantId = desc.variantId;
+		defineFlags = desc.defineFlags;
 
 		pipelineDesc = {};
 		pipelineDesc.name = desc.shaderName;
@@ -83,6 +84,26 @@ namespace CE::RPI
 			}
 		}
 
+		// Per-object constant buffers are sub-allocated from shared pages and bound with dynamic offsets,
+		// so objects that use the same page can share one descriptor set.
+		for (auto& srgLayout : pipelineDesc.srgLayouts)
+		{
+			if (srgLayout.srgType != RHI::SRGType::PerObject)
+				continue;
+
+			u32 dynamicOffsetCount = 0;
+
+			for (auto& variable : srgLayout.variables)
+			{
+				if (variable.type == RHI::ShaderResourceType::ConstantBuffer && variable.arrayCount == 1 &&
+					dynamicOffsetCount < RHI::Limits::Pipeline::MaxDynamicOffsetCount)
+				{
+					variable.usesDynamicOffset = true;
+					dynamicOffsetCount++;
+				}
+			}
+		}
+
 		pipelineDesc.multisampleState.sampleCount = 1;
 
 		pipelineDesc.depthStencilState.depthState.enable = true;
@@ -265,6 +265,17 @@ namespace CE::RPI
 
     Texture::~Texture()
     {
+        u32 index = bindlessIndex.exchange(RHI::BindlessTable::InvalidIndex);
+        if (index != RHI::BindlessTable::InvalidIndex)
+        {
+            // The slot stays reserved until in-flight frames are done with it. The RHI may already be shut down.
+            RHI::BindlessTable* bindlessTable = RHI::gDynamicRHI != nullptr ? RHI::gDynamicRHI->GetBindlessTable() : nullptr;
+            if (bindlessTable != nullptr)
+            {
+                bindlessTable->RemoveTexture(index);
+            }
+        }
+
         if (texture)
         {
             RPISystem::Get().QueueDestroy(texture);
@@ -280,6 +291,35 @@ namespace CE::RPI
         samplerState = nullptr;
     }
 
+    u32 Texture::GetBindlessIndex()
+    {
+        u32 index = bindlessIndex.load(std::memory_order_acquire);
+        if (index != RHI::BindlessTable::InvalidIndex)
+            return index;
+
+        RHI::BindlessTable* bindlessTable = RHI::gDynamicRHI->GetBindlessTable();
+        if (bindlessTable == nullptr)
+            return RHI::BindlessTable::InvalidIndex;
+
+        u32 newIndex = RHI::BindlessTable::InvalidIndex;
+        if (textureView != nullptr)
+            newIndex = bindlessTable->AddTexture(textureView);
+        else if (texture != nullptr)
+            newIndex = bindlessTable->AddTexture(texture);
+
+        if (newIndex == RHI::BindlessTable::InvalidIndex)
+            return RHI::BindlessTable::InvalidIndex;
+
+        // Another thread may have allocated a slot in the meantime: keep the first one and give ours back
+        if (!bindlessIndex.compare_exchange_strong(index, newIndex, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            bindlessTable->RemoveTexture(newIndex);
+            return index;
+        }
+
+        return newIndex;
+    }
+
     RHI::TextureView* Texture::GetOrCreateTextureView()
     {
         if (textureView)
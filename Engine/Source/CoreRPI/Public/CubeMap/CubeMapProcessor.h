@@ -34,6 +34,10 @@ namespace CE::RPI
 		bool specularConvolution = false;
 
 		BinaryBlob* diffuseIrradianceOutput = nullptr;
+
+		// Compute the cubemap and IBL maps on the CPU using the job system. Shaders are not required in that case.
+		// The CPU path is always used when there is no RHI (ex: headless asset builds).
+		bool useCpu = false;
 	};
 
 	class CORERPI_API CubeMapProcessor
@@ -46,8 +50,16 @@ namespace CE::RPI
 		// Takes an equirectangular HDRI raw image (in CPU memory) and generates a cubemap out of it, and optionally generate IBL maps.
 		bool ProcessCubeMapOffline(const CubeMapOfflineProcessInfo& processInfo, BinaryBlob& cubeMapOutput, u32& outMipLevels);
 
+		// CPU implementation of ProcessCubeMapOffline(). Produces the same output layout and format as the GPU path.
+		bool ProcessCubeMapOfflineCPU(const CubeMapOfflineProcessInfo& processInfo, BinaryBlob& cubeMapOutput, u32& outMipLevels);
+
 	private:
 
+		static u64 CalculateTotalTextureSize(u32 width, u32 height, u32 bitsPerPixel, u32 arrayCount = 1, u32 mipLevelCount = 1);
+
+		// Encodes a mip-major RGBA16F cubemap (all 6 faces of each mip) to BC6H, one job per face and mip.
+		static void CompressBC6H(const u8* sourceData, u32 resolution, u32 mipLevelCount, u8* outputData);
+
 	};
 
 } // namespace CE::RPI
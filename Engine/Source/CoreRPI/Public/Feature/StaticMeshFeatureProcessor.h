@@ -28,8 +28,13 @@ namespace CE::RPI
 
 		Array<RHI::ShaderResourceGroup*> objectSrgList{};
 
+		//! @brief Page buffers that hold this instance's object data. Owned by the feature processor.
 		StaticArray<RHI::Buffer*, RHI::Limits::MaxSwapChainImageCount> objectBuffers{};
 
+		//! @brief Slot of this instance's object data in the feature processor's object data pages.
+		u32 objectDataSlot = NumericLimits<u32>::Max();
+		u64 objectDataOffset = 0;
+
 		void Init(StaticMeshFeatureProcessor* fp);
 		void Deinit(StaticMeshFeatureProcessor* fp);
 		void BuildDrawPacketList(StaticMeshFeatureProcessor* fp, u32 modelLodIndex);
@@ -73,12 +78,32 @@ namespace CE::RPI
 
 		void OnRenderEnd() override;
 
+		//! @brief Allocates a slot for per-object data in a shared page buffer. Thread-safe.
+		u32 AllocateObjectData(StaticArray<RHI::Buffer*, RHI::Limits::MaxSwapChainImageCount>& outBuffers, u64& outOffset);
+
+		void FreeObjectData(u32 slot);
+
 	private:
 
 		Array<Job*> CreateInitJobs();
 
 		PagedDynamicArray<ModelDataInstance> modelInstances{};
 
+		//! @brief Object data of many instances is packed into pages, so every instance that uses the same page
+		//! shares one descriptor set and only differs by its dynamic offset.
+		static constexpr u32 ObjectDataSlotsPerPage = 256;
+
+		struct ObjectDataPage
+		{
+			StaticArray<RHI::Buffer*, RHI::Limits::MaxSwapChainImageCount> buffers{};
+		};
+
+		Array<ObjectDataPage> objectDataPages{};
+		Array<u32> freeObjectDataSlots{};
+		u32 objectDataSlotCount = 0;
+		u64 objectDataStride = 0;
+		Mutex objectDataMutex{};
+
 		bool forceRebuildDrawPackets = false;
 	};
 
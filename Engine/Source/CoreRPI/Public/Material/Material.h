@@ -77,6 +77,12 @@ namespace CE::RPI
 		void FlushProperties(u32 imageIndex);
 
 		void RecreateShaderResourceGroup();
+
+		//! @brief Writes the bindless table index of a texture, texture view or buffer value.
+		//! @return False if the value is not a bindless resource.
+		bool WriteBindlessIndex(Name propertyName, const MaterialPropertyValue& value, u32* outIndex);
+
+		void ReleaseBindlessIndices();
 		
 		RHI::ShaderResourceGroup* shaderResourceGroup = nullptr;
 
@@ -89,6 +95,19 @@ namespace CE::RPI
 
         HashMap<Name, Array<u64>> memberOffsetsByVariableName{};
 
+        //! @brief Bindless slots owned by this material, for texture view and buffer properties.
+        //! RPI::Texture values use the texture's own slot.
+        struct BindlessEntry
+        {
+            void* resource = nullptr;
+            u64 byteOffset = 0;
+            u64 byteCount = 0;
+            u32 index = RHI::BindlessTable::InvalidIndex;
+            bool isBuffer = false;
+        };
+
+        HashMap<Name, BindlessEntry> bindlessEntriesByProperty{};
+
 		bool ownsShaderCollection;
 		ShaderCollection* shaderCollection;
 
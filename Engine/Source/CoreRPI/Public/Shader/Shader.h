@@ -23,6 +23,9 @@ namespace CE::RPI
 
 		RPI::ShaderVariant* GetDefaultVariant() const { return GetVariant(GetDefaultVariantIndex()); }
 
+		//! @brief Finds the variant compiled with the given keywords. See ShaderPermutations::GetVariantHash().
+		RPI::ShaderVariant* FindVariant(SIZE_T variantId) const;
+
 		RHI::PipelineState* GetDefaultPipeline() const
 		{
 			RPI::ShaderVariant* variant = GetDefaultVariant();
@@ -12,6 +12,10 @@ namespace CE::RPI
 		Array<Name> entryPoints{};
 		bool interleaveVertexData = false;
 
+		//! @brief Hash of the shader keywords this variant was compiled with. 0 if it was compiled without any keyword.
+		SIZE_T variantId = 0;
+		Array<Name> defineFlags{};
+
 		inline bool TagExists(const Name& key) const
 		{
 			for (int i = tags.GetSize() - 1; i >= 0; i--)
@@ -44,6 +48,8 @@ namespace CE::RPI
 
 		inline SIZE_T GetVariantId() const { return variantId; }
 
+		inline const Array<Name>& GetDefineFlags() const { return defineFlags; }
+
         inline RHI::PipelineState* GetPipeline() const { return pipelineCollection->GetPipeline(); }
 
 		RHI::PipelineState* GetPipeline(const RHI::GraphicsPipelineVariant& variant);
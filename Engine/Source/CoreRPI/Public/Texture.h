@@ -36,6 +36,10 @@ namespace CE::RPI
 
         void TransitionResourceTo(RHI::ResourceState fromState, RHI::ResourceState toState);
 
+        //! @brief Index of this texture in the RHI bindless table, allocated on first use.
+        //! Returns RHI::BindlessTable::InvalidIndex if the device doesn't support bindless resources.
+        u32 GetBindlessIndex();
+
     protected:
 
         RHI::Texture* texture = nullptr;
@@ -45,6 +49,9 @@ namespace CE::RPI
         u32 width = 0;
         u32 height = 0;
         u32 depth = 1;
+
+        //! @brief Allocated lazily by GetBindlessIndex(), which may be called from several threads.
+        Atomic<u32> bindlessIndex = RHI::BindlessTable::InvalidIndex;
     };
 
 } // namespace CE::RPI
@@ -81,3 +81,72 @@ TEST(RPI, Scene)
 	TEST_END;
 }
 
+
+TEST(RPI, CubeMapProcessorCPU)
+{
+	JobManagerDesc desc{};
+	desc.totalThreads = 0;
+
+	JobManager manager{ "Test", desc };
+	JobContext context{ &manager };
+	JobContext::PushGlobalContext(&context);
+
+	constexpr u32 width = 64;
+	constexpr u32 height = 32;
+
+	// A constant environment must stay constant after resampling, specular and diffuse convolution
+	Array<f32> pixels{};
+	pixels.Resize(width * height * 4);
+	for (int i = 0; i < width * height; i++)
+	{
+		pixels[i * 4 + 0] = 1.5f;
+		pixels[i * 4 + 1] = 0.5f;
+		pixels[i * 4 + 2] = 0.25f;
+		pixels[i * 4 + 3] = 1.0f;
+	}
+
+	BinaryBlob cubeMap{};
+	BinaryBlob diffuseIrradiance{};
+	u32 mipLevels = 0;
+
+	RPI::CubeMapOfflineProcessInfo processInfo{};
+	processInfo.name = "TestCubeMap";
+	processInfo.sourceImage = CMImage::LoadRawImageFromMemory((unsigned char*)pixels.GetData(), width, height,
+		CMImageFormat::RGBA32, CMImageSourceFormat::None, 32, 128);
+	processInfo.useCpu = true;
+	processInfo.specularConvolution = true;
+	processInfo.diffuseIrradianceResolution = 8;
+	processInfo.diffuseIrradianceOutput = &diffuseIrradiance;
+
+	RPI::CubeMapProcessor processor{};
+	EXPECT_TRUE(processor.ProcessCubeMapOffline(processInfo, cubeMap, mipLevels));
+
+	// 32x32 faces down to 1x1
+	EXPECT_EQ(mipLevels, 6);
+
+	u64 expectedSize = 0;
+	for (int mip = 0; mip < mipLevels; mip++)
+	{
+		expectedSize += (32 >> mip) * (32 >> mip) * 8 * 6;
+	}
+
+	auto verifyPixels = [](const BinaryBlob& blob, u64 byteSize)
+		{
+			const u16* data = (const u16*)blob.GetDataPtr();
+			for (u64 i = 0; i < byteSize / 8; i++)
+			{
+				EXPECT_NEAR(Math::ToFloat32(data[i * 4 + 0]), 1.5f, 0.01f);
+				EXPECT_NEAR(Math::ToFloat32(data[i * 4 + 1]), 0.5f, 0.01f);
+				EXPECT_NEAR(Math::ToFloat32(data[i * 4 + 2]), 0.25f, 0.01f);
+			}
+		};
+
+	EXPECT_EQ(cubeMap.GetDataSize(), expectedSize);
+	verifyPixels(cubeMap, expectedSize);
+
+	EXPECT_EQ(diffuseIrradiance.GetDataSize(), 8 * 8 * 8 * 6);
+	verifyPixels(diffuseIrradiance, 8 * 8 * 8 * 6);
+
+	manager.DeactivateWorkersAndWait();
+	JobContext::PopGlobalContext();
+}
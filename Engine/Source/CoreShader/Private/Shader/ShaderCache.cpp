@@ -0,0 +1,148 @@
+
+#include "CoreShader.h"
+
+namespace CE
+{
+
+	ShaderCache& ShaderCache::Get()
+	{
+		static ShaderCache instance{};
+		return instance;
+	}
+
+	void ShaderCache::Initialize(const IO::Path& cacheDirectory)
+	{
+		this->cacheDirectory = cacheDirectory;
+
+		if (!cacheDirectory.IsEmpty() && !cacheDirectory.Exists())
+		{
+			IO::Path::CreateDirectories(cacheDirectory);
+		}
+
+		ResetStatistics();
+	}
+
+	String ShaderCache::ComputeKey(ShaderBlobFormat format, const void* source, u64 sourceSize, const ShaderBuildConfig& buildConfig, const Array<std::wstring>& extraArgs)
+	{
+		ZoneScoped;
+
+		Hash128 sourceHash = CalculateHash128(source, sourceSize);
+
+		String keyString = String::Format("ShaderCache{};{};{};{};{};{};{:016x}{:016x};", Version, ShaderCompiler::GetCompilerVersion(),
+			(int)format, (int)buildConfig.stage, (int)buildConfig.shaderModel, buildConfig.entry, sourceHash.high64, sourceHash.low64);
+
+		for (const String& define : buildConfig.globalDefines)
+		{
+			keyString += "D=" + define + ";";
+		}
+
+		for (const std::wstring& arg : extraArgs)
+		{
+			keyString += "A=";
+			for (wchar_t c : arg)
+			{
+				keyString.Append((char)c);
+			}
+			keyString.Append(';');
+		}
+
+		Hash128 keyHash = CalculateHash128(keyString.GetCString(), keyString.GetLength());
+		return String::Format("{:016x}{:016x}", keyHash.high64, keyHash.low64);
+	}
+
+	bool ShaderCache::Fetch(const String& key, BinaryBlob& outByteCode)
+	{
+		ZoneScoped;
+
+		if (!IsEnabled() || key.IsEmpty())
+			return false;
+
+		IO::Path entryPath = GetEntryPath(key);
+
+		if (entryPath.Exists())
+		{
+			FileStream fileStream = FileStream(entryPath, Stream::Permissions::ReadOnly);
+			fileStream.SetBinaryMode(true);
+
+			u64 length = fileStream.IsOpen() ? fileStream.GetLength() : 0;
+
+			if (length > 0)
+			{
+				outByteCode.Free();
+				outByteCode.Reserve(length);
+
+				if (fileStream.Read(outByteCode.GetDataPtr(), length) == (s64)length)
+				{
+					hits++;
+					return true;
+				}
+
+				outByteCode.Free();
+			}
+		}
+
+		misses++;
+		return false;
+	}
+
+	bool ShaderCache::Store(const String& key, const BinaryBlob& byteCode)
+	{
+		ZoneScoped;
+
+		if (!IsEnabled() || key.IsEmpty() || !byteCode.IsValid())
+			return false;
+
+		IO::Path entryPath = GetEntryPath(key);
+		IO::Path parentPath = entryPath.GetParentPath();
+
+		if (!parentPath.Exists())
+		{
+			IO::Path::CreateDirectories(parentPath);
+		}
+
+		// Write to a temporary file first, so other jobs & processes never see a partially written entry
+		IO::Path tempPath = parentPath / String::Format("{}.{}.tmp", entryPath.GetFileName().GetString(), Uuid::Random());
+
+		{
+			FileStream fileStream = FileStream(tempPath, Stream::Permissions::WriteOnly);
+			if (!fileStream.IsOpen())
+				return false;
+
+			fileStream.Write(byteCode.GetDataPtr(), byteCode.GetDataSize());
+		}
+
+		std::error_code error{};
+		fs::rename((fs::path)tempPath, (fs::path)entryPath, error);
+		if (error)
+		{
+			CE_LOG(Warn, All, "Shader cache failed to write {}: {}", entryPath, error.message());
+			fs::remove((fs::path)tempPath, error);
+			return false;
+		}
+
+		stores++;
+		return true;
+	}
+
+	ShaderCache::Statistics ShaderCache::GetStatistics() const
+	{
+		Statistics statistics{};
+		statistics.hits = hits;
+		statistics.misses = misses;
+		statistics.stores = stores;
+		return statistics;
+	}
+
+	void ShaderCache::ResetStatistics()
+	{
+		hits = 0;
+		misses = 0;
+		stores = 0;
+	}
+
+	IO::Path ShaderCache::GetEntryPath(const String& key) const
+	{
+		return cacheDirectory / key.GetSubstring(0, 2) / (key + ".spv");
+	}
+
+} // namespace CE
@@ -61,6 +61,45 @@ namespace CE
 		delete impl;
 	}
 
+	const String& ShaderCompiler::GetCompilerVersion()
+	{
+		static const String compilerVersion = []() -> String
+			{
+				CComPtr<IDxcCompiler3> compiler;
+				DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&compiler));
+				if (compiler == nullptr)
+					return "Unknown";
+
+				String version = "Unknown";
+
+				CComPtr<IDxcVersionInfo> versionInfo;
+				if (SUCCEEDED(compiler->QueryInterface(IID_PPV_ARGS(&versionInfo))))
+				{
+					UINT32 major = 0, minor = 0;
+					versionInfo->GetVersion(&major, &minor);
+					version = String::Format("{}.{}", major, minor);
+				}
+
+				// The version alone doesn't change between builds of the same release
+				CComPtr<IDxcVersionInfo2> versionInfo2;
+				if (SUCCEEDED(compiler->QueryInterface(IID_PPV_ARGS(&versionInfo2))))
+				{
+					UINT32 commitCount = 0;
+					char* commitHash = nullptr;
+
+					if (SUCCEEDED(versionInfo2->GetCommitInfo(&commitCount, &commitHash)) && commitHash != nullptr)
+					{
+						version += String::Format(" ({}, {})", commitCount, commitHash);
+						CoTaskMemFree(commitHash);
+					}
+				}
+
+				return version;
+			}();
+
+		return compilerVersion;
+	}
+
 	ShaderCompiler::ErrorCode ShaderCompiler::BuildSpirv(const IO::Path& hlslPath, const ShaderBuildConfig& buildConfig, BinaryBlob& outByteCode, Array<std::wstring>& extraArgs)
 	{
 		if (!hlslPath.Exists())
@@ -0,0 +1,346 @@
+
+#include "CoreShader.h"
+
+namespace CE
+{
+
+	ShaderIncludeCache& ShaderIncludeCache::Get()
+	{
+		static ShaderIncludeCache instance{};
+		return instance;
+	}
+
+	Ptr<ShaderIncludeCache::File> ShaderIncludeCache::GetFile(const IO::Path& filePath)
+	{
+		ZoneScoped;
+
+		if (!filePath.Exists() || filePath.IsDirectory())
+			return nullptr;
+
+		u64 lastWriteTime = filePath.GetLastWriteTime().ToNumber();
+
+		{
+			LockGuard lock{ mutex };
+
+			auto it = files.Find(filePath);
+			if (it != files.end() && it->second->lastWriteTime == lastWriteTime)
+			{
+				hits++;
+				return it->second;
+			}
+		}
+
+		misses++;
+
+		// Read the whole file at once, instead of going through the file stream for every character
+		Array<u8> data{};
+		{
+			FileStream fileReader = FileStream(filePath, Stream::Permissions::ReadOnly);
+			if (!fileReader.IsOpen())
+				return nullptr;
+
+			fileReader.SetBinaryMode(true);
+			u64 length = fileReader.GetLength();
+			data.Resize(length);
+
+			if (length > 0 && fileReader.Read(data.GetData(), length) != (s64)length)
+				return nullptr;
+		}
+
+		Ptr<File> file = new File();
+		file->path = filePath;
+		file->lastWriteTime = lastWriteTime;
+
+		if (data.NotEmpty())
+		{
+			MemoryStream memoryReader = MemoryStream(data.GetData(), (u32)data.GetSize(), Stream::Permissions::ReadOnly);
+			Scan(&memoryReader, file->segments, false);
+		}
+
+		LockGuard lock{ mutex };
+		files[filePath] = file;
+		return file;
+	}
+
+	IO::Path ShaderIncludeCache::ResolveInclude(const String& includePath, const Array<IO::Path>& searchPaths, const IO::Path& additionalSearchPath)
+	{
+		for (const IO::Path& searchPath : searchPaths)
+		{
+			IO::Path includeFile = searchPath / includePath;
+			if (includeFile.Exists() && !includeFile.IsDirectory())
+				return includeFile;
+		}
+
+		IO::Path includeFile = additionalSearchPath / includePath;
+		if (includeFile.Exists() && !includeFile.IsDirectory())
+			return includeFile;
+
+		return {};
+	}
+
+	void ShaderIncludeCache::CollectIncludeDependencies(const IO::Path& sourcePath, const Array<IO::Path>& includePaths, Array<IO::Path>& outIncludedFiles)
+	{
+		ZoneScoped;
+
+		HashSet<IO::Path> visitedFiles{};
+		visitedFiles.Add(sourcePath);
+
+		struct PendingFile
+		{
+			Ptr<File> file = nullptr;
+			IO::Path additionalSearchPath{};
+		};
+
+		Array<PendingFile> stack{};
+
+		Ptr<File> sourceFile = GetFile(sourcePath);
+		if (sourceFile == nullptr)
+			return;
+
+		// The shader itself resolves includes without its own directory, just like ShaderPreprocessor::ReadHLSLProgram()
+		stack.Add({ sourceFile, IO::Path() });
+
+		while (stack.NotEmpty())
+		{
+			PendingFile pending = stack.Top();
+			stack.Pop();
+
+			for (const Segment& segment : pending.file->segments)
+			{
+				if (segment.type != SegmentType::Include)
+					continue;
+
+				IO::Path includeFile = ResolveInclude(segment.value, includePaths, pending.additionalSearchPath);
+				if (includeFile.IsEmpty() || visitedFiles.Exists(includeFile))
+					continue;
+
+				visitedFiles.Add(includeFile);
+				outIncludedFiles.Add(includeFile);
+
+				Ptr<File> includedFile = GetFile(includeFile);
+				if (includedFile != nullptr)
+				{
+					stack.Add({ includedFile, includeFile.GetParentPath() });
+				}
+			}
+		}
+	}
+
+	bool ShaderIncludeCache::Scan(Stream* stream, Array<Segment>& outSegments, bool stopAtEndHlsl)
+	{
+		String text = "";
+
+		auto flushText = [&]()
+			{
+				if (text.NotEmpty())
+				{
+					outSegments.Add({ SegmentType::Text, text });
+					text = "";
+				}
+			};
+
+		defer(&)
+		{
+			flushText();
+		};
+
+		char next = 0;
+		char prev = 0;
+
+		while (!stream->IsOutOfBounds())
+		{
+			next = stream->Read();
+
+			if (stopAtEndHlsl && !String::IsAlphabet(prev) && prev != '_' && next == 'E' && !stream->IsOutOfBounds())
+			{
+				auto curPos = stream->GetCurrentPosition();
+				char next2 = 0;
+
+				String string = "E";
+
+				while (!stream->IsOutOfBounds())
+				{
+					next2 = stream->Read();
+					if (String::IsAlphabet(next2))
+					{
+						string.Append(next2);
+					}
+					else
+					{
+						stream->Seek(-1, SeekMode::Current);
+						break;
+					}
+				}
+
+				if (string == "ENDHLSL")
+				{
+					return true;
+				}
+
+				stream->Seek(curPos, SeekMode::Begin);
+			}
+			else if (next == '/' && !stream->IsOutOfBounds()) // Check for comment
+			{
+				auto next2 = stream->Read();
+				if (next2 == '*') // Multi-line comment
+				{
+					while (!stream->IsOutOfBounds())
+					{
+						next2 = stream->Read();
+						if (next2 == '*' && !stream->IsOutOfBounds() && stream->Read() == '/')
+						{
+							break; // End of multi-line comment
+						}
+					}
+					continue;
+				}
+				else if (next2 == '/') // Single-line comment
+				{
+					while (!stream->IsOutOfBounds())
+					{
+						next2 = stream->Read();
+						if (next2 == '\n')
+						{
+							break; // End of single-line comment
+						}
+					}
+					continue;
+				}
+				else // NOT a comment, go back before next2 character
+				{
+					stream->Seek(-1, SeekMode::Current);
+				}
+			}
+			else if (next == '#' && !stream->IsOutOfBounds()) // Check for #include or #pragma
+			{
+				auto curPos = stream->GetCurrentPosition();
+				char next2 = 0;
+				bool shouldContinue = false;
+
+				// Everything after the '#', in case an include has to be left to the compiler
+				String directiveText = "";
+
+				while (!stream->IsOutOfBounds())
+				{
+					next2 = stream->Read();
+					if (next2 == ' ')
+					{
+						directiveText.Append(next2);
+						continue;
+					}
+					if (String::IsAlphabet(next2))
+					{
+						String keyword = "";
+
+						while (String::IsAlphabet(next2))
+						{
+							keyword.Append(next2);
+							next2 = stream->Read();
+						}
+
+						stream->Seek(-1, SeekMode::Current);
+						directiveText += keyword;
+
+						if (keyword == "include")
+						{
+							bool isStringLiteral = false;
+							String stringLiteral = "";
+
+							while (!stream->IsOutOfBounds())
+							{
+								next2 = stream->Read();
+								directiveText.Append(next2);
+
+								if (!isStringLiteral && next2 == ' ')
+									continue;
+								if (next2 == '\"')
+								{
+									isStringLiteral = !isStringLiteral;
+									if (!isStringLiteral)
+										break;
+								}
+								else if (isStringLiteral)
+								{
+									stringLiteral.Append(next2);
+								}
+							}
+
+							flushText();
+							outSegments.Add({ SegmentType::Include, stringLiteral, directiveText });
+							shouldContinue = true;
+						}
+						else if (keyword == "pragma")
+						{
+							String value = "";
+
+							while (!stream->IsOutOfBounds())
+							{
+								next2 = stream->Read();
+								if (next2 == '\n')
+									break;
+								if (next2 != '\r')
+									value.Append(next2);
+							}
+
+							Array<String> splits = value.Replace({ '\t' }, ' ').Split(' ');
+
+							if (splits.GetSize() >= 2 && splits[0] == "shader_feature")
+							{
+								// A group of mutually exclusive keywords is stored as a single space separated entry: "_ KEYWORD_A KEYWORD_B"
+								String keywordGroup = "";
+
+								for (int i = 1; i < splits.GetSize(); i++)
+								{
+									if (splits[i].IsEmpty())
+										continue;
+									if (keywordGroup.NotEmpty())
+										keywordGroup.Append(' ');
+									keywordGroup += splits[i];
+								}
+
+								if (keywordGroup.NotEmpty())
+								{
+									flushText();
+									outSegments.Add({ SegmentType::Feature, keywordGroup });
+								}
+							}
+
+							shouldContinue = true;
+						}
+
+						break;
+					}
+
+					directiveText.Append(next2);
+				}
+
+				if (shouldContinue)
+					continue;
+
+				stream->Seek(curPos, SeekMode::Begin);
+			}
+
+			prev = next;
+			text.Append(next);
+		}
+
+		return false;
+	}
+
+	void ShaderIncludeCache::Clear()
+	{
+		LockGuard lock{ mutex };
+		files.Clear();
+		hits = 0;
+		misses = 0;
+	}
+
+	ShaderIncludeCache::Statistics ShaderIncludeCache::GetStatistics() const
+	{
+		Statistics statistics{};
+		statistics.hits = hits;
+		statistics.misses = misses;
+		return statistics;
+	}
+
+} // namespace CE
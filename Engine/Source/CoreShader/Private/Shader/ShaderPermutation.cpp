@@ -0,0 +1,112 @@
+
+#include "CoreShader.h"
+
+namespace CE
+{
+
+	Array<String> ShaderPermutations::ParseKeywordGroup(const String& keywordGroup)
+	{
+		Array<String> options{};
+
+		for (const String& keyword : keywordGroup.Split(' '))
+		{
+			if (keyword.IsEmpty())
+				continue;
+
+			String option = keyword == "_" ? String() : keyword;
+			if (!options.Exists(option))
+			{
+				options.Add(option);
+			}
+		}
+
+		// A single keyword can always be turned off
+		if (options.GetSize() == 1 && options[0].NotEmpty())
+		{
+			options.InsertAt(0, String());
+		}
+
+		return options;
+	}
+
+	bool ShaderPermutations::Enumerate(const Array<String>& keywordGroups, u32 maxPermutations, Array<ShaderPermutation>& outPermutations)
+	{
+		outPermutations.Clear();
+
+		Array<Array<String>> groupOptions{};
+		u64 numPermutations = 1;
+
+		for (const String& keywordGroup : keywordGroups)
+		{
+			Array<String> options = ParseKeywordGroup(keywordGroup);
+			if (options.GetSize() <= 1 && (options.IsEmpty() || options[0].IsEmpty()))
+				continue;
+
+			numPermutations *= options.GetSize();
+			if (numPermutations > maxPermutations)
+				return false;
+
+			groupOptions.Add(options);
+		}
+
+		outPermutations.Reserve(numPermutations);
+
+		// Odometer over the option index of every group, with the first group changing the slowest
+		Array<u32> optionIndices{};
+		optionIndices.Resize(groupOptions.GetSize());
+		for (int i = 0; i < optionIndices.GetSize(); i++)
+		{
+			optionIndices[i] = 0;
+		}
+
+		for (u64 permutationIndex = 0; permutationIndex < numPermutations; permutationIndex++)
+		{
+			ShaderPermutation permutation{};
+
+			for (int i = 0; i < groupOptions.GetSize(); i++)
+			{
+				const String& option = groupOptions[i][optionIndices[i]];
+				if (option.NotEmpty() && !permutation.defines.Exists(option))
+				{
+					permutation.defines.Add(option);
+				}
+			}
+
+			permutation.variantHash = GetVariantHash(permutation.defines);
+			outPermutations.Add(permutation);
+
+			for (int i = (int)groupOptions.GetSize() - 1; i >= 0; i--)
+			{
+				if (++optionIndices[i] < groupOptions[i].GetSize())
+					break;
+				optionIndices[i] = 0;
+			}
+		}
+
+		return true;
+	}
+
+	SIZE_T ShaderPermutations::GetVariantHash(const Array<String>& defines)
+	{
+		if (defines.IsEmpty())
+			return 0;
+
+		Array<String> sortedDefines = defines;
+		sortedDefines.Sort([](const String& lhs, const String& rhs)
+			{
+				return lhs < rhs;
+			});
+
+		String hashString = "";
+		for (const String& define : sortedDefines)
+		{
+			hashString += define;
+			hashString.Append(';');
+		}
+
+		SIZE_T hash = CalculateHash(hashString.GetCString(), hashString.GetLength());
+		// 0 is reserved for the permutation without any keyword
+		return hash != 0 ? hash : 1;
+	}
+
+} // namespace CE
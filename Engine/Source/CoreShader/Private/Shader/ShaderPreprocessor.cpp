@@ -658,189 +658,62 @@ namespace CE
 		if (stream->IsOutOfBounds())
 			return false;
 
-		Array<IO::Path> alreadyIncludedFiles{};
+		Array<ShaderIncludeCache::Segment> segments{};
+		bool endFound = ShaderIncludeCache::Scan(stream, segments, true);
 
-		bool result = PreprocessHLSL(stream, curPassSource, alreadyIncludedFiles);
+		HashSet<IO::Path> alreadyIncludedFiles{};
+
+		bool result = PreprocessHLSL(segments, curPassSource, alreadyIncludedFiles);
 		curPassSource->Write('\0'); // Null terminator
 
+		if (endFound)
+		{
+			passPreprocessData.Add(curPassPreprocess);
+			curPassPreprocess = {};
+		}
+
 		return result;
 	}
 
-	bool ShaderPreprocessor::PreprocessHLSL(Stream* stream, MemoryStream* outStream, Array<IO::Path>& alreadyIncludedFiles, const IO::Path& additionalIncludePath)
+	bool ShaderPreprocessor::PreprocessHLSL(const Array<ShaderIncludeCache::Segment>& segments, MemoryStream* outStream, HashSet<IO::Path>& alreadyIncludedFiles, const IO::Path& additionalIncludePath)
 	{
-		if (stream->IsOutOfBounds())
-			return false;
-
-		Array<IO::Path> includeSearchPaths = includePaths;
-		includeSearchPaths.Add(additionalIncludePath);
-
-		char next = 0;
-		char prev = 0;
-
-		while (!stream->IsOutOfBounds())
+		for (const ShaderIncludeCache::Segment& segment : segments)
 		{
-			next = stream->Read();
-			
-			if (!String::IsAlphabet(prev) && prev != '_' && next == 'E' && !stream->IsOutOfBounds())
+			switch (segment.type)
 			{
-				auto curPos = stream->GetCurrentPosition();
-				char next2 = 0;
-
-				String string = "E";
-
-				while (!stream->IsOutOfBounds())
+			case ShaderIncludeCache::SegmentType::Text:
+				outStream->Write(segment.value.GetCString(), segment.value.GetLength());
+				break;
+			case ShaderIncludeCache::SegmentType::Feature:
+				if (!curPassPreprocess.features.Exists(segment.value))
 				{
-					next2 = stream->Read();
-					if (String::IsAlphabet(next2))
-					{
-						string.Append(next2);
-					}
-					else
-					{
-						stream->Seek(-1, SeekMode::Current);
-						break;
-					}
+					curPassPreprocess.features.Add(segment.value);
 				}
-				
-				if (string == "ENDHLSL")
+				break;
+			case ShaderIncludeCache::SegmentType::Include:
+			{
+				IO::Path includeFile = ShaderIncludeCache::ResolveInclude(segment.value, includePaths, additionalIncludePath);
+
+				if (includeFile.IsEmpty())
 				{
-					passPreprocessData.Add(curPassPreprocess);
-					curPassPreprocess = {};
+					// Leave it to the shader compiler
+					outStream->Write('#');
+					outStream->Write(segment.rawText.GetCString(), segment.rawText.GetLength());
 					break;
 				}
 
-				stream->Seek(curPos, SeekMode::Begin);
-			}
-			else if (next == '/' && !stream->IsOutOfBounds()) // Check for comment
-			{
-				auto next2 = stream->Read();
-				if (next2 == '*') // Multi-line comment
-				{
-					while (!stream->IsOutOfBounds())
-					{
-						next2 = stream->Read();
-						if (next2 == '*' && !stream->IsOutOfBounds() && stream->Read() == '/')
-						{
-							break; // End of multi-line comment
-						}
-					}
-					continue;
-				}
-				else if (next2 == '/') // Single-line comment
-				{
-					while (!stream->IsOutOfBounds())
-					{
-						next2 = stream->Read();
-						if (next2 == '\n')
-						{
-							break; // End of single-line comment
-						}
-					}
-					continue;
-				}
-				else // NOT a comment, go back before next2 character
-				{
-					stream->Seek(-1, SeekMode::Current);
-				}
-			}
-			else if (next == '#' && !stream->IsOutOfBounds()) // Check for #include or #pragma
-			{
-				auto curPos = stream->GetCurrentPosition();
-				char next2 = 0;
-				bool shouldContinue = false;
+				if (alreadyIncludedFiles.Exists(includeFile)) // If we have already include'ed this file
+					break;
+				alreadyIncludedFiles.Add(includeFile);
 
-				while (!stream->IsOutOfBounds())
+				Ptr<ShaderIncludeCache::File> file = ShaderIncludeCache::Get().GetFile(includeFile);
+				if (file != nullptr)
 				{
-					next2 = stream->Read();
-					if (next2 == ' ')
-						continue;
-					if (String::IsAlphabet(next2))
-					{
-						String keyword = "";
-
-						while (String::IsAlphabet(next2))
-						{
-							keyword.Append(next2);
-							next2 = stream->Read();
-						}
-
-						stream->Seek(-1, SeekMode::Current);
-
-						if (keyword == "include")
-						{
-							bool isStringLiteral = false;
-							String stringLiteral = "";
-
-							while (!stream->IsOutOfBounds())
-							{
-								next2 = stream->Read();
-								if (!isStringLiteral && next2 == ' ')
-									continue;
-								if (next2 == '\"')
-								{
-									isStringLiteral = !isStringLiteral;
-									if (!isStringLiteral)
-										break;
-								}
-								else if (isStringLiteral)
-								{
-									stringLiteral.Append(next2);
-								}
-							}
-
-							for (const auto& includePath : includeSearchPaths)
-							{
-								auto includeFile = includePath / stringLiteral;
-								if (includeFile.Exists() && !includeFile.IsDirectory())
-								{
-									FileStream fileReader = FileStream(includeFile, Stream::Permissions::ReadOnly);
-									fileReader.SetAsciiMode(true);
-									shouldContinue = true;
-									if (alreadyIncludedFiles.Exists(includeFile)) // If we have already include'ed this file
-										break;
-									alreadyIncludedFiles.Add(includeFile);
-									PreprocessHLSL(&fileReader, outStream, alreadyIncludedFiles, includeFile.GetParentPath());
-									break;
-								}
-							}
-
-							break;
-						}
-						else if (keyword == "pragma")
-						{
-							String value = "";
-
-							while (!stream->IsOutOfBounds())
-							{
-								next2 = stream->Read();
-								if (next2 == '\n')
-									break;
-								if (next2 != '\r')
-									value.Append(next2);
-							}
-
-							Array<String> splits = value.Split(' ');
-
-							if (splits.GetSize() >= 2 && splits[0] == "shader_feature")
-							{
-								curPassPreprocess.features.Add(splits[1]);
-							}
-
-							shouldContinue = true;
-						}
-
-						break;
-					}
+					PreprocessHLSL(file->segments, outStream, alreadyIncludedFiles, includeFile.GetParentPath());
 				}
-
-				if (shouldContinue)
-					continue;
-
-				stream->Seek(curPos, SeekMode::Begin);
 			}
-
-			prev = next;
-			outStream->Write(next);
+				break;
+			}
 		}
 
 		return true;
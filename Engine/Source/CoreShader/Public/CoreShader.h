@@ -6,9 +6,12 @@
 #include "ShaderMath/Vector.h"
 
 #include "Shader/ShaderDefines.h"
+#include "Shader/ShaderIncludeCache.h"
 #include "Shader/ShaderPreprocessor.h"
 #include "Shader/ComputeShaderPreprocessor.h"
 #include "Shader/ShaderCompiler.h"
+#include "Shader/ShaderPermutation.h"
+#include "Shader/ShaderCache.h"
 #include "Shader/ShaderReflector.h"
 
 namespace CE
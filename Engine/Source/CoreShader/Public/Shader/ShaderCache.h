@@ -0,0 +1,61 @@
+#pragma once
+
+namespace CE
+{
+	/// @brief Content-addressed cache of compiled shader byte code.
+	/// Byte code is stored under a key computed from the preprocessed source, the entry point, stage, defines and compiler
+	/// arguments, and the compiler version. So a variant whose inputs didn't change is never compiled again, even when
+	/// another pass, shader or machine produced it. All functions are thread-safe.
+	class CORESHADER_API ShaderCache final
+	{
+	public:
+
+		//! @brief Increment it to invalidate all the entries, ex: when the key format changes.
+		static constexpr u32 Version = 1;
+
+		struct Statistics
+		{
+			u32 hits = 0;
+			u32 misses = 0;
+			u32 stores = 0;
+		};
+
+		static ShaderCache& Get();
+
+		ShaderCache() = default;
+
+		ShaderCache(const ShaderCache&) = delete;
+		ShaderCache& operator=(const ShaderCache&) = delete;
+
+		//! @brief Enables the cache. Should be called before any shader is compiled.
+		void Initialize(const IO::Path& cacheDirectory);
+
+		bool IsEnabled() const { return !cacheDirectory.IsEmpty(); }
+
+		const IO::Path& GetCacheDirectory() const { return cacheDirectory; }
+
+		//! @brief Computes the cache key for a compilation. The source should already be preprocessed, as included files are not hashed.
+		static String ComputeKey(ShaderBlobFormat format, const void* source, u64 sourceSize, const ShaderBuildConfig& buildConfig, const Array<std::wstring>& extraArgs);
+
+		//! @brief Loads the cached byte code for key.
+		//! @return False on a miss.
+		bool Fetch(const String& key, BinaryBlob& outByteCode);
+
+		bool Store(const String& key, const BinaryBlob& byteCode);
+
+		Statistics GetStatistics() const;
+
+		void ResetStatistics();
+
+	private:
+
+		IO::Path GetEntryPath(const String& key) const;
+
+		IO::Path cacheDirectory{};
+
+		Atomic<u32> hits = 0;
+		Atomic<u32> misses = 0;
+		Atomic<u32> stores = 0;
+	};
+
+} // namespace CE
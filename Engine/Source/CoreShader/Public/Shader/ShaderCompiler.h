@@ -78,6 +78,9 @@ namespace CE
             return errorMessage;
         }
 
+		//! @brief Version & commit of the DirectX Shader Compiler library that is loaded. Never changes while the process is running.
+		static const String& GetCompilerVersion();
+
     protected:
 
 		ErrorCode BuildSpirv(DxcBuffer buffer, const ShaderBuildConfig& buildConfig, BinaryBlob& outByteCode, Array<std::wstring>& extraArgs);
@@ -0,0 +1,84 @@
+#pragma once
+
+namespace CE
+{
+	/*
+	*   Process-wide cache of the HLSL files included by shaders.
+	*   Every file is read & scanned for directives once, and kept as a list of segments until its last write time changes.
+	*   So the headers shared by hundreds of shaders are not read again for every shader during an import pass.
+	*   All functions are thread-safe.
+	*/
+	class CORESHADER_API ShaderIncludeCache final
+	{
+	public:
+
+		enum class SegmentType : u8
+		{
+			//! @brief HLSL code that is copied to the output as is.
+			Text = 0,
+			//! @brief An #include directive. value is the path inside the quotes.
+			Include,
+			//! @brief A #pragma shader_feature directive. value is the keyword group.
+			Feature
+		};
+
+		struct Segment
+		{
+			SegmentType type = SegmentType::Text;
+			String value{};
+
+			//! @brief For includes: the directive text after the '#', which is written to the output if the file can't be found.
+			String rawText{};
+		};
+
+		struct File : IntrusiveBase
+		{
+			IO::Path path{};
+			u64 lastWriteTime = 0;
+			Array<Segment> segments{};
+		};
+
+		struct Statistics
+		{
+			u32 hits = 0;
+			u32 misses = 0;
+		};
+
+		static ShaderIncludeCache& Get();
+
+		ShaderIncludeCache() = default;
+
+		ShaderIncludeCache(const ShaderIncludeCache&) = delete;
+		ShaderIncludeCache& operator=(const ShaderIncludeCache&) = delete;
+
+		//! @brief Returns the scanned file, reading it again only if it was modified since the last call.
+		//! @return Null if the file can't be read.
+		Ptr<File> GetFile(const IO::Path& filePath);
+
+		//! @brief Finds the file an #include refers to, in the given order of search paths.
+		//! @return An empty path if the file doesn't exist in any of them.
+		static IO::Path ResolveInclude(const String& includePath, const Array<IO::Path>& searchPaths, const IO::Path& additionalSearchPath);
+
+		//! @brief Collects every file that sourcePath includes, directly or indirectly. Files that can't be found are skipped,
+		//! the same way the preprocessor leaves their #include to the compiler.
+		void CollectIncludeDependencies(const IO::Path& sourcePath, const Array<IO::Path>& includePaths, Array<IO::Path>& outIncludedFiles);
+
+		//! @brief Splits HLSL source into segments: comments are stripped, and #include & #pragma directives are extracted.
+		//! @param stopAtEndHlsl If true, stops after the first ENDHLSL keyword, which is not part of the output.
+		//! @return True if ENDHLSL was found.
+		static bool Scan(Stream* stream, Array<Segment>& outSegments, bool stopAtEndHlsl);
+
+		void Clear();
+
+		Statistics GetStatistics() const;
+
+	private:
+
+		Mutex mutex{};
+		HashMap<IO::Path, Ptr<File>> files{};
+
+		Atomic<u32> hits = 0;
+		Atomic<u32> misses = 0;
+	};
+
+} // namespace CE
@@ -0,0 +1,42 @@
+#pragma once
+
+namespace CE
+{
+	/// @brief A single combination of shader keywords, which is compiled into its own shader variant.
+	struct ShaderPermutation
+	{
+		/// @brief Keywords that are defined as KEYWORD=1 when compiling this permutation, in declaration order.
+		Array<String> defines{};
+
+		/// @brief Is always 0 for the permutation that doesn't define any keyword.
+		SIZE_T variantHash = 0;
+	};
+
+	/*
+	*   Expands the keyword groups declared with `#pragma shader_feature` into all the permutations of a shader pass.
+	*
+	*   #pragma shader_feature KEYWORD                  -> KEYWORD is either defined or not.
+	*   #pragma shader_feature _ KEYWORD_A KEYWORD_B    -> At most one of the keywords is defined. `_` stands for none of them.
+	*   #pragma shader_feature KEYWORD_A KEYWORD_B      -> Exactly one of the keywords is defined.
+	*
+	*   The first permutation always uses the first option of every group, and is used as the default variant.
+	*/
+	class CORESHADER_API ShaderPermutations
+	{
+	public:
+
+		ShaderPermutations() = delete;
+
+		//! @brief Returns the options of a keyword group, where an empty string means no keyword is defined.
+		static Array<String> ParseKeywordGroup(const String& keywordGroup);
+
+		//! @brief Builds the cartesian product of all the keyword groups.
+		//! @return False if there are more than maxPermutations permutations.
+		static bool Enumerate(const Array<String>& keywordGroups, u32 maxPermutations, Array<ShaderPermutation>& outPermutations);
+
+		//! @brief Hash of the set of defined keywords. It doesn't depend on the order of the keywords, and is stable across runs.
+		static SIZE_T GetVariantHash(const Array<String>& defines);
+
+	};
+
+} // namespace CE
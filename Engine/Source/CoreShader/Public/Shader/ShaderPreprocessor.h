@@ -227,7 +227,8 @@ namespace CE
 
 		bool ReadHLSLProgram();
 
-		bool PreprocessHLSL(Stream* inStream, MemoryStream* outStream, Array<IO::Path>& alreadyIncludedFiles, const IO::Path& additionalIncludePath = {});
+		//! @brief Writes the segments to the output, and recursively expands the includes through the ShaderIncludeCache.
+		bool PreprocessHLSL(const Array<ShaderIncludeCache::Segment>& segments, MemoryStream* outStream, HashSet<IO::Path>& alreadyIncludedFiles, const IO::Path& additionalIncludePath = {});
 
 		Array<Token> tokens{};
 		
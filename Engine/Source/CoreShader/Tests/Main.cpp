@@ -1,5 +1,241 @@
-
 #include "CoreShader.h"
 
 #include <gtest/gtest.h>
 
+using namespace CE;
+
+#define TEST_BEGIN TestBegin()
+#define TEST_END TestEnd()
+
+static void TestBegin()
+{
+	ModuleManager::Get().LoadModule("Core");
+	ModuleManager::Get().LoadModule("CoreRHI");
+	ModuleManager::Get().LoadModule("CoreShader");
+}
+
+static void TestEnd()
+{
+	ModuleManager::Get().UnloadModule("CoreShader");
+	ModuleManager::Get().UnloadModule("CoreRHI");
+	ModuleManager::Get().UnloadModule("Core");
+}
+
+#pragma region Permutations
+
+TEST(ShaderPermutations, Enumerate)
+{
+	TEST_BEGIN;
+
+	Array<ShaderPermutation> permutations{};
+
+	// No keyword: a single default permutation
+	EXPECT_TRUE(ShaderPermutations::Enumerate({}, 16, permutations));
+	ASSERT_EQ(permutations.GetSize(), 1);
+	EXPECT_TRUE(permutations[0].defines.IsEmpty());
+	EXPECT_EQ(permutations[0].variantHash, 0);
+
+	// On/off keyword x optional group of 2 x exclusive group of 2 = 2 * 3 * 2
+	Array<String> keywordGroups = { "USE_FOG", "_ SHADOWS_HARD SHADOWS_SOFT", "LIT UNLIT" };
+	EXPECT_TRUE(ShaderPermutations::Enumerate(keywordGroups, 64, permutations));
+	ASSERT_EQ(permutations.GetSize(), 12);
+
+	// The first group changes the slowest, and the first permutation uses the first option of every group
+	const Array<Array<String>> expectedDefines = {
+		{ "LIT" },
+		{ "UNLIT" },
+		{ "SHADOWS_HARD", "LIT" },
+		{ "SHADOWS_HARD", "UNLIT" },
+		{ "SHADOWS_SOFT", "LIT" },
+		{ "SHADOWS_SOFT", "UNLIT" },
+		{ "USE_FOG", "LIT" },
+		{ "USE_FOG", "UNLIT" },
+		{ "USE_FOG", "SHADOWS_HARD", "LIT" },
+		{ "USE_FOG", "SHADOWS_HARD", "UNLIT" },
+		{ "USE_FOG", "SHADOWS_SOFT", "LIT" },
+		{ "USE_FOG", "SHADOWS_SOFT", "UNLIT" },
+	};
+
+	for (int i = 0; i < permutations.GetSize(); i++)
+	{
+		ASSERT_EQ(permutations[i].defines.GetSize(), expectedDefines[i].GetSize());
+
+		for (int j = 0; j < expectedDefines[i].GetSize(); j++)
+		{
+			EXPECT_EQ(permutations[i].defines[j], expectedDefines[i][j]);
+		}
+
+		EXPECT_EQ(permutations[i].variantHash, ShaderPermutations::GetVariantHash(permutations[i].defines));
+	}
+
+	// Empty groups are skipped, and the limit is checked
+	EXPECT_TRUE(ShaderPermutations::Enumerate({ "", "_", "A B C" }, 3, permutations));
+	EXPECT_EQ(permutations.GetSize(), 3);
+	EXPECT_FALSE(ShaderPermutations::Enumerate({ "A B C", "D" }, 5, permutations));
+
+	TEST_END;
+}
+
+TEST(ShaderPermutations, VariantHash)
+{
+	TEST_BEGIN;
+
+	EXPECT_EQ(ShaderPermutations::GetVariantHash({}), 0);
+
+	// Doesn't depend on the order of the keywords
+	SIZE_T hash = ShaderPermutations::GetVariantHash({ "USE_FOG", "LIT" });
+	EXPECT_NE(hash, 0);
+	EXPECT_EQ(hash, ShaderPermutations::GetVariantHash({ "LIT", "USE_FOG" }));
+	EXPECT_EQ(hash, ShaderPermutations::GetVariantHash({ "USE_FOG", "LIT" }));
+
+	// Distinct for every permutation
+	Array<ShaderPermutation> permutations{};
+	EXPECT_TRUE(ShaderPermutations::Enumerate({ "A", "B", "_ C D", "E F G" }, 64, permutations));
+	ASSERT_EQ(permutations.GetSize(), 36);
+
+	for (int i = 0; i < permutations.GetSize(); i++)
+	{
+		for (int j = i + 1; j < permutations.GetSize(); j++)
+		{
+			EXPECT_NE(permutations[i].variantHash, permutations[j].variantHash);
+		}
+	}
+
+	// Keyword boundaries are part of the hash
+	EXPECT_NE(ShaderPermutations::GetVariantHash({ "AB", "C" }), ShaderPermutations::GetVariantHash({ "A", "BC" }));
+
+	TEST_END;
+}
+
+#pragma endregion
+
+#pragma region Cache
+
+TEST(ShaderCache, RoundTrip)
+{
+	TEST_BEGIN;
+
+	IO::Path cacheDirectory = PlatformDirectories::GetLaunchDir() / "Temp/ShaderCacheTest";
+	if (cacheDirectory.Exists())
+	{
+		IO::Path::RemoveRecursively(cacheDirectory);
+	}
+
+	ShaderCache cache{};
+	EXPECT_FALSE(cache.IsEnabled());
+
+	cache.Initialize(cacheDirectory);
+	EXPECT_TRUE(cache.IsEnabled());
+	EXPECT_TRUE(cacheDirectory.Exists());
+
+	// SPIR-V module header followed by some words
+	Array<u32> spirv = { 0x07230203, 0x00010500, 0x0008000b, 0x00000010, 0 };
+	for (u32 i = 0; i < 256; i++)
+	{
+		spirv.Add(i * 2654435761u);
+	}
+
+	BinaryBlob byteCode{};
+	byteCode.LoadData(spirv.GetData(), spirv.GetSize() * sizeof(u32));
+
+	const String key = "0123456789abcdef0123456789abcdef";
+	const String otherKey = "fedcba9876543210fedcba9876543210";
+
+	BinaryBlob fetched{};
+	EXPECT_FALSE(cache.Fetch(key, fetched));
+
+	EXPECT_TRUE(cache.Store(key, byteCode));
+
+	EXPECT_TRUE(cache.Fetch(key, fetched));
+	ASSERT_EQ(fetched.GetDataSize(), byteCode.GetDataSize());
+	EXPECT_EQ(memcmp(fetched.GetDataPtr(), byteCode.GetDataPtr(), byteCode.GetDataSize()), 0);
+
+	BinaryBlob otherFetched{};
+	EXPECT_FALSE(cache.Fetch(otherKey, otherFetched));
+
+	// Storing again replaces the entry
+	spirv[5] = 42;
+	byteCode.LoadData(spirv.GetData(), spirv.GetSize() * sizeof(u32));
+	EXPECT_TRUE(cache.Store(key, byteCode));
+	EXPECT_TRUE(cache.Fetch(key, fetched));
+	ASSERT_EQ(fetched.GetDataSize(), byteCode.GetDataSize());
+	EXPECT_EQ(memcmp(fetched.GetDataPtr(), byteCode.GetDataPtr(), byteCode.GetDataSize()), 0);
+
+	ShaderCache::Statistics statistics = cache.GetStatistics();
+	EXPECT_EQ(statistics.hits, 2);
+	EXPECT_EQ(statistics.misses, 2);
+	EXPECT_EQ(statistics.stores, 2);
+
+	// An empty blob is never stored
+	EXPECT_FALSE(cache.Store(otherKey, BinaryBlob()));
+
+	IO::Path::RemoveRecursively(cacheDirectory);
+
+	TEST_END;
+}
+
+#pragma endregion
+
+#pragma region Includes
+
+TEST(ShaderIncludeCache, Scan)
+{
+	TEST_BEGIN;
+
+	const String source =
+		"// Header comment\n"
+		"float4 color;\n"
+		"/* Block\n"
+		"   comment */\n"
+		"#include \"Common.hlsli\"\n"
+		"#pragma shader_feature _ FOG_LINEAR   FOG_EXP\n"
+		"#define VALUE 1\n"
+		"float x = 1 / 2;\n"
+		"ENDHLSL\n"
+		"float ignored;\n";
+
+	using SegmentType = ShaderIncludeCache::SegmentType;
+
+	{
+		MemoryStream stream = MemoryStream((void*)source.GetCString(), source.GetLength(), Stream::Permissions::ReadOnly);
+
+		Array<ShaderIncludeCache::Segment> segments{};
+		EXPECT_TRUE(ShaderIncludeCache::Scan(&stream, segments, true));
+
+		ASSERT_EQ(segments.GetSize(), 5);
+
+		// Comments are stripped
+		EXPECT_EQ(segments[0].type, SegmentType::Text);
+		EXPECT_EQ(segments[0].value, "float4 color;\n\n");
+
+		EXPECT_EQ(segments[1].type, SegmentType::Include);
+		EXPECT_EQ(segments[1].value, "Common.hlsli");
+		EXPECT_EQ(segments[1].rawText, "include \"Common.hlsli\"");
+
+		EXPECT_EQ(segments[2].type, SegmentType::Text);
+		EXPECT_EQ(segments[2].value, "\n");
+
+		// Keyword groups are normalized to single spaces
+		EXPECT_EQ(segments[3].type, SegmentType::Feature);
+		EXPECT_EQ(segments[3].value, "_ FOG_LINEAR FOG_EXP");
+
+		// Other directives and divisions are kept, and nothing after ENDHLSL is read
+		EXPECT_EQ(segments[4].type, SegmentType::Text);
+		EXPECT_EQ(segments[4].value, "#define VALUE 1\nfloat x = 1 / 2;\n");
+	}
+
+	{
+		MemoryStream stream = MemoryStream((void*)source.GetCString(), source.GetLength(), Stream::Permissions::ReadOnly);
+
+		Array<ShaderIncludeCache::Segment> segments{};
+		EXPECT_FALSE(ShaderIncludeCache::Scan(&stream, segments, false));
+
+		ASSERT_EQ(segments.GetSize(), 5);
+		EXPECT_EQ(segments[4].type, SegmentType::Text);
+		EXPECT_EQ(segments[4].value, "#define VALUE 1\nfloat x = 1 / 2;\nENDHLSL\nfloat ignored;\n");
+	}
+
+	TEST_END;
+}
+
+#pragma endregion
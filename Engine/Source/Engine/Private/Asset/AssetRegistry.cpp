@@ -9,6 +9,87 @@ namespace CE
 		return String::NaturalCompare(lhs->bundleName.GetLastComponent(), rhs->bundleName.GetLastComponent());
 	}
 
+	struct AssetRegistryScanItem
+	{
+		IO::Path absolutePath{};
+		String snapshotKey{};
+		String bundlePath{};
+		b8 includeSourceAssetPath = false;
+
+		b8 statSucceeded = false;
+		u64 lastWriteTime = 0;
+		u64 fileSize = 0;
+	};
+
+	//! @brief Reads the last write time and size of a file. Doesn't go through DateTime, which uses std::localtime()
+	//! and is therefore not thread-safe.
+	static bool StatBundleFile(const IO::Path& absolutePath, u64& outLastWriteTime, u64& outFileSize)
+	{
+		std::error_code error{};
+
+		fs::file_time_type lastWriteTime = fs::last_write_time((fs::path)absolutePath, error);
+		if (error)
+			return false;
+
+		u64 fileSize = fs::file_size((fs::path)absolutePath, error);
+		if (error)
+			return false;
+
+		outLastWriteTime = (u64)lastWriteTime.time_since_epoch().count();
+		outFileSize = fileSize;
+		return true;
+	}
+
+	//! @brief Adds the directories under assetsDirectory to the path trees, and collects the bundles in it.
+	static void ScanAssetDirectory(const IO::Path& rootDirectory, const IO::Path& assetsDirectory, bool includeSourceAssetPath,
+		PathTree& pathTree, PathTree& directoryTree, Array<AssetRegistryScanItem>& outBundles)
+	{
+		ZoneScoped;
+
+		assetsDirectory.RecursivelyIterateChildren([&](const IO::Path& item)
+			{
+				auto relativePath = IO::Path::GetRelative(item, rootDirectory);
+				auto relativePathStr = relativePath.RemoveExtension().GetString().Replace({ '\\' }, '/');
+				if (!relativePathStr.StartsWith("/"))
+					relativePathStr = "/" + relativePathStr;
+
+				if (item.IsDirectory()) // Folder
+				{
+					if (!relativePathStr.IsEmpty())
+					{
+						pathTree.AddPath(relativePathStr);
+						directoryTree.AddPath(relativePathStr);
+					}
+				}
+				else if (item.GetExtension() == ".casset") // Product asset file
+				{
+					AssetRegistryScanItem scanItem{};
+					scanItem.absolutePath = item;
+					scanItem.snapshotKey = AssetRegistrySnapshot::GetEntryKey(item);
+					scanItem.bundlePath = relativePathStr;
+					scanItem.includeSourceAssetPath = includeSourceAssetPath;
+					outBundles.Add(scanItem);
+				}
+			});
+	}
+
+	static void ApplySnapshotEntry(AssetData* assetData, const AssetRegistrySnapshot::Entry& entry)
+	{
+		assetData->bundleName = entry.bundleName;
+		assetData->bundlePath = entry.bundlePath;
+		assetData->assetName = entry.assetName;
+		assetData->assetClassTypeName = entry.assetClassTypeName;
+		assetData->bundleUuid = entry.bundleUuid;
+		assetData->assetUuid = entry.assetUuid;
+		assetData->bundleDependencies = entry.dependencies;
+#if PAL_TRAIT_BUILD_EDITOR
+		if (entry.sourceAssetPath.IsValid())
+		{
+			assetData->sourceAssetPath = entry.sourceAssetPath;
+		}
+#endif
+	}
+
 	AssetRegistry::AssetRegistry()
 	{
 
@@ -25,6 +106,7 @@ namespace CE
 			delete assetData;
 		}
 		allAssetDatas.Clear();
+		searchIndex.Clear();
 
 		cachedAssetsByPath.Clear();
 	}
@@ -32,6 +114,44 @@ namespace CE
 	void AssetRegistry::Shutdown()
 	{
 		Bundle::PopBundleResolver(this);
+
+		SaveSnapshot();
+	}
+
+	void AssetRegistry::SaveSnapshot()
+	{
+		if (!cacheInitialized || !snapshot.IsDirty())
+			return;
+
+		snapshot.SaveToDisk(GetSnapshotPath());
+	}
+
+	IO::Path AssetRegistry::GetSnapshotPath()
+	{
+		return gProjectPath / "Temp/AssetRegistry.snapshot";
+	}
+
+	AssetRegistrySnapshot::Entry AssetRegistry::MakeSnapshotEntry(const Ref<Bundle>& bundle, bool includeSourceAssetPath)
+	{
+		AssetRegistrySnapshot::Entry entry{};
+
+		Bundle::ObjectData primaryObjectData = bundle->GetPrimaryObjectData();
+
+		entry.bundleName = bundle->GetName();
+		entry.bundlePath = bundle->GetBundlePath();
+		entry.assetName = primaryObjectData.name;
+		entry.assetClassTypeName = primaryObjectData.typeName;
+		entry.bundleUuid = bundle->GetUuid();
+		entry.assetUuid = primaryObjectData.uuid;
+		entry.dependencies = bundle->dependencies;
+
+		// Source asset path relative to project assets directory
+		if (includeSourceAssetPath && bundle->sourceAssetRelativePath.IsValid())
+		{
+			entry.sourceAssetPath = bundle->GetBundlePath().GetParentPath() + "/" + bundle->sourceAssetRelativePath.GetString();
+		}
+
+		return entry;
 	}
 
 	AssetRegistry* AssetRegistry::Get()
@@ -85,6 +205,13 @@ namespace CE
 		return cachedAssetsByType[typeId];
 	}
 
+	Array<AssetSearchIndex::Result> AssetRegistry::SearchAssets(const String& query, u32 maxResults, const String& excludedPathPrefix)
+	{
+		LockGuard guard{ cacheMutex };
+
+		return searchIndex.Query(query, maxResults, excludedPathPrefix);
+	}
+
 	Array<String> AssetRegistry::GetSubDirectoriesAtPath(const Name& path)
 	{
 		LockGuard guard{ cacheMutex };
@@ -192,31 +319,22 @@ namespace CE
 			newEntry = true;
 		}
 
-		//String sourceAssetRelativePath = sourcePath.GetString();
-		Bundle::ObjectData primaryObjectData = load->GetPrimaryObjectData();
-
-		Name primaryName = primaryObjectData.name;
-		Name primaryTypeName = primaryObjectData.typeName;
-		assetData->bundleName = load->GetName();
-		assetData->bundlePath = load->GetBundlePath();
-		assetData->assetName = primaryName;
-		assetData->assetClassTypeName = primaryTypeName;
-		assetData->bundleUuid = load->GetUuid();
-		assetData->assetUuid = primaryObjectData.uuid;
-		
-#if PAL_TRAIT_BUILD_EDITOR
-		// Source asset path relative in project
-		//assetData->sourceAssetPath = sourceAssetRelativePath;
-		if (load->sourceAssetRelativePath.IsValid())
+		AssetRegistrySnapshot::Entry snapshotEntry = MakeSnapshotEntry(load, true);
+		ApplySnapshotEntry(assetData, snapshotEntry);
+
+		if (StatBundleFile(bundleAbsolutePath, snapshotEntry.lastWriteTime, snapshotEntry.fileSize))
 		{
-			assetData->sourceAssetPath = load->GetBundlePath().GetParentPath() + "/" + load->sourceAssetRelativePath.GetString();
+			snapshot.SetEntry(AssetRegistrySnapshot::GetEntryKey(bundleAbsolutePath), snapshotEntry);
 		}
-#endif
-		
+
 		if (newEntry && relativePathStr.NotEmpty())
 		{
 			AddAssetEntry(relativePathStr, assetData);
 		}
+		else if (!newEntry)
+		{
+			searchIndex.AddAsset(assetData);
+		}
 
 		load->BeginDestroy();
 		load = nullptr;
@@ -333,6 +451,8 @@ namespace CE
 								assetData->sourceAssetPath = newSourcePath;
 								String::IsAlphabet('a');
 							}
+
+							searchIndex.AddAsset(assetData);
 						}
 
 						cachedAssetsByPath.Remove(curOldPath);
@@ -508,6 +628,7 @@ namespace CE
 			{
 				assetData->bundleName = newName;
 				assetData->bundlePath = newPath;
+				searchIndex.AddAsset(assetData);
 			}
 		}
 		if (cachedPrimaryAssetByPath.KeyExists(originalPath))
@@ -517,6 +638,7 @@ namespace CE
 
 			cachedPrimaryAssetByPath[newPath]->bundleName = newName;
 			cachedPrimaryAssetByPath[newPath]->bundlePath = newPath;
+			searchIndex.AddAsset(cachedPrimaryAssetByPath[newPath]);
 		}
 
 		if (bundle == nullptr)
@@ -583,6 +705,8 @@ namespace CE
 
 	void AssetRegistry::InitializeCache()
 	{
+		ZoneScoped;
+
 		if (cacheInitialized)
 			return;
 
@@ -597,72 +721,15 @@ namespace CE
 #if PAL_TRAIT_BUILD_EDITOR
 		//pathTree.AddPath("/Editor"); directoryTree.AddPath("/Editor");
 #endif
-		
+
+		Array<AssetRegistryScanItem> scannedBundles{};
+
 		// Game assets
 		if (gProjectPath.Exists() && (gProjectPath / "Game/Assets").Exists())
 		{
 			auto projectAssetsPath = gProjectPath / "Game/Assets";
-			
-			projectAssetsPath.RecursivelyIterateChildren([&](const IO::Path& item)
-				{
-					auto relativePath = IO::Path::GetRelative(item, gProjectPath);
-					auto relativePathStr = relativePath.RemoveExtension().GetString().Replace({'\\'}, '/');
-                    if (!relativePathStr.StartsWith("/"))
-						relativePathStr = "/" + relativePathStr;
-
-					String parentRelativePathStr = relativePath.GetParentPath().GetString().Replace({ '\\' }, '/');
-					if (!parentRelativePathStr.StartsWith("/"))
-						parentRelativePathStr = "/" + parentRelativePathStr;
-
-					if (item.IsDirectory()) // Folder
-					{
-                        if (!relativePathStr.IsEmpty())
-						{
-							cachedPathTree.AddPath(relativePathStr);
-							cachedDirectoryTree.AddPath(relativePathStr);
-						}
-					}
-                    else if (item.GetExtension() == ".casset") // Product asset file
-                    {
-                    	LoadBundleArgs args{
-                    		.loadFully = false,
-                    		.forceReload = false,
-                    		.destroyOutdatedObjects = false
-                    	};
-
-						Ref<Bundle> load = Bundle::LoadBundleAbsolute(nullptr, item, args);
-						if (load != nullptr)
-						{
-							AssetData* assetData = new AssetData();
-							auto primaryObjectData = load->GetPrimaryObjectData();
-							//if (!load->GetPrimaryObjectName().IsValid())
-							//	load->LoadFully();
-							Name primaryName = primaryObjectData.name;
-							Name primaryTypeName = primaryObjectData.typeName;
-							assetData->bundleName = load->GetName();
-							assetData->bundlePath = load->GetBundlePath();
-							assetData->assetName = primaryName;
-							assetData->assetClassTypeName = primaryTypeName;
-							assetData->bundleUuid = load->GetUuid();
-							assetData->assetUuid = primaryObjectData.uuid;
-#if PAL_TRAIT_BUILD_EDITOR
-							// Source asset path relative to project assets directory
-							if (load->sourceAssetRelativePath.IsValid())
-							{
-								assetData->sourceAssetPath = load->GetBundlePath().GetParentPath() + "/" + load->sourceAssetRelativePath.GetString();
-							}
-#endif
-							load->BeginDestroy();
-							load = nullptr;
 
-							AddAssetEntry(relativePathStr, assetData);
-						}
-						else
-						{
-							CE_LOG(Error, All, "Failed to load asset metadata: {}", item);
-						}
-                    }
-				});
+			ScanAssetDirectory(gProjectPath, projectAssetsPath, true, cachedPathTree, cachedDirectoryTree, scannedBundles);
 
 #if PAL_TRAIT_BUILD_EDITOR
 			fileWatchID = fileWatcher.AddWatcher(projectAssetsPath, this, true);
@@ -680,62 +747,7 @@ namespace CE
 		// Engine assets
 		if (engineDir.Exists() && (engineDir / "Engine/Assets").Exists())
 		{
-			auto projectAssetsPath = engineDir / "Engine/Assets";
-
-			projectAssetsPath.RecursivelyIterateChildren([&](const IO::Path& item)
-				{
-					auto relativePath = IO::Path::GetRelative(item, engineDir);
-					auto relativePathStr = relativePath.RemoveExtension().GetString().Replace({ '\\' }, '/');
-					if (!relativePathStr.StartsWith("/"))
-						relativePathStr = "/" + relativePathStr;
-
-					String parentRelativePathStr = relativePath.GetParentPath().GetString().Replace({ '\\' }, '/');
-					if (!parentRelativePathStr.StartsWith("/"))
-						parentRelativePathStr = "/" + parentRelativePathStr;
-
-					if (item.IsDirectory()) // Folder
-					{
-						if (!relativePathStr.IsEmpty())
-						{
-							cachedPathTree.AddPath(relativePathStr);
-							cachedDirectoryTree.AddPath(relativePathStr);
-						}
-					}
-					else if (item.GetExtension() == ".casset") // Product asset file
-					{
-						LoadBundleArgs args{
-							.loadFully = false
-						};
-
-						Ref<Bundle> load = Bundle::LoadBundleAbsolute(nullptr, item, args);
-						if (load != nullptr)
-						{
-							AssetData* assetData = new AssetData();
-							auto primaryObjectData = load->GetPrimaryObjectData();
-
-							Name primaryName = primaryObjectData.name;
-							Name primaryTypeName = primaryObjectData.typeName;
-							assetData->bundleName = load->GetName();
-							assetData->bundlePath = load->GetBundlePath();
-							assetData->assetName = primaryName;
-							assetData->assetClassTypeName = primaryTypeName;
-							assetData->bundleUuid = load->GetUuid();
-							assetData->assetUuid = primaryObjectData.uuid;
-#if PAL_TRAIT_BUILD_EDITOR
-							// Source asset path relative to project assets directory
-							//assetData->sourceAssetPath = load->GetPrimarySourceAssetRelativePath();
-#endif
-							load->BeginDestroy();
-							load = nullptr;
-
-							AddAssetEntry(relativePathStr, assetData);
-						}
-						else
-						{
-							CE_LOG(Error, All, "Failed to load asset metadata: {}", item);
-						}
-					}
-				});
+			ScanAssetDirectory(engineDir, engineDir / "Engine/Assets", false, cachedPathTree, cachedDirectoryTree, scannedBundles);
 		}
 
 		auto launchDir = PlatformDirectories::GetLaunchDir();
@@ -743,66 +755,71 @@ namespace CE
 		// Editor assets
 		if ((launchDir / "Editor/Assets").Exists())
 		{
-			auto editorAssetsPath = launchDir / "Editor/Assets";
+			ScanAssetDirectory(launchDir, launchDir / "Editor/Assets", false, cachedPathTree, cachedDirectoryTree, scannedBundles);
+		}
+
+		snapshot.LoadFromDisk(GetSnapshotPath());
+
+		// Stat every bundle in parallel, the snapshot entry is only used if the file hasn't changed since
+		ParallelFor((u32)scannedBundles.GetSize(), [&](u32 index)
+			{
+				AssetRegistryScanItem& scanItem = scannedBundles[index];
+				scanItem.statSucceeded = StatBundleFile(scanItem.absolutePath, scanItem.lastWriteTime, scanItem.fileSize);
+			});
+
+		HashSet<String> scannedSnapshotKeys{};
+		u32 numBundlesRead = 0;
+
+		for (const AssetRegistryScanItem& scanItem : scannedBundles)
+		{
+			scannedSnapshotKeys.Add(scanItem.snapshotKey);
+
+			AssetRegistrySnapshot::Entry entry{};
 
-			editorAssetsPath.RecursivelyIterateChildren([&](const IO::Path& item)
+			if (!scanItem.statSucceeded || 
+				!snapshot.FindValidEntry(scanItem.snapshotKey, scanItem.lastWriteTime, scanItem.fileSize, entry))
+			{
+				LoadBundleArgs args{
+					.loadFully = false,
+					.forceReload = false,
+					.destroyOutdatedObjects = false
+				};
+
+				Ref<Bundle> load = Bundle::LoadBundleAbsolute(nullptr, scanItem.absolutePath, args);
+				if (load == nullptr)
 				{
-					auto relativePath = IO::Path::GetRelative(item, launchDir);
-					auto relativePathStr = relativePath.RemoveExtension().GetString().Replace({ '\\' }, '/');
-					if (!relativePathStr.StartsWith("/"))
-						relativePathStr = "/" + relativePathStr;
+					CE_LOG(Error, All, "Failed to load asset metadata: {}", scanItem.absolutePath);
+					snapshot.RemoveEntry(scanItem.snapshotKey);
+					continue;
+				}
 
-					String parentRelativePathStr = relativePath.GetParentPath().GetString().Replace({ '\\' }, '/');
-					if (!parentRelativePathStr.StartsWith("/"))
-						parentRelativePathStr = "/" + parentRelativePathStr;
+				entry = MakeSnapshotEntry(load, scanItem.includeSourceAssetPath);
+				entry.lastWriteTime = scanItem.lastWriteTime;
+				entry.fileSize = scanItem.fileSize;
 
-					if (item.IsDirectory()) // Folder
-					{
-						if (!relativePathStr.IsEmpty())
-						{
-							cachedPathTree.AddPath(relativePathStr);
-							cachedDirectoryTree.AddPath(relativePathStr);
-						}
-					}
-					else if (item.GetExtension() == ".casset") // Product asset file
-					{
-						LoadBundleArgs args{
-							.loadFully = false
-						};
+				load->BeginDestroy();
+				load = nullptr;
 
-						Ref<Bundle> load = Bundle::LoadBundleAbsolute(nullptr, item, args);
-						if (load != nullptr)
-						{
-							AssetData* assetData = new AssetData();
-							auto primaryObjectData = load->GetPrimaryObjectData();
-
-							Name primaryName = primaryObjectData.name;
-							Name primaryTypeName = primaryObjectData.typeName;
-							assetData->bundleName = load->GetName();
-							assetData->bundlePath = load->GetBundlePath();
-							assetData->assetName = primaryName;
-							assetData->assetClassTypeName = primaryTypeName;
-							assetData->bundleUuid = load->GetUuid();
-							assetData->assetUuid = primaryObjectData.uuid;
-#if PAL_TRAIT_BUILD_EDITOR
-							// Source asset path relative to project assets directory
-							// TODO:
-							//assetData->sourceAssetPath = load->GetPrimarySourceAssetRelativePath();
-#endif
-							load->BeginDestroy();
-							load = nullptr;
+				numBundlesRead++;
 
-							AddAssetEntry(relativePathStr, assetData);
-						}
-						else
-						{
-							CE_LOG(Error, All, "Failed to load asset metadata: {}", item);
-						}
-					}
+				if (scanItem.statSucceeded)
+				{
+					snapshot.SetEntry(scanItem.snapshotKey, entry);
 				}
-			);
+			}
+
+			AssetData* assetData = new AssetData();
+			ApplySnapshotEntry(assetData, entry);
+
+			AddAssetEntry(scanItem.bundlePath, assetData);
 		}
 
+		// Bundles that were deleted or moved while the editor wasn't running
+		snapshot.RemoveEntriesNotIn(scannedSnapshotKeys);
+
+		CE_LOG(Info, All, "Asset registry: {} bundles, {} read from disk, {} from snapshot", 
+			scannedBundles.GetSize(), numBundlesRead, scannedBundles.GetSize() - numBundlesRead);
+
 		// We don't want to sort the root directories: /Game, /Engine, /Editor
 		for (PathTreeNode* child : cachedDirectoryTree.GetRootNode()->children)
 		{
@@ -814,8 +831,9 @@ namespace CE
 		}
 
 		cacheInitialized = true;
-	}
 
+		SaveSnapshot();
+	}
 
 	void AssetRegistry::AddAssetEntry(const Name& bundleName, AssetData* assetData)
 	{
@@ -850,6 +868,8 @@ namespace CE
 		{
 			cachedAssetBySourcePath[assetData->sourceAssetPath] = assetData;
 		}
+
+		searchIndex.AddAsset(assetData);
 	}
 
 	void AssetRegistry::DeleteAssetEntry(const Name& bundlePath)
@@ -909,6 +929,7 @@ namespace CE
 					cachedPrimaryAssetsByParentPath[parentPath].Remove(assetData);
 
 					allAssetDatas.Remove(assetData);
+					searchIndex.RemoveAsset(assetData);
 
 					Name sourcePath = assetData->sourceAssetPath;
 					if (cachedAssetBySourcePath.KeyExists(sourcePath))
@@ -1010,6 +1031,11 @@ namespace CE
             }
             else if (fileAction == IO::FileAction::Delete)
             {
+				if (filePath.GetExtension() == ".casset")
+				{
+					snapshot.RemoveEntry(AssetRegistrySnapshot::GetEntryKey(filePath));
+				}
+
                 SourceAssetChange change{};
                 change.fileAction = IO::FileAction::Delete;
                 change.currentPath = filePath;
@@ -1018,6 +1044,11 @@ namespace CE
             }
             else if (fileAction == IO::FileAction::Moved)
             {
+				if (IO::Path(directory / oldFileName).GetExtension() == ".casset")
+				{
+					snapshot.RemoveEntry(AssetRegistrySnapshot::GetEntryKey(directory / oldFileName));
+				}
+
                 SourceAssetChange change{};
                 change.fileAction = IO::FileAction::Moved;
                 change.currentPath = filePath;
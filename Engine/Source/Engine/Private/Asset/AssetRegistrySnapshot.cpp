@@ -0,0 +1,247 @@
+#include "Engine.h"
+
+namespace CE
+{
+	static constexpr u64 AssetRegistrySnapshotMagic = 0x50414E5341524543; // CERASNAP
+
+	bool AssetRegistrySnapshot::LoadFromDisk(const IO::Path& snapshotPath)
+	{
+		ZoneScoped;
+
+		LockGuard lock{ mutex };
+
+		entriesByPath.Clear();
+		isDirty = false;
+
+		if (!snapshotPath.Exists())
+			return false;
+
+		FileStream reader = FileStream(snapshotPath, Stream::Permissions::ReadOnly);
+		if (!reader.IsOpen())
+			return false;
+
+		reader.SetBinaryMode(true);
+
+		// FileStream keeps advancing past the end of the file on failed reads
+		const u64 fileLength = reader.GetLength();
+		auto isTruncated = [&]
+			{
+				return reader.GetCurrentPosition() > fileLength;
+			};
+
+		u64 magic = 0;
+		u32 version = 0;
+		u32 bundleMajor = 0, bundleMinor = 0;
+		reader >> magic;
+		reader >> version;
+		reader >> bundleMajor;
+		reader >> bundleMinor;
+
+		// Header layout depends on the bundle version, so a snapshot from a different version can't be trusted
+		if (magic != AssetRegistrySnapshotMagic || version != Version ||
+			bundleMajor != Bundle::GetCurrentMajor() || bundleMinor != Bundle::GetCurrentMinor())
+		{
+			return false;
+		}
+
+		u32 entryCount = 0;
+		reader >> entryCount;
+
+		for (u32 i = 0; i < entryCount; i++)
+		{
+			String key{};
+			Entry entry{};
+
+			reader >> key;
+			reader >> entry.bundlePath;
+			reader >> entry.bundleName;
+			reader >> entry.bundleUuid;
+			reader >> entry.assetName;
+			reader >> entry.assetUuid;
+			reader >> entry.assetClassTypeName;
+			reader >> entry.sourceAssetPath;
+
+			u32 dependencyCount = 0;
+			reader >> dependencyCount;
+
+			if (isTruncated())
+				break;
+
+			for (u32 j = 0; j < dependencyCount && !isTruncated(); j++)
+			{
+				Uuid dependency{};
+				reader >> dependency;
+				entry.dependencies.Add(dependency);
+			}
+
+			reader >> entry.lastWriteTime;
+			reader >> entry.fileSize;
+
+			if (isTruncated())
+				break;
+
+			entriesByPath[key] = entry;
+		}
+
+		if (isTruncated())
+		{
+			CE_LOG(Warn, All, "Asset registry snapshot is corrupted and will be rebuilt: {}", snapshotPath);
+			entriesByPath.Clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool AssetRegistrySnapshot::SaveToDisk(const IO::Path& snapshotPath)
+	{
+		ZoneScoped;
+
+		LockGuard lock{ mutex };
+
+		if (!snapshotPath.GetParentPath().Exists())
+		{
+			IO::Path::CreateDirectories(snapshotPath.GetParentPath());
+		}
+
+		// Write to a temporary file first, so a crash mid-write never leaves a truncated snapshot behind
+		IO::Path tempPath = snapshotPath.GetParentPath() / String::Format("{}.{}.tmp", snapshotPath.GetFileName().GetString(), Uuid::Random());
+
+		{
+			FileStream writer = FileStream(tempPath, Stream::Permissions::WriteOnly);
+			if (!writer.IsOpen())
+			{
+				CE_LOG(Error, All, "Failed to write asset registry snapshot: {}", tempPath);
+				return false;
+			}
+
+			writer.SetBinaryMode(true);
+
+			writer << AssetRegistrySnapshotMagic;
+			writer << Version;
+			writer << Bundle::GetCurrentMajor();
+			writer << Bundle::GetCurrentMinor();
+
+			writer << (u32)entriesByPath.GetSize();
+
+			for (const auto& [key, entry] : entriesByPath)
+			{
+				writer << key;
+				writer << entry.bundlePath;
+				writer << entry.bundleName;
+				writer << entry.bundleUuid;
+				writer << entry.assetName;
+				writer << entry.assetUuid;
+				writer << entry.assetClassTypeName;
+				writer << entry.sourceAssetPath;
+
+				writer << (u32)entry.dependencies.GetSize();
+				for (const Uuid& dependency : entry.dependencies)
+				{
+					writer << dependency;
+				}
+
+				writer << entry.lastWriteTime;
+				writer << entry.fileSize;
+			}
+
+			writer.Close();
+		}
+
+		std::error_code error{};
+		fs::rename((fs::path)tempPath, (fs::path)snapshotPath, error);
+		if (error)
+		{
+			CE_LOG(Error, All, "Failed to write asset registry snapshot {}: {}", snapshotPath, error.message());
+			fs::remove((fs::path)tempPath, error);
+			return false;
+		}
+
+		isDirty = false;
+		return true;
+	}
+
+	bool AssetRegistrySnapshot::FindValidEntry(const String& absoluteBundlePath, u64 lastWriteTime, u64 fileSize, Entry& outEntry)
+	{
+		LockGuard lock{ mutex };
+
+		auto it = entriesByPath.Find(absoluteBundlePath);
+		if (it == entriesByPath.End())
+			return false;
+
+		if (it->second.lastWriteTime != lastWriteTime || it->second.fileSize != fileSize)
+			return false;
+
+		outEntry = it->second;
+		return true;
+	}
+
+	void AssetRegistrySnapshot::SetEntry(const String& absoluteBundlePath, const Entry& entry)
+	{
+		LockGuard lock{ mutex };
+
+		entriesByPath[absoluteBundlePath] = entry;
+		isDirty = true;
+	}
+
+	void AssetRegistrySnapshot::RemoveEntry(const String& absoluteBundlePath)
+	{
+		LockGuard lock{ mutex };
+
+		if (entriesByPath.KeyExists(absoluteBundlePath))
+		{
+			entriesByPath.Remove(absoluteBundlePath);
+			isDirty = true;
+		}
+	}
+
+	void AssetRegistrySnapshot::RemoveEntriesNotIn(const HashSet<String>& absoluteBundlePaths)
+	{
+		LockGuard lock{ mutex };
+
+		Array<String> removedPaths{};
+
+		for (const auto& [key, entry] : entriesByPath)
+		{
+			if (!absoluteBundlePaths.Exists(key))
+			{
+				removedPaths.Add(key);
+			}
+		}
+
+		for (const String& path : removedPaths)
+		{
+			entriesByPath.Remove(path);
+		}
+
+		if (removedPaths.NotEmpty())
+		{
+			isDirty = true;
+		}
+	}
+
+	void AssetRegistrySnapshot::Clear()
+	{
+		LockGuard lock{ mutex };
+
+		if (entriesByPath.NotEmpty())
+		{
+			isDirty = true;
+		}
+
+		entriesByPath.Clear();
+	}
+
+	u32 AssetRegistrySnapshot::GetEntryCount()
+	{
+		LockGuard lock{ mutex };
+
+		return (u32)entriesByPath.GetSize();
+	}
+
+	String AssetRegistrySnapshot::GetEntryKey(const IO::Path& absoluteBundlePath)
+	{
+		return absoluteBundlePath.GetString().Replace({ '\\' }, '/');
+	}
+
+} // namespace CE
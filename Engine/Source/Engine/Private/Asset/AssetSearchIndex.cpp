@@ -0,0 +1,575 @@
+#include "Engine.h"
+
+namespace CE
+{
+	// Fields are indexed separately, so a trigram never spans two of them. Each posting entry carries the fields of
+	// the document that contain its key, and a query only verifies the fields every one of its keys was found in.
+	static constexpr u32 FieldName = 1 << 0;
+	static constexpr u32 FieldPath = 1 << 1;
+	static constexpr u32 FieldType = 1 << 2;
+	static constexpr u32 FieldBits = 3;
+	static constexpr u32 FieldMask = (1 << FieldBits) - 1;
+
+	// Trigram keys pack 3 characters and leave the top byte empty. Prefix & word start keys pack the first 1 to 3
+	// characters of the name and of each word in it: they answer queries too short to have a trigram, and tell which
+	// candidates can rank high before their text is compared.
+	static constexpr u32 PrefixKeyFlag = 0xFE000000;
+	static constexpr u32 WordStartKeyFlag = 0xFF000000;
+
+	static constexpr u32 ExactNameScore = 100;
+	static constexpr u32 NamePrefixScore = 80;
+	static constexpr u32 NameWordStartScore = 60;
+	static constexpr u32 NameScore = 40;
+	static constexpr u32 TypeScore = 20;
+	static constexpr u32 PathScore = 10;
+
+	static inline u32 MakeTrigramKey(const char* text)
+	{
+		return (u32)(u8)text[0] | ((u32)(u8)text[1] << 8) | ((u32)(u8)text[2] << 16);
+	}
+
+	static inline u32 MakeShortKey(u32 flag, const char* text, u32 length)
+	{
+		u32 key = flag;
+		for (u32 i = 0; i < length && i < 3; i++)
+		{
+			key |= (u32)(u8)text[i] << (i * 8);
+		}
+		return key;
+	}
+
+	static inline bool IsAlphaNumeric(char c)
+	{
+		return String::IsAlphabet(c) || String::IsNumeric(c);
+	}
+
+	static inline bool IsWhiteSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+	}
+
+	//! @brief "/Code/Engine.CE::Texture2D" -> "Texture2D"
+	static String GetShortTypeName(const String& typeName)
+	{
+		int start = 0;
+		for (int i = 0; i < typeName.GetLength(); i++)
+		{
+			if (typeName[i] == ':' || typeName[i] == '.' || typeName[i] == '/')
+				start = i + 1;
+		}
+		return typeName.GetSubstring(start);
+	}
+
+	/// Walks a posting list forward. Candidates are visited in increasing document order, so each lookup gallops
+	/// from the previous position instead of searching the whole list.
+	struct PostingCursor
+	{
+		const u32* position = nullptr;
+		const u32* end = nullptr;
+
+		PostingCursor() = default;
+
+		PostingCursor(const Array<u32>* list)
+		{
+			if (list != nullptr)
+			{
+				position = list->GetData();
+				end = position + list->GetSize();
+			}
+		}
+
+		//! @brief Returns the fields of the document that contain the key, 0 if it isn't in the list.
+		u32 Seek(u32 documentIndex)
+		{
+			const u32 target = documentIndex << FieldBits;
+
+			const u32* low = position;
+			SIZE_T step = 1;
+			while (step < (SIZE_T)(end - low) && low[step] < target)
+			{
+				low += step;
+				step <<= 1;
+			}
+
+			const u32* high = step < (SIZE_T)(end - low) ? low + step + 1 : end;
+			position = std::lower_bound(low, high, target);
+
+			if (position != end && (*position >> FieldBits) == documentIndex)
+				return *position & FieldMask;
+			return 0;
+		}
+	};
+
+	static void AddTrigramKeys(const String& text, u32 field, Array<u64>& outFieldKeys)
+	{
+		const char* data = text.GetCString();
+		for (int i = 0; i + 3 <= text.GetLength(); i++)
+		{
+			outFieldKeys.Add(((u64)MakeTrigramKey(data + i) << 32) | field);
+		}
+	}
+
+	static void AddShortKeys(u32 flag, const char* text, Array<u64>& outFieldKeys)
+	{
+		for (u32 length = 1; length <= 3 && text[length - 1] != 0; length++)
+		{
+			outFieldKeys.Add(((u64)MakeShortKey(flag, text, length) << 32) | FieldName);
+		}
+	}
+
+	void AssetSearchIndex::CollectKeys(const Document& document, Array<u64>& outFieldKeys)
+	{
+		outFieldKeys.Clear();
+
+		AddTrigramKeys(document.name, FieldName, outFieldKeys);
+		AddTrigramKeys(document.path, FieldPath, outFieldKeys);
+		AddTrigramKeys(document.typeName, FieldType, outFieldKeys);
+
+		const char* name = document.name.GetCString();
+		if (name[0] != 0)
+		{
+			AddShortKeys(PrefixKeyFlag, name, outFieldKeys);
+		}
+
+		for (u16 wordStart : document.nameWordStarts)
+		{
+			AddShortKeys(WordStartKeyFlag, name + wordStart, outFieldKeys);
+		}
+
+		// Merge the fields of duplicate keys
+		u64* begin = outFieldKeys.GetData();
+		std::sort(begin, begin + outFieldKeys.GetSize());
+
+		int count = 0;
+		for (int i = 0; i < outFieldKeys.GetSize(); i++)
+		{
+			if (count > 0 && (outFieldKeys[count - 1] >> 32) == (outFieldKeys[i] >> 32))
+				outFieldKeys[count - 1] |= outFieldKeys[i] & FieldMask;
+			else
+				outFieldKeys[count++] = outFieldKeys[i];
+		}
+		outFieldKeys.Resize(count);
+	}
+
+	void AssetSearchIndex::AddAsset(AssetData* assetData)
+	{
+		if (assetData == nullptr)
+			return;
+
+		if (documentByAsset.KeyExists(assetData))
+		{
+			RemoveAsset(assetData);
+		}
+
+		u32 documentIndex = 0;
+		if (!freeDocuments.IsEmpty())
+		{
+			documentIndex = freeDocuments.Top();
+			freeDocuments.Pop();
+		}
+		else
+		{
+			documentIndex = documents.GetSize();
+			documents.Add({});
+			nameLengths.Add(0);
+		}
+
+		Document& document = documents[documentIndex];
+		document.assetData = assetData;
+
+		const String& name = assetData->bundleName.GetString();
+		document.name = name.ToLower();
+		document.path = assetData->bundlePath.GetString().ToLower();
+		document.typeName = GetShortTypeName(assetData->assetClassTypeName.GetString()).ToLower();
+
+		nameLengths[documentIndex] = (u16)Math::Min<int>(name.GetLength(), UINT16_MAX);
+
+		document.nameWordStarts.Clear();
+		for (int i = 0; i < name.GetLength() && i <= UINT16_MAX; i++)
+		{
+			char c = name[i];
+			if (!IsAlphaNumeric(c))
+				continue;
+
+			if (i == 0 || !IsAlphaNumeric(name[i - 1]) ||
+				(String::IsUpper(c) && String::IsLower(name[i - 1])) ||
+				(String::IsNumeric(c) && !String::IsNumeric(name[i - 1])))
+			{
+				document.nameWordStarts.Add((u16)i);
+			}
+		}
+
+		Array<u64> fieldKeys;
+		CollectKeys(document, fieldKeys);
+
+		document.keys.Clear();
+		document.keys.Reserve(fieldKeys.GetSize());
+
+		for (u64 fieldKey : fieldKeys)
+		{
+			u32 key = (u32)(fieldKey >> 32);
+			u32 entry = (documentIndex << FieldBits) | (u32)(fieldKey & FieldMask);
+
+			// New documents usually have the highest index, so this is mostly an append
+			Array<u32>& list = postings[key];
+			const u32* begin = list.GetData();
+			const u32* position = std::lower_bound(begin, begin + list.GetSize(), entry);
+			list.InsertAt((int)(position - begin), entry);
+
+			document.keys.Add(key);
+		}
+
+		documentByAsset[assetData] = documentIndex;
+	}
+
+	void AssetSearchIndex::RemoveAsset(AssetData* assetData)
+	{
+		auto it = documentByAsset.Find(assetData);
+		if (it == documentByAsset.End())
+			return;
+
+		u32 documentIndex = it->second;
+		documentByAsset.Remove(assetData);
+
+		Document& document = documents[documentIndex];
+
+		for (u32 key : document.keys)
+		{
+			auto postingIt = postings.Find(key);
+			if (postingIt == postings.End())
+				continue;
+
+			Array<u32>& list = postingIt->second;
+			const u32* begin = list.GetData();
+			const u32* end = begin + list.GetSize();
+			const u32* position = std::lower_bound(begin, end, documentIndex << FieldBits);
+
+			if (position != end && (*position >> FieldBits) == documentIndex)
+			{
+				list.RemoveAt(position - begin);
+			}
+
+			if (list.IsEmpty())
+			{
+				postings.Remove(key);
+			}
+		}
+
+		document = {};
+		nameLengths[documentIndex] = 0;
+		freeDocuments.Add(documentIndex);
+	}
+
+	const Array<u32>* AssetSearchIndex::FindPostings(u32 key) const
+	{
+		auto it = postings.Find(key);
+		if (it == postings.End())
+			return nullptr;
+		return &it->second;
+	}
+
+	u32 AssetSearchIndex::ScoreToken(const Document& document, const Token& token, u32 fields)
+	{
+		const char* text = token.text.GetCString();
+		const u32 length = token.text.GetLength();
+
+		if ((fields & FieldName) && document.name.NotEmpty())
+		{
+			const char* name = document.name.GetCString();
+
+			if (strncmp(name, text, length) == 0)
+				return name[length] == 0 ? ExactNameScore : NamePrefixScore;
+
+			const u16* wordStartsBegin = document.nameWordStarts.GetData();
+			const u16* wordStartsEnd = wordStartsBegin + document.nameWordStarts.GetSize();
+			bool found = false;
+
+			for (const char* match = strstr(name + 1, text); match != nullptr; match = strstr(match + 1, text))
+			{
+				found = true;
+
+				if (std::binary_search(wordStartsBegin, wordStartsEnd, (u16)(match - name)))
+					return NameWordStartScore;
+			}
+
+			if (found)
+				return NameScore;
+		}
+
+		if ((fields & FieldType) && strstr(document.typeName.GetCString(), text) != nullptr)
+			return TypeScore;
+
+		if ((fields & FieldPath) && strstr(document.path.GetCString(), text) != nullptr)
+			return PathScore;
+
+		return 0;
+	}
+
+	Array<AssetSearchIndex::Result> AssetSearchIndex::Query(const String& query, u32 maxResults, const String& excludedPathPrefix) const
+	{
+		ZoneScoped;
+
+		Array<Result> results;
+
+		if (maxResults == 0 || documentByAsset.GetSize() == 0)
+			return results;
+
+		// - Tokenize -
+
+		String lowerQuery = query.ToLower();
+		Array<Token> tokens;
+
+		for (int i = 0; i < lowerQuery.GetLength() && tokens.GetSize() < MaxQueryWords; )
+		{
+			while (i < lowerQuery.GetLength() && IsWhiteSpace(lowerQuery[i]))
+				i++;
+
+			int start = i;
+			while (i < lowerQuery.GetLength() && !IsWhiteSpace(lowerQuery[i]))
+				i++;
+
+			if (i == start)
+				continue;
+
+			String text = lowerQuery.GetSubstring(start, i - start);
+			if (tokens.Exists([&](const Token& token) { return token.text == text; }))
+				continue;
+
+			Token& token = tokens.EmplaceBack();
+			token.text = text;
+
+			const char* data = token.text.GetCString();
+			const u32 length = token.text.GetLength();
+
+			token.prefixList = FindPostings(MakeShortKey(PrefixKeyFlag, data, length));
+			token.wordStartList = FindPostings(MakeShortKey(WordStartKeyFlag, data, length));
+			token.keysAreExact = length <= 3;
+
+			if (length < 3)
+			{
+				if (token.wordStartList == nullptr) // Nothing matches every token
+					return results;
+
+				token.lists.Add(token.wordStartList);
+				continue;
+			}
+
+			for (u32 j = 0; j + 3 <= length; j++)
+			{
+				const Array<u32>* list = FindPostings(MakeTrigramKey(data + j));
+				if (list == nullptr)
+					return results;
+
+				if (!token.lists.Exists(list))
+					token.lists.Add(list);
+			}
+
+			std::sort(token.lists.begin(), token.lists.end(),
+				[](const Array<u32>* lhs, const Array<u32>* rhs) { return lhs->GetSize() < rhs->GetSize(); });
+		}
+
+		if (tokens.IsEmpty())
+			return results;
+
+		// Most selective token first, so the candidates shrink as early as possible
+		std::sort(tokens.begin(), tokens.end(),
+			[](const Token& lhs, const Token& rhs) { return lhs.lists[0]->GetSize() < rhs.lists[0]->GetSize(); });
+
+		// - Intersect -
+
+		struct Candidate
+		{
+			u32 documentIndex = 0;
+			//! @brief FieldBits wide field masks, one per token.
+			u32 tokenFields = 0;
+		};
+
+		// Sorted by document index, like the posting lists
+		Array<Candidate> candidates;
+		Array<Candidate> nextCandidates;
+		Array<PostingCursor> cursors;
+
+		for (int tokenIndex = 0; tokenIndex < tokens.GetSize(); tokenIndex++)
+		{
+			const Token& token = tokens[tokenIndex];
+			const u32 shift = tokenIndex * FieldBits;
+
+			cursors.Clear();
+			for (const Array<u32>* list : token.lists)
+			{
+				cursors.Add(PostingCursor(list));
+			}
+
+			nextCandidates.Clear();
+
+			auto matchDocument = [&](u32 documentIndex, u32 fields, u32 tokenFields, int firstCursor)
+				{
+					for (int i = firstCursor; i < cursors.GetSize() && fields != 0; i++)
+					{
+						fields &= cursors[i].Seek(documentIndex);
+					}
+
+					if (fields != 0)
+					{
+						nextCandidates.Add({ documentIndex, tokenFields | (fields << shift) });
+					}
+				};
+
+			if (tokenIndex == 0)
+			{
+				for (u32 entry : *token.lists[0])
+				{
+					matchDocument(entry >> FieldBits, entry & FieldMask, 0, 1);
+				}
+			}
+			else
+			{
+				for (const Candidate& candidate : candidates)
+				{
+					matchDocument(candidate.documentIndex, FieldMask, candidate.tokenFields, 0);
+				}
+			}
+
+			std::swap(candidates, nextCandidates);
+
+			if (candidates.IsEmpty())
+				return results;
+		}
+
+		// - Rank -
+
+		// Short tokens are scored from the keys alone. Longer ones get an upper bound from the keys, and their text is
+		// only compared if that bound could still make the top maxResults.
+
+		struct RankedCandidate
+		{
+			u32 documentIndex = 0;
+			u32 score = 0;
+		};
+
+		auto isBetter = [this](const RankedCandidate& lhs, const RankedCandidate& rhs)
+			{
+				if (lhs.score != rhs.score)
+					return lhs.score > rhs.score;
+				if (nameLengths[lhs.documentIndex] != nameLengths[rhs.documentIndex])
+					return nameLengths[lhs.documentIndex] < nameLengths[rhs.documentIndex];
+				return lhs.documentIndex < rhs.documentIndex;
+			};
+
+		// Heap of the best candidates so far, the worst one on top
+		Array<RankedCandidate> best;
+		best.Reserve(Math::Min<u32>(maxResults, candidates.GetSize()));
+
+		Array<PostingCursor> prefixCursors;
+		Array<PostingCursor> wordStartCursors;
+		for (const Token& token : tokens)
+		{
+			prefixCursors.Add(PostingCursor(token.prefixList));
+			wordStartCursors.Add(PostingCursor(token.wordStartList));
+		}
+
+		for (const Candidate& candidate : candidates)
+		{
+			const u32 documentIndex = candidate.documentIndex;
+			u32 bound = 0;
+			bool isExact = true;
+
+			for (int tokenIndex = 0; tokenIndex < tokens.GetSize(); tokenIndex++)
+			{
+				const Token& token = tokens[tokenIndex];
+				const u32 fields = (candidate.tokenFields >> (tokenIndex * FieldBits)) & FieldMask;
+
+				u32 tokenBound = 0;
+
+				// For a token longer than 3 characters the keys only tell where its first 3 characters are,
+				// which still bounds the score: it can't be a prefix of the name if they aren't.
+				if (fields & FieldName)
+				{
+					if (prefixCursors[tokenIndex].Seek(documentIndex))
+						tokenBound = nameLengths[documentIndex] == token.text.GetLength() ? ExactNameScore : NamePrefixScore;
+					else if (wordStartCursors[tokenIndex].Seek(documentIndex))
+						tokenBound = NameWordStartScore;
+					else
+						tokenBound = NameScore;
+				}
+				else if (fields & FieldType)
+				{
+					tokenBound = TypeScore;
+				}
+				else
+				{
+					tokenBound = PathScore;
+				}
+
+				bound += tokenBound;
+				isExact = isExact && token.keysAreExact;
+			}
+
+			RankedCandidate ranked{ documentIndex, bound };
+
+			if (best.GetSize() == maxResults && !isBetter(ranked, best[0]))
+				continue;
+
+			if (excludedPathPrefix.NotEmpty() && documents[documentIndex].assetData->bundlePath.GetString().StartsWith(excludedPathPrefix))
+				continue;
+
+			if (!isExact)
+			{
+				const Document& document = documents[documentIndex];
+				ranked.score = 0;
+
+				for (int tokenIndex = 0; tokenIndex < tokens.GetSize(); tokenIndex++)
+				{
+					const u32 fields = (candidate.tokenFields >> (tokenIndex * FieldBits)) & FieldMask;
+					u32 tokenScore = ScoreToken(document, tokens[tokenIndex], fields);
+
+					if (tokenScore == 0)
+					{
+						ranked.score = 0;
+						break;
+					}
+
+					ranked.score += tokenScore;
+				}
+
+				if (ranked.score == 0)
+					continue;
+
+				if (best.GetSize() == maxResults && !isBetter(ranked, best[0]))
+					continue;
+			}
+
+			if (best.GetSize() == maxResults)
+			{
+				std::pop_heap(best.begin(), best.end(), isBetter);
+				best.Top() = ranked;
+			}
+			else
+			{
+				best.Add(ranked);
+			}
+
+			std::push_heap(best.begin(), best.end(), isBetter);
+		}
+
+		std::sort_heap(best.begin(), best.end(), isBetter);
+
+		results.Reserve(best.GetSize());
+		for (const RankedCandidate& ranked : best)
+		{
+			results.Add({ documents[ranked.documentIndex].assetData, ranked.score });
+		}
+
+		return results;
+	}
+
+	void AssetSearchIndex::Clear()
+	{
+		documents.Clear();
+		freeDocuments.Clear();
+		nameLengths.Clear();
+		documentByAsset.Clear();
+		postings.Clear();
+	}
+
+} // namespace CE
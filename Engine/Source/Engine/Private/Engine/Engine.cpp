@@ -100,6 +100,8 @@ namespace CE
 	{
 		ZoneScoped;
 
+		tickStartTime = std::chrono::steady_clock::now();
+
 		if (IsEngineRequestingExit())
 		{
 			return;
@@ -62,6 +62,20 @@ namespace CE
 			rpiScene->SetName(GetName());
 		}
 
+		if (tickScheduleDirty)
+		{
+			tickScheduleDirty = false;
+			tickScheduler.Rebuild(actors, this);
+		}
+
+		if (transformHierarchyDirty)
+		{
+			RebuildTransformHierarchy();
+		}
+
+		// Components only recompute transforms that changed after this point
+		transformHierarchy.Update();
+
 		for (Actor* actor : actors)
 		{
 			if (!actor->IsSelfEnabled())
@@ -70,6 +84,9 @@ namespace CE
 			actor->Tick(delta);
 		}
 
+		tickScheduler.Tick(TickGroup::PrePhysics, delta, &transformHierarchy);
+		tickScheduler.Tick(TickGroup::DuringPhysics, delta, &transformHierarchy);
+
 		for (CameraComponent* camera : cameras)
 		{
 			if (!camera->IsEnabledInHierarchy())
@@ -88,6 +105,129 @@ namespace CE
 		if (physicsScene)
 		{
 			physicsScene->Tick(delta);
+
+			ApplyPhysicsTransforms();
+
+			// Post physics components see the simulated transforms
+			transformHierarchy.Update();
+		}
+
+		tickScheduler.Tick(TickGroup::PostPhysics, delta, &transformHierarchy);
+		tickScheduler.Tick(TickGroup::PostUpdateWork, delta, &transformHierarchy);
+	}
+
+	void CE::Scene::ApplyPhysicsTransforms()
+	{
+		ZoneScoped;
+
+		if (!physicsScene || !physicsScene->IsSimulationEnabled())
+			return;
+
+		physicsTransforms.Clear();
+
+		IterateAllComponents<GeometryComponent>([&](GeometryComponent* component)
+			{
+				if (component->IsSimulatingPhysics() && component->GetPhysicsBody().IsValid() && component->IsEnabledInHierarchy())
+				{
+					physicsTransforms.EmplaceBack().component = component;
+				}
+			});
+
+		if (physicsTransforms.IsEmpty())
+			return;
+
+		// Reading the bodies and converting to local space doesn't modify any component, so it runs in parallel
+		ParallelFor((u32)physicsTransforms.GetSize(), [&](u32 index)
+			{
+				PhysicsTransform& physicsTransform = physicsTransforms[index];
+				GeometryComponent* component = physicsTransform.component;
+				PhysicsBody* physicsBody = component->GetPhysicsBody().Get();
+
+				physicsTransform.worldPosition = physicsBody->GetPosition();
+				physicsTransform.localPosition = component->WorldToLocalPosition(physicsTransform.worldPosition);
+				physicsTransform.localEulerAngles = component->WorldToLocalEulerAngles(physicsBody->GetRotation());
+			});
+
+		// Setters notify field listeners, so they stay on the game thread. With a transform hierarchy node each one is O(1).
+		for (const PhysicsTransform& physicsTransform : physicsTransforms)
+		{
+			GeometryComponent* component = physicsTransform.component;
+
+			component->globalPosition = physicsTransform.worldPosition;
+			component->SetLocalPosition(physicsTransform.localPosition);
+			component->SetLocalEulerAngles(physicsTransform.localEulerAngles);
+		}
+	}
+
+	void CE::Scene::RebuildTransformHierarchy()
+	{
+		ZoneScoped;
+
+		transformHierarchyDirty = false;
+
+		transformHierarchy.BeginVisit();
+
+		std::function<void(SceneComponent*, u32)> visitSceneComponent = [&](SceneComponent* sceneComponent, u32 parentHandle)
+			{
+				u32& handle = sceneComponent->transformHandle;
+
+				if (!transformHierarchy.IsValid(handle, sceneComponent))
+				{
+					handle = transformHierarchy.Allocate(sceneComponent);
+					transformHierarchy.SetLocalTransform(handle, sceneComponent->localPosition, sceneComponent->localEulerAngles, sceneComponent->localScale);
+				}
+				else
+				{
+					transformHierarchy.MarkVisited(handle);
+				}
+
+				transformHierarchy.SetParent(handle, parentHandle);
+
+				for (SceneComponent* component : sceneComponent->attachedComponents)
+				{
+					if (component != nullptr && component != sceneComponent)
+						visitSceneComponent(component, handle);
+				}
+			};
+
+		// Root components of child actors are parented to the closest ancestor actor's root component
+		std::function<void(Actor*, u32)> visitActor = [&](Actor* actor, u32 parentHandle)
+			{
+				if (actor->rootComponent != nullptr)
+				{
+					visitSceneComponent(actor->rootComponent, parentHandle);
+					parentHandle = actor->rootComponent->transformHandle;
+				}
+
+				for (Actor* child : actor->children)
+				{
+					if (child != nullptr && child != actor)
+						visitActor(child, parentHandle);
+				}
+			};
+
+		for (Actor* actor : actors)
+		{
+			if (actor != nullptr)
+				visitActor(actor, TransformHierarchy::InvalidHandle);
+		}
+
+		transformHierarchy.FreeUnvisited();
+	}
+
+	RenderSnapshot* CE::Scene::GetRenderSnapshot() const
+	{
+		if (rendererSubsystem == nullptr)
+			return nullptr;
+
+		return rendererSubsystem->GetGameThreadSnapshot();
+	}
+
+	void CE::Scene::SyncRenderThread()
+	{
+		if (rendererSubsystem != nullptr)
+		{
+			rendererSubsystem->SyncRenderThread();
 		}
 	}
 
@@ -124,6 +264,8 @@ namespace CE
 	{
 		if (renderPipeline && !renderPipelines.Exists(renderPipeline))
 		{
+			SyncRenderThread();
+
 			rpiScene->AddRenderPipeline(renderPipeline->GetRpiRenderPipeline());
 			renderPipelines.Add(renderPipeline);
 		}
@@ -131,6 +273,8 @@ namespace CE
 	
 	void CE::Scene::RemoveRenderPipeline(CE::RenderPipeline* renderPipeline)
 	{
+		SyncRenderThread();
+
 		rpiScene->RemoveRenderPipeline(renderPipeline->GetRpiRenderPipeline());
 		renderPipelines.Remove(renderPipeline);
 	}
@@ -164,6 +308,9 @@ namespace CE
 
 	void CE::Scene::RegisterActorComponent(ActorComponent* actorComponent)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		auto componentClass = actorComponent->GetClass();
 		auto componentUuid = actorComponent->GetUuid();
 
@@ -177,6 +324,9 @@ namespace CE
 
 	void CE::Scene::DeregisterActorComponent(ActorComponent* actorComponent)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		auto componentClass = actorComponent->GetClass();
 		auto componentUuid = actorComponent->GetUuid();
 
@@ -190,6 +340,9 @@ namespace CE
 
 	void CE::Scene::OnActorChainAttached(Actor* actor)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		if (!actor)
 			return;
 		
@@ -271,6 +424,9 @@ namespace CE
 
 	void CE::Scene::OnActorChainDetached(Actor* actor)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		if (!actor)
 			return;
         
@@ -356,6 +512,9 @@ namespace CE
 
 	void CE::Scene::RegisterSceneComponent(SceneComponent* sceneComponent)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		if (!sceneComponent)
 			return;
 
@@ -375,6 +534,9 @@ namespace CE
 
 	void CE::Scene::DeregisterSceneComponent(SceneComponent* sceneComponent)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		if (!sceneComponent)
 			return;
 
@@ -394,6 +556,9 @@ namespace CE
 
 	void CE::Scene::OnSceneComponentAttached(SceneComponent* sceneComponent)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
 		sceneComponent->scene = this;
 
 		if (sceneComponent->IsOfType<DirectionalLightComponent>())
@@ -412,6 +577,20 @@ namespace CE
 
 	void CE::Scene::OnSceneComponentDetached(SceneComponent* sceneComponent)
 	{
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
+
+		// Keep the last known transform on the component once it leaves the hierarchy
+		if (transformHierarchy.IsValid(sceneComponent->transformHandle, sceneComponent))
+		{
+			transformHierarchy.Resolve(sceneComponent->transformHandle);
+			sceneComponent->transform = transformHierarchy.GetWorldTransform(sceneComponent->transformHandle);
+			sceneComponent->localTransform = transformHierarchy.GetLocalTransform(sceneComponent->transformHandle);
+
+			transformHierarchy.Free(sceneComponent->transformHandle);
+			sceneComponent->transformHandle = TransformHierarchy::InvalidHandle;
+		}
+
 		if (sceneComponent->IsOfType<DirectionalLightComponent>())
 		{
 			auto directionalLight = static_cast<DirectionalLightComponent*>(sceneComponent);
@@ -464,7 +643,8 @@ namespace CE
 
 	void CE::Scene::OnRootComponentSet(SceneComponent* rootComponent, Actor* ownerActor)
 	{
-		
+		tickScheduleDirty = true;
+		transformHierarchyDirty = true;
 	}
 
 } // namespace CE
@@ -103,6 +103,12 @@ namespace CE
 					variantDesc.tags = {};
 					variantDesc.tags.AddRange(subShader->tags);
 					variantDesc.tags.AddRange(shaderPass->tags);
+					variantDesc.variantId = variant.variantHash;
+
+					for (const String& defineFlag : variant.defineFlags)
+					{
+						variantDesc.defineFlags.Add(defineFlag);
+					}
 
 					for (ShaderBlob* curShaderBlob : variant.shaderStageBlobs)
 					{
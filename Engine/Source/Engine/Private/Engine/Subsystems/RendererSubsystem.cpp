@@ -63,6 +63,8 @@ namespace CE
 		{
 			RebuildFrameGraph();
 
+			SyncRenderThread();
+
 			scheduler->ResetFramesInFlight();
 		}
 
@@ -95,6 +97,7 @@ namespace CE
 
 		RHI::FrameSchedulerDescriptor desc{};
 		desc.numFramesInFlight = 2;
+		desc.drawListChunkSize = drawListChunkSize;
 
 		scheduler = RHI::FrameScheduler::Create(desc);
 
@@ -122,6 +125,8 @@ namespace CE
 
 		Super::PreShutdown();
 
+		StopRenderThread();
+
 		FusionApplication* app = FusionApplication::TryGet();
 
 		if (app)
@@ -147,10 +152,214 @@ namespace CE
 
 		Super::Tick(delta);
 
-		FusionApplication* fusion = FusionApplication::TryGet();
+		if (pipelinedRendering)
+		{
+			TickPipelined();
+			return;
+		}
+
+		int submittedImageIndex = -1;
+
+		if (!BeginFrame(submittedImageIndex))
+		{
+			return;
+		}
+
+		auto frameStartTime = std::chrono::steady_clock::now();
+
+		if (RenderFrame(submittedImageIndex))
+		{
+			UpdateFrameStats(gEngine->GetTickStartTime(), frameStartTime, frameStartTime, std::chrono::steady_clock::now());
+
+			EndFrame();
+		}
+	}
+
+	void RendererSubsystem::TickPipelined()
+	{
+		ZoneScoped;
+
+		// Frame N-1 is still being rendered while the scene was simulating frame N
+		WaitForRenderThread();
+
+		if (endFramePending)
+		{
+			endFramePending = false;
+			EndFrame();
+		}
+
+		if (!renderThread.IsJoinable())
+		{
+			StartRenderThread();
+		}
 
 		int submittedImageIndex = -1;
 
+		// Anything recorded this frame stays in the game thread snapshot and is rendered with the next frame
+		if (!BeginFrame(submittedImageIndex))
+		{
+			return;
+		}
+
+		// Fusion, the viewports and their scenes are owned by the game thread, so everything
+		// the frame needs from them is recorded here while the render thread is idle
+		if (!PrepareFrame())
+		{
+			return;
+		}
+
+		RenderSnapshot& snapshot = renderSnapshots[gameSnapshotIndex];
+		snapshot.frameNumber = frameNumber++;
+		snapshot.gameFrameStartTime = gEngine->GetTickStartTime();
+
+		renderSnapshotIndex = gameSnapshotIndex;
+		renderSubmittedImageIndex = submittedImageIndex;
+		gameSnapshotIndex = 1 - gameSnapshotIndex;
+
+		renderFrameInFlight = true;
+		renderFrameRequested.release();
+	}
+
+	RenderSnapshot* RendererSubsystem::GetGameThreadSnapshot()
+	{
+		if (!pipelinedRendering)
+			return nullptr;
+
+		return &renderSnapshots[gameSnapshotIndex];
+	}
+
+	void RendererSubsystem::SyncRenderThread()
+	{
+		if (!pipelinedRendering || Thread::GetCurrentThreadId() == renderThreadId)
+			return;
+
+		WaitForRenderThread();
+
+		// Keep the order of the writes recorded so far and the structural change that follows
+		RenderSnapshot& snapshot = renderSnapshots[gameSnapshotIndex];
+		snapshot.Apply();
+		snapshot.Clear();
+	}
+
+	void RendererSubsystem::WaitForRenderThread()
+	{
+		if (!renderFrameInFlight)
+			return;
+
+		{
+			ZoneScopedN("WaitForRenderThread");
+
+			renderFrameFinished.acquire();
+		}
+
+		renderFrameInFlight = false;
+		endFramePending = true;
+
+		const RenderSnapshot& snapshot = renderSnapshots[renderSnapshotIndex];
+		UpdateFrameStats(snapshot.gameFrameStartTime, renderStartTime, renderStartTime, renderEndTime);
+	}
+
+	void RendererSubsystem::StartRenderThread()
+	{
+		stopRenderThread = false;
+
+		renderThread = Thread([this]
+			{
+				RenderThreadMain();
+			});
+
+		renderThreadId = renderThread.GetId();
+	}
+
+	void RendererSubsystem::StopRenderThread()
+	{
+		if (!renderThread.IsJoinable())
+			return;
+
+		WaitForRenderThread();
+
+		stopRenderThread = true;
+		renderFrameRequested.release();
+
+		renderThread.Join();
+		renderThreadId = 0;
+
+		for (RenderSnapshot& snapshot : renderSnapshots)
+		{
+			snapshot.Clear();
+		}
+	}
+
+	void RendererSubsystem::RenderThreadMain()
+	{
+		while (true)
+		{
+			renderFrameRequested.acquire();
+
+			if (stopRenderThread)
+				break;
+
+			ZoneScopedN("RenderThreadFrame");
+
+			renderStartTime = std::chrono::steady_clock::now();
+
+			RenderSnapshot& snapshot = renderSnapshots[renderSnapshotIndex];
+			snapshot.Apply();
+
+			SubmitFrame(renderSubmittedImageIndex);
+
+			snapshot.Clear();
+
+			renderEndTime = std::chrono::steady_clock::now();
+
+			renderFrameFinished.release();
+		}
+	}
+
+	void RendererSubsystem::UpdateFrameStats(std::chrono::steady_clock::time_point gameFrameStart, std::chrono::steady_clock::time_point frameSubmitTime,
+		std::chrono::steady_clock::time_point renderStart, std::chrono::steady_clock::time_point renderEnd)
+	{
+		using Milliseconds = std::chrono::duration<f32, std::milli>;
+
+		constexpr f32 smoothing = 0.1f;
+
+		auto accumulate = [&](f32& value, f32 sample)
+			{
+				value = frameStats.frameCount == 0 ? sample : value + (sample - value) * smoothing;
+			};
+
+		if (lastFrameSubmitTime.time_since_epoch().count() != 0)
+		{
+			accumulate(frameStats.frameTime, Milliseconds(renderEnd - lastFrameSubmitTime).count());
+		}
+
+		accumulate(frameStats.gameThreadTime, Milliseconds(frameSubmitTime - gameFrameStart).count());
+		accumulate(frameStats.renderThreadTime, Milliseconds(renderEnd - renderStart).count());
+		accumulate(frameStats.inputLatency, Milliseconds(renderEnd - gameFrameStart).count());
+
+		frameStats.bindingStats = RHI::CommandList::ConsumeFrameBindingStats();
+
+		lastFrameSubmitTime = renderEnd;
+		frameStats.frameCount++;
+
+		// Report to the profiler (no-op unless Tracy is enabled)
+		TracyPlot("Frame Time (ms)", frameStats.frameTime);
+		TracyPlot("Game Thread (ms)", frameStats.gameThreadTime);
+		TracyPlot("Render Thread (ms)", frameStats.renderThreadTime);
+		TracyPlot("Input Latency (ms)", frameStats.inputLatency);
+		TracyPlot("Pipeline Binds", (i64)frameStats.bindingStats.pipelineBinds);
+		TracyPlot("Descriptor Set Binds", (i64)frameStats.bindingStats.descriptorSetBinds);
+		TracyPlot("Descriptor Set Binds Skipped", (i64)frameStats.bindingStats.descriptorSetBindsSkipped);
+	}
+
+	bool RendererSubsystem::BeginFrame(int& outSubmittedImageIndex)
+	{
+		ZoneScoped;
+
+		FusionApplication* fusion = FusionApplication::TryGet();
+
+		outSubmittedImageIndex = -1;
+
 		if (fusion)
 		{
 			fusion->Tick();
@@ -158,7 +367,7 @@ namespace CE
 
 		if (IsEngineRequestingExit())
 		{
-			return;
+			return false;
 		}
 
 		if (rebuildFrameGraph)
@@ -167,7 +376,7 @@ namespace CE
 			recompileFrameGraph = true;
 
 			BuildFrameGraph();
-			submittedImageIndex = curImageIndex;
+			outSubmittedImageIndex = curImageIndex;
 		}
 
 		if (recompileFrameGraph)
@@ -179,21 +388,41 @@ namespace CE
 
 		if (IsEngineRequestingExit())
 		{
-			return;
+			return false;
 		}
 
 		if (rebuildFrameGraph || recompileFrameGraph)
 		{
 			RebuildFrameGraph();
-			return;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool RendererSubsystem::RenderFrame(int submittedImageIndex)
+	{
+		if (!PrepareFrame())
+		{
+			return false;
 		}
 
+		SubmitFrame(submittedImageIndex);
+		return true;
+	}
+
+	bool RendererSubsystem::PrepareFrame()
+	{
+		ZoneScoped;
+
+		FusionApplication* fusion = FusionApplication::TryGet();
+
 		int imageIndex = scheduler->BeginExecution();
 
 		if (imageIndex >= RHI::Limits::MaxSwapChainImageCount || rebuildFrameGraph || recompileFrameGraph)
 		{
 			RebuildFrameGraph();
-			return;
+			return false;
 		}
 
     	for (FGameWindow* renderViewport : renderViewports)
@@ -208,7 +437,7 @@ namespace CE
     				previouslyVisibleViewports.Remove(renderViewport->GetUuid());
 
     				RebuildFrameGraph();
-    				return;
+    				return false;
     			}
     			continue;
     		}
@@ -219,36 +448,26 @@ namespace CE
     			previouslyVisibleViewports.Add(renderViewport->GetUuid());
 
     			RebuildFrameGraph();
-    			return;
+    			return false;
     		}
     	}
 
 		curImageIndex = imageIndex;
 
 		// ---------------------------------------------------------
-		// - Enqueue draw packets to views
-
-		if (submittedImageIndex != curImageIndex)
-		{
-			RPI::RPISystem::Get().SimulationTick(curImageIndex);
-			RPI::RPISystem::Get().RenderTick(curImageIndex);
-		}
-
-		// ---------------------------------------------------------
-		// - Submit draw lists to scopes for execution
+		// - Setup draw list mask
 
 		drawList.Shutdown();
 
 		RHI::DrawListMask drawListMask{};
-		HashSet<RHI::DrawListTag> drawListTags{};
-
-		// - Setup draw list mask
 
 		if (fusion)
 		{
 			fusion->UpdateDrawListMask(drawListMask);
 		}
 
+		renderViewportScenes.Clear();
+
 		for (FGameWindow* renderViewport : renderViewports)
 		{
 			//if (!renderViewport->IsEnabledInHierarchy())
@@ -256,7 +475,9 @@ namespace CE
 
 			renderViewport->GetDrawListContext().Shutdown();
 
+			// The render thread reads the scene captured here, the viewport can switch scenes while it renders
 			RPI::Scene* rpiScene = renderViewport->GetScene();
+			renderViewportScenes.Add(rpiScene);
 			if (!rpiScene)
 				continue;
 
@@ -312,7 +533,7 @@ namespace CE
 			}
 		}
 
-		// - Enqueue additional draw packets
+		drawListTags.Clear();
 
 		for (int i = 0; i < drawListMask.GetSize(); ++i)
 		{
@@ -322,6 +543,9 @@ namespace CE
 			}
 		}
 
+		// ---------------------------------------------------------
+		// - Record Fusion draw packets
+
 		drawList.Init(drawListMask);
 
 		if (fusion)
@@ -329,12 +553,39 @@ namespace CE
 			fusion->EnqueueDrawPackets(drawList, curImageIndex);
 		}
 
-		for (FGameWindow* renderViewport : renderViewports)
+		drawList.Finalize();
+
+		if (fusion) // FWidget Scopes & DrawLists
+		{
+			fusion->FlushDrawPackets(drawList, curImageIndex);
+		}
+
+		return true;
+	}
+
+	void RendererSubsystem::SubmitFrame(int submittedImageIndex)
+	{
+		ZoneScoped;
+
+		// ---------------------------------------------------------
+		// - Enqueue draw packets to views
+
+		if (submittedImageIndex != curImageIndex)
 		{
+			RPI::RPISystem::Get().SimulationTick(curImageIndex);
+			RPI::RPISystem::Get().RenderTick(curImageIndex);
+		}
+
+		// ---------------------------------------------------------
+		// - Submit draw lists to scopes for execution
+
+		for (int viewportIndex = 0; viewportIndex < renderViewports.GetSize(); ++viewportIndex)
+		{
+			FGameWindow* renderViewport = renderViewports[viewportIndex];
 			//if (!renderViewport->IsEnabledInHierarchy())
 			//	continue;
 
-			RPI::Scene* rpiScene = renderViewport->GetScene();
+			RPI::Scene* rpiScene = renderViewportScenes[viewportIndex];
 			if (!rpiScene)
 				continue;
 
@@ -402,21 +653,15 @@ namespace CE
 			sceneRenderer->GetDrawListContext().Finalize();
 		}
 
-		drawList.Finalize();
-
 		// - Give scope draw lists to the Scheduler
-    
-		if (fusion) // FWidget Scopes & DrawLists
-		{
-			fusion->FlushDrawPackets(drawList, curImageIndex);
-		}
 
-		for (FGameWindow* renderViewport : renderViewports)
+		for (int viewportIndex = 0; viewportIndex < renderViewports.GetSize(); ++viewportIndex)
 		{
+			FGameWindow* renderViewport = renderViewports[viewportIndex];
 			//if (!renderViewport->IsEnabledInHierarchy())
 			//	continue;
 
-			RPI::Scene* rpiScene = renderViewport->GetScene();
+			RPI::Scene* rpiScene = renderViewportScenes[viewportIndex];
 			if (!rpiScene)
 				continue;
 
@@ -479,7 +724,10 @@ namespace CE
 		}
 
 		scheduler->EndExecution();
+	}
 
+	void RendererSubsystem::EndFrame()
+	{
 		for (int i = sceneRenderers.GetSize() - 1; i >= 0; --i)
 		{
 			if (sceneRenderers[i]->IsOneShot())
@@ -733,6 +981,8 @@ namespace CE
 
 	void RendererSubsystem::AddViewport(FGameWindow* viewport)
 	{
+		SyncRenderThread();
+
 		if (renderViewports.Exists(viewport))
 		{
 			RebuildFrameGraph();
@@ -751,6 +1001,8 @@ namespace CE
 
 	void RendererSubsystem::RemoveViewport(FGameWindow* viewport)
 	{
+		SyncRenderThread();
+
 		if (renderViewports.Remove(viewport))
 		{
 			RebuildFrameGraph();
@@ -762,6 +1014,8 @@ namespace CE
 		if (!scene)
 			return;
 
+		SyncRenderThread();
+
 		for (FGameWindow* renderViewport : renderViewports)
 		{
 			if (renderViewport != nullptr && renderViewport->GetScene() == scene->GetRpiScene())
@@ -0,0 +1,267 @@
+#include "Engine.h"
+
+namespace CE
+{
+
+	void TickScheduler::Tick(TickGroup tickGroup, f32 delta, TransformHierarchy* transformHierarchy)
+	{
+		ZoneScoped;
+
+		TickGroupSchedule& schedule = schedules[(int)tickGroup];
+
+		auto tickComponent = [delta](ActorComponent* component)
+			{
+				if (component->CanTick() && component->IsEnabledInHierarchy())
+				{
+					component->Tick(delta);
+				}
+			};
+
+		for (ActorComponent* component : schedule.serialComponents)
+		{
+			tickComponent(component);
+		}
+
+		// Parallel ticks only read world transforms: resolving a node writes its ancestors, which other tasks may read
+		const bool hasParallelTasks = !schedule.tasks.IsEmpty();
+		if (hasParallelTasks && transformHierarchy != nullptr)
+		{
+			transformHierarchy->SetReadOnly(true);
+		}
+
+		for (int level = 0; level + 1 < schedule.levelOffsets.GetSize(); level++)
+		{
+			const u32 firstTask = schedule.levelOffsets[level];
+			const u32 taskCount = schedule.levelOffsets[level + 1] - firstTask;
+
+			ParallelFor(taskCount, [&](u32 index)
+				{
+					const TickTask& task = schedule.tasks[firstTask + index];
+
+					for (u32 i = 0; i < task.componentCount; i++)
+					{
+						tickComponent(schedule.taskComponents[task.firstComponent + i]);
+					}
+				});
+		}
+
+		if (hasParallelTasks && transformHierarchy != nullptr)
+		{
+			transformHierarchy->SetReadOnly(false);
+		}
+
+		for (ActorComponent* component : schedule.cyclicComponents)
+		{
+			tickComponent(component);
+		}
+
+		for (SceneComponent* component : schedule.gameThreadChildren)
+		{
+			// Same conditions as SceneComponent::Tick ticking its children: the parent must have ticked too
+			SceneComponent* parent = component->GetParentComponent();
+			if (parent != nullptr && parent->CanTick())
+			{
+				tickComponent(component);
+			}
+		}
+	}
+
+	void TickScheduler::Rebuild(const Array<Actor*>& rootActors, CE::Scene* scene)
+	{
+		ZoneScoped;
+
+		constexpr int numTickGroups = (int)TickGroup::COUNT;
+
+		// Components of each task are gathered separately, then flattened in level order
+		Array<Array<ActorComponent*>> taskComponents[numTickGroups];
+
+		Clear();
+
+		// - Gather scheduled components in hierarchy order, one task per root actor and tick group -
+
+		int rootActorTask[numTickGroups];
+
+		auto addComponent = [&](ActorComponent* component)
+			{
+				component->tickTaskIndex = -1;
+
+				if (component->IsTickedByOwner())
+					return;
+
+				const int group = (int)component->tickGroup;
+
+				if (!component->tickInParallel)
+				{
+					schedules[group].serialComponents.Add(component);
+					return;
+				}
+
+				if (rootActorTask[group] < 0)
+				{
+					rootActorTask[group] = taskComponents[group].GetSize();
+					taskComponents[group].EmplaceBack();
+				}
+
+				component->tickTaskIndex = rootActorTask[group];
+				taskComponents[group][rootActorTask[group]].Add(component);
+			};
+
+		std::function<void(SceneComponent*)> visitSceneComponent = [&](SceneComponent* sceneComponent)
+			{
+				addComponent(sceneComponent);
+
+				for (SceneComponent* component : sceneComponent->attachedComponents)
+				{
+					if (component == nullptr || component == sceneComponent)
+						continue;
+
+					if (sceneComponent->tickInParallel && component->IsTickedByOwner())
+					{
+						schedules[(int)sceneComponent->tickGroup].gameThreadChildren.Add(component);
+					}
+
+					visitSceneComponent(component);
+				}
+			};
+
+		std::function<void(Actor*)> visitActor = [&](Actor* actor)
+			{
+				if (actor->rootComponent != nullptr)
+					visitSceneComponent(actor->rootComponent);
+
+				for (ActorComponent* component : actor->attachedComponents)
+				{
+					if (component != nullptr)
+						addComponent(component);
+				}
+
+				for (Actor* child : actor->children)
+				{
+					if (child != nullptr && child != actor)
+						visitActor(child);
+				}
+			};
+
+		for (Actor* actor : rootActors)
+		{
+			if (actor == nullptr)
+				continue;
+
+			for (int group = 0; group < numTickGroups; group++)
+			{
+				rootActorTask[group] = -1;
+			}
+
+			visitActor(actor);
+		}
+
+		// - Sort the tasks of each tick group into dependency levels -
+
+		for (int group = 0; group < numTickGroups; group++)
+		{
+			TickGroupSchedule& schedule = schedules[group];
+			const u32 taskCount = taskComponents[group].GetSize();
+
+			if (taskCount == 0)
+				continue;
+
+			Array<u32> dependencyCount{};
+			dependencyCount.Resize(taskCount, 0);
+			Array<Array<u32>> dependents{};
+			dependents.Resize(taskCount);
+
+			for (u32 task = 0; task < taskCount; task++)
+			{
+				for (ActorComponent* component : taskComponents[group][task])
+				{
+					for (const WeakRef<ActorComponent>& prerequisiteRef : component->tickPrerequisites)
+					{
+						ActorComponent* prerequisite = prerequisiteRef.Get();
+
+						// Prerequisites in other scenes, tick groups or in the same task are already ordered
+						if (prerequisite == nullptr || prerequisite->scene != scene || (int)prerequisite->tickGroup != group ||
+							prerequisite->tickTaskIndex < 0 || prerequisite->tickTaskIndex == (int)task)
+							continue;
+
+						dependents[prerequisite->tickTaskIndex].Add(task);
+						dependencyCount[task]++;
+					}
+				}
+			}
+
+			Array<u32> currentLevel{};
+			Array<u32> nextLevel{};
+			Array<u32>* current = &currentLevel;
+			Array<u32>* next = &nextLevel;
+
+			for (u32 task = 0; task < taskCount; task++)
+			{
+				if (dependencyCount[task] == 0)
+					current->Add(task);
+			}
+
+			u32 scheduledCount = 0;
+
+			while (!current->IsEmpty())
+			{
+				schedule.levelOffsets.Add(schedule.tasks.GetSize());
+
+				for (u32 task : *current)
+				{
+					TickTask& tickTask = schedule.tasks.EmplaceBack();
+					tickTask.firstComponent = schedule.taskComponents.GetSize();
+					tickTask.componentCount = taskComponents[group][task].GetSize();
+
+					for (ActorComponent* component : taskComponents[group][task])
+					{
+						schedule.taskComponents.Add(component);
+					}
+
+					for (u32 dependent : dependents[task])
+					{
+						if (--dependencyCount[dependent] == 0)
+							next->Add(dependent);
+					}
+				}
+
+				scheduledCount += current->GetSize();
+
+				current->Clear();
+				std::swap(current, next);
+			}
+
+			schedule.levelOffsets.Add(schedule.tasks.GetSize());
+
+			if (scheduledCount < taskCount)
+			{
+				CE_LOG(Warn, All, "Scene {}: {} parallel tick tasks have cyclic tick prerequisites and will be ticked serially",
+					scene != nullptr ? scene->GetName() : Name(), taskCount - scheduledCount);
+
+				for (u32 task = 0; task < taskCount; task++)
+				{
+					if (dependencyCount[task] == 0)
+						continue;
+
+					for (ActorComponent* component : taskComponents[group][task])
+					{
+						schedule.cyclicComponents.Add(component);
+					}
+				}
+			}
+		}
+	}
+
+	void TickScheduler::Clear()
+	{
+		for (TickGroupSchedule& schedule : schedules)
+		{
+			schedule.serialComponents.Clear();
+			schedule.taskComponents.Clear();
+			schedule.tasks.Clear();
+			schedule.levelOffsets.Clear();
+			schedule.cyclicComponents.Clear();
+			schedule.gameThreadChildren.Clear();
+		}
+	}
+
+} // namespace CE
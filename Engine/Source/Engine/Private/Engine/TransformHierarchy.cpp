@@ -0,0 +1,463 @@
+#include "Engine.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	define CE_TRANSFORM_SSE 1
+#	include <xmmintrin.h>
+#endif
+
+namespace CE
+{
+	namespace
+	{
+		// out = lhs * rhs, for row-major matrices. out must not alias lhs or rhs.
+		inline void MultiplyTransforms(const Matrix4x4& lhs, const Matrix4x4& rhs, Matrix4x4& out)
+		{
+#if CE_TRANSFORM_SSE
+			const __m128 rhs0 = _mm_loadu_ps(rhs.rows[0].xyzw);
+			const __m128 rhs1 = _mm_loadu_ps(rhs.rows[1].xyzw);
+			const __m128 rhs2 = _mm_loadu_ps(rhs.rows[2].xyzw);
+			const __m128 rhs3 = _mm_loadu_ps(rhs.rows[3].xyzw);
+
+			for (int i = 0; i < 4; i++)
+			{
+				const f32* row = lhs.rows[i].xyzw;
+
+				__m128 result = _mm_mul_ps(_mm_set1_ps(row[0]), rhs0);
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(row[1]), rhs1));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(row[2]), rhs2));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(row[3]), rhs3));
+
+				_mm_storeu_ps(out.rows[i].xyzw, result);
+			}
+#else
+			out = Matrix4x4::Multiply(lhs, rhs);
+#endif
+		}
+
+		// Same as Translation * Rotation * Scale, without the two full matrix multiplications
+		inline void ComposeTransform(const Vec3& position, const Vec3& eulerDegrees, const Vec3& scale, Matrix4x4& out)
+		{
+			out = Quat::EulerDegrees(eulerDegrees).ToMatrix();
+
+			const f32 translation[3] = { position.x, position.y, position.z };
+
+			for (int row = 0; row < 3; row++)
+			{
+				out.rows[row][0] *= scale.x;
+				out.rows[row][1] *= scale.y;
+				out.rows[row][2] *= scale.z;
+				out.rows[row][3] = translation[row];
+			}
+		}
+	}
+
+	TransformHierarchy::TransformHierarchy()
+	{
+
+	}
+
+	TransformHierarchy::~TransformHierarchy()
+	{
+
+	}
+
+	u32 TransformHierarchy::Allocate(const void* owner)
+	{
+		u32 handle;
+
+		if (!freeHandles.IsEmpty())
+		{
+			handle = freeHandles.Top();
+			freeHandles.Pop();
+		}
+		else
+		{
+			handle = slotOfHandle.GetSize();
+			slotOfHandle.Add(InvalidSlot);
+			ownerOfHandle.Add(nullptr);
+			visited.Add(0);
+		}
+
+		const u32 slot = handleOfSlot.GetSize();
+
+		slotOfHandle[handle] = slot;
+		ownerOfHandle[handle] = owner;
+		visited[handle] = 1;
+
+		handleOfSlot.Add(handle);
+		parentSlot.Add(InvalidSlot);
+		localPositions.Add(Vec3());
+		localEulerAngles.Add(Vec3());
+		localScales.Add(Vec3(1, 1, 1));
+		localTransforms.Add(Matrix4x4::Identity());
+		worldTransforms.Add(Matrix4x4::Identity());
+		worldVersions.Add(0);
+		parentVersions.Add(0);
+		localDirty.Add(1);
+		updated.Add(0);
+
+		nodeCount++;
+
+		// New nodes are appended at the end, which breaks the depth order
+		depthOrderDirty = true;
+
+		return handle;
+	}
+
+	void TransformHierarchy::Free(u32 handle)
+	{
+		if (handle >= slotOfHandle.GetSize() || slotOfHandle[handle] == InvalidSlot)
+			return;
+
+		// The slot is compacted away by the next SortByDepth()
+		handleOfSlot[slotOfHandle[handle]] = InvalidHandle;
+
+		slotOfHandle[handle] = InvalidSlot;
+		ownerOfHandle[handle] = nullptr;
+		freeHandles.Add(handle);
+
+		nodeCount--;
+		depthOrderDirty = true;
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		slotOfHandle.Clear();
+		ownerOfHandle.Clear();
+		freeHandles.Clear();
+		visited.Clear();
+
+		handleOfSlot.Clear();
+		parentSlot.Clear();
+		localPositions.Clear();
+		localEulerAngles.Clear();
+		localScales.Clear();
+		localTransforms.Clear();
+		worldTransforms.Clear();
+		worldVersions.Clear();
+		parentVersions.Clear();
+		localDirty.Clear();
+		updated.Clear();
+		levelOffsets.Clear();
+
+		nodeCount = 0;
+		depthOrderDirty = false;
+	}
+
+	bool TransformHierarchy::IsValid(u32 handle, const void* owner) const
+	{
+		return handle < slotOfHandle.GetSize() && slotOfHandle[handle] != InvalidSlot && ownerOfHandle[handle] == owner;
+	}
+
+	void TransformHierarchy::SetParent(u32 handle, u32 parentHandle)
+	{
+		const u32 slot = slotOfHandle[handle];
+		const u32 newParentSlot = parentHandle != InvalidHandle ? slotOfHandle[parentHandle] : InvalidSlot;
+
+		if (parentSlot[slot] == newParentSlot)
+			return;
+
+		parentSlot[slot] = newParentSlot;
+		localDirty[slot] = 1;
+
+		depthOrderDirty = true;
+	}
+
+	u32 TransformHierarchy::GetParent(u32 handle) const
+	{
+		const u32 parent = parentSlot[slotOfHandle[handle]];
+		if (parent == InvalidSlot)
+			return InvalidHandle;
+
+		return handleOfSlot[parent];
+	}
+
+	void TransformHierarchy::SetLocalTransform(u32 handle, const Vec3& position, const Vec3& eulerDegrees, const Vec3& scale)
+	{
+		const u32 slot = slotOfHandle[handle];
+
+		localPositions[slot] = position;
+		localEulerAngles[slot] = eulerDegrees;
+		localScales[slot] = scale;
+		localDirty[slot] = 1;
+	}
+
+	void TransformHierarchy::BeginVisit()
+	{
+		if (!visited.IsEmpty())
+		{
+			memset(visited.GetData(), 0, visited.GetSize());
+		}
+	}
+
+	void TransformHierarchy::MarkVisited(u32 handle)
+	{
+		visited[handle] = 1;
+	}
+
+	void TransformHierarchy::FreeUnvisited()
+	{
+		for (u32 handle = 0; handle < slotOfHandle.GetSize(); handle++)
+		{
+			if (slotOfHandle[handle] != InvalidSlot && visited[handle] == 0)
+			{
+				Free(handle);
+			}
+		}
+	}
+
+	void TransformHierarchy::Update()
+	{
+		ZoneScoped;
+
+		if (depthOrderDirty)
+		{
+			SortByDepth();
+		}
+
+		if (nodeCount == 0)
+			return;
+
+		memset(updated.GetData(), 0, updated.GetSize());
+
+		const u32 nodesPerBatch = Math::Max<u32>(batchSize, 1);
+
+		// Parents live in earlier levels, so a level only depends on the levels before it
+		for (int level = 0; level + 1 < levelOffsets.GetSize(); level++)
+		{
+			const u32 levelBegin = levelOffsets[level];
+			const u32 levelEnd = levelOffsets[level + 1];
+			const u32 numBatches = (levelEnd - levelBegin + nodesPerBatch - 1) / nodesPerBatch;
+
+			ParallelFor(numBatches, [&](u32 batch)
+				{
+					const u32 begin = levelBegin + batch * nodesPerBatch;
+					const u32 end = Math::Min(begin + nodesPerBatch, levelEnd);
+
+					UpdateRange(begin, end);
+				});
+		}
+	}
+
+	bool TransformHierarchy::Resolve(u32 handle)
+	{
+		const u32 slot = slotOfHandle[handle];
+
+		if (!readOnly)
+		{
+			ResolveSlot(slot);
+		}
+
+		return updated[slot] != 0;
+	}
+
+	bool TransformHierarchy::IsUpdated(u32 handle) const
+	{
+		return updated[slotOfHandle[handle]] != 0;
+	}
+
+	const Matrix4x4& TransformHierarchy::GetWorldTransform(u32 handle) const
+	{
+		return worldTransforms[slotOfHandle[handle]];
+	}
+
+	const Matrix4x4& TransformHierarchy::GetLocalTransform(u32 handle) const
+	{
+		return localTransforms[slotOfHandle[handle]];
+	}
+
+	void TransformHierarchy::UpdateSlot(u32 slot)
+	{
+		const u32 parent = parentSlot[slot];
+
+		if (localDirty[slot] == 0 && (parent == InvalidSlot || parentVersions[slot] == worldVersions[parent]))
+			return;
+
+		if (localDirty[slot] != 0)
+		{
+			ComposeTransform(localPositions[slot], localEulerAngles[slot], localScales[slot], localTransforms[slot]);
+			localDirty[slot] = 0;
+		}
+
+		if (parent == InvalidSlot)
+		{
+			worldTransforms[slot] = localTransforms[slot];
+		}
+		else
+		{
+			MultiplyTransforms(worldTransforms[parent], localTransforms[slot], worldTransforms[slot]);
+			parentVersions[slot] = worldVersions[parent];
+		}
+
+		worldVersions[slot]++;
+		updated[slot] = 1;
+	}
+
+	void TransformHierarchy::UpdateRange(u32 begin, u32 end)
+	{
+		const u32* parents = parentSlot.GetData();
+		const u32* parentVersionData = parentVersions.GetData();
+		const u32* worldVersionData = worldVersions.GetData();
+		const u8* localDirtyData = localDirty.GetData();
+
+		for (u32 slot = begin; slot < end; slot++)
+		{
+			const u32 parent = parents[slot];
+
+			// Most nodes are clean: skip them without touching their matrices
+			if (localDirtyData[slot] == 0 && (parent == InvalidSlot || parentVersionData[slot] == worldVersionData[parent]))
+				continue;
+
+			UpdateSlot(slot);
+		}
+	}
+
+	void TransformHierarchy::ResolveSlot(u32 slot)
+	{
+		const u32 parent = parentSlot[slot];
+
+		if (parent != InvalidSlot)
+		{
+			ResolveSlot(parent);
+		}
+
+		UpdateSlot(slot);
+	}
+
+	void TransformHierarchy::SortByDepth()
+	{
+		ZoneScoped;
+
+		depthOrderDirty = false;
+
+		const u32 slotCount = handleOfSlot.GetSize();
+
+		// - Compute depths. Parents that were freed turn their children into roots -
+
+		Array<u32> depths{};
+		depths.Resize(slotCount, InvalidSlot);
+
+		Array<u32> chain{};
+		u32 maxDepth = 0;
+
+		for (u32 slot = 0; slot < slotCount; slot++)
+		{
+			if (handleOfSlot[slot] == InvalidHandle || depths[slot] != InvalidSlot)
+				continue;
+
+			chain.Clear();
+
+			u32 current = slot;
+			u32 depth = 0;
+
+			while (true)
+			{
+				const u32 parent = parentSlot[current];
+
+				if (parent != InvalidSlot && handleOfSlot[parent] == InvalidHandle)
+				{
+					parentSlot[current] = InvalidSlot;
+					localDirty[current] = 1;
+				}
+
+				if (parentSlot[current] == InvalidSlot)
+				{
+					depth = 0;
+					break;
+				}
+
+				chain.Add(current);
+				current = parentSlot[current];
+
+				if (depths[current] != InvalidSlot)
+				{
+					depth = depths[current];
+					break;
+				}
+			}
+
+			depths[current] = depth;
+
+			for (int i = chain.GetSize() - 1; i >= 0; i--)
+			{
+				depths[chain[i]] = ++depth;
+			}
+
+			maxDepth = Math::Max(maxDepth, depth);
+		}
+
+		// - Counting sort by depth, keeping the previous order within a level -
+
+		levelOffsets.Clear();
+
+		if (nodeCount == 0)
+		{
+			Clear();
+			return;
+		}
+
+		levelOffsets.Resize(maxDepth + 2, 0);
+
+		for (u32 slot = 0; slot < slotCount; slot++)
+		{
+			if (handleOfSlot[slot] != InvalidHandle)
+				levelOffsets[depths[slot] + 1]++;
+		}
+
+		for (u32 level = 1; level < levelOffsets.GetSize(); level++)
+		{
+			levelOffsets[level] += levelOffsets[level - 1];
+		}
+
+		Array<u32> newSlots{};
+		newSlots.Resize(slotCount, InvalidSlot);
+
+		{
+			Array<u32> nextSlot = levelOffsets;
+
+			for (u32 slot = 0; slot < slotCount; slot++)
+			{
+				if (handleOfSlot[slot] != InvalidHandle)
+					newSlots[slot] = nextSlot[depths[slot]]++;
+			}
+		}
+
+		auto reorder = [&]<typename T>(Array<T>& values)
+			{
+				Array<T> sorted{};
+				sorted.Resize(nodeCount);
+
+				for (u32 slot = 0; slot < slotCount; slot++)
+				{
+					if (newSlots[slot] != InvalidSlot)
+						sorted[newSlots[slot]] = values[slot];
+				}
+
+				values = sorted;
+			};
+
+		for (u32 slot = 0; slot < slotCount; slot++)
+		{
+			if (parentSlot[slot] != InvalidSlot)
+				parentSlot[slot] = newSlots[parentSlot[slot]];
+		}
+
+		reorder(handleOfSlot);
+		reorder(parentSlot);
+		reorder(localPositions);
+		reorder(localEulerAngles);
+		reorder(localScales);
+		reorder(localTransforms);
+		reorder(worldTransforms);
+		reorder(worldVersions);
+		reorder(parentVersions);
+		reorder(localDirty);
+		reorder(updated);
+
+		for (u32 slot = 0; slot < nodeCount; slot++)
+		{
+			slotOfHandle[handleOfSlot[slot]] = slot;
+		}
+	}
+
+} // namespace CE
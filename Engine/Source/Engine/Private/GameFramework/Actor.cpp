@@ -209,14 +209,14 @@ namespace CE
 		if (!IsSelfEnabled())
 			return;
 
-		if (rootComponent && rootComponent->CanTick() && rootComponent->IsEnabled())
+		if (rootComponent && rootComponent->IsTickedByOwner() && rootComponent->CanTick() && rootComponent->IsEnabled())
 		{
 			rootComponent->Tick(delta);
 		}
 
 		for (auto component : attachedComponents)
 		{
-			if (component->CanTick() && component->IsEnabled())
+			if (component->IsTickedByOwner() && component->CanTick() && component->IsEnabled())
 			{
 				component->Tick(delta);
 			}
@@ -18,6 +18,67 @@ namespace CE
 		
 	}
 
+	void ActorComponent::SetTickGroup(TickGroup tickGroup)
+	{
+		if (this->tickGroup == tickGroup)
+			return;
+
+		this->tickGroup = tickGroup;
+
+		if (Ref<CE::Scene> scene = GetScene())
+		{
+			scene->tickScheduleDirty = true;
+		}
+	}
+
+	void ActorComponent::SetTickInParallel(bool tickInParallel)
+	{
+		if (this->tickInParallel == tickInParallel)
+			return;
+
+		this->tickInParallel = tickInParallel;
+
+		if (Ref<CE::Scene> scene = GetScene())
+		{
+			scene->tickScheduleDirty = true;
+		}
+	}
+
+	void ActorComponent::AddTickPrerequisite(ActorComponent* prerequisite)
+	{
+		if (prerequisite == nullptr || prerequisite == this)
+			return;
+
+		for (const WeakRef<ActorComponent>& existing : tickPrerequisites)
+		{
+			if (existing == prerequisite)
+				return;
+		}
+
+		tickPrerequisites.Add(prerequisite);
+
+		if (Ref<CE::Scene> scene = GetScene())
+		{
+			scene->tickScheduleDirty = true;
+		}
+	}
+
+	void ActorComponent::RemoveTickPrerequisite(ActorComponent* prerequisite)
+	{
+		for (int i = tickPrerequisites.GetSize() - 1; i >= 0; i--)
+		{
+			if (tickPrerequisites[i] == prerequisite || tickPrerequisites[i] == nullptr)
+			{
+				tickPrerequisites.RemoveAt(i);
+			}
+		}
+
+		if (Ref<CE::Scene> scene = GetScene())
+		{
+			scene->tickScheduleDirty = true;
+		}
+	}
+
 	Ref<CE::Scene> ActorComponent::GetScene() const
 	{
 		return scene.Lock();
@@ -52,6 +113,8 @@ namespace CE
 		Super::OnFieldChanged(fieldName);
 
 		thread_local const Name isEnabledName = NAMEOF(isEnabled);
+		thread_local const Name tickGroupName = NAMEOF(tickGroup);
+		thread_local const Name tickInParallelName = NAMEOF(tickInParallel);
 
 		if (fieldName == isEnabledName)
 		{
@@ -60,6 +123,13 @@ namespace CE
 			else
 				OnDisabled();
 		}
+		else if (fieldName == tickGroupName || fieldName == tickInParallelName)
+		{
+			if (Ref<CE::Scene> scene = GetScene())
+			{
+				scene->tickScheduleDirty = true;
+			}
+		}
 	}
 
 	void ActorComponent::OnFieldEdited(const Name& fieldName)
@@ -67,6 +137,8 @@ namespace CE
 		Super::OnFieldEdited(fieldName);
 
 		thread_local const Name isEnabledName = NAMEOF(isEnabled);
+		thread_local const Name tickGroupName = NAMEOF(tickGroup);
+		thread_local const Name tickInParallelName = NAMEOF(tickInParallel);
 
 		if (fieldName == isEnabledName)
 		{
@@ -75,6 +147,13 @@ namespace CE
 			else
 				OnDisabled();
 		}
+		else if (fieldName == tickGroupName || fieldName == tickInParallelName)
+		{
+			if (Ref<CE::Scene> scene = GetScene())
+			{
+				scene->tickScheduleDirty = true;
+			}
+		}
 	}
 
 	void ActorComponent::OnEnabled()
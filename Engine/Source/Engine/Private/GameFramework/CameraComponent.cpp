@@ -74,22 +74,31 @@ namespace CE
 
             if (projection == CameraProjection::Perspective && windowSize.height > 0)
             {
-                viewConstants.projectionMatrix = Matrix4x4::PerspectiveProjection((f32)windowSize.width / windowSize.height, fieldOfView, nearPlane, farPlane);
+                projectionMatrix = Matrix4x4::PerspectiveProjection((f32)windowSize.width / windowSize.height, fieldOfView, nearPlane, farPlane);
             }
             else if (projection == CameraProjection::Orthogonal && windowSize.height > 0)
             {
-                viewConstants.projectionMatrix = Matrix4x4::OrthographicProjection((f32)windowSize.width / windowSize.height, nearPlane, farPlane);
+                projectionMatrix = Matrix4x4::OrthographicProjection((f32)windowSize.width / windowSize.height, nearPlane, farPlane);
             }
 
             Vec3 lookDir = GetForwardVector();
             Vec3 upDir = GetUpwardVector();
 
-            viewConstants.viewMatrix = Quat::LookRotation2(lookDir, upDir).ToMatrix() * Matrix4x4::Translation(-GetPosition());
-            viewConstants.viewPosition = GetPosition();
-            viewConstants.pixelResolution = windowSize.ToVec2();
-            viewConstants.viewProjectionMatrix = viewConstants.projectionMatrix * viewConstants.viewMatrix;
-			viewConstants.nearPlane = nearPlane;
-            viewConstants.farPlane = farPlane;
+            Matrix4x4 viewMatrix = Quat::LookRotation2(lookDir, upDir).ToMatrix() * Matrix4x4::Translation(-GetPosition());
+
+            RenderSnapshot* snapshot = nullptr;
+            if (Ref<CE::Scene> scene = GetScene())
+            {
+                snapshot = scene->GetRenderSnapshot();
+            }
+
+            RenderSnapshot::Store(snapshot, viewConstants.projectionMatrix, projectionMatrix);
+            RenderSnapshot::Store(snapshot, viewConstants.viewMatrix, viewMatrix);
+            RenderSnapshot::Store(snapshot, viewConstants.viewPosition, Vec4(GetPosition()));
+            RenderSnapshot::Store(snapshot, viewConstants.pixelResolution, windowSize.ToVec2());
+            RenderSnapshot::Store(snapshot, viewConstants.viewProjectionMatrix, projectionMatrix * viewMatrix);
+            RenderSnapshot::Store(snapshot, viewConstants.nearPlane, nearPlane);
+            RenderSnapshot::Store(snapshot, viewConstants.farPlane, farPlane);
         }
     }
 
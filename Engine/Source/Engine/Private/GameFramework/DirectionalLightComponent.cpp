@@ -29,6 +29,8 @@ namespace CE
             if (!fp)
                 return;
 
+            scene->SyncRenderThread();
+
             fp->ReleaseLight(lightHandle);
         }
     }
@@ -61,6 +63,8 @@ namespace CE
             if (!fp)
                 return;
 
+            scene->SyncRenderThread();
+
             fp->ReleaseLight(lightHandle);
             //lightHandle->flags.visible = false;
         }
@@ -92,32 +96,42 @@ namespace CE
 
         if (!lightHandle.IsValid())
         {
+            scene->SyncRenderThread();
+
             RPI::DirectionalLightHandleDescriptor desc{};
             lightHandle = fp->AcquireLight(desc);
         }
 
-        Vec3 forward = GetForwardVector();
-        Vec3 up = GetUpwardVector();
+        if (lightHandle->shadowView != rpiView || lightHandle->flags.shadows != enableShadows)
+        {
+            scene->SyncRenderThread();
 
-        lightHandle->shadowView = rpiView;
-        lightHandle->flags.shadows = enableShadows;
+            lightHandle->shadowView = rpiView;
+            lightHandle->flags.shadows = enableShadows;
+        }
 
-        lightHandle->colorAndIntensity = lightColor.ToVec4();
-        lightHandle->colorAndIntensity.w = intensity;
-        lightHandle->temperature = temperature;
-        lightHandle->shadowDistance = shadowDistance;
-        lightHandle->pixelResolution = Vec2i(1, 1) * rp->directionalShadowResolution;
+        Vec3 forward = GetForwardVector();
 
-        lightHandle->direction = forward;
-        Vec3 cameraForward = mainCamera->GetForwardVector();
+        Vec4 colorAndIntensity = lightColor.ToVec4();
+        colorAndIntensity.w = intensity;
 
         // TODO: Fix view position
-        lightHandle->viewPosition = mainCamera->GetPosition() - forward * 5.0f; // Position light 5 units above camera
-        lightHandle->projectionMatrix = Matrix4x4::OrthographicProjection(-shadowDistance, shadowDistance, shadowDistance, -shadowDistance, 0.01f, 100.0f);
-        lightHandle->viewMatrix = Matrix4x4::Translation(-lightHandle->viewPosition) *
-            Quat::LookRotation(lightHandle->direction).ToMatrix();
-        lightHandle->viewProjectionMatrix = lightHandle->projectionMatrix * lightHandle->viewMatrix;
-
+        Vec3 viewPosition = mainCamera->GetPosition() - forward * 5.0f; // Position light 5 units above camera
+        Matrix4x4 projectionMatrix = Matrix4x4::OrthographicProjection(-shadowDistance, shadowDistance, shadowDistance, -shadowDistance, 0.01f, 100.0f);
+        Matrix4x4 viewMatrix = Matrix4x4::Translation(-viewPosition) *
+            Quat::LookRotation(forward).ToMatrix();
+
+        RenderSnapshot* snapshot = scene->GetRenderSnapshot();
+
+        RenderSnapshot::Store(snapshot, lightHandle->colorAndIntensity, colorAndIntensity);
+        RenderSnapshot::Store(snapshot, lightHandle->temperature, temperature);
+        RenderSnapshot::Store(snapshot, lightHandle->shadowDistance, shadowDistance);
+        RenderSnapshot::Store(snapshot, lightHandle->pixelResolution, Vec2i(1, 1) * rp->directionalShadowResolution);
+        RenderSnapshot::Store(snapshot, lightHandle->direction, Vec4(forward));
+        RenderSnapshot::Store(snapshot, lightHandle->viewPosition, viewPosition);
+        RenderSnapshot::Store(snapshot, lightHandle->projectionMatrix, projectionMatrix);
+        RenderSnapshot::Store(snapshot, lightHandle->viewMatrix, viewMatrix);
+        RenderSnapshot::Store(snapshot, lightHandle->viewProjectionMatrix, projectionMatrix * viewMatrix);
     }
 
 } // namespace CE
@@ -20,23 +20,8 @@ namespace CE
 
 	void GeometryComponent::Tick(f32 delta)
 	{
+		// Simulated transforms are written back by CE::Scene right after the physics step
 		Super::Tick(delta);
-
-		if (Ref<CE::Scene> scene = GetScene())
-		{
-			if (Ref<PhysicsScene> physicsScene = scene->GetPhysicsScene())
-			{
-				if (simulatePhysics && physicsScene->IsSimulationEnabled() && physicsBody.IsValid())
-				{
-					Vec3 pos = physicsBody->GetPosition();
-					Quat rot = physicsBody->GetRotation();
-					Vec3 euler = rot.ToEulerDegrees();
-
-					SetPosition(pos);
-					SetRotation(rot);
-				}
-			}
-		}
 	}
 
 	void GeometryComponent::OnAttachedToScene(Ref<CE::Scene> scene)
@@ -26,6 +26,8 @@ namespace CE
             if (!fp)
                 return;
 
+            scene->SyncRenderThread();
+
             fp->ReleaseLight(lightHandle);
         }
     }
@@ -56,6 +58,8 @@ namespace CE
 
         if (!lightHandle.IsValid())
         {
+            scene->SyncRenderThread();
+
             RPI::LocalLightHandleDescriptor desc{};
             lightHandle = fp->AcquireLight(desc);
         }
@@ -63,15 +67,17 @@ namespace CE
         Vec3 lookDir = GetForwardVector();
         Vec3 upDir = GetUpwardVector();
 
-        lightHandle->viewPosition = GetPosition();
-        lightHandle->viewMatrix = Quat::LookRotation2(lookDir, upDir).ToMatrix() * Matrix4x4::Translation(-GetPosition());
+        RenderSnapshot* snapshot = scene->GetRenderSnapshot();
+
+        RenderSnapshot::Store(snapshot, lightHandle->viewPosition, GetPosition());
+        RenderSnapshot::Store(snapshot, lightHandle->viewMatrix, Quat::LookRotation2(lookDir, upDir).ToMatrix() * Matrix4x4::Translation(-GetPosition()));
 
-        lightHandle->lightType = LocalLightType::Point;
+        RenderSnapshot::Store(snapshot, lightHandle->lightType, LocalLightType::Point);
 
-        lightHandle->range = range;
-        lightHandle->temperature = temperature;
-        lightHandle->colorAndIntensity = Vec4(lightColor.r, lightColor.g, lightColor.b, intensity);
-        lightHandle->worldPos = GetPosition();
+        RenderSnapshot::Store(snapshot, lightHandle->range, range);
+        RenderSnapshot::Store(snapshot, lightHandle->temperature, temperature);
+        RenderSnapshot::Store(snapshot, lightHandle->colorAndIntensity, Vec4(lightColor.r, lightColor.g, lightColor.b, intensity));
+        RenderSnapshot::Store(snapshot, lightHandle->worldPos, GetPosition());
     }
 
     void PointLightComponent::OnFieldChanged(const Name& fieldName)
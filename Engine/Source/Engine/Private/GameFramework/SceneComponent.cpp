@@ -105,7 +105,7 @@ namespace CE
 		Quat parentGlobalRotation;
 		Vec3 scale;
 
-    	parentComponent->transform.Decompose(translation, parentGlobalRotation, scale);
+    	parentComponent->GetTransform().Decompose(translation, parentGlobalRotation, scale);
 
 		return parentGlobalRotation * Quat::EulerDegrees(localEulerAngles);
 	}
@@ -114,30 +114,32 @@ namespace CE
 	{
 		globalPosition = pos;
 
-		if (!parentComponent)
-		{
-			SetLocalPosition(pos);
-			return;
-		}
+		SetLocalPosition(WorldToLocalPosition(pos));
+	}
+
+	void SceneComponent::SetRotation(Quat worldRotation)
+	{
+		SetLocalEulerAngles(WorldToLocalEulerAngles(worldRotation));
+	}
 
-		Matrix4x4 parentTransformInverse = parentComponent->transform.GetInverse();
-		Vec3 newLocalPos = parentTransformInverse * Vec4(pos.x, pos.y, pos.z, 1.0f);
+	Vec3 SceneComponent::WorldToLocalPosition(const Vec3& worldPosition) const
+	{
+		if (!parentComponent)
+			return worldPosition;
 
-		SetLocalPosition(newLocalPos);
+		Matrix4x4 parentTransformInverse = parentComponent->GetTransform().GetInverse();
+		return parentTransformInverse * Vec4(worldPosition.x, worldPosition.y, worldPosition.z, 1.0f);
 	}
 
-	void SceneComponent::SetRotation(Quat worldRotation)
+	Vec3 SceneComponent::WorldToLocalEulerAngles(const Quat& worldRotation) const
 	{
 		if (!parentComponent)
-		{
-			SetLocalEulerAngles(worldRotation.ToEulerDegrees());
-			return;
-		}
+			return worldRotation.ToEulerDegrees();
 
-		Quat parentGlobalRot = parentComponent->transform.GetRotation();
+		Quat parentGlobalRot = parentComponent->GetTransform().GetRotation();
 		Quat localRot = parentGlobalRot.GetInversed() * worldRotation;
 
-		SetLocalEulerAngles(localRot.ToEulerDegrees());
+		return localRot.ToEulerDegrees();
 	}
 
 	void SceneComponent::OnSubobjectDetached(Object* subobject)
@@ -200,17 +202,48 @@ namespace CE
 		}
 	}
 
+	const Matrix4x4& SceneComponent::GetTransform() const
+	{
+		if (TransformHierarchy* transformHierarchy = GetTransformHierarchy())
+		{
+			return transformHierarchy->GetWorldTransform(transformHandle);
+		}
+
+		return transform;
+	}
+
+	const Matrix4x4& SceneComponent::GetLocalTransform() const
+	{
+		if (TransformHierarchy* transformHierarchy = GetTransformHierarchy())
+		{
+			return transformHierarchy->GetLocalTransform(transformHandle);
+		}
+
+		return localTransform;
+	}
+
+	TransformHierarchy* SceneComponent::GetTransformHierarchy() const
+	{
+		CE::Scene* scene = this->scene.Get();
+		if (scene == nullptr || !scene->transformHierarchy.IsValid(transformHandle, this))
+			return nullptr;
+
+		return &scene->transformHierarchy;
+	}
+
 	void SceneComponent::UpdateTransformInternal()
 	{
 		auto actor = GetActor();
 
+		Matrix4x4 localTranslationMat = Matrix4x4::Identity();
 		localTranslationMat[0][3] = localPosition.x;
 		localTranslationMat[1][3] = localPosition.y;
 		localTranslationMat[2][3] = localPosition.z;
 
 		localRotation = Quat::EulerDegrees(localEulerAngles);
-		localRotationMat = localRotation.ToMatrix();
+		Matrix4x4 localRotationMat = localRotation.ToMatrix();
 
+		Matrix4x4 localScaleMat = Matrix4x4::Identity();
 		localScaleMat[0][0] = localScale.x;
 		localScaleMat[1][1] = localScale.y;
 		localScaleMat[2][2] = localScale.z;
@@ -219,7 +252,7 @@ namespace CE
 		
 		if (parentComponent != nullptr)
 		{
-			transform = parentComponent->transform * localTransform;
+			transform = parentComponent->GetTransform() * localTransform;
 		}
 		else if (actor != nullptr && actor->parent != nullptr)
 		{
@@ -234,7 +267,7 @@ namespace CE
 			}
 
 			if (parent && parent->rootComponent != nullptr)
-				transform = parent->rootComponent->transform * localTransform;
+				transform = parent->rootComponent->GetTransform() * localTransform;
 			else
 				transform = localTransform;
 		}
@@ -255,16 +288,34 @@ namespace CE
 	{
 		Super::Tick(delta);
 		transformUpdated = false;
+
+		bool updateTransform;
+
+		if (TransformHierarchy* transformHierarchy = GetTransformHierarchy())
+		{
+			// Scene::Tick updates the whole hierarchy in batches. This only recomputes nodes that changed since then,
+			// and nothing at all during parallel ticks (see TransformHierarchy::SetReadOnly()).
+			updateTransform = transformHierarchy->Resolve(transformHandle);
+		}
+		else
+		{
+			updateTransform = IsDirty();
+
+			if (updateTransform)
+			{
+				UpdateTransformInternal();
+			}
+		}
         
-		if (IsDirty())
+		if (updateTransform)
 		{
-			UpdateTransformInternal();
+			const Matrix4x4& worldTransform = GetTransform();
 
-			globalPosition = transform * Vec4(0, 0, 0, 1);
+			globalPosition = worldTransform * Vec4(0, 0, 0, 1);
 
-			forwardVector = transform * Vec4(0, 0, 1, 0);
-			upwardVector = transform * Vec4(0, 1, 0, 0);
-			rightwardVector = transform * Vec4(1, 0, 0, 0);
+			forwardVector = worldTransform * Vec4(0, 0, 1, 0);
+			upwardVector = worldTransform * Vec4(0, 1, 0, 0);
+			rightwardVector = worldTransform * Vec4(1, 0, 0, 0);
 
 			Quat::LookRotation2(forwardVector, upwardVector);
 
@@ -272,9 +323,13 @@ namespace CE
 			transformUpdated = true;
 		}
 
+		// Children of a parallel component are ticked by the scene's TickScheduler on the game thread instead
+		if (tickInParallel)
+			return;
+
 		for (auto component : attachedComponents)
 		{
-			if (component->IsEnabled() && component->CanTick())
+			if (component->IsTickedByOwner() && component->IsEnabled() && component->CanTick())
 			{
 				component->Tick(delta);
 			}
@@ -309,6 +364,13 @@ namespace CE
 	{
 		isDirty = true;
 
+		// The transform hierarchy propagates changes to children by itself
+		if (TransformHierarchy* transformHierarchy = GetTransformHierarchy())
+		{
+			transformHierarchy->SetLocalTransform(transformHandle, localPosition, localEulerAngles, localScale);
+			return;
+		}
+
 		for (SceneComponent* attachedComponent : attachedComponents)
 		{
 			attachedComponent->SetDirty();
@@ -19,6 +19,8 @@ namespace CE
                 RPI::Scene* rpiScene = scene->GetRpiScene();
                 RPI::StaticMeshFeatureProcessor* fp = rpiScene->GetFeatureProcessor<RPI::StaticMeshFeatureProcessor>();
 
+                scene->SyncRenderThread();
+
                 fp->ReleaseMesh(meshHandle);
             }
 	    }
@@ -82,6 +84,11 @@ namespace CE
 
         if (meshHandle.IsValid())
         {
+            if (Ref<CE::Scene> scene = GetScene())
+            {
+                scene->SyncRenderThread();
+            }
+
             meshHandle->flags.visible = true;
         }
     }
@@ -92,6 +99,11 @@ namespace CE
 
         if (meshHandle.IsValid())
         {
+            if (Ref<CE::Scene> scene = GetScene())
+            {
+                scene->SyncRenderThread();
+            }
+
             meshHandle->flags.visible = false;
         }
     }
@@ -111,6 +123,8 @@ namespace CE
 
         if (staticMesh == nullptr && meshHandle.IsValid())
         {
+            scene->SyncRenderThread();
+
             fp->ReleaseMesh(meshHandle);
         }
 
@@ -125,12 +139,16 @@ namespace CE
         {
             SetMaterialDirty(false);
 
+            scene->SyncRenderThread();
+
             meshHandle->materialMap = GetRpiMaterialMap();
             meshHandle->materialMap[DefaultCustomMaterialId] = gEngine->GetErrorMaterial()->GetRpiMaterial();
         }
 
         if (meshChanged)
         {
+            scene->SyncRenderThread();
+
             if (meshHandle.IsValid())
             {
                 fp->ReleaseMesh(meshHandle);
@@ -149,7 +167,7 @@ namespace CE
 
         if (meshHandle.IsValid())
         {
-            meshHandle->localToWorldTransform = GetTransform();
+            RenderSnapshot::Store(scene->GetRenderSnapshot(), meshHandle->localToWorldTransform, GetTransform());
         }
 
         meshChanged = false;
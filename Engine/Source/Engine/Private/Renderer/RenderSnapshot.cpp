@@ -0,0 +1,63 @@
+#include "Engine.h"
+
+namespace CE
+{
+
+	RenderSnapshot::RenderSnapshot()
+	{
+
+	}
+
+	RenderSnapshot::~RenderSnapshot()
+	{
+
+	}
+
+	void RenderSnapshot::Enqueue(const Delegate<void(void)>& command)
+	{
+		LockGuard guard{ mutex };
+
+		commands.Add(command);
+	}
+
+	void RenderSnapshot::Apply()
+	{
+		ZoneScoped;
+
+		const u8* values = data.GetData();
+
+		for (const WriteEntry& write : writes)
+		{
+			memcpy(write.target, values + write.offset, write.size);
+		}
+
+		for (Delegate<void(void)>& command : commands)
+		{
+			command.InvokeIfValid();
+		}
+	}
+
+	void RenderSnapshot::Clear()
+	{
+		writes.Clear();
+		data.Clear();
+		commands.Clear();
+	}
+
+	void RenderSnapshot::WriteBytes(void* target, const void* value, u32 size)
+	{
+		if (target == nullptr || size == 0)
+			return;
+
+		LockGuard guard{ mutex };
+
+		WriteEntry& entry = writes.EmplaceBack();
+		entry.target = target;
+		entry.offset = (u32)data.GetSize();
+		entry.size = size;
+
+		data.Resize(entry.offset + size);
+		memcpy(data.GetData() + entry.offset, value, size);
+	}
+
+} // namespace CE
@@ -30,6 +30,9 @@ namespace CE
 
 		// Path to the source asset. For Editor only!
 		Name sourceAssetPath{};
+
+		// Uuids of the bundles that this bundle references.
+		Array<Uuid> bundleDependencies{};
 	};
 
 	template<>
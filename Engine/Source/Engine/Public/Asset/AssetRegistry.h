@@ -79,6 +79,9 @@ namespace CE
 
 		const Array<AssetData*>& GetAllAssetsOfType(TypeId typeId);
 
+		//! @brief Text search over asset names, paths and type names. See AssetSearchIndex::Query().
+		Array<AssetSearchIndex::Result> SearchAssets(const String& query, u32 maxResults, const String& excludedPathPrefix = "");
+
 		Array<String> GetSubDirectoriesAtPath(const Name& path);
 		PathTreeNode* GetDirectoryNode(const Name& path);
 		
@@ -89,9 +92,15 @@ namespace CE
 
 	protected:
 
-		/// Caches path tree structure
+		/// Caches path tree structure. Bundle headers are read from the registry snapshot when the bundle file
+		/// hasn't changed since the snapshot was saved.
 		void InitializeCache();
 
+		/// Saves the registry snapshot if it changed since it was loaded.
+		void SaveSnapshot();
+
+		static IO::Path GetSnapshotPath();
+
 		// Inherited via IFileWatchListener
 		virtual void HandleFileAction(IO::WatchID watchId, IO::Path directory, const String& fileName, IO::FileAction fileAction, const String& oldFileName) override;
 
@@ -119,6 +128,8 @@ namespace CE
 		void AddAssetEntry(const Name& bundleName, AssetData* assetData);
 		void DeleteAssetEntry(const Name& bundlePath);
 
+		static AssetRegistrySnapshot::Entry MakeSnapshotEntry(const Ref<Bundle>& bundle, bool includeSourceAssetPath);
+
 		PathTree cachedDirectoryTree{};
 		PathTree cachedPathTree{};
 
@@ -142,6 +153,8 @@ namespace CE
 
 		Array<IAssetRegistryListener*> listeners;
 
+		AssetRegistrySnapshot snapshot{};
+
 		// Asset Registry State
 
 		Array<AssetData*> allAssetDatas{};
@@ -156,6 +169,8 @@ namespace CE
 
 		HashMap<TypeId, Array<AssetData*>> cachedAssetsByType{};
 
+		AssetSearchIndex searchIndex{};
+
 		// List of primary assets in the sub-path of a path
 		HashMap<Name, Array<AssetData*>> cachedPrimaryAssetsByParentPath{};
 		
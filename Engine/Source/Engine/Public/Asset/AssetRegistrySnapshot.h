@@ -0,0 +1,69 @@
+#pragma once
+
+namespace CE
+{
+
+	/// @brief On-disk snapshot of the asset registry, so startup doesn't have to open every bundle to read its header.
+	/// Entries are keyed by the absolute path of the bundle file, and are only trusted while the file's size and last
+	/// write time still match. All functions are thread-safe.
+	class ENGINE_API AssetRegistrySnapshot final
+	{
+	public:
+
+		static constexpr u32 Version = 1;
+
+		struct Entry
+		{
+			Name bundlePath{};
+			Name bundleName{};
+			Uuid bundleUuid{};
+			Name assetName{};
+			Uuid assetUuid{};
+			Name assetClassTypeName{};
+			Name sourceAssetPath{};
+			Array<Uuid> dependencies{};
+
+			u64 lastWriteTime = 0;
+			u64 fileSize = 0;
+		};
+
+		AssetRegistrySnapshot() = default;
+
+		AssetRegistrySnapshot(const AssetRegistrySnapshot&) = delete;
+		AssetRegistrySnapshot& operator=(const AssetRegistrySnapshot&) = delete;
+
+		//! @brief Replaces the current entries with the ones stored at snapshotPath.
+		//! @return False if the file is missing, corrupted or was written by a different version.
+		bool LoadFromDisk(const IO::Path& snapshotPath);
+
+		//! @brief Writes all entries to snapshotPath and clears the dirty flag.
+		bool SaveToDisk(const IO::Path& snapshotPath);
+
+		//! @brief Returns a copy of the entry if it exists and matches the given file size & last write time.
+		bool FindValidEntry(const String& absoluteBundlePath, u64 lastWriteTime, u64 fileSize, Entry& outEntry);
+
+		void SetEntry(const String& absoluteBundlePath, const Entry& entry);
+
+		void RemoveEntry(const String& absoluteBundlePath);
+
+		//! @brief Removes every entry whose path is not in absoluteBundlePaths.
+		void RemoveEntriesNotIn(const HashSet<String>& absoluteBundlePaths);
+
+		void Clear();
+
+		u32 GetEntryCount();
+
+		//! @brief True if the entries changed since they were last loaded or saved.
+		bool IsDirty() const { return isDirty; }
+
+		//! @brief Returns the path in the form used as the entry key.
+		static String GetEntryKey(const IO::Path& absoluteBundlePath);
+
+	private:
+
+		Mutex mutex{};
+		HashMap<String, Entry> entriesByPath{};
+		Atomic<bool> isDirty = false;
+	};
+
+} // namespace CE
@@ -0,0 +1,99 @@
+#pragma once
+
+namespace CE
+{
+	struct AssetData;
+
+	/// @brief Trigram index over asset names, paths and type names, for ranked text search.
+	/// Every 3 character sequence of a field maps to the sorted list of assets whose field contains it, so a query only
+	/// intersects the lists of its own trigrams instead of scanning every asset. Queries shorter than 3 characters match
+	/// the start of words in asset names. Matching is case insensitive. Not thread-safe: the AssetRegistry owns it and
+	/// guards it with its cache mutex.
+	class ENGINE_API AssetSearchIndex final
+	{
+	public:
+
+		static constexpr u32 MaxQueryWords = 10;
+
+		struct Result
+		{
+			AssetData* assetData = nullptr;
+			u32 score = 0;
+		};
+
+		AssetSearchIndex() = default;
+
+		AssetSearchIndex(const AssetSearchIndex&) = delete;
+		AssetSearchIndex& operator=(const AssetSearchIndex&) = delete;
+
+		//! @brief Indexes the asset, or re-indexes it if it is already in the index. Call it again whenever the
+		//! bundle name, bundle path or class of the asset data changes.
+		void AddAsset(AssetData* assetData);
+
+		void RemoveAsset(AssetData* assetData);
+
+		//! @brief Returns the best maxResults assets that match every whitespace separated word of the query, best first.
+		//! A word scores highest when it is the asset name, then a prefix of it, the start of a word in it, part of it,
+		//! part of the type name and last part of the path. Ties go to the shorter name. Only the first MaxQueryWords
+		//! words are used.
+		//! @param excludedPathPrefix Assets whose bundle path starts with it are skipped before the results are cut to maxResults.
+		Array<Result> Query(const String& query, u32 maxResults, const String& excludedPathPrefix = "") const;
+
+		void Clear();
+
+		u32 GetAssetCount() const { return documentByAsset.GetSize(); }
+
+	private:
+
+		struct Document
+		{
+			AssetData* assetData = nullptr;
+
+			String name{};
+			String path{};
+			String typeName{};
+
+			//! @brief Offsets of the words in the name: its start, after a separator & camel case humps.
+			Array<u16> nameWordStarts{};
+
+			//! @brief Every key this document is listed under, to remove it without searching all postings.
+			Array<u32> keys{};
+		};
+
+		struct Token
+		{
+			String text{};
+
+			//! @brief Posting lists of the keys every matching field contains, shortest first.
+			Array<const Array<u32>*> lists{};
+
+			//! @brief Assets whose name starts with, or has a word that starts with the first 3 characters of the token.
+			//! Null if there are none.
+			const Array<u32>* prefixList = nullptr;
+			const Array<u32>* wordStartList = nullptr;
+
+			//! @brief True if being in all lists already proves the token is in the fields they report,
+			//! i.e. the token is a single trigram or shorter.
+			bool keysAreExact = false;
+		};
+
+		static void CollectKeys(const Document& document, Array<u64>& outFieldKeys);
+
+		//! @brief Finds the token in the given fields of the document by comparing the text.
+		static u32 ScoreToken(const Document& document, const Token& token, u32 fields);
+
+		const Array<u32>* FindPostings(u32 key) const;
+
+		Array<Document> documents{};
+		Array<u32> freeDocuments{};
+
+		//! @brief Name length of each document, packed apart from the documents to rank candidates without touching them.
+		Array<u16> nameLengths{};
+
+		HashMap<AssetData*, u32> documentByAsset{};
+
+		//! @brief Key -> sorted (document index << FieldBits | fields containing the key) entries.
+		HashMap<u32, Array<u32>> postings{};
+	};
+
+} // namespace CE
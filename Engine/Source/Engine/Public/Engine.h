@@ -11,6 +11,8 @@
 
 // Asset Meta
 #include "Asset/AssetData.h"
+#include "Asset/AssetRegistrySnapshot.h"
+#include "Asset/AssetSearchIndex.h"
 #include "Asset/AssetRegistry.h"
 #include "Engine/AssetManager.h"
 
@@ -42,6 +44,8 @@ namespace CE::Editor
 // Engine
 #include "Engine/Subsystem.h"
 #include "Engine/EngineSubsystem.h"
+#include "Renderer/RenderSnapshot.h"
+#include "Engine/TransformHierarchy.h"
 #include "Engine/Subsystems/SceneRenderer.h"
 #include "Engine/Subsystems/SceneSubsystem.h"
 #include "Engine/Subsystems/PhysicsSubsystem.h"
@@ -82,6 +86,7 @@ namespace CE::Editor
 #include "GameFramework/PointLight.h"
 
 // Scene
+#include "Engine/TickScheduler.h"
 #include "Engine/Scene.h"
 
 namespace CE
@@ -28,6 +28,9 @@ namespace CE
 
 		void DispatchOnMainThread(const Delegate<void(void)>& action);
 
+		//! @brief Time at which the current (or last) Tick() started.
+		std::chrono::steady_clock::time_point GetTickStartTime() const { return tickStartTime; }
+
 		virtual GameInstance* GetGameInstance();
 
 		bool IsInitialized() const { return isInitialized; }
@@ -94,6 +97,8 @@ namespace CE
 
 		b8 isInitialized = false;
 
+		std::chrono::steady_clock::time_point tickStartTime{};
+
 		static Array<ClassType*> subsystemClassQueue;
 
 		friend class EngineModule;
@@ -7,6 +7,7 @@ namespace CE
     class CameraComponent;
     class StaticMeshComponent;
 	class SceneComponent;
+	class GeometryComponent;
 	class RenderPipeline;
 	class SceneSubsystem;
 	
@@ -32,6 +33,13 @@ namespace CE
 
 		RPI::Scene* GetRpiScene() const { return rpiScene; }
 
+		//! @brief Returns the snapshot that render state has to be recorded into this frame, or nullptr if the RPI scene
+		//! can be written directly. See RendererSubsystem::GetGameThreadSnapshot().
+		RenderSnapshot* GetRenderSnapshot() const;
+
+		//! @brief Call before making structural changes to the RPI scene. See RendererSubsystem::SyncRenderThread().
+		void SyncRenderThread();
+
 		void AddActor(Actor* actor);
 		void RemoveActor(Actor* actor);
 
@@ -46,6 +54,8 @@ namespace CE
 		void SetEnabled(bool set) { isEnabled = set; }
 
 		Ref<PhysicsScene> GetPhysicsScene() { return physicsScene; }
+
+		TransformHierarchy& GetTransformHierarchy() { return transformHierarchy; }
 		
 		void IterateAllComponents(SubClass<ActorComponent> componentClass, auto callback)
 		{
@@ -117,6 +127,15 @@ namespace CE
 
 		void OnRootComponentSet(SceneComponent* rootComponent, Actor* ownerActor);
 
+		// - Transforms -
+
+		//! @brief Copies the simulated poses of physics bodies back to their components, right after the physics step.
+		void ApplyPhysicsTransforms();
+
+		//! @brief Assigns transform hierarchy nodes to new scene components, updates parent links
+		//! and frees the nodes of components that left the scene.
+		void RebuildTransformHierarchy();
+
 	protected:
 
 		FIELD()
@@ -149,6 +168,29 @@ namespace CE
 		FIELD()
 		Ref<PhysicsScene> physicsScene;
 
+		// - Transforms -
+
+		TransformHierarchy transformHierarchy{};
+
+		struct PhysicsTransform
+		{
+			GeometryComponent* component = nullptr;
+			Vec3 worldPosition{};
+			Vec3 localPosition{};
+			Vec3 localEulerAngles{};
+		};
+
+		//! @brief Scratch buffer of ApplyPhysicsTransforms(), kept to avoid allocating every frame.
+		Array<PhysicsTransform> physicsTransforms{};
+
+		bool transformHierarchyDirty = true;
+
+		// - Tick Scheduling -
+
+		TickScheduler tickScheduler{};
+
+		bool tickScheduleDirty = true;
+
 		// - Cache -
 
 		HashMap<Uuid, Actor*> actorsByUuid{};
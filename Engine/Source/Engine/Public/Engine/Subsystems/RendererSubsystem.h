@@ -5,6 +5,27 @@ namespace CE
 	class SceneSubsystem;
 	class ActorComponent;
 
+	//! @brief Frame timings in milliseconds, smoothed over the last few frames.
+	struct RenderFrameStats
+	{
+		//! Time between two consecutive frames.
+		f32 frameTime = 0;
+
+		//! Time from the start of the game frame until its render state was handed to the renderer.
+		f32 gameThreadTime = 0;
+
+		//! Time spent recording and submitting a frame.
+		f32 renderThreadTime = 0;
+
+		//! Time from the start of the game frame (input poll) until the frame that shows it was submitted for presentation.
+		f32 inputLatency = 0;
+
+		u64 frameCount = 0;
+
+		//! Pipeline, vertex/index buffer and descriptor set bindings issued and skipped by the command lists of the last frame.
+		RHI::CommandListBindingStats bindingStats{};
+	};
+
 	CLASS()
 	class ENGINE_API RendererSubsystem : public EngineSubsystem, ApplicationMessageHandler
 	{
@@ -39,6 +60,21 @@ namespace CE
 
 		const Array<FGameWindow*>& GetAllViewports() const { return renderViewports; }
 
+		//! @brief Returns true if a dedicated render thread renders frame N while the game thread simulates frame N+1.
+		bool IsPipelined() const { return pipelinedRendering; }
+
+		/// @brief Returns the snapshot the game thread records render state into during this frame, or nullptr when
+		/// rendering is not pipelined, in which case RPI handles can be written directly.
+		RenderSnapshot* GetGameThreadSnapshot();
+
+		/// @brief Waits until the render thread has finished its frame and applies the pending snapshot. Must be called
+		/// before the game thread makes structural changes to RPI state (acquiring or releasing handles, adding or removing
+		/// scenes and pipelines, immediate RHI uploads). The render thread then stays idle until the renderer ticks again.
+		/// Does nothing when rendering is not pipelined.
+		void SyncRenderThread();
+
+		const RenderFrameStats& GetFrameStats() const { return frameStats; }
+
 	protected:
 
 		void OnSceneDestroyed(CE::Scene* scene);
@@ -62,6 +98,33 @@ namespace CE
 
 		void Tick(f32 delta) override;
 
+		void TickPipelined();
+
+		//! @brief Game thread part of a frame: ticks Fusion and rebuilds the frame graph if needed.
+		//! Returns false if nothing should be rendered this frame.
+		bool BeginFrame(int& outSubmittedImageIndex);
+
+		//! @brief Records and submits a frame on the calling thread.
+		bool RenderFrame(int submittedImageIndex);
+
+		//! @brief Game thread part of recording a frame: acquires the next image, checks viewport visibility
+		//! and records Fusion's draw packets. Returns false if the frame graph has to be rebuilt first.
+		bool PrepareFrame();
+
+		//! @brief Collects the scene draw items and submits the frame. Runs on the render thread when rendering is pipelined.
+		void SubmitFrame(int submittedImageIndex);
+
+		//! @brief Game thread work after a frame has been submitted.
+		void EndFrame();
+
+		void StartRenderThread();
+		void StopRenderThread();
+		void RenderThreadMain();
+		void WaitForRenderThread();
+
+		void UpdateFrameStats(std::chrono::steady_clock::time_point gameFrameStart, std::chrono::steady_clock::time_point frameSubmitTime,
+			std::chrono::steady_clock::time_point renderStart, std::chrono::steady_clock::time_point renderEnd);
+
 		void BuildFrameGraph();
 		void CompileFrameGraph();
 
@@ -84,17 +147,57 @@ namespace CE
 
 		Array<FGameWindow*> renderViewports;
 
+		//! @brief Scene of each render viewport, captured by PrepareFrame() for SubmitFrame().
+		Array<RPI::Scene*> renderViewportScenes;
+
 		HashSet<Uuid> previouslyVisibleViewports;
 
 		// - Frame Graph -
 
 		RHI::FrameScheduler* scheduler = nullptr;
 
+		//! @brief Number of draw items recorded per job when a scope's draw list is recorded in parallel. 0 disables it.
+		FIELD(Config)
+		u32 drawListChunkSize = 0;
+
 		RHI::DrawListContext drawList{};
+		HashSet<RHI::DrawListTag> drawListTags{};
 
 		bool temporaryScenesPresent = false;
-		bool rebuildFrameGraph = true;
-		bool recompileFrameGraph = true;
+		Atomic<bool> rebuildFrameGraph = true;
+		Atomic<bool> recompileFrameGraph = true;
+
+		// - Pipelined Rendering -
+
+		//! @brief Render frame N on a dedicated render thread while the game thread simulates frame N+1.
+		//! Adds one frame of latency in exchange for overlapping simulation with render submission.
+		FIELD(Config)
+		bool pipelinedRendering = false;
+
+		Thread renderThread{};
+		ThreadId renderThreadId = 0;
+		Atomic<bool> stopRenderThread = false;
+		std::binary_semaphore renderFrameRequested{ 0 };
+		std::binary_semaphore renderFrameFinished{ 0 };
+
+		// Owned by the game thread
+		bool renderFrameInFlight = false;
+		bool endFramePending = false;
+		u32 gameSnapshotIndex = 0;
+		u64 frameNumber = 0;
+		std::chrono::steady_clock::time_point lastFrameSubmitTime{};
+
+		// Written by the game thread before a frame is requested, read by the render thread
+		u32 renderSnapshotIndex = 0;
+		int renderSubmittedImageIndex = -1;
+
+		// Written by the render thread before a frame is finished, read by the game thread
+		std::chrono::steady_clock::time_point renderStartTime{};
+		std::chrono::steady_clock::time_point renderEndTime{};
+
+		RenderSnapshot renderSnapshots[2];
+
+		RenderFrameStats frameStats{};
 
 		friend class SceneSubsystem;
 	};
@@ -0,0 +1,81 @@
+#pragma once
+
+namespace CE
+{
+	class Actor;
+	class ActorComponent;
+	class SceneComponent;
+	class Scene;
+	class TransformHierarchy;
+
+	/// @brief Orders the component ticks of a scene by tick group. Within a tick group, components that opted out of
+	/// parallel ticking are ticked first on the calling thread. Parallel components are grouped into one task per root
+	/// actor and tasks are ticked level by level in dependency order, so a task only starts after the tasks holding
+	/// its prerequisites. Components ticked by their owner are not scheduled, except under a parallel parent.
+	class ENGINE_API TickScheduler final
+	{
+	public:
+
+		TickScheduler() = default;
+
+		TickScheduler(const TickScheduler&) = delete;
+		TickScheduler& operator=(const TickScheduler&) = delete;
+
+		//! @brief Rebuilds the schedule of every tick group from the given root actors and their subtrees.
+		//! @param scene Scene that owns the actors. Prerequisites in other scenes are ignored.
+		void Rebuild(const Array<Actor*>& rootActors, CE::Scene* scene);
+
+		//! @brief Ticks the components scheduled in the given tick group. Must be called from the game thread.
+		//! @param transformHierarchy Hierarchy of the scene, made read only while parallel tasks run. Can be null.
+		void Tick(TickGroup tickGroup, f32 delta, TransformHierarchy* transformHierarchy = nullptr);
+
+		void Clear();
+
+		// - Inspection -
+
+		const Array<ActorComponent*>& GetSerialComponents(TickGroup tickGroup) const { return schedules[(int)tickGroup].serialComponents; }
+
+		u32 GetParallelTaskCount(TickGroup tickGroup) const { return schedules[(int)tickGroup].tasks.GetSize(); }
+
+		u32 GetParallelLevelCount(TickGroup tickGroup) const
+		{
+			const Array<u32>& levelOffsets = schedules[(int)tickGroup].levelOffsets;
+			return levelOffsets.IsEmpty() ? 0 : (u32)levelOffsets.GetSize() - 1;
+		}
+
+		const Array<SceneComponent*>& GetGameThreadChildren(TickGroup tickGroup) const { return schedules[(int)tickGroup].gameThreadChildren; }
+
+	private:
+
+		//! @brief Parallel components of one root actor's subtree, in hierarchy order.
+		struct TickTask
+		{
+			u32 firstComponent = 0;
+			u32 componentCount = 0;
+		};
+
+		struct TickGroupSchedule
+		{
+			//! @brief Components that opted out of parallel ticking. Ticked first, on the game thread, in hierarchy order.
+			Array<ActorComponent*> serialComponents{};
+
+			Array<ActorComponent*> taskComponents{};
+
+			//! @brief Tasks sorted by dependency level. Tasks of the same level run in parallel.
+			Array<TickTask> tasks{};
+
+			//! @brief Tasks of level i are [levelOffsets[i], levelOffsets[i + 1]).
+			Array<u32> levelOffsets{};
+
+			//! @brief Components of tasks with cyclic prerequisites. Ticked after the parallel tasks, on the game thread.
+			Array<ActorComponent*> cyclicComponents{};
+
+			//! @brief Owner ticked components attached to a parallel scene component. A parallel tick never ticks
+			//! its children (see SceneComponent::Tick), so they are ticked last, on the game thread, in hierarchy order.
+			Array<SceneComponent*> gameThreadChildren{};
+		};
+
+		TickGroupSchedule schedules[(int)TickGroup::COUNT];
+	};
+
+} // namespace CE
@@ -0,0 +1,121 @@
+#pragma once
+
+namespace CE
+{
+
+	/// @brief Scene-wide store of local and world transforms in structure-of-arrays layout.
+	/// Nodes are kept sorted by depth, so every parent is stored before its children and each depth level is a
+	/// contiguous range that can be updated in parallel. Nodes are addressed through stable handles.
+	class ENGINE_API TransformHierarchy final
+	{
+	public:
+
+		static constexpr u32 InvalidHandle = NumericLimits<u32>::Max();
+
+		TransformHierarchy();
+		~TransformHierarchy();
+
+		TransformHierarchy(const TransformHierarchy&) = delete;
+		TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+		//! @brief Allocates a root node with identity transform. owner is only used to validate handles.
+		u32 Allocate(const void* owner);
+
+		void Free(u32 handle);
+
+		void Clear();
+
+		//! @brief Returns true if handle refers to a live node that was allocated for owner.
+		bool IsValid(u32 handle, const void* owner) const;
+
+		//! @brief Pass InvalidHandle to make the node a root.
+		void SetParent(u32 handle, u32 parentHandle);
+
+		u32 GetParent(u32 handle) const;
+
+		void SetLocalTransform(u32 handle, const Vec3& position, const Vec3& eulerDegrees, const Vec3& scale);
+
+		//! @brief Frees every node that was not visited since BeginVisit(). Used to garbage collect nodes
+		//! whose owners left the hierarchy without freeing them.
+		void BeginVisit();
+		void MarkVisited(u32 handle);
+		void FreeUnvisited();
+
+		//! @brief Recomputes all stale world transforms, one depth level at a time.
+		void Update();
+
+		//! @brief Brings a single node (and its ancestors) up to date, outside of Update().
+		//! Does not recompute anything while the hierarchy is read only, see SetReadOnly().
+		//! @return True if the node's world transform was recomputed since the last Update() began.
+		bool Resolve(u32 handle);
+
+		//! @brief While read only, Resolve() only reports IsUpdated(): nodes that changed since the last Update() keep
+		//! their previous world transform until the next Update(). Set around parallel ticks, so that world transforms
+		//! are only ever written by the serial Update() and Resolve() calls. SetLocalTransform() only writes the node's own
+		//! slot and stays allowed. Must be toggled from the game thread.
+		void SetReadOnly(bool readOnly) { this->readOnly = readOnly; }
+
+		bool IsReadOnly() const { return readOnly; }
+
+		//! @brief Returns true if the world transform was recomputed since the last Update() began.
+		bool IsUpdated(u32 handle) const;
+
+		const Matrix4x4& GetWorldTransform(u32 handle) const;
+
+		const Matrix4x4& GetLocalTransform(u32 handle) const;
+
+		u32 GetNodeCount() const { return nodeCount; }
+
+		u32 GetLevelCount() const { return levelOffsets.IsEmpty() ? 0 : (u32)levelOffsets.GetSize() - 1; }
+
+		//! @brief Each depth level is split into batches of this many nodes, which are updated in parallel.
+		u32 batchSize = 1024;
+
+	private:
+
+		static constexpr u32 InvalidSlot = NumericLimits<u32>::Max();
+
+		void SortByDepth();
+
+		void UpdateSlot(u32 slot);
+
+		void UpdateRange(u32 begin, u32 end);
+
+		void ResolveSlot(u32 slot);
+
+		// - Handles -
+
+		Array<u32> slotOfHandle{};
+		Array<const void*> ownerOfHandle{};
+		Array<u32> freeHandles{};
+		Array<u8> visited{};
+
+		// - Nodes, indexed by slot and sorted by depth -
+
+		Array<u32> handleOfSlot{};
+		Array<u32> parentSlot{};
+
+		Array<Vec3> localPositions{};
+		Array<Vec3> localEulerAngles{};
+		Array<Vec3> localScales{};
+
+		Array<Matrix4x4> localTransforms{};
+		Array<Matrix4x4> worldTransforms{};
+
+		//! @brief Incremented every time a node's world transform is recomputed.
+		Array<u32> worldVersions{};
+		//! @brief Parent's world version at the time the node's world transform was computed.
+		Array<u32> parentVersions{};
+
+		Array<u8> localDirty{};
+		Array<u8> updated{};
+
+		//! @brief Nodes of depth i are [levelOffsets[i], levelOffsets[i + 1]).
+		Array<u32> levelOffsets{};
+
+		u32 nodeCount = 0;
+		bool depthOrderDirty = false;
+		bool readOnly = false;
+	};
+
+} // namespace CE
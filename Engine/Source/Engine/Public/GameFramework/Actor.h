@@ -106,6 +106,7 @@ namespace CE
 		b8 hasBegunPlaying = false;
 
 		friend class CE::Scene;
+		friend class TickScheduler;
 		friend class SceneComponent;
 	};
 
@@ -6,6 +6,22 @@ namespace CE
 	class Scene;
 	class SceneComponent;
 
+	//! @brief Stage of CE::Scene::Tick in which a component is ticked.
+	ENUM()
+	enum class TickGroup : u8
+	{
+		//! @brief Ticked while walking the actor hierarchy, before cameras and physics. Default.
+		PrePhysics = 0,
+		//! @brief Ticked after the actor hierarchy, right before the physics step.
+		DuringPhysics,
+		//! @brief Ticked after the physics step.
+		PostPhysics,
+		//! @brief Ticked last, after every other tick group.
+		PostUpdateWork,
+		COUNT
+	};
+	ENUM_CLASS(TickGroup);
+
 	CLASS()
 	class ENGINE_API ActorComponent : public Object
 	{
@@ -36,6 +52,28 @@ namespace CE
 
 		void SetCanTick(bool canTick) { this->canTick = canTick; }
 
+		TickGroup GetTickGroup() const { return tickGroup; }
+
+		void SetTickGroup(TickGroup tickGroup);
+
+		bool CanTickInParallel() const { return tickInParallel; }
+
+		//! @brief Allows the scene to tick this component on a worker thread, concurrently with components of other
+		//! root actors. Parallel ticks must not attach, detach or destroy objects, or acquire/release RPI handles.
+		//! Children of a parallel scene component that are ticked by their owner are ticked on the game thread, after
+		//! every parallel task of the tick group.
+		void SetTickInParallel(bool tickInParallel);
+
+		//! @brief Ticks this component only after the prerequisite has ticked. Prerequisites in an earlier tick group
+		//! are always met; prerequisites in a later tick group are ignored.
+		void AddTickPrerequisite(ActorComponent* prerequisite);
+
+		void RemoveTickPrerequisite(ActorComponent* prerequisite);
+
+		//! @brief Returns true if this component is ticked by its owner during the actor hierarchy walk,
+		//! instead of being scheduled separately by the scene.
+		bool IsTickedByOwner() const { return tickGroup == TickGroup::PrePhysics && !tickInParallel; }
+
 		bool HasBegunPlaying() const { return hasBegunPlaying; }
 
 	protected:
@@ -50,6 +88,12 @@ namespace CE
 		FIELD()
 		bool canTick = true;
 
+		FIELD()
+		TickGroup tickGroup = TickGroup::PrePhysics;
+
+		FIELD()
+		bool tickInParallel = false;
+
 		FIELD()
 		WeakRef<Actor> owner = nullptr;
 
@@ -65,9 +109,15 @@ namespace CE
 		b8 onEnabledCalled = false;
 		b8 onDisabledCalled = false;
 
+		Array<WeakRef<ActorComponent>> tickPrerequisites{};
+
+		//! @brief Index of the parallel tick task this component belongs to. Only valid while the scene rebuilds its tick schedule.
+		int tickTaskIndex = -1;
+
 		friend class Actor;
 		friend class CE::Scene;
 		friend class RendererSubsystem;
+		friend class TickScheduler;
 	};
 
 } // namespace CE
@@ -77,6 +77,10 @@ namespace CE
 
 		RPI::ViewPtr rpiView = nullptr;
 
+		//! @brief Game thread copy of the last projection stored to the view constants, which the render thread
+		//! may be writing while the game thread ticks.
+		Matrix4x4 projectionMatrix = Matrix4x4::Identity();
+
 	public: // - Accessors -
 
 		CE_PROPERTY(CameraType, cameraType);
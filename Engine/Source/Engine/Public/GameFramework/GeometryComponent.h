@@ -50,6 +50,8 @@ namespace CE
 
 		Ref<PhysicsBody> GetPhysicsBody() const { return physicsBody; }
 
+		bool IsSimulatingPhysics() const { return simulatePhysics; }
+
 	private:
 
 		FIELD()
@@ -39,13 +39,20 @@ namespace CE
 		void SetPosition(Vec3 globalPosition);
 		void SetRotation(Quat globalRotation);
 
+		//! @brief Converts a world space position to this component's local space, i.e. its parent component's space.
+		Vec3 WorldToLocalPosition(const Vec3& worldPosition) const;
+
+		//! @brief Converts a world space rotation to local euler angles in degrees, relative to the parent component.
+		Vec3 WorldToLocalEulerAngles(const Quat& worldRotation) const;
+
 		void OnBeginPlay() override;
 
 		void Tick(f32 delta) override;
 
-		const Matrix4x4& GetTransform() const { return transform; }
+		//! @brief Returns the local-to-world transform. The reference is only valid until the scene's hierarchy changes.
+		const Matrix4x4& GetTransform() const;
 
-		const Matrix4x4& GetLocalTransform() const { return localTransform; }
+		const Matrix4x4& GetLocalTransform() const;
 
 		const Vec3& GetForwardVector() const { return forwardVector; }
 
@@ -78,6 +85,10 @@ namespace CE
 
 	private:
 
+		//! @brief Returns the scene's transform hierarchy if this component has a node in it, nullptr otherwise.
+		TransformHierarchy* GetTransformHierarchy() const;
+
+		//! @brief Computes the transform without a transform hierarchy, for components that are not in a scene yet.
 		void UpdateTransformInternal();
 
 		bool IsDirty();
@@ -120,13 +131,13 @@ namespace CE
 
 		b8 transformUpdated = false;
         
+		//! @brief Node in the scene's TransformHierarchy. Assigned by the scene.
+		u32 transformHandle = TransformHierarchy::InvalidHandle;
+
+		// Only used while the component has no transform hierarchy node
         Matrix4x4 transform{};
 		Matrix4x4 localTransform{};
 
-		Matrix4x4 localTranslationMat = Matrix4x4::Identity();
-		Matrix4x4 localRotationMat = Matrix4x4::Identity();
-		Matrix4x4 localScaleMat = Matrix4x4::Identity();
-
     public: // - Accessors -
 
 		CE_PROPERTY(LocalPosition, localPosition);
@@ -135,6 +146,7 @@ namespace CE
 		CE_PROPERTY(Mobility, mobility);
         
         friend class CE::Scene;
+		friend class TickScheduler;
 		friend class Actor;
 		friend class ActorComponent;
 	};
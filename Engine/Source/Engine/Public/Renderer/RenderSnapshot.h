@@ -0,0 +1,78 @@
+#pragma once
+
+namespace CE
+{
+
+	/// @brief Render state produced by the game thread for one frame when pipelined rendering is enabled.
+	/// Components record the values they would normally write into RPI handles (transforms, light parameters,
+	/// view constants, etc.) and the render thread applies them at the start of the frame that renders them.
+	/// A snapshot is never modified after it has been handed to the render thread. Recording is thread-safe, so
+	/// components that tick in parallel can record into the same snapshot.
+	class ENGINE_API RenderSnapshot final
+	{
+	public:
+
+		RenderSnapshot();
+		~RenderSnapshot();
+
+		RenderSnapshot(const RenderSnapshot&) = delete;
+		RenderSnapshot& operator=(const RenderSnapshot&) = delete;
+
+		//! @brief Copies value into target when the snapshot is applied. Later writes to the same target win.
+		//! Values are copied as plain bytes, so T must not own any resources (matrices, vectors, scalars, etc.).
+		template<typename T>
+		void Write(T* target, const std::type_identity_t<T>& value)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "RenderSnapshot::Write() copies values as plain bytes");
+
+			WriteBytes(target, &value, sizeof(T));
+		}
+
+		//! @brief Writes value into target through the snapshot, or directly if snapshot is nullptr.
+		template<typename T>
+		static void Store(RenderSnapshot* snapshot, T& target, const std::type_identity_t<T>& value)
+		{
+			if (snapshot != nullptr)
+				snapshot->Write(&target, value);
+			else
+				target = value;
+		}
+
+		//! @brief Runs the command on the render thread after all writes of this snapshot have been applied.
+		//! Use for state that can't be copied as plain bytes.
+		void Enqueue(const Delegate<void(void)>& command);
+
+		//! @brief Applies all writes in the order they were recorded, then runs the commands.
+		void Apply();
+
+		void Clear();
+
+		bool IsEmpty() const { return writes.IsEmpty() && commands.IsEmpty(); }
+
+		u32 GetWriteCount() const { return (u32)writes.GetSize(); }
+
+		//! @brief Game frame that produced this snapshot.
+		u64 frameNumber = 0;
+
+		//! @brief Time at which the game frame started, i.e. right after input was polled.
+		std::chrono::steady_clock::time_point gameFrameStartTime{};
+
+	private:
+
+		void WriteBytes(void* target, const void* value, u32 size);
+
+		struct WriteEntry
+		{
+			void* target = nullptr;
+			u32 offset = 0;
+			u32 size = 0;
+		};
+
+		Array<WriteEntry> writes{};
+		Array<u8> data{};
+		Array<Delegate<void(void)>> commands{};
+
+		Mutex mutex{};
+	};
+
+} // namespace CE
@@ -3,6 +3,10 @@
 
 #include <iostream>
 #include <any>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -74,3 +78,860 @@ TEST(Scene, BasicNodes)
 
 #pragma endregion
 
+
+#pragma region TransformHierarchy
+
+TEST(TransformHierarchy, Benchmark100k)
+{
+	TEST_BEGIN;
+
+	constexpr u32 nodeCount = 100'000;
+	constexpr u32 rootCount = 16;
+
+	// Reference implementation: the per-component T * R * S path
+	auto composeLocal = [](const Vec3& position, const Vec3& euler, const Vec3& scale)
+		{
+			return Matrix4x4::Translation(position) * Quat::EulerDegrees(euler).ToMatrix() * Matrix4x4::Scale(scale);
+		};
+
+	TransformHierarchy hierarchy{};
+
+	Array<u32> handles{};
+	Array<u32> parents{};
+	Array<Vec3> positions{};
+	Array<Vec3> eulerAngles{};
+	handles.Resize(nodeCount);
+	parents.Resize(nodeCount);
+	positions.Resize(nodeCount);
+	eulerAngles.Resize(nodeCount);
+
+	std::mt19937 random(1234);
+
+	for (u32 i = 0; i < nodeCount; i++)
+	{
+		handles[i] = hierarchy.Allocate(&handles[i]);
+		parents[i] = i < rootCount ? TransformHierarchy::InvalidHandle : (u32)(random() % i);
+		positions[i] = Vec3((f32)(random() % 16), (f32)(random() % 16), (f32)(random() % 16)) * 0.25f;
+		eulerAngles[i] = Vec3((f32)(random() % 360), (f32)(random() % 360), (f32)(random() % 360));
+
+		hierarchy.SetParent(handles[i], parents[i] == TransformHierarchy::InvalidHandle ? TransformHierarchy::InvalidHandle : handles[parents[i]]);
+		hierarchy.SetLocalTransform(handles[i], positions[i], eulerAngles[i], Vec3(1, 1, 1));
+	}
+
+	EXPECT_EQ(hierarchy.GetNodeCount(), nodeCount);
+
+	auto measure = [&](const char* name, auto&& func)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			f64 ms = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+			CE_LOG(Info, Console, "TransformHierarchy {}: {} ms", name, ms);
+		};
+
+	auto verify = [&]()
+		{
+			Array<Matrix4x4> expected{};
+			expected.Resize(nodeCount);
+
+			f32 maxError = 0;
+
+			for (u32 i = 0; i < nodeCount; i++)
+			{
+				Matrix4x4 local = composeLocal(positions[i], eulerAngles[i], Vec3(1, 1, 1));
+				expected[i] = parents[i] == TransformHierarchy::InvalidHandle ? local : expected[parents[i]] * local;
+
+				const Matrix4x4& actual = hierarchy.GetWorldTransform(handles[i]);
+
+				for (int row = 0; row < 4; row++)
+				{
+					for (int col = 0; col < 4; col++)
+					{
+						maxError = Math::Max(maxError, std::abs(actual.rows[row][col] - expected[i].rows[row][col]));
+					}
+				}
+			}
+
+			EXPECT_LT(maxError, 0.01f);
+		};
+
+	measure("initial update", [&] { hierarchy.Update(); });
+	verify();
+
+	measure("clean update", [&] { hierarchy.Update(); });
+
+	// Moving a root only recomputes its subtree
+	positions[0] = Vec3(10, 0, 0);
+	hierarchy.SetLocalTransform(handles[0], positions[0], eulerAngles[0], Vec3(1, 1, 1));
+
+	measure("root moved", [&] { hierarchy.Update(); });
+	verify();
+
+	u32 updatedCount = 0;
+	for (u32 i = 0; i < nodeCount; i++)
+	{
+		if (hierarchy.IsUpdated(handles[i]))
+			updatedCount++;
+	}
+	EXPECT_GT(updatedCount, 0);
+	EXPECT_LT(updatedCount, nodeCount);
+
+	// Reference: recompute every node one at a time, like the recursive component tick did
+	measure("per-node reference", [&]
+		{
+			Array<Matrix4x4> world{};
+			world.Resize(nodeCount);
+
+			for (u32 i = 0; i < nodeCount; i++)
+			{
+				Matrix4x4 local = composeLocal(positions[i], eulerAngles[i], Vec3(1, 1, 1));
+				world[i] = parents[i] == TransformHierarchy::InvalidHandle ? local : world[parents[i]] * local;
+			}
+		});
+
+	// Freed parents turn their children into roots
+	hierarchy.Free(handles[nodeCount - 1]);
+	EXPECT_FALSE(hierarchy.IsValid(handles[nodeCount - 1], &handles[nodeCount - 1]));
+	hierarchy.Update();
+	EXPECT_EQ(hierarchy.GetNodeCount(), nodeCount - 1);
+
+	TEST_END;
+}
+
+#pragma endregion
+
+
+#pragma region TickScheduler
+
+namespace TickTests
+{
+	struct TickRecord
+	{
+		ActorComponent* component = nullptr;
+		std::thread::id threadId{};
+	};
+
+	static Mutex tickRecordMutex{};
+	static Array<TickRecord> tickRecords{};
+
+	static void RecordTick(ActorComponent* component)
+	{
+		LockGuard lock{ tickRecordMutex };
+		tickRecords.Add({ component, std::this_thread::get_id() });
+	}
+
+	class TickRecorderComponent : public ActorComponent
+	{
+		CE_CLASS(TickRecorderComponent, ActorComponent)
+	public:
+
+		void Tick(f32 delta) override
+		{
+			RecordTick(this);
+			Super::Tick(delta);
+		}
+	};
+
+	class TickRecorderSceneComponent : public SceneComponent
+	{
+		CE_CLASS(TickRecorderSceneComponent, SceneComponent)
+	public:
+
+		void Tick(f32 delta) override
+		{
+			RecordTick(this);
+			Super::Tick(delta);
+		}
+	};
+
+	// Index of the component's first tick, or -1
+	static int FindTick(ActorComponent* component)
+	{
+		for (int i = 0; i < tickRecords.GetSize(); i++)
+		{
+			if (tickRecords[i].component == component)
+				return i;
+		}
+		return -1;
+	}
+
+	static int CountTicks(ActorComponent* component)
+	{
+		int count = 0;
+		for (const TickRecord& record : tickRecords)
+		{
+			if (record.component == component)
+				count++;
+		}
+		return count;
+	}
+
+	// Same order as Scene::Tick, minus cameras, rendering & physics
+	static void TickLikeScene(const Array<Actor*>& actors, TickScheduler& scheduler)
+	{
+		for (Actor* actor : actors)
+		{
+			actor->Tick(0.016f);
+		}
+
+		for (int group = 0; group < (int)TickGroup::COUNT; group++)
+		{
+			scheduler.Tick((TickGroup)group, 0.016f);
+		}
+	}
+}
+
+CE_RTTI_CLASS(, TickTests, TickRecorderComponent,
+	CE_SUPER(ActorComponent),
+	CE_NOT_ABSTRACT,
+	CE_ATTRIBS(),
+	CE_FIELD_LIST(),
+	CE_FUNCTION_LIST()
+)
+CE_RTTI_CLASS_IMPL(, TickTests, TickRecorderComponent)
+
+CE_RTTI_CLASS(, TickTests, TickRecorderSceneComponent,
+	CE_SUPER(SceneComponent),
+	CE_NOT_ABSTRACT,
+	CE_ATTRIBS(),
+	CE_FIELD_LIST(),
+	CE_FUNCTION_LIST()
+)
+CE_RTTI_CLASS_IMPL(, TickTests, TickRecorderSceneComponent)
+
+TEST(TickScheduler, TickGroupOrder)
+{
+	TEST_BEGIN;
+	CE_REGISTER_TYPES(TickTests::TickRecorderComponent, TickTests::TickRecorderSceneComponent);
+	using namespace TickTests;
+
+	tickRecords.Clear();
+
+	constexpr int actorCount = 2;
+	constexpr int groupCount = (int)TickGroup::COUNT;
+
+	Array<Actor*> actors{};
+	// [actor][group][0 = serial, 1 = parallel]
+	TickRecorderComponent* components[actorCount][groupCount][2] = {};
+
+	for (int a = 0; a < actorCount; a++)
+	{
+		Actor* actor = CreateObject<Actor>(nullptr, String::Format("Actor{}", a));
+		actors.Add(actor);
+
+		// Added in reverse tick group order, so hierarchy order alone can't pass the test
+		for (int group = groupCount - 1; group >= 0; group--)
+		{
+			for (int parallel = 0; parallel < 2; parallel++)
+			{
+				TickRecorderComponent* component = CreateObject<TickRecorderComponent>(actor,
+					String::Format("Component{}_{}", group, parallel));
+				component->SetTickGroup((TickGroup)group);
+				component->SetTickInParallel(parallel == 1);
+				actor->AttachComponent(component);
+
+				components[a][group][parallel] = component;
+			}
+		}
+	}
+
+	// Across root actors, a parallel prerequisite puts the dependent task one level later
+	components[1][(int)TickGroup::PostPhysics][1]->AddTickPrerequisite(components[0][(int)TickGroup::PostPhysics][1]);
+
+	TickScheduler scheduler{};
+	scheduler.Rebuild(actors, nullptr);
+
+	EXPECT_EQ(scheduler.GetParallelLevelCount(TickGroup::PostPhysics), 2u);
+	EXPECT_EQ(scheduler.GetParallelLevelCount(TickGroup::DuringPhysics), 1u);
+
+	TickLikeScene(actors, scheduler);
+
+	// Every component ticks once, and never before a component of an earlier tick group
+	TickGroup lastGroup = TickGroup::PrePhysics;
+	for (const TickRecord& record : tickRecords)
+	{
+		EXPECT_GE((int)record.component->GetTickGroup(), (int)lastGroup);
+		lastGroup = record.component->GetTickGroup();
+	}
+
+	for (int a = 0; a < actorCount; a++)
+	{
+		for (int group = 0; group < groupCount; group++)
+		{
+			EXPECT_EQ(CountTicks(components[a][group][0]), 1);
+			EXPECT_EQ(CountTicks(components[a][group][1]), 1);
+		}
+	}
+
+	EXPECT_LT(FindTick(components[0][(int)TickGroup::PostPhysics][1]), FindTick(components[1][(int)TickGroup::PostPhysics][1]));
+
+	for (Actor* actor : actors)
+	{
+		actor->BeginDestroy();
+	}
+	tickRecords.Clear();
+
+	CE_DEREGISTER_TYPES(TickTests::TickRecorderComponent, TickTests::TickRecorderSceneComponent);
+	TEST_END;
+}
+
+TEST(TickScheduler, ParallelSerialSplit)
+{
+	TEST_BEGIN;
+	CE_REGISTER_TYPES(TickTests::TickRecorderComponent, TickTests::TickRecorderSceneComponent);
+	using namespace TickTests;
+
+	JobManagerDesc jobManagerDesc{};
+	jobManagerDesc.defaultTag = JOB_THREAD_WORKER;
+	jobManagerDesc.totalThreads = 0; // auto set optimal number of threads
+
+	JobManager* jobManager = new JobManager("TickSchedulerJobManager", jobManagerDesc);
+	JobContext* jobContext = new JobContext(jobManager);
+	JobContext::PushGlobalContext(jobContext);
+
+	tickRecords.Clear();
+
+	const std::thread::id gameThreadId = std::this_thread::get_id();
+	constexpr int actorCount = 8;
+
+	Array<Actor*> actors{};
+	Array<TickRecorderSceneComponent*> roots{};
+	Array<TickRecorderSceneComponent*> children{};
+	Array<TickRecorderSceneComponent*> grandChildren{};
+	Array<TickRecorderComponent*> serialComponents{};
+
+	for (int a = 0; a < actorCount; a++)
+	{
+		Actor* actor = CreateObject<Actor>(nullptr, String::Format("Actor{}", a));
+		actors.Add(actor);
+
+		// Parallel root with a chain of components ticked by their owner
+		TickRecorderSceneComponent* root = CreateObject<TickRecorderSceneComponent>(actor, "Root");
+		root->SetTickInParallel(true);
+		actor->SetRootComponent(root);
+		roots.Add(root);
+
+		TickRecorderSceneComponent* child = CreateObject<TickRecorderSceneComponent>(actor, "Child");
+		root->SetupAttachment(child);
+		children.Add(child);
+
+		TickRecorderSceneComponent* grandChild = CreateObject<TickRecorderSceneComponent>(actor, "GrandChild");
+		child->SetupAttachment(grandChild);
+		grandChildren.Add(grandChild);
+
+		TickRecorderComponent* serialComponent = CreateObject<TickRecorderComponent>(actor, "Serial");
+		serialComponent->SetTickGroup(TickGroup::DuringPhysics);
+		actor->AttachComponent(serialComponent);
+		serialComponents.Add(serialComponent);
+	}
+
+	TickScheduler scheduler{};
+	scheduler.Rebuild(actors, nullptr);
+
+	// Owner ticked components are never scheduled themselves; only direct children of parallel components are
+	EXPECT_TRUE(scheduler.GetSerialComponents(TickGroup::PrePhysics).IsEmpty());
+	EXPECT_EQ(scheduler.GetParallelTaskCount(TickGroup::PrePhysics), (u32)actorCount);
+	EXPECT_EQ(scheduler.GetGameThreadChildren(TickGroup::PrePhysics).GetSize(), actorCount);
+	EXPECT_EQ(scheduler.GetSerialComponents(TickGroup::DuringPhysics).GetSize(), actorCount);
+	EXPECT_EQ(scheduler.GetParallelTaskCount(TickGroup::DuringPhysics), 0u);
+
+	for (int frame = 0; frame < 4; frame++)
+	{
+		tickRecords.Clear();
+
+		TickLikeScene(actors, scheduler);
+
+		for (int a = 0; a < actorCount; a++)
+		{
+			EXPECT_EQ(CountTicks(roots[a]), 1);
+			EXPECT_EQ(CountTicks(children[a]), 1);
+			EXPECT_EQ(CountTicks(grandChildren[a]), 1);
+			EXPECT_EQ(CountTicks(serialComponents[a]), 1);
+
+			// Children tick after their parent, and only parallel components leave the game thread
+			EXPECT_LT(FindTick(roots[a]), FindTick(children[a]));
+			EXPECT_LT(FindTick(children[a]), FindTick(grandChildren[a]));
+
+			EXPECT_EQ(tickRecords[FindTick(children[a])].threadId, gameThreadId);
+			EXPECT_EQ(tickRecords[FindTick(grandChildren[a])].threadId, gameThreadId);
+			EXPECT_EQ(tickRecords[FindTick(serialComponents[a])].threadId, gameThreadId);
+		}
+	}
+
+	for (Actor* actor : actors)
+	{
+		actor->BeginDestroy();
+	}
+	tickRecords.Clear();
+
+	JobContext::PopGlobalContext();
+	delete jobContext;
+	delete jobManager;
+
+	CE_DEREGISTER_TYPES(TickTests::TickRecorderComponent, TickTests::TickRecorderSceneComponent);
+	TEST_END;
+}
+
+#pragma endregion
+
+
+#pragma region AssetRegistry
+
+TEST(AssetRegistry, SnapshotRoundTrip)
+{
+	TEST_BEGIN;
+
+	IO::Path snapshotPath = PlatformDirectories::GetLaunchDir() / "Temp/Tests/AssetRegistry.snapshot";
+	if (snapshotPath.Exists())
+	{
+		IO::Path::Remove(snapshotPath);
+	}
+
+	Uuid dependency = Uuid::Random();
+
+	{
+		AssetRegistrySnapshot snapshot{};
+		EXPECT_FALSE(snapshot.LoadFromDisk(snapshotPath));
+
+		AssetRegistrySnapshot::Entry entry{};
+		entry.bundlePath = "/Game/Assets/Textures/Noise";
+		entry.bundleName = "Noise";
+		entry.bundleUuid = Uuid::Random();
+		entry.assetName = "Noise";
+		entry.assetUuid = Uuid::Random();
+		entry.assetClassTypeName = "/Code/Engine.CE::Texture2D";
+		entry.sourceAssetPath = "/Game/Assets/Textures/Noise.png";
+		entry.dependencies.Add(dependency);
+		entry.lastWriteTime = 1234;
+		entry.fileSize = 5678;
+
+		snapshot.SetEntry("/Project/Game/Assets/Textures/Noise.casset", entry);
+
+		entry.bundlePath = "/Game/Assets/Textures/Deleted";
+		entry.dependencies.Clear();
+		snapshot.SetEntry("/Project/Game/Assets/Textures/Deleted.casset", entry);
+
+		EXPECT_TRUE(snapshot.IsDirty());
+		EXPECT_TRUE(snapshot.SaveToDisk(snapshotPath));
+		EXPECT_FALSE(snapshot.IsDirty());
+	}
+
+	{
+		AssetRegistrySnapshot snapshot{};
+		EXPECT_TRUE(snapshot.LoadFromDisk(snapshotPath));
+		EXPECT_EQ(snapshot.GetEntryCount(), 2u);
+
+		AssetRegistrySnapshot::Entry entry{};
+
+		// Entries are only valid while the bundle's size & write time are unchanged
+		EXPECT_FALSE(snapshot.FindValidEntry("/Project/Game/Assets/Textures/Noise.casset", 1235, 5678, entry));
+		EXPECT_FALSE(snapshot.FindValidEntry("/Project/Game/Assets/Textures/Noise.casset", 1234, 5679, entry));
+		EXPECT_TRUE(snapshot.FindValidEntry("/Project/Game/Assets/Textures/Noise.casset", 1234, 5678, entry));
+
+		EXPECT_EQ(entry.bundlePath, Name("/Game/Assets/Textures/Noise"));
+		EXPECT_EQ(entry.assetClassTypeName, Name("/Code/Engine.CE::Texture2D"));
+		EXPECT_EQ(entry.sourceAssetPath, Name("/Game/Assets/Textures/Noise.png"));
+		ASSERT_EQ(entry.dependencies.GetSize(), 1);
+		EXPECT_EQ(entry.dependencies[0], dependency);
+
+		HashSet<String> existingPaths{};
+		existingPaths.Add("/Project/Game/Assets/Textures/Noise.casset");
+		snapshot.RemoveEntriesNotIn(existingPaths);
+
+		EXPECT_EQ(snapshot.GetEntryCount(), 1u);
+		EXPECT_TRUE(snapshot.IsDirty());
+	}
+
+	IO::Path::Remove(snapshotPath);
+
+	TEST_END;
+}
+
+#pragma endregion
+
+
+#pragma region AssetSearchIndex
+
+static AssetData MakeSearchAsset(const String& name, const String& path, const String& typeName = "/Code/Engine.CE::Texture2D")
+{
+	AssetData assetData{};
+	assetData.bundleName = name;
+	assetData.bundlePath = path;
+	assetData.assetName = name;
+	assetData.assetClassTypeName = typeName;
+	return assetData;
+}
+
+static bool SearchResultsContain(const Array<AssetSearchIndex::Result>& results, const AssetData* assetData)
+{
+	return results.Exists([assetData](const AssetSearchIndex::Result& result) { return result.assetData == assetData; });
+}
+
+//! @brief Scores the asset by scanning its fields, with the rules documented in AssetSearchIndex::Query(). 0 if it doesn't match.
+static u32 ScoreAssetBruteForce(const AssetData& assetData, const Array<std::string>& words)
+{
+	const std::string originalName = assetData.bundleName.GetString().ToStdString();
+	const std::string name = assetData.bundleName.GetString().ToLower().ToStdString();
+	const std::string path = assetData.bundlePath.GetString().ToLower().ToStdString();
+
+	std::string typeName = assetData.assetClassTypeName.GetString().ToLower().ToStdString();
+	SIZE_T separator = typeName.find_last_of(":./");
+	if (separator != std::string::npos)
+		typeName = typeName.substr(separator + 1);
+
+	auto isAlphaNumeric = [](char c) { return String::IsAlphabet(c) || String::IsNumeric(c); };
+
+	auto isWordStart = [&](SIZE_T i)
+		{
+			char c = originalName[i];
+			if (!isAlphaNumeric(c))
+				return false;
+			return i == 0 || !isAlphaNumeric(originalName[i - 1]) ||
+				(String::IsUpper(c) && String::IsLower(originalName[i - 1])) ||
+				(String::IsNumeric(c) && !String::IsNumeric(originalName[i - 1]));
+		};
+
+	u32 score = 0;
+
+	for (const std::string& word : words)
+	{
+		u32 wordScore = 0;
+
+		if (name == word)
+		{
+			wordScore = 100;
+		}
+		else if (name.rfind(word, 0) == 0)
+		{
+			wordScore = 80;
+		}
+		else
+		{
+			bool found = false;
+			for (SIZE_T i = name.find(word, 1); i != std::string::npos && wordScore == 0; i = name.find(word, i + 1))
+			{
+				found = true;
+				if (isWordStart(i))
+					wordScore = 60;
+			}
+
+			// Words shorter than 3 characters only match the start of words in the name
+			if (wordScore == 0 && word.size() >= 3)
+			{
+				if (found)
+					wordScore = 40;
+				else if (typeName.find(word) != std::string::npos)
+					wordScore = 20;
+				else if (path.find(word) != std::string::npos)
+					wordScore = 10;
+			}
+		}
+
+		if (wordScore == 0)
+			return 0;
+
+		score += wordScore;
+	}
+
+	return score;
+}
+
+TEST(AssetSearchIndex, AddRemove)
+{
+	TEST_BEGIN;
+
+	AssetData stoneWall = MakeSearchAsset("StoneWall", "/Game/Assets/Walls/StoneWall");
+	AssetData woodWall = MakeSearchAsset("WoodWall", "/Game/Assets/Walls/WoodWall");
+
+	AssetSearchIndex index{};
+	index.AddAsset(&stoneWall);
+	index.AddAsset(&woodWall);
+	EXPECT_EQ(index.GetAssetCount(), 2);
+
+	Array<AssetSearchIndex::Result> results = index.Query("stone", 10);
+	ASSERT_EQ(results.GetSize(), 1);
+	EXPECT_EQ(results[0].assetData, &stoneWall);
+
+	EXPECT_EQ(index.Query("wall", 10).GetSize(), 2);
+
+	index.RemoveAsset(&stoneWall);
+	EXPECT_EQ(index.GetAssetCount(), 1);
+	EXPECT_TRUE(index.Query("stone", 10).IsEmpty());
+
+	results = index.Query("wall", 10);
+	ASSERT_EQ(results.GetSize(), 1);
+	EXPECT_EQ(results[0].assetData, &woodWall);
+
+	// Removing twice does nothing
+	index.RemoveAsset(&stoneWall);
+	EXPECT_EQ(index.GetAssetCount(), 1);
+
+	// Re-adding a renamed asset replaces its old keys
+	stoneWall = MakeSearchAsset("BrickWall", "/Game/Assets/Walls/BrickWall");
+	index.AddAsset(&stoneWall);
+	index.AddAsset(&stoneWall);
+	EXPECT_EQ(index.GetAssetCount(), 2);
+
+	EXPECT_TRUE(index.Query("stone", 10).IsEmpty());
+	results = index.Query("brick", 10);
+	ASSERT_EQ(results.GetSize(), 1);
+	EXPECT_EQ(results[0].assetData, &stoneWall);
+	EXPECT_EQ(index.Query("wall", 10).GetSize(), 2);
+
+	index.Clear();
+	EXPECT_EQ(index.GetAssetCount(), 0);
+	EXPECT_TRUE(index.Query("wall", 10).IsEmpty());
+
+	TEST_END;
+}
+
+TEST(AssetSearchIndex, ShortWords)
+{
+	TEST_BEGIN;
+
+	AssetData stoneWall = MakeSearchAsset("StoneWall", "/Game/Assets/StoneWall");
+	AssetData wallStone = MakeSearchAsset("WallStone", "/Game/Assets/WallStone");
+	AssetData rock_stone = MakeSearchAsset("rock_stone", "/Game/Assets/rock_stone");
+	AssetData mist = MakeSearchAsset("Mist", "/Game/Assets/Mist");
+	AssetData dust = MakeSearchAsset("Dust", "/Game/Stuff/Dust");
+
+	AssetSearchIndex index{};
+	for (AssetData* assetData : { &stoneWall, &wallStone, &rock_stone, &mist, &dust })
+	{
+		index.AddAsset(assetData);
+	}
+
+	// Only the start of words in names: not inside "Mist", nor in the path of "Dust"
+	Array<AssetSearchIndex::Result> results = index.Query("st", 10);
+	ASSERT_EQ(results.GetSize(), 3);
+	EXPECT_EQ(results[0].assetData, &stoneWall);
+	EXPECT_TRUE(SearchResultsContain(results, &wallStone));
+	EXPECT_TRUE(SearchResultsContain(results, &rock_stone));
+	EXPECT_GT(results[0].score, results[1].score);
+
+	results = index.Query("W", 10);
+	ASSERT_EQ(results.GetSize(), 2);
+	EXPECT_EQ(results[0].assetData, &wallStone);
+	EXPECT_EQ(results[1].assetData, &stoneWall);
+
+	EXPECT_TRUE(index.Query("xy", 10).IsEmpty());
+	EXPECT_TRUE(index.Query("   ", 10).IsEmpty());
+
+	TEST_END;
+}
+
+TEST(AssetSearchIndex, MultipleWords)
+{
+	TEST_BEGIN;
+
+	AssetData stoneWall = MakeSearchAsset("StoneWall", "/Game/Assets/StoneWall");
+	AssetData stoneFloor = MakeSearchAsset("StoneFloor", "/Game/Assets/StoneFloor");
+	AssetData woodWall = MakeSearchAsset("WoodWall", "/Game/Assets/WoodWall");
+	AssetData wallMesh = MakeSearchAsset("Wall", "/Game/Assets/Stone/Wall", "/Code/Engine.CE::StaticMesh");
+
+	AssetSearchIndex index{};
+	for (AssetData* assetData : { &stoneWall, &stoneFloor, &woodWall, &wallMesh })
+	{
+		index.AddAsset(assetData);
+	}
+
+	// Every word has to match, in any field
+	Array<AssetSearchIndex::Result> results = index.Query("stone wall", 10);
+	ASSERT_EQ(results.GetSize(), 2);
+	EXPECT_TRUE(SearchResultsContain(results, &stoneWall));
+	EXPECT_TRUE(SearchResultsContain(results, &wallMesh));
+
+	// Word order, case, repeated words & extra spaces don't matter
+	Array<AssetSearchIndex::Result> reordered = index.Query("  WALL\tStone stone ", 10);
+	ASSERT_EQ(reordered.GetSize(), results.GetSize());
+	for (int i = 0; i < results.GetSize(); i++)
+	{
+		EXPECT_EQ(reordered[i].assetData, results[i].assetData);
+		EXPECT_EQ(reordered[i].score, results[i].score);
+	}
+
+	results = index.Query("wall mesh", 10);
+	ASSERT_EQ(results.GetSize(), 1);
+	EXPECT_EQ(results[0].assetData, &wallMesh);
+
+	EXPECT_TRUE(index.Query("wood floor", 10).IsEmpty());
+
+	TEST_END;
+}
+
+TEST(AssetSearchIndex, ScoreOrder)
+{
+	TEST_BEGIN;
+
+	AssetData exact = MakeSearchAsset("Rock", "/Game/Assets/A/Rock");
+	AssetData prefix = MakeSearchAsset("RockWall", "/Game/Assets/A/RockWall");
+	AssetData wordStart = MakeSearchAsset("WallRock", "/Game/Assets/A/WallRock");
+	AssetData substring = MakeSearchAsset("Bedrock", "/Game/Assets/A/Bedrock");
+	AssetData type = MakeSearchAsset("Pebble", "/Game/Assets/A/Pebble", "/Code/Engine.CE::RockMaterial");
+	AssetData path = MakeSearchAsset("Gravel", "/Game/Assets/Rocks/Gravel");
+	AssetData editorAsset = MakeSearchAsset("Rock", "/Editor/Assets/Rock");
+
+	AssetSearchIndex index{};
+	for (AssetData* assetData : { &path, &type, &substring, &wordStart, &prefix, &exact })
+	{
+		index.AddAsset(assetData);
+	}
+
+	Array<AssetSearchIndex::Result> results = index.Query("rock", 10);
+	const AssetData* expectedOrder[] = { &exact, &prefix, &wordStart, &substring, &type, &path };
+
+	ASSERT_EQ(results.GetSize(), 6);
+	for (int i = 0; i < results.GetSize(); i++)
+	{
+		EXPECT_EQ(results[i].assetData, expectedOrder[i]);
+		if (i > 0)
+		{
+			EXPECT_LT(results[i].score, results[i - 1].score);
+		}
+	}
+
+	// The best results are kept
+	results = index.Query("rock", 2);
+	ASSERT_EQ(results.GetSize(), 2);
+	EXPECT_EQ(results[0].assetData, &exact);
+	EXPECT_EQ(results[1].assetData, &prefix);
+
+	// Ties go to the shorter name
+	AssetData longerPrefix = MakeSearchAsset("RockWallLarge", "/Game/Assets/A/RockWallLarge");
+	index.AddAsset(&longerPrefix);
+	results = index.Query("rockw", 10);
+	ASSERT_EQ(results.GetSize(), 2);
+	EXPECT_EQ(results[0].assetData, &prefix);
+	EXPECT_EQ(results[1].assetData, &longerPrefix);
+	EXPECT_EQ(results[0].score, results[1].score);
+
+	// Excluded paths are skipped before the results are cut, so they don't take the place of others
+	index.AddAsset(&editorAsset);
+	results = index.Query("rock", 2);
+	ASSERT_EQ(results.GetSize(), 2);
+	EXPECT_TRUE(SearchResultsContain(results, &editorAsset));
+
+	results = index.Query("rock", 2, "/Editor/");
+	ASSERT_EQ(results.GetSize(), 2);
+	EXPECT_EQ(results[0].assetData, &exact);
+	EXPECT_EQ(results[1].assetData, &prefix);
+
+	TEST_END;
+}
+
+TEST(AssetSearchIndex, MatchesBruteForce)
+{
+	TEST_BEGIN;
+
+	const char* materials[] = { "Stone", "Wood", "Metal", "Grass", "Noise", "Brick", "Sky", "Rust" };
+	const char* suffixes[] = { "Albedo", "Normal", "Roughness", "Mask", "01", "2K", "_Tiled", "" };
+	const char* folders[] = { "Textures", "Meshes", "Materials", "Environment/Rocks" };
+	const char* types[] = { "/Code/Engine.CE::Texture2D", "/Code/Engine.CE::StaticMesh", "/Code/Engine.CE::Material" };
+
+	constexpr int NumAssets = 600;
+
+	std::mt19937 random{ 1234 };
+
+	Array<AssetData> assets{};
+	assets.Resize(NumAssets);
+
+	for (int i = 0; i < NumAssets; i++)
+	{
+		String name = String(materials[random() % std::size(materials)]) + suffixes[random() % std::size(suffixes)];
+		if (random() % 3 == 0)
+		{
+			name += materials[random() % std::size(materials)];
+		}
+
+		String path = String::Format("/Game/Assets/{}/{}{}", folders[random() % std::size(folders)], name, i);
+
+		assets[i] = MakeSearchAsset(name, path, types[random() % std::size(types)]);
+	}
+
+	AssetSearchIndex index{};
+	for (AssetData& assetData : assets)
+	{
+		index.AddAsset(&assetData);
+	}
+
+	// Removed & re-added assets reuse document slots in a different order
+	for (int i = 0; i < NumAssets; i += 7)
+	{
+		index.RemoveAsset(&assets[i]);
+	}
+	for (int i = NumAssets - 1; i >= 0; i -= 14)
+	{
+		index.AddAsset(&assets[i]);
+	}
+
+	HashSet<AssetData*> indexedAssets{};
+	for (int i = 0; i < NumAssets; i++)
+	{
+		if (i % 7 != 0 || (NumAssets - 1 - i) % 14 == 0)
+			indexedAssets.Add(&assets[i]);
+	}
+
+	EXPECT_EQ(index.GetAssetCount(), (u32)indexedAssets.GetSize());
+
+	const char* queries[] = {
+		"stone", "st", "n", "2k", "tex", "mesh", "material", "rocks", "game", "ness",
+		"stone albedo", "al no", "wood 01", "metal mesh", "brick tiled", "sky sky", "rust roughness mask", "zzz", "tiled_"
+	};
+
+	for (const char* query : queries)
+	{
+		Array<std::string> words{};
+		{
+			std::istringstream stream{ String(query).ToLower().ToStdString() };
+			std::string word{};
+			while (stream >> word)
+			{
+				if (!words.Exists(word))
+					words.Add(word);
+			}
+		}
+
+		struct Expected
+		{
+			AssetData* assetData = nullptr;
+			u32 score = 0;
+		};
+
+		Array<Expected> expected{};
+		for (AssetData* assetData : indexedAssets)
+		{
+			u32 score = ScoreAssetBruteForce(*assetData, words);
+			if (score > 0)
+			{
+				expected.Add({ assetData, score });
+			}
+		}
+
+		std::sort(expected.begin(), expected.end(), [](const Expected& lhs, const Expected& rhs)
+			{
+				if (lhs.score != rhs.score)
+					return lhs.score > rhs.score;
+				return lhs.assetData->bundleName.GetString().GetLength() < rhs.assetData->bundleName.GetString().GetLength();
+			});
+
+		// Every match, then only the best ones. Ties between names of the same length can come in any order.
+		for (u32 maxResults : { (u32)NumAssets, 10u })
+		{
+			Array<AssetSearchIndex::Result> results = index.Query(query, maxResults);
+
+			ASSERT_EQ(results.GetSize(), Math::Min<u32>(maxResults, (u32)expected.GetSize())) << "Query: " << query;
+
+			for (int i = 0; i < results.GetSize(); i++)
+			{
+				EXPECT_EQ(results[i].score, expected[i].score) << "Query: " << query;
+				EXPECT_EQ(results[i].assetData->bundleName.GetString().GetLength(), expected[i].assetData->bundleName.GetString().GetLength()) << "Query: " << query;
+
+				u32 score = ScoreAssetBruteForce(*results[i].assetData, words);
+				EXPECT_EQ(results[i].score, score) << "Query: " << query << ", asset: " << results[i].assetData->bundlePath.GetString().ToStdString();
+			}
+		}
+	}
+
+	TEST_END;
+}
+
+#pragma endregion
@@ -83,6 +83,7 @@ namespace CE
 
     void FListView::OnModelUpdate()
     {
+        container->rowHeightsDirty = true;
         container->UpdateRows();
     }
 }
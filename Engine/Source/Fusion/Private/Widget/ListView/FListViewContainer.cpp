@@ -131,10 +131,9 @@ namespace CE
 
         if (listView->m_RowHeightDelegate.IsValid())
         {
-            for (int i = 0; i < rowCount; ++i)
-            {
-                totalRowHeight += listView->m_RowHeightDelegate(i);
-            }
+            UpdateRowHeights(listView, rowCount);
+
+            totalRowHeight = rowHeights.GetTotal();
         }
         else
         {
@@ -183,30 +182,33 @@ namespace CE
         Vec2 availableSize = computedSize - Vec2(m_Padding.left + m_Padding.right,
             m_Padding.top + m_Padding.bottom);
 
-        if (listView->m_RowHeightDelegate.IsValid())
-        {
+        const bool variableHeight = listView->m_RowHeightDelegate.IsValid();
 
-        }
-        else
+        for (int i = 0; i < children.GetCount(); ++i)
         {
-            for (int i = 0; i < children.GetCount(); ++i)
-            {
-                FListViewRow* child = children[i];
+            FListViewRow* child = children[i];
 
-                if (!child->Enabled())
-                    continue;
+            if (!child->Enabled())
+                continue;
 
-                f32 rowHeight = listView->m_RowHeight;
+            f32 rowHeight = listView->m_RowHeight;
 
+            if (variableHeight && child->rowIndex >= 0 && (u32)child->rowIndex < rowHeights.GetSize())
+            {
+                rowHeight = rowHeights.Get(child->rowIndex);
+                curPos.y = rowHeights.GetPrefixSum(child->rowIndex);
+            }
+            else
+            {
                 curPos.y = child->rowIndex * rowHeight;
+            }
 
-                child->SetComputedPosition(curPos);
-                child->SetComputedSize(Vec2(availableSize.x, Math::Max(rowHeight, child->GetIntrinsicSize().height)));
+            child->SetComputedPosition(curPos);
+            child->SetComputedSize(Vec2(availableSize.x, Math::Max(rowHeight, child->GetIntrinsicSize().height)));
 
-                child->PlaceSubWidgets();
+            child->PlaceSubWidgets();
 
-                //curPos.y += child->computedSize.y;
-            }
+            //curPos.y += child->computedSize.y;
         }
     }
 
@@ -280,77 +282,60 @@ namespace CE
         f32 curPosY = 0;
         f32 scrollY = -Translation().y;
 
-        if (listView->m_RowHeightDelegate.IsValid())
-        {
-            for (int i = 0; i < rowCount; ++i)
-            {
-                f32 rowHeight = 0;
-
-                rowHeight = listView->m_RowHeightDelegate(i);
-
-                f32 topY = curPosY;
-                f32 bottomY = curPosY + rowHeight;
-
-                if (bottomY + RowHideDistance < scrollY)
-                {
-                    continue; // Above the bounds
-                }
-                else if (topY > scrollY + computedSize.y + RowHideDistance)
-                {
-                    break; // Below the bounds
-                }
+        const bool variableHeight = listView->m_RowHeightDelegate.IsValid();
+        int startIndex = 0;
 
-                curPosY += rowHeight;
+        if (variableHeight)
+        {
+            UpdateRowHeights(listView, rowCount);
 
-                // TODO: Finish this
-            }
+            startIndex = (int)rowHeights.FindIndex(Math::Max(0.0f, scrollY - RowHideDistance));
+            curPosY = rowHeights.GetPrefixSum(startIndex);
         }
         else
         {
-            f32 rowHeight = listView->m_RowHeight;
-            int startIndex = Math::Max(0, (int)floor((scrollY - RowHideDistance) / rowHeight));
+            startIndex = Math::Max(0, (int)floor((scrollY - RowHideDistance) / listView->m_RowHeight));
+            curPosY = startIndex * listView->m_RowHeight;
+        }
 
-            curPosY = startIndex * rowHeight;
+        for (int rowIndex = startIndex; rowIndex < rowCount; rowIndex++)
+        {
+            f32 rowHeight = variableHeight ? rowHeights.Get(rowIndex) : listView->m_RowHeight;
+            f32 topY = curPosY;
 
-            for (int rowIndex = startIndex; rowIndex < rowCount; rowIndex++)
+            if (topY > scrollY + parent->GetComputedSize().y + RowHideDistance)
             {
-                f32 topY = curPosY;
-                f32 bottomY = curPosY + rowHeight;
-
-                if (topY > scrollY + parent->GetComputedSize().y + RowHideDistance)
-                {
-                    break; // Below the bounds
-                }
+                break; // Below the bounds
+            }
 
-                FListViewRow* rowWidget = nullptr;
+            FListViewRow* rowWidget = nullptr;
 
-                if (childIndex < children.GetCount())
-                {
-                    rowWidget = children[childIndex];
-                }
-                else
-                {
-                    rowWidget = &listView->m_GenerateRowCallback();
-                    children.Insert(rowWidget);
-                }
+            if (childIndex < children.GetCount())
+            {
+                rowWidget = children[childIndex];
+            }
+            else
+            {
+                rowWidget = &listView->m_GenerateRowCallback();
+                children.Insert(rowWidget);
+            }
 
-                rowWidget->SetParent(this);
-                rowWidget->rowIndex = rowIndex;
-                rowWidget->listView = listView;
-                rowWidget->isAlternate = rowIndex % 2 != 0;
-                rowWidget->isSelected = listView->selectedRows.Exists(rowIndex);
+            rowWidget->SetParent(this);
+            rowWidget->rowIndex = rowIndex;
+            rowWidget->listView = listView;
+            rowWidget->isAlternate = rowIndex % 2 != 0;
+            rowWidget->isSelected = listView->selectedRows.Exists(rowIndex);
 
-                Ref<FFusionContext> ctx = GetContext();
-                rowWidget->SetContextRecursively(ctx.Get());
-                rowWidget->ApplyStyleRecursively();
+            Ref<FFusionContext> ctx = GetContext();
+            rowWidget->SetContextRecursively(ctx.Get());
+            rowWidget->ApplyStyleRecursively();
 
-                rowWidget->Enabled(true);
+            rowWidget->Enabled(true);
 
-                childIndex++;
-                curPosY += rowHeight;
+            childIndex++;
+            curPosY += rowHeight;
 
-                model->SetData(rowIndex, *rowWidget);
-            }
+            model->SetData(rowIndex, *rowWidget);
         }
 
         while (childIndex < children.GetCount())
@@ -366,6 +351,26 @@ namespace CE
         MarkDirty();
     }
 
+    void FListViewContainer::UpdateRowHeights(const Ref<FListView>& listView, int rowCount)
+    {
+        ZoneScoped;
+
+        if (!rowHeightsDirty && rowHeights.GetSize() == (u32)rowCount)
+            return;
+
+        rowHeightsDirty = false;
+
+        Array<f32> heights;
+        heights.Resize(rowCount);
+
+        for (int i = 0; i < rowCount; ++i)
+        {
+            heights[i] = listView->m_RowHeightDelegate(i);
+        }
+
+        rowHeights.Build(heights);
+    }
+
     void FListViewContainer::OnSelectionChanged()
     {
 
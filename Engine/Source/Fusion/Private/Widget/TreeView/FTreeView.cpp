@@ -80,6 +80,8 @@ namespace CE
 
         static const CE::Name model = "Model";
         static const CE::Name indentation = "Indentation";
+        static const CE::Name rowHeight = "RowHeight";
+        static const CE::Name rowHeightDelegate = "RowHeightDelegate";
 
         if (propertyName == model)
         {
@@ -88,8 +90,16 @@ namespace CE
                 m_Model->treeView = this;
                 m_Model->OnTreeViewAssigned();
             }
+            if (container)
+            {
+                container->MarkRowIndexDirty();
+            }
             MarkLayoutDirty();
         }
+        else if ((propertyName == rowHeight || propertyName == rowHeightDelegate) && container)
+        {
+            container->MarkRowIndexDirty();
+        }
     }
 
     void FTreeView::OnRowRightClicked(FTreeViewRow& row, Vec2 mousePos)
@@ -127,6 +137,7 @@ namespace CE
 
     void FTreeView::OnModelUpdate()
     {
+        container->MarkRowIndexDirty();
         container->OnModelUpdate();
     }
 
@@ -89,6 +89,8 @@ namespace CE
                 parent = treeView->m_Model->GetParent(parent);
             }
         }
+
+        MarkRowIndexDirty();
     }
 
     void FTreeViewContainer::ExpandAllRows()
@@ -111,6 +113,133 @@ namespace CE
 
             visitor({});
         }
+
+        MarkRowIndexDirty();
+    }
+
+    void FTreeViewContainer::MarkRowIndexDirty()
+    {
+        rowIndexDirty = true;
+    }
+
+    f32 FTreeViewContainer::GetRowHeight(const FModelIndex& index)
+    {
+        if (!treeView->m_RowHeightDelegate.IsValid())
+        {
+            return treeView->m_RowHeight;
+        }
+
+        return treeView->m_RowHeightDelegate(index);
+    }
+
+    void FTreeViewContainer::GatherVisibleRows(const FModelIndex& parent, int indentLevel, Array<FlatRow>& outRows, Array<f32>& outHeights)
+    {
+        auto model = treeView->m_Model;
+
+        int rowCount = model->GetRowCount(parent);
+
+        for (int i = 0; i < rowCount; ++i)
+        {
+            FModelIndex index = model->GetIndex(i, 0, parent);
+            if (!index.IsValid())
+                continue;
+
+            FlatRow flatRow{};
+            flatRow.index = index;
+            flatRow.parent = parent;
+            flatRow.row = (u32)i;
+            flatRow.indentLevel = indentLevel;
+            flatRow.childrenCount = model->GetRowCount(index);
+
+            outRows.Add(flatRow);
+            outHeights.Add(GetRowHeight(index));
+
+            if (flatRow.childrenCount > 0 && expandedRows.Exists(index))
+            {
+                GatherVisibleRows(index, indentLevel + 1, outRows, outHeights);
+            }
+        }
+    }
+
+    void FTreeViewContainer::UpdateRowIndex()
+    {
+        ZoneScoped;
+
+        if (treeView == nullptr || treeView->m_Model == nullptr || !treeView->m_Model->IsReady())
+        {
+            flatRows.Clear();
+            rowHeights.Clear();
+            rootRowCount = 0;
+            return;
+        }
+
+        u32 curRootRowCount = treeView->m_Model->GetRowCount({});
+
+        if (!rowIndexDirty && curRootRowCount == rootRowCount)
+            return;
+
+        rowIndexDirty = false;
+        rootRowCount = curRootRowCount;
+
+        Array<f32> heights;
+        flatRows.Clear();
+
+        GatherVisibleRows({}, 0, flatRows, heights);
+
+        rowHeights.Build(heights);
+    }
+
+    void FTreeViewContainer::ToggleRowExpansion(const FModelIndex& index, int globalRowIdx)
+    {
+        ZoneScoped;
+
+        bool expand = !expandedRows.Exists(index);
+
+        if (expand)
+        {
+            expandedRows.Add(index);
+        }
+        else
+        {
+            expandedRows.Remove(index);
+        }
+
+        if (rowIndexDirty || globalRowIdx < 0 || globalRowIdx >= (int)flatRows.GetSize() ||
+            flatRows[globalRowIdx].index != index)
+        {
+            MarkRowIndexDirty();
+            MarkLayoutDirty();
+            return;
+        }
+
+        // Splice only the subtree of the toggled row instead of walking the whole model again
+
+        const FlatRow& flatRow = flatRows[globalRowIdx];
+        const u32 first = (u32)globalRowIdx + 1;
+
+        if (expand)
+        {
+            Array<FlatRow> newRows;
+            Array<f32> newHeights;
+
+            GatherVisibleRows(index, flatRow.indentLevel + 1, newRows, newHeights);
+
+            flatRows.InsertRange(first, newRows);
+            rowHeights.InsertRange(first, newHeights);
+        }
+        else
+        {
+            u32 end = first;
+            while (end < flatRows.GetSize() && flatRows[end].indentLevel > flatRow.indentLevel)
+            {
+                end++;
+            }
+
+            flatRows.RemoveRange(first, end - first);
+            rowHeights.RemoveRange(first, end - first);
+        }
+
+        MarkLayoutDirty();
     }
 
     Ref<FTreeViewRow> FTreeViewContainer::FindRow(const FModelIndex& index)
@@ -240,11 +369,11 @@ namespace CE
 
         auto model = treeView->m_Model;
 
+        UpdateRowIndex();
+
         int childIndex = 0;
-        f32 curPosY = 0;
         f32 scrollY = -Translation().y;
 		f32 scrollViewHeight = GetParent()->GetComputedSize().y;
-        int globalRowIdx = 0;
 
         if (treeView->header)
         {
@@ -254,158 +383,115 @@ namespace CE
         rowCache.Clear();
         globalRowIndexCache.Clear();
 
-        Delegate<void(const FModelIndex&, int)> visitor = [&](const FModelIndex& parent, int indentLevel) -> void
-			{
-				if (GetName() == "DebugContainer")
-				{
-                    String::IsAlphabet('a');
-				}
+        const u32 totalRows = flatRows.GetSize();
 
-                int rowCount = model->GetRowCount(parent);
-                if (rowCount == 0)
-                    return;
+        // Start one row above the first visible row, same as the margin used before.
+        u32 globalRowIdx = rowHeights.FindIndex(scrollY);
+        if (globalRowIdx > 0)
+            globalRowIdx--;
 
-                for (int i = 0; i < rowCount; ++i)
-                {
-                    FModelIndex index = model->GetIndex(i, 0, parent);
-                    if (!index.IsValid())
-                        continue;
+        f32 curPosY = rowHeights.GetPrefixSum(globalRowIdx);
 
-                    f32 rowHeight = 0;
+        f32 availWidth = treeView->GetComputedSize().width -
+            treeView->Padding().left - treeView->Padding().right -
+            Margin().left - Margin().right;
 
-                    if (!treeView->m_RowHeightDelegate.IsValid())
-                    {
-                        rowHeight = treeView->m_RowHeight;
-                    }
-                    else
-                    {
-                        rowHeight = treeView->m_RowHeightDelegate(index);
-                    }
+        Ref<FFusionContext> ctx = GetContext();
 
-                    const f32 topY = curPosY;
-                    const f32 bottomY = curPosY + rowHeight;
+        for (; globalRowIdx < totalRows; ++globalRowIdx)
+        {
+            const FlatRow& flatRow = flatRows[globalRowIdx];
+            const FModelIndex& index = flatRow.index;
+            const f32 rowHeight = rowHeights.Get(globalRowIdx);
+            const f32 topY = curPosY;
 
-                    int childrenCount = model->GetRowCount(index);
+            if (topY - rowHeight > scrollY + scrollViewHeight)
+            {
+                break; // We are below the scroll view
+            }
 
-                    if (bottomY + rowHeight < scrollY)
-                    {
-                        curPosY += rowHeight; // We are above the scroll view
-                        globalRowIdx++;
+            globalRowIndexCache[(int)globalRowIdx] = index;
 
-                        if (childrenCount > 0 && expandedRows.Exists(index))
-                        {
-                            visitor(index, indentLevel + 1);
-                        }
+            FTreeViewRow* rowWidget = nullptr;
+            if (childIndex < children.GetCount())
+            {
+                rowWidget = children[childIndex];
+            }
+            else
+            {
+                rowWidget = &treeView->m_GenerateRowDelegate();
+                children.Insert(rowWidget);
+            }
 
-                        continue;
-                    }
-                    else if (topY - rowHeight > scrollY + scrollViewHeight)
-                    {
-                        break; // We are below the scroll view
-                    }
+            rowCache[index] = rowWidget;
 
-                    globalRowIndexCache[globalRowIdx] = index;
+            rowWidget->SetParent(this);
+            rowWidget->index = index;
+            rowWidget->globalRowIdx = (int)globalRowIdx;
+            rowWidget->Enabled(true);
+            rowWidget->isAlternate = (globalRowIdx % 2 != 0);
+            rowWidget->treeView = treeView;
+            rowWidget->isHovered = false;
 
-                    FTreeViewRow* rowWidget = nullptr;
-                    if (childIndex < children.GetCount())
-                    {
-                        rowWidget = children[childIndex];
-                    }
-                    else
-                    {
-                        rowWidget = &treeView->m_GenerateRowDelegate();
-                        children.Insert(rowWidget);
-                    }
+            rowWidget->SetContextRecursively(ctx.Get());
+            rowWidget->ApplyStyleRecursively();
 
-                    rowCache[index] = rowWidget;
+            childIndex++;
+            curPosY += rowHeight;
 
-                    rowWidget->SetParent(this);
-                    rowWidget->index = index;
-					rowWidget->globalRowIdx = globalRowIdx;
-                    rowWidget->Enabled(true);
-                    rowWidget->isAlternate = (globalRowIdx % 2 != 0);
-                    rowWidget->treeView = treeView;
-                    rowWidget->isHovered = false;
+            model->SetData(flatRow.row, *rowWidget, flatRow.parent);
 
-                    Ref<FFusionContext> ctx = GetContext();
-                    rowWidget->SetContextRecursively(ctx.Get());
-                    rowWidget->ApplyStyleRecursively();
+            int headerCount = rowWidget->GetCellCount();
+            if (treeView->header)
+            {
+                headerCount = treeView->header->GetColumnCount();
+            }
 
-                    childIndex++;
-                    curPosY += rowHeight;
+            const int indentLevel = flatRow.indentLevel;
+            const int rowIdx = (int)globalRowIdx;
 
-                    model->SetData(i, *rowWidget, parent);
+            for (int c = 0; c < headerCount && c < rowWidget->GetCellCount(); ++c)
+            {
+                f32 minWidth = availWidth / Math::Min<f32>(headerCount, rowWidget->GetCellCount());
+                if (treeView->header)
+                {
+                    minWidth = treeView->header->GetColumn(c)->GetComputedSize().x;
+                }
+                rowWidget->Visible(true);
 
-                    int headerCount = rowWidget->GetCellCount();
-                    if (treeView->header)
-                    {
-                        headerCount = treeView->header->GetColumnCount();
-                    }
+                FTreeViewCell& cell = *rowWidget->GetCell(c);
 
-                    f32 availWidth = treeView->GetComputedSize().width -
-                        treeView->Padding().left - treeView->Padding().right -
-                        Margin().left - Margin().right;
+                cell
+                    .ArrowVisible(treeView->m_ExpandableColumn == c && flatRow.childrenCount > 0)
+                    .ArrowEnabled(treeView->m_ExpandableColumn == c)
+                    .ArrowExpanded(expandedRows.Exists(index))
+                    .OnToggleExpansion([index, rowIdx, this]
+                        {
+                            ToggleRowExpansion(index, rowIdx);
+                        })
+                    ;
 
-                    for (int c = 0; c < headerCount && c < rowWidget->GetCellCount(); ++c)
+                if (treeView->m_ExpandableColumn == c && indentLevel > 0)
+                {
+                    f32 indentOffset = treeView->m_Indentation * indentLevel;
+                    if (indentOffset < minWidth)
                     {
-                        f32 minWidth = availWidth / Math::Min<f32>(headerCount, rowWidget->GetCellCount());
-                        if (treeView->header)
-                        {
-                            minWidth = treeView->header->GetColumn(c)->GetComputedSize().x;
-                        }
-                        rowWidget->Visible(true);
-
-                        FTreeViewCell& cell = *rowWidget->GetCell(c);
-
-                        cell
-                            .ArrowVisible(treeView->m_ExpandableColumn == c && childrenCount > 0)
-                            .ArrowEnabled(treeView->m_ExpandableColumn == c)
-                            .ArrowExpanded(expandedRows.Exists(index))
-                            .OnToggleExpansion([index, this]
-                                {
-                                    if (!expandedRows.Exists(index))
-                                    {
-                                        expandedRows.Add(index);
-                                    }
-                                    else
-                                    {
-                                        expandedRows.Remove(index);
-                                    }
-                                    MarkLayoutDirty();
-                                })
-                            ;
-
-                        if (treeView->m_ExpandableColumn == c && indentLevel > 0)
-                        {
-                            f32 indentOffset = treeView->m_Indentation * indentLevel;
-                            if (indentOffset < minWidth)
-                            {
-                                cell.Margin(Vec4(indentOffset, 0, 0, 0));
-                                cell.Width(minWidth - indentOffset);
-                            }
-                            else
-                            {
-                                rowWidget->Visible(false);
-                            }
-                        }
-                        else
-                        {
-                            // Reset indentation
-                            cell.Margin(Vec4(0, 0, 0, 0));
-                            cell.Width(minWidth);
-                        }
+                        cell.Margin(Vec4(indentOffset, 0, 0, 0));
+                        cell.Width(minWidth - indentOffset);
                     }
-
-                    globalRowIdx++;
-
-                    if (childrenCount > 0 && expandedRows.Exists(index))
+                    else
                     {
-                        visitor(index, indentLevel + 1);
+                        rowWidget->Visible(false);
                     }
                 }
-            };
-
-        visitor(FModelIndex(), 0);
+                else
+                {
+                    // Reset indentation
+                    cell.Margin(Vec4(0, 0, 0, 0));
+                    cell.Width(minWidth);
+                }
+            }
+        }
 
         while (childIndex < children.GetCount())
         {
@@ -438,39 +524,10 @@ namespace CE
 
         Vec2 contentSize = Vec2();
 
-        auto model = treeView->m_Model;
-
-        totalRowHeight = 0;
-
-        Delegate<void(const FModelIndex&)> visitor = [&](const FModelIndex& parent) -> void
-            {
-                ZoneScoped;
-
-                int rowCount = model->GetRowCount(parent);
-                if (rowCount == 0)
-                    return;
-
-                for (int i = 0; i < rowCount; ++i)
-                {
-                    FModelIndex index = model->GetIndex(i, 0, parent);
-
-                    if (!treeView->m_RowHeightDelegate.IsValid())
-                    {
-	                    totalRowHeight += treeView->m_RowHeight;
-                    }
-                    else
-                    {
-                        totalRowHeight += treeView->m_RowHeightDelegate(index);
-                    }
+        UpdateRowIndex();
 
-                    if (expandedRows.Exists(index))
-                    {
-                        visitor(index);
-                    }
-                }
-            };
+        totalRowHeight = rowHeights.GetTotal();
 
-        visitor(FModelIndex());
         if (treeView->AutoHeight())
         {
             contentSize.height = totalRowHeight;
@@ -486,15 +543,7 @@ namespace CE
 
             if (!treeView->AutoHeight())
             {
-                f32 rowHeight = 0;
-                if (!treeView->m_RowHeightDelegate.IsValid())
-                {
-                    rowHeight = treeView->m_RowHeight;
-                }
-                else
-                {
-                    rowHeight = treeView->m_RowHeightDelegate(children[i]->index);
-                }
+                f32 rowHeight = GetRowHeight(children[i]->index);
 
                 contentSize.height += Math::Max(rowHeight, children[i]->GetIntrinsicSize().height);
             }
@@ -550,27 +599,13 @@ namespace CE
             {
 				isFirst = false;
 
-                if (treeView->m_RowHeightDelegate.IsValid())
-                {
-                    for (int j = 0; j < child->globalRowIdx; j++)
-                    {
-						// TODO: Add rowHeight for all rows above this one.
-                    }
-                }
-                else
-                {
-					curPos.y += child->globalRowIdx * treeView->m_RowHeight;
-                }
+                curPos.y += rowHeights.GetPrefixSum((u32)child->globalRowIdx);
             }
 
-            f32 rowHeight = 0;
-            if (!treeView->m_RowHeightDelegate.IsValid())
-            {
-                rowHeight = treeView->m_RowHeight;
-            }
-            else
+            f32 rowHeight = GetRowHeight(child->index);
+            if (child->globalRowIdx >= 0 && (u32)child->globalRowIdx < rowHeights.GetSize())
             {
-                rowHeight = treeView->m_RowHeightDelegate(child->index);
+                rowHeight = rowHeights.Get((u32)child->globalRowIdx);
             }
 
             Vec2 childPos = curPos + Vec2(child->Margin().left, child->Margin().top);
@@ -39,6 +39,9 @@ namespace CE
 
         void UpdateRows();
 
+        //! @brief Rebuilds the row height prefix sums if the model changed. Only used with a row height delegate.
+        void UpdateRowHeights(const Ref<FListView>& listView, int rowCount);
+
         void OnSelectionChanged();
 
         using ListViewRowList = StableDynamicArray<FListViewRow*, 64, false>;
@@ -48,6 +51,9 @@ namespace CE
 
         f32 totalRowHeight = 0;
 
+        FenwickTree<f32> rowHeights;
+        bool rowHeightsDirty = true;
+
     public: // - Fusion Properties - 
 
         Self& ListView(Ref<FListView> listView);
@@ -39,6 +39,9 @@ namespace CE
 
         Ref<FTreeViewRow> FindRow(const FModelIndex& index);
 
+        //! @brief Forces the flattened row index to be rebuilt from the model on next update.
+        void MarkRowIndexDirty();
+
     protected:
 
         FTreeViewContainer();
@@ -57,6 +60,24 @@ namespace CE
             return *this;
         }
 
+        //! @brief A visible (i.e. all ancestors expanded) row in depth-first order.
+        struct FlatRow
+        {
+            FModelIndex index{};
+            FModelIndex parent{};
+            u32 row = 0;
+            int indentLevel = 0;
+            int childrenCount = 0;
+        };
+
+        void UpdateRowIndex();
+
+        void GatherVisibleRows(const FModelIndex& parent, int indentLevel, Array<FlatRow>& outRows, Array<f32>& outHeights);
+
+        void ToggleRowExpansion(const FModelIndex& index, int globalRowIdx);
+
+        f32 GetRowHeight(const FModelIndex& index);
+
         using TreeViewRowList = StableDynamicArray<FTreeViewRow*, 64, false>;
         using TreeViewHashMap = HashMap<FModelIndex, FTreeViewRow*>;
 		using TreeViewGlobalRowIndexCache = HashMap<int, FModelIndex>;
@@ -66,6 +87,13 @@ namespace CE
         TreeViewHashMap rowCache;
 		TreeViewGlobalRowIndexCache globalRowIndexCache;
         HashSet<FModelIndex> expandedRows;
+
+        //! Flattened list of visible rows, and a fenwick tree of their heights for O(log N) scroll lookups.
+        Array<FlatRow> flatRows;
+        FenwickTree<f32> rowHeights;
+        u32 rootRowCount = 0;
+        bool rowIndexDirty = true;
+
         Vec2 modelUpdateComputedSize;
         f32 totalRowHeight = 0;
         bool isScrollHovered = false;
@@ -44,6 +44,7 @@ namespace CE
 		{
 			layoutDirty = false;
 			dirty = true;
+			layoutVersion++;
 
 			owningWidget->CalculateIntrinsicSize();
 
@@ -122,8 +122,24 @@ namespace CE
 			dropTarget = nullptr;
 		}
 
-		if (!hoveredWidgetStack.IsEmpty() && hoveredWidgetStack.Top() != hoveredWidget &&
-			(hoveredWidget == nullptr || !hoveredWidget->ParentExistsRecursive(hoveredWidgetStack.Top().Get())))
+		// - Hover state -
+		// The hovered widget stack holds the hovered widget's ancestors, root first. Diff it against the new chain
+		// so that only the widgets whose hover state changed receive MouseLeave & MouseEnter events.
+
+		hoveredWidgetChain.Clear();
+		for (FWidget* widget = hoveredWidget.Get(); widget != nullptr; widget = widget->parent.Get())
+		{
+			hoveredWidgetChain.Add(widget);
+		}
+
+		int numCommonWidgets = 0;
+		while (numCommonWidgets < hoveredWidgetStack.GetSize() && numCommonWidgets < hoveredWidgetChain.GetSize() &&
+			hoveredWidgetStack[numCommonWidgets] == hoveredWidgetChain[hoveredWidgetChain.GetSize() - 1 - numCommonWidgets])
+		{
+			numCommonWidgets++;
+		}
+
+		if (hoveredWidgetStack.GetSize() > numCommonWidgets)
 		{
 			FMouseEvent event{};
 			event.type = FEventType::MouseLeave;
@@ -134,7 +150,7 @@ namespace CE
 			event.isInside = true;
 			event.keyModifiers = keyModifierStates;
 
-			while (hoveredWidgetStack.NotEmpty() && (hoveredWidget == nullptr || (hoveredWidget != nullptr && !hoveredWidget->ParentExistsRecursive(hoveredWidgetStack.Top().Get()))))
+			while (hoveredWidgetStack.GetSize() > numCommonWidgets)
 			{
 				event.sender = hoveredWidgetStack.Top().Get();
 				event.Reset();
@@ -154,9 +170,7 @@ namespace CE
 			}
 		}
 
-		if (hoveredWidget != nullptr &&
-			(hoveredWidgetStack.IsEmpty() || hoveredWidgetStack.Top() != hoveredWidget) &&
-			(hoveredWidgetStack.IsEmpty() || !hoveredWidgetStack.Top()->ParentExistsRecursive(hoveredWidget.Get())))
+		if (hoveredWidgetChain.GetSize() > numCommonWidgets)
 		{
 			FMouseEvent event{};
 			event.type = FEventType::MouseEnter;
@@ -168,16 +182,10 @@ namespace CE
 			event.keyModifiers = keyModifierStates;
 
 			int idx = hoveredWidgetStack.GetSize();
-			FWidget* basePrevWidget = nullptr;
-			if (hoveredWidgetStack.NotEmpty())
-				basePrevWidget = hoveredWidgetStack.Top().Get();
-
-			auto widget = hoveredWidget;
 
-			while ((hoveredWidgetStack.IsEmpty() || widget != basePrevWidget) && widget != nullptr)
+			for (int i = hoveredWidgetChain.GetSize() - 1 - numCommonWidgets; i >= 0; --i)
 			{
-				hoveredWidgetStack.InsertAt(idx, widget);
-				widget = widget->parent.Get();
+				hoveredWidgetStack.Add(hoveredWidgetChain[i]);
 			}
 
 			for (int i = idx; i < hoveredWidgetStack.GetSize(); ++i)
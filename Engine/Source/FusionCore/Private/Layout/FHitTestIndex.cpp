@@ -0,0 +1,130 @@
+#include "FusionCore.h"
+
+namespace CE
+{
+    static Rect UnionRect(const Rect& a, const Rect& b)
+    {
+        return Rect(Math::Min(a.left, b.left), Math::Min(a.top, b.top), Math::Max(a.right, b.right), Math::Max(a.bottom, b.bottom));
+    }
+
+    void FHitTestIndex::Build(const Array<Rect>& rects)
+    {
+        ZoneScoped;
+
+        Clear();
+
+        items.Reserve(rects.GetSize());
+
+        for (int i = 0; i < rects.GetSize(); i++)
+        {
+            const Rect& rect = rects[i];
+
+            // Empty & inverted rects can never contain a point
+            if (rect.right < rect.left || rect.bottom < rect.top)
+                continue;
+
+            items.Add({ rect, (u32)i });
+        }
+
+        if (items.IsEmpty())
+            return;
+
+        nodes.Reserve(items.GetSize() * 2 / MaxLeafSize + 1);
+        BuildRecursive(0, items.GetSize());
+    }
+
+    u32 FHitTestIndex::BuildRecursive(u32 first, u32 count)
+    {
+        u32 nodeIndex = nodes.GetSize();
+        nodes.Add({});
+
+        Rect bounds = items[first].rect;
+        Rect centerBounds = Rect(items[first].rect.min + items[first].rect.max, items[first].rect.min + items[first].rect.max);
+
+        for (u32 i = first + 1; i < first + count; i++)
+        {
+            bounds = UnionRect(bounds, items[i].rect);
+
+            Vec2 center = items[i].rect.min + items[i].rect.max;
+            centerBounds = UnionRect(centerBounds, Rect(center, center));
+        }
+
+        if (count <= MaxLeafSize)
+        {
+            Node& leaf = nodes[nodeIndex];
+            leaf.bounds = bounds;
+            leaf.offset = first;
+            leaf.count = count;
+            return nodeIndex;
+        }
+
+        // Median split along the longest axis of the rect centers. Widgets are mostly laid out in rows and columns,
+        // so this keeps siblings that are next to each other in the same subtree.
+        Vec2 centerExtent = centerBounds.GetSize();
+        int axis = centerExtent.x >= centerExtent.y ? 0 : 1;
+        u32 half = count / 2;
+
+        Item* begin = items.GetData() + first;
+
+        std::nth_element(begin, begin + half, begin + count,
+            [axis](const Item& lhs, const Item& rhs)
+            {
+                if (axis == 0)
+                    return lhs.rect.left + lhs.rect.right < rhs.rect.left + rhs.rect.right;
+                return lhs.rect.top + lhs.rect.bottom < rhs.rect.top + rhs.rect.bottom;
+            });
+
+        BuildRecursive(first, half);
+        u32 secondChild = BuildRecursive(first + half, count - half);
+
+        // The recursion may have reallocated the nodes
+        Node& node = nodes[nodeIndex];
+        node.bounds = bounds;
+        node.offset = secondChild;
+        node.count = 0;
+
+        return nodeIndex;
+    }
+
+    void FHitTestIndex::Query(Vec2 point, Array<u32>& outIndices) const
+    {
+        if (nodes.IsEmpty())
+            return;
+
+        // Depth is logarithmic, a fixed stack is plenty
+        u32 stack[64];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const Node& node = nodes[stack[--stackSize]];
+
+            if (!node.bounds.Contains(point))
+                continue;
+
+            if (node.count > 0)
+            {
+                for (u32 i = node.offset; i < node.offset + node.count; i++)
+                {
+                    if (items[i].rect.Contains(point))
+                    {
+                        outIndices.Add(items[i].index);
+                    }
+                }
+                continue;
+            }
+
+            u32 firstChild = (u32)(&node - nodes.GetData()) + 1;
+            stack[stackSize++] = firstChild;
+            stack[stackSize++] = node.offset;
+        }
+    }
+
+    void FHitTestIndex::Clear()
+    {
+        nodes.Clear();
+        items.Clear();
+    }
+
+} // namespace CE
@@ -25,10 +25,12 @@ namespace CE
 
     FImageAtlas::ImageItem FImageAtlas::FindImage(const Name& imageName)
     {
-        if (!imagesByName.KeyExists(imageName))
+        auto it = imagesByName.Find(imageName);
+        if (it == imagesByName.End())
             return {};
 
-        return imagesByName[imageName];
+        it->second.lastUsedFrame = frameCounter;
+        return it->second.item;
     }
 
     void FImageAtlas::Init()
@@ -38,10 +40,11 @@ namespace CE
         if (atlasLayers.NotEmpty())
             return;
 
-        Ptr<FAtlasImage> atlas = new FAtlasImage(atlasSize);
+        Ptr<FAtlasImage> atlas = new FAtlasImage(atlasSize, useSkylinePacker);
         atlas->layerIndex = 0;
 
         atlasLayers.Add(atlas);
+        layerCapacity = 1;
 
         Array<String> pages = GetPages();
         pages.Add(String::Format("Page {}", pages.GetSize()));
@@ -54,38 +57,20 @@ namespace CE
         auto perDrawSrgLayout = fusionShader->GetDefaultVariant()->GetSrgLayout(RHI::SRGType::PerDraw);
         textureSrg = RHI::gDynamicRHI->CreateShaderResourceGroup(perDrawSrgLayout);
 
-        RPI::TextureDescriptor textureDescriptor{};
-        textureDescriptor.texture.width = textureDescriptor.texture.height = atlasSize;
-        textureDescriptor.texture.sampleCount = 1;
-        textureDescriptor.texture.depth = 1;
-        textureDescriptor.texture.dimension = Dimension::Dim2DArray;
-        textureDescriptor.texture.arrayLayers = atlasLayers.GetSize();
-        textureDescriptor.texture.mipLevels = 1;
-        textureDescriptor.texture.bindFlags = TextureBindFlags::ShaderRead;
-        textureDescriptor.texture.format = Format::R8G8B8A8_UNORM;
-        textureDescriptor.texture.defaultHeapType = MemoryHeapType::Upload;
-
-        textureDescriptor.samplerDesc.addressModeU = SamplerAddressMode::ClampToBorder;
-        textureDescriptor.samplerDesc.addressModeV = SamplerAddressMode::ClampToBorder;
-        textureDescriptor.samplerDesc.addressModeW = SamplerAddressMode::ClampToBorder;
-        textureDescriptor.samplerDesc.borderColor = SamplerBorderColor::FloatTransparentBlack;
-        textureDescriptor.samplerDesc.enableAnisotropy = false;
-        textureDescriptor.samplerDesc.samplerFilterMode = FilterMode::Linear;
-
         for (int i = 0; i < atlasTexturesPerFrame.GetSize(); ++i)
         {
-            textureDescriptor.texture.name = String::Format("Fusion Image Atlas {}", i);
-
-            atlasTexturesPerFrame[i] = new RPI::Texture(textureDescriptor);
+            atlasTexturesPerFrame[i] = nullptr;
+            CreateAtlasTexture(i);
 
-            textureSrg->Bind(i, "_Texture", atlasTexturesPerFrame[i]->GetRhiTexture());
-            textureSrg->Bind(i, "_TextureSampler", atlasTexturesPerFrame[i]->GetSamplerState());
+            flushRequiredPerImage[i] = true;
+            fullCopyRequiredPerImage[i] = true;
+            dirtyRegionsPerImage[i].Clear();
         }
 
         RHI::BufferDescriptor stagingDesc{};
         stagingDesc.name = "Staging Buffer";
         stagingDesc.bindFlags = RHI::BufferBindFlags::StagingBuffer;
-        stagingDesc.bufferSize = atlasSize * atlasSize * sizeof(u32) * atlasLayers.GetSize();
+        stagingDesc.bufferSize = (u64)atlasSize * atlasSize * sizeof(u32) * layerCapacity;
         stagingDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
 
         stagingBuffer = RHI::gDynamicRHI->CreateBuffer(stagingDesc);
@@ -136,17 +121,20 @@ namespace CE
         {
             delete atlasTexturesPerFrame[i];
             atlasTexturesPerFrame[i] = nullptr;
+
+            dirtyRegionsPerImage[i].Clear();
         }
 
     	atlasLayers.Clear();
         imagesByName.Clear();
+        layerCapacity = 0;
     }
 
     void FImageAtlas::UpdateImageAtlasItems()
     {
 	    for (int i = 0; i < atlasLayers.GetSize(); ++i)
 	    {
-            imagesByName[String::Format("__ImageAtlas_{}", i)] = ImageItem{
+            imagesByName[String::Format("__ImageAtlas_{}", i)].item = ImageItem{
                 .layerIndex = i,
                 .uvMin = Vec2(0, 0),
                 .uvMax = Vec2(1, 1),
@@ -156,44 +144,165 @@ namespace CE
 	    }
     }
 
+    void FImageAtlas::CreateAtlasTexture(u32 imageIndex)
+    {
+        RPI::TextureDescriptor textureDescriptor{};
+        textureDescriptor.texture.width = textureDescriptor.texture.height = atlasSize;
+        textureDescriptor.texture.sampleCount = 1;
+        textureDescriptor.texture.depth = 1;
+        textureDescriptor.texture.dimension = Dimension::Dim2DArray;
+        textureDescriptor.texture.arrayLayers = layerCapacity;
+        textureDescriptor.texture.name = String::Format("Fusion Image Atlas {}", imageIndex);
+        textureDescriptor.texture.mipLevels = 1;
+        textureDescriptor.texture.bindFlags = TextureBindFlags::ShaderRead;
+        textureDescriptor.texture.format = Format::R8G8B8A8_UNORM;
+        textureDescriptor.texture.defaultHeapType = MemoryHeapType::Upload;
+
+        textureDescriptor.samplerDesc.addressModeU = SamplerAddressMode::ClampToBorder;
+        textureDescriptor.samplerDesc.addressModeV = SamplerAddressMode::ClampToBorder;
+        textureDescriptor.samplerDesc.addressModeW = SamplerAddressMode::ClampToBorder;
+        textureDescriptor.samplerDesc.borderColor = SamplerBorderColor::FloatTransparentBlack;
+        textureDescriptor.samplerDesc.enableAnisotropy = false;
+        textureDescriptor.samplerDesc.samplerFilterMode = FilterMode::Linear;
+
+        delete atlasTexturesPerFrame[imageIndex];
+
+        atlasTexturesPerFrame[imageIndex] = new RPI::Texture(textureDescriptor);
+
+        textureSrg->Bind(imageIndex, "_Texture", atlasTexturesPerFrame[imageIndex]->GetRhiTexture());
+        textureSrg->Bind(imageIndex, "_TextureSampler", atlasTexturesPerFrame[imageIndex]->GetSamplerState());
+    }
+
+    void FImageAtlas::GrowLayerCapacity(u32 layerCount)
+    {
+        if (layerCount <= layerCapacity)
+            return;
+
+        u32 newCapacity = Math::Max<u32>(layerCapacity * 2, layerCount);
+        if (maxArrayLayers > 0)
+        {
+            newCapacity = Math::Max<u32>(Math::Min<u32>(newCapacity, maxArrayLayers), layerCount);
+        }
+
+        RHI::BufferDescriptor stagingDesc{};
+        stagingDesc.name = "Staging Buffer";
+        stagingDesc.bindFlags = RHI::BufferBindFlags::StagingBuffer;
+        stagingDesc.bufferSize = (u64)atlasSize * atlasSize * sizeof(u32) * newCapacity;
+        stagingDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
+
+        RHI::Buffer* newStagingBuffer = RHI::gDynamicRHI->CreateBuffer(stagingDesc);
+
+        void* data;
+        stagingBuffer->Map(0, stagingBuffer->GetBufferSize(), &data);
+        {
+            newStagingBuffer->UploadData(data, stagingBuffer->GetBufferSize());
+        }
+        stagingBuffer->Unmap();
+
+        RHI::gDynamicRHI->DestroyBuffer(stagingBuffer);
+        stagingBuffer = newStagingBuffer;
+
+        layerCapacity = newCapacity;
+
+        // Textures are recreated lazily in Flush()
+        for (int i = 0; i < flushRequiredPerImage.GetSize(); ++i)
+        {
+            flushRequiredPerImage[i] = true;
+        }
+    }
+
+    void FImageAtlas::AddDirtyRegion(int layerIndex, Vec2i offset, Vec2i size)
+    {
+        if (size.width <= 0 || size.height <= 0)
+            return;
+
+        for (int i = 0; i < dirtyRegionsPerImage.GetSize(); ++i)
+        {
+            flushRequiredPerImage[i] = true;
+
+            if (fullCopyRequiredPerImage[i])
+                continue;
+
+            Array<DirtyRegion>& dirtyRegions = dirtyRegionsPerImage[i];
+
+            if (dirtyRegions.GetSize() < MaxDirtyRegionsPerImage)
+            {
+                dirtyRegions.Add(DirtyRegion{ .layerIndex = layerIndex, .offset = offset, .size = size });
+                continue;
+            }
+
+            // Too many small copies: collapse into one bounding region per layer
+            Array<DirtyRegion> mergedRegions;
+            dirtyRegions.Add(DirtyRegion{ .layerIndex = layerIndex, .offset = offset, .size = size });
+
+            for (const DirtyRegion& region : dirtyRegions)
+            {
+                DirtyRegion* merged = nullptr;
+                for (DirtyRegion& candidate : mergedRegions)
+                {
+                    if (candidate.layerIndex == region.layerIndex)
+                    {
+                        merged = &candidate;
+                        break;
+                    }
+                }
+
+                if (merged == nullptr)
+                {
+                    mergedRegions.Add(region);
+                    continue;
+                }
+
+                Vec2i min = Vec2i(Math::Min(merged->offset.x, region.offset.x), Math::Min(merged->offset.y, region.offset.y));
+                Vec2i max = Vec2i(Math::Max(merged->offset.x + merged->size.x, region.offset.x + region.size.x),
+                    Math::Max(merged->offset.y + merged->size.y, region.offset.y + region.size.y));
+
+                merged->offset = min;
+                merged->size = max - min;
+            }
+
+            dirtyRegions = mergedRegions;
+        }
+    }
+
     void FImageAtlas::Flush(u32 imageIndex)
     {
         ZoneScoped;
 
+        frameCounter++;
+
+        if (imagesEvicted)
+        {
+            imagesEvicted = false;
+
+            // Widgets that are not repainted every frame may still reference evicted images
+            if (FRootContext* rootContext = FusionApplication::Get()->GetRootContext())
+            {
+                rootContext->MarkDirty();
+            }
+        }
+
         if (!flushRequiredPerImage[imageIndex])
             return;
 
-        if (atlasTexturesPerFrame[imageIndex]->GetRhiTexture()->GetArrayLayerCount() != atlasLayers.GetSize())
+        if (atlasTexturesPerFrame[imageIndex]->GetRhiTexture()->GetArrayLayerCount() != layerCapacity)
         {
-            RPI::TextureDescriptor textureDescriptor{};
-            textureDescriptor.texture.width = textureDescriptor.texture.height = atlasSize;
-            textureDescriptor.texture.sampleCount = 1;
-            textureDescriptor.texture.depth = 1;
-            textureDescriptor.texture.dimension = Dimension::Dim2DArray;
-            textureDescriptor.texture.arrayLayers = atlasLayers.GetSize();
-            textureDescriptor.texture.name = String::Format("Fusion Image Atlas {}", imageIndex);
-            textureDescriptor.texture.mipLevels = 1;
-            textureDescriptor.texture.bindFlags = TextureBindFlags::ShaderRead;
-            textureDescriptor.texture.format = Format::R8G8B8A8_UNORM;
-            textureDescriptor.texture.defaultHeapType = MemoryHeapType::Upload;
+            CreateAtlasTexture(imageIndex);
+
+            textureSrg->FlushBindings();
 
-            textureDescriptor.samplerDesc.addressModeU = SamplerAddressMode::ClampToBorder;
-            textureDescriptor.samplerDesc.addressModeV = SamplerAddressMode::ClampToBorder;
-            textureDescriptor.samplerDesc.addressModeW = SamplerAddressMode::ClampToBorder;
-            textureDescriptor.samplerDesc.borderColor = SamplerBorderColor::FloatTransparentBlack;
-            textureDescriptor.samplerDesc.enableAnisotropy = false;
-            textureDescriptor.samplerDesc.samplerFilterMode = FilterMode::Linear;
+            fullCopyRequiredPerImage[imageIndex] = true;
+        }
 
-            delete atlasTexturesPerFrame[imageIndex];
+        bool fullCopy = fullCopyRequiredPerImage[imageIndex];
+        Array<DirtyRegion>& dirtyRegions = dirtyRegionsPerImage[imageIndex];
 
-            atlasTexturesPerFrame[imageIndex] = new RPI::Texture(textureDescriptor);
-            
-            textureSrg->Bind(imageIndex, "_Texture", atlasTexturesPerFrame[imageIndex]->GetRhiTexture());
-            textureSrg->Bind(imageIndex, "_TextureSampler", atlasTexturesPerFrame[imageIndex]->GetSamplerState());
+        if (!fullCopy && dirtyRegions.IsEmpty())
+        {
+            flushRequiredPerImage[imageIndex] = false;
+            return;
         }
 
-        textureSrg->FlushBindings();
-        
         // Copy data to image
         {
             RPI::Texture* atlasTexture = atlasTexturesPerFrame[imageIndex];
@@ -209,21 +318,46 @@ namespace CE
                 barrier.toState = ResourceState::CopySource;
                 commandList->ResourceBarrier(1, &barrier);
 
+                // Partial copies must preserve the existing contents of the texture
                 barrier.resource = atlasRhiTexture;
-                barrier.fromState = ResourceState::Undefined;
+                barrier.fromState = fullCopy ? ResourceState::Undefined : ResourceState::FragmentShaderResource;
                 barrier.toState = ResourceState::CopyDestination;
                 commandList->ResourceBarrier(1, &barrier);
 
-                RHI::BufferToTextureCopy copy{};
-                copy.dstTexture = atlasRhiTexture;
-                copy.mipSlice = 0;
-                copy.baseArrayLayer = 0;
-                copy.layerCount = atlasLayers.GetSize();
+                if (fullCopy)
+                {
+                    RHI::BufferToTextureCopy copy{};
+                    copy.dstTexture = atlasRhiTexture;
+                    copy.mipSlice = 0;
+                    copy.baseArrayLayer = 0;
+                    copy.layerCount = layerCapacity;
 
-            	copy.srcBuffer = stagingBuffer;
-                copy.bufferOffset = 0;
+                    copy.srcBuffer = stagingBuffer;
+                    copy.bufferOffset = 0;
 
-                commandList->CopyTextureRegion(copy);
+                    commandList->CopyTextureRegion(copy);
+                }
+                else
+                {
+                    for (const DirtyRegion& region : dirtyRegions)
+                    {
+                        RHI::BufferToTextureCopy copy{};
+                        copy.dstTexture = atlasRhiTexture;
+                        copy.mipSlice = 0;
+                        copy.baseArrayLayer = region.layerIndex;
+                        copy.layerCount = 1;
+                        copy.dstOffset = Vec3i(region.offset.x, region.offset.y, 0);
+                        copy.dstExtent = Vec3i(region.size.x, region.size.y, 1);
+
+                        copy.srcBuffer = stagingBuffer;
+                        copy.bufferOffset = ((u64)region.layerIndex * atlasSize * atlasSize +
+                            (u64)region.offset.y * atlasSize + (u64)region.offset.x) * sizeof(u32);
+                        copy.bufferRowLength = atlasSize;
+                        copy.bufferImageHeight = atlasSize;
+
+                        commandList->CopyTextureRegion(copy);
+                    }
+                }
 
                 barrier.resource = atlasRhiTexture;
                 barrier.fromState = ResourceState::CopyDestination;
@@ -237,10 +371,58 @@ namespace CE
             stagingBufferFence->WaitForFence();
         }
 
+        dirtyRegions.Clear();
+        fullCopyRequiredPerImage[imageIndex] = false;
         flushRequiredPerImage[imageIndex] = false;
     }
 
-    FImageAtlas::ImageItem FImageAtlas::AddImage(const Name& name, const CMImage& imageSource)
+    Ptr<FImageAtlas::BinaryNode> FImageAtlas::EvictAndInsert(Vec2i imageSize, Ptr<FAtlasImage>& outAtlas)
+    {
+        ZoneScoped;
+
+        struct Candidate
+        {
+            Name imageName;
+            u64 lastUsedFrame = 0;
+        };
+
+        Array<Candidate> candidates;
+
+        for (const auto& [imageName, entry] : imagesByName)
+        {
+            if (entry.evictable && entry.lastUsedFrame + evictionMinFrames <= frameCounter)
+            {
+                candidates.Add(Candidate{ .imageName = imageName, .lastUsedFrame = entry.lastUsedFrame });
+            }
+        }
+
+        candidates.Sort([](const Candidate& lhs, const Candidate& rhs)
+            {
+                return lhs.lastUsedFrame < rhs.lastUsedFrame;
+            });
+
+        for (const Candidate& candidate : candidates)
+        {
+            int layerIndex = imagesByName[candidate.imageName].item.layerIndex;
+
+            if (!RemoveImage(candidate.imageName))
+                continue;
+
+            imagesEvicted = true;
+
+            Ptr<FAtlasImage> atlas = atlasLayers[layerIndex];
+            Ptr<BinaryNode> node = atlas->Insert(imageSize);
+            if (node != nullptr)
+            {
+                outAtlas = atlas;
+                return node;
+            }
+        }
+
+        return nullptr;
+    }
+
+    FImageAtlas::ImageItem FImageAtlas::AddImage(const Name& name, const CMImage& imageSource, bool evictable)
     {
         if (!name.IsValid() || !imageSource.IsValid() || imagesByName.KeyExists(name))
         {
@@ -265,7 +447,6 @@ namespace CE
         }
 
         Vec2i textureSize = Vec2i(imageSource.GetWidth(), imageSource.GetHeight());
-        u32 textureArea = textureSize.width * textureSize.height;
 
         Ptr<FAtlasImage> foundAtlas = nullptr;
         Ptr<BinaryNode> insertNode = nullptr;
@@ -274,14 +455,7 @@ namespace CE
         {
             Ptr<FAtlasImage> atlas = atlasLayers[i];
 
-            insertNode = atlas->root->Insert(textureSize);
-
-            if (insertNode == nullptr && atlas->root->GetFreeArea() > textureArea * 2)
-            {
-                atlas->root->DefragmentSlow();
-                
-                insertNode = atlas->root->Insert(textureSize);
-            }
+            insertNode = atlas->Insert(textureSize);
 
             if (insertNode != nullptr)
             {
@@ -290,9 +464,14 @@ namespace CE
             }
         }
 
+        if (insertNode == nullptr && maxArrayLayers > 0 && atlasLayers.GetSize() >= maxArrayLayers)
+        {
+            insertNode = EvictAndInsert(textureSize, foundAtlas);
+        }
+
         if (insertNode == nullptr) // Need to create a new atlas layer
         {
-            Ptr<FAtlasImage> atlas = new FAtlasImage(atlasSize);
+            Ptr<FAtlasImage> atlas = new FAtlasImage(atlasSize, useSkylinePacker);
             atlas->layerIndex = atlasLayers.GetSize();
             atlasLayers.Add(atlas);
 
@@ -302,25 +481,9 @@ namespace CE
 
             UpdateImageAtlasItems();
 
-            RHI::BufferDescriptor stagingDesc{};
-            stagingDesc.name = "Staging Buffer";
-            stagingDesc.bindFlags = RHI::BufferBindFlags::StagingBuffer;
-            stagingDesc.bufferSize = atlasSize * atlasSize * sizeof(u32) * atlasLayers.GetSize();
-            stagingDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
-
-            RHI::Buffer* newStagingBuffer = RHI::gDynamicRHI->CreateBuffer(stagingDesc);
-
-            void* data;
-            stagingBuffer->Map(0, stagingBuffer->GetBufferSize(), &data);
-            {
-                newStagingBuffer->UploadData(data, stagingBuffer->GetBufferSize());
-            }
-            stagingBuffer->Unmap();
-
-            delete stagingBuffer;
-        	stagingBuffer = newStagingBuffer;
+            GrowLayerCapacity(atlasLayers.GetSize());
 
-            insertNode = atlas->root->Insert(textureSize);
+            insertNode = atlas->Insert(textureSize);
 
             if (insertNode == nullptr)
             {
@@ -332,7 +495,6 @@ namespace CE
 
         insertNode->imageName = name;
 
-        foundAtlas->root->usedArea += textureArea;
         foundAtlas->nodesByImageName[name] = insertNode;
 
         int posX = Math::RoundToInt(insertNode->rect.min.x);
@@ -416,16 +578,16 @@ namespace CE
 
         stagingBuffer->Unmap();
 
+        AddDirtyRegion(foundAtlas->layerIndex, Vec2i(posX, posY), textureSize);
+
         ImageItem item = { .layerIndex = foundAtlas->layerIndex, .uvMin = uvMin, .uvMax = uvMax };
         item.width = textureSize.width;
         item.height = textureSize.height;
 
-        imagesByName[name] = item;
-
-        for (int i = 0; i < flushRequiredPerImage.GetSize(); ++i)
-        {
-            flushRequiredPerImage[i] = true;
-        }
+        ImageEntry& entry = imagesByName[name];
+        entry.item = item;
+        entry.lastUsedFrame = frameCounter;
+        entry.evictable = evictable;
 
         return item;
     }
@@ -435,7 +597,7 @@ namespace CE
         if (!imagesByName.KeyExists(name))
             return false;
 
-        int layerIndex = imagesByName[name].layerIndex;
+        int layerIndex = imagesByName[name].item.layerIndex;
         if (layerIndex < 0 || layerIndex >= atlasLayers.GetSize())
             return false;
 
@@ -448,48 +610,241 @@ namespace CE
         if (node == nullptr)
             return false;
 
-        // Clean up the image pixels from the atlas (not necessary)
+        int posX = Math::RoundToInt(node->rect.min.x);
+        int posY = Math::RoundToInt(node->rect.min.y);
+        Vec2i textureSize = node->GetSize();
+
+        // Clear the image pixels, so that linear filtering of neighbouring images never samples stale texels
         {
             void* stagingPtr;
-            stagingBuffer->Map((u32)atlas->layerIndex * atlasSize * atlasSize * sizeof(u32),
-                atlasSize * atlasSize * sizeof(u32), &stagingPtr);
+            stagingBuffer->Map((u64)atlas->layerIndex * atlasSize * atlasSize * sizeof(u32),
+                (u64)atlasSize * atlasSize * sizeof(u32), &stagingPtr);
 
-            int posX = node->rect.min.x;
-            int posY = node->rect.min.y;
-            Vec2i textureSize = node->GetSize();
+            for (int y = 0; y < textureSize.y; ++y)
+            {
+                u8* dstRow = (u8*)stagingPtr + ((SIZE_T)atlas->atlasSize * (posY + y) + posX) * sizeof(u32);
+                memset(dstRow, 0, (SIZE_T)textureSize.x * sizeof(u32));
+            }
 
-            for (int x = 0; x < textureSize.x; ++x)
+            stagingBuffer->Unmap();
+        }
+
+        AddDirtyRegion(atlas->layerIndex, Vec2i(posX, posY), textureSize);
+
+        atlas->Free(node);
+
+        atlas->nodesByImageName.Remove(name);
+        imagesByName.Remove(name);
+
+        return true;
+    }
+
+    Ptr<FImageAtlas::BinaryNode> FImageAtlas::FAtlasImage::Insert(Vec2i imageSize)
+    {
+        Ptr<BinaryNode> node = nullptr;
+
+        if (useSkyline)
+        {
+            node = InsertSkyline(imageSize);
+        }
+        else
+        {
+            u32 imageArea = imageSize.width * imageSize.height;
+
+            node = root->Insert(imageSize);
+
+            if (node == nullptr && root->GetFreeArea() > imageArea * 2)
             {
-                for (int y = 0; y < textureSize.y; ++y)
-                {
-                    Vec2i dstPos = Vec2i(posX + x, posY + y);
+                root->DefragmentSlow();
 
-                    u8* dstPixel = (u8*)stagingPtr + (atlas->atlasSize * dstPos.y + dstPos.x) * sizeof(u32);
-                    u8* r = dstPixel;
-                    u8* g = dstPixel + 1;
-                    u8* b = dstPixel + 2;
-                    u8* a = dstPixel + 3;
+                node = root->Insert(imageSize);
+            }
+        }
 
-                    memset(dstPixel, 0, sizeof(u32));
-                }
+        if (node != nullptr)
+        {
+            root->usedArea += node->rect.GetAreaInt();
+        }
+
+        return node;
+    }
+
+    void FImageAtlas::FAtlasImage::Free(const Ptr<BinaryNode>& node)
+    {
+        if (node == nullptr)
+            return;
+
+        root->usedArea -= node->rect.GetAreaInt();
+
+        if (useSkyline)
+        {
+            FreeSkyline(node);
+            return;
+        }
+
+        node->ClearImage();
+        root->Defragment();
+    }
+
+    void FImageAtlas::FAtlasImage::ResetSkyline()
+    {
+        skyline.Clear();
+        skyline.Add(SkylineSegment{ .x = 0, .y = 0, .width = (int)atlasSize });
+    }
+
+    bool FImageAtlas::FAtlasImage::SkylineFits(int segmentIndex, Vec2i imageSize, int& outY) const
+    {
+        int x = skyline[segmentIndex].x;
+        if (x + imageSize.width > (int)atlasSize)
+            return false;
+
+        // Reserve a 1px gutter to the right and bottom, unless it would fall outside the atlas
+        int widthLeft = Math::Min<int>(imageSize.width + 1, (int)atlasSize - x);
+        int y = 0;
+
+        for (int i = segmentIndex; widthLeft > 0 && i < skyline.GetSize(); ++i)
+        {
+            y = Math::Max(y, skyline[i].y);
+            if (y + imageSize.height > (int)atlasSize)
+                return false;
+
+            widthLeft -= skyline[i].width;
+        }
+
+        outY = y;
+        return true;
+    }
+
+    void FImageAtlas::FAtlasImage::AddSkylineLevel(int segmentIndex, int x, int y, int width, int height)
+    {
+        skyline.InsertAt(segmentIndex, SkylineSegment{ .x = x, .y = y + height, .width = width });
+
+        // Trim the segments now covered by the new one
+        for (int i = segmentIndex + 1; i < skyline.GetSize(); )
+        {
+            int coveredEnd = skyline[segmentIndex].x + skyline[segmentIndex].width;
+            if (skyline[i].x >= coveredEnd)
+                break;
+
+            int shrink = coveredEnd - skyline[i].x;
+            skyline[i].x += shrink;
+            skyline[i].width -= shrink;
+
+            if (skyline[i].width > 0)
+                break;
+
+            skyline.RemoveAt(i);
+        }
+
+        MergeSkyline();
+    }
+
+    void FImageAtlas::FAtlasImage::SplitSkyline(int x)
+    {
+        for (int i = 0; i < skyline.GetSize(); ++i)
+        {
+            SkylineSegment& segment = skyline[i];
+            if (x > segment.x && x < segment.x + segment.width)
+            {
+                SkylineSegment right{ .x = x, .y = segment.y, .width = segment.x + segment.width - x };
+                segment.width = x - segment.x;
+                skyline.InsertAt(i + 1, right);
+                return;
             }
+        }
+    }
 
-            stagingBuffer->Unmap();
+    void FImageAtlas::FAtlasImage::MergeSkyline()
+    {
+        for (int i = 0; i + 1 < skyline.GetSize(); )
+        {
+            if (skyline[i].y == skyline[i + 1].y)
+            {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.RemoveAt(i + 1);
+            }
+            else
+            {
+                ++i;
+            }
         }
+    }
+
+    Ptr<FImageAtlas::BinaryNode> FImageAtlas::FAtlasImage::InsertSkyline(Vec2i imageSize)
+    {
+        if (imageSize.width <= 0 || imageSize.height <= 0)
+            return nullptr;
+
+        // Bottom-left heuristic: lowest top edge first, then leftmost
+        int bestIndex = -1;
+        int bestY = NumericLimits<int>::Max();
+
+        for (int i = 0; i < skyline.GetSize(); ++i)
+        {
+            int y = 0;
+            if (SkylineFits(i, imageSize, y) && y < bestY)
+            {
+                bestIndex = i;
+                bestY = y;
+            }
+        }
+
+        if (bestIndex < 0)
+            return nullptr;
+
+        int x = skyline[bestIndex].x;
+        int footprintWidth = Math::Min<int>(imageSize.width + 1, (int)atlasSize - x);
+        int footprintHeight = Math::Min<int>(imageSize.height + 1, (int)atlasSize - bestY);
+
+        AddSkylineLevel(bestIndex, x, bestY, footprintWidth, footprintHeight);
+
+        Ptr<BinaryNode> node = new BinaryNode;
+        node->parent = root.Get();
+        node->rect = Rect(x, bestY, x + imageSize.width, bestY + imageSize.height);
+
+        return node;
+    }
 
-        atlas->root->usedArea -= node->rect.GetAreaInt();
+    void FImageAtlas::FAtlasImage::FreeSkyline(const Ptr<BinaryNode>& node)
+    {
         node->ClearImage();
-        atlas->root->Defragment();
 
-        for (int i = 0; i < flushRequiredPerImage.GetSize(); ++i)
+        if (root->usedArea == 0)
         {
-            flushRequiredPerImage[i] = true;
+            ResetSkyline();
+            return;
         }
 
-        atlas->nodesByImageName.Remove(name);
-        imagesByName.Remove(name);
+        Vec2i size = node->GetSize();
+        int x = Math::RoundToInt(node->rect.min.x);
+        int y = Math::RoundToInt(node->rect.min.y);
+        int footprintWidth = Math::Min<int>(size.width + 1, (int)atlasSize - x);
+        int footprintHeight = Math::Min<int>(size.height + 1, (int)atlasSize - y);
+        int footprintEnd = x + footprintWidth;
 
-        return true;
+        // The space can only be given back if nothing was placed on top of the image. Otherwise it stays
+        // unused until the whole layer is empty.
+        for (const SkylineSegment& segment : skyline)
+        {
+            if (segment.x + segment.width <= x || segment.x >= footprintEnd)
+                continue;
+
+            if (segment.y != y + footprintHeight)
+                return;
+        }
+
+        SplitSkyline(x);
+        SplitSkyline(footprintEnd);
+
+        for (SkylineSegment& segment : skyline)
+        {
+            if (segment.x >= x && segment.x + segment.width <= footprintEnd)
+            {
+                segment.y = y;
+            }
+        }
+
+        MergeSkyline();
     }
 
     void FImageAtlas::BinaryNode::ClearImage()
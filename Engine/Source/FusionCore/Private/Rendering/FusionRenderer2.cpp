@@ -2456,7 +2456,7 @@ namespace CE
 	            CMImage imageAsset = app->LoadImageAsset(currentBrush.GetImageName());
                 if (imageAsset.IsValid())
                 {
-                	image = app->GetImageAtlas()->AddImage(currentBrush.GetImageName(), imageAsset);
+                	image = app->GetImageAtlas()->AddImage(currentBrush.GetImageName(), imageAsset, true);
                 }
             }
 
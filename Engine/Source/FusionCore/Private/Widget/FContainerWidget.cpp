@@ -48,21 +48,124 @@ namespace CE
 			    Matrix4x4::Scale(invScale) *
 			    Matrix4x4::Translation(-computedPosition - m_Translation - computedSize * m_Anchor)) *
 		    Vec4(localMousePos.x, localMousePos.y, 0, 1);
-        
-	    for (int i = children.GetSize() - 1; i >= 0; --i)
-	    {
-            Ref<FWidget> child = children[i].Get();
-            if (!child->Enabled())
+
+        if (FWidget* result = HitTestChildren(transformedMousePos))
+        {
+            return result;
+        }
+
+        return thisHitTest;
+    }
+
+    FWidget* FContainerWidget::HitTestChildren(Vec2 transformedMousePos)
+    {
+        ZoneScoped;
+
+        if (children.GetSize() < HitTestIndexThreshold)
+        {
+            for (int i = children.GetSize() - 1; i >= 0; --i)
+            {
+                Ref<FWidget> child = children[i].Get();
+                if (!child->Enabled())
+                    continue;
+
+                FWidget* result = child->HitTest(transformedMousePos);
+                if (result)
+                {
+                    return result;
+                }
+            }
+
+            return nullptr;
+        }
+
+        UpdateHitTestIndex();
+
+        // A child can only be hit inside its own rect, so the other children don't need to be tested at all
+        hitTestCandidates.Clear();
+        childHitTestIndex.Query(transformedMousePos, hitTestCandidates);
+
+        // Later children are drawn on top
+        hitTestCandidates.Sort([](u32 lhs, u32 rhs) { return lhs > rhs; });
+
+        for (u32 index : hitTestCandidates)
+        {
+            if (index >= children.GetSize())
                 continue;
 
-            FWidget* result = child->HitTest(transformedMousePos);
-            if (result)
+            FWidget* child = children[index].Get();
+            if (child == nullptr || !child->Enabled())
+                continue;
+
+            if (FWidget* result = child->HitTest(transformedMousePos))
             {
                 return result;
             }
-	    }
+        }
 
-        return thisHitTest;
+        return nullptr;
+    }
+
+    void FContainerWidget::UpdateHitTestIndex()
+    {
+        Ref<FFusionContext> fusionContext = GetContext();
+        u64 layoutVersion = fusionContext != nullptr ? fusionContext->GetLayoutVersion() : 0;
+
+        if (!isHitTestIndexDirty && hitTestIndexLayoutVersion == layoutVersion)
+            return;
+
+        ZoneScoped;
+
+        isHitTestIndexDirty = false;
+        hitTestIndexLayoutVersion = layoutVersion;
+
+        Array<Rect> childRects{};
+        childRects.Resize(children.GetSize());
+
+        for (int i = 0; i < children.GetSize(); i++)
+        {
+            FWidget* child = children[i].Get();
+            if (child == nullptr || !child->Enabled())
+            {
+                childRects[i] = Rect(0, 0, -1, -1); // Never hit
+                continue;
+            }
+
+            Vec2 size = child->GetComputedSize();
+
+            if (child->IsTranslationOnly())
+            {
+                childRects[i] = Rect::FromSize(child->GetComputedPosition() + child->Translation(), size);
+                continue;
+            }
+
+            // Bounds of the rotated & scaled rect
+            const Matrix4x4& transform = child->GetLocalTransform();
+            Vec2 corners[4] = {
+                transform * Vec4(0, 0, 0, 1),
+                transform * Vec4(size.x, 0, 0, 1),
+                transform * Vec4(0, size.y, 0, 1),
+                transform * Vec4(size.x, size.y, 0, 1)
+            };
+
+            Rect bounds = Rect(corners[0], corners[0]);
+            for (int c = 1; c < 4; c++)
+            {
+                bounds.min = Vec2(Math::Min(bounds.min.x, corners[c].x), Math::Min(bounds.min.y, corners[c].y));
+                bounds.max = Vec2(Math::Max(bounds.max.x, corners[c].x), Math::Max(bounds.max.y, corners[c].y));
+            }
+
+            childRects[i] = bounds;
+        }
+
+        childHitTestIndex.Build(childRects);
+    }
+
+    void FContainerWidget::OnChildTransformChanged(FWidget* child)
+    {
+        Super::OnChildTransformChanged(child);
+
+        isHitTestIndexDirty = true;
     }
 
     bool FContainerWidget::ChildExistsRecursive(FWidget* child)
@@ -119,6 +222,8 @@ namespace CE
         {
             children.Remove(child);
             children.InsertAt(index, child);
+
+            MarkHitTestIndexDirty();
         }
     }
 
@@ -139,6 +244,7 @@ namespace CE
         children.RemoveAt(curIndex);
         children.InsertAt(index, child);
 
+        MarkHitTestIndexDirty();
         MarkLayoutDirty();
     }
 
@@ -207,6 +313,7 @@ namespace CE
 
         children.Add(child);
 
+        MarkHitTestIndexDirty();
         MarkLayoutDirty();
         return true;
     }
@@ -222,6 +329,7 @@ namespace CE
 
         children.RemoveAt(index);
 
+        MarkHitTestIndexDirty();
         MarkLayoutDirty();
     	return true;
     }
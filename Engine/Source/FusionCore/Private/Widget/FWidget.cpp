@@ -126,6 +126,8 @@ namespace CE
         if (parent != nullptr)
         {
             globalTransform = parent->globalTransform * localTransform;
+
+            parent->OnChildTransformChanged(this);
         }
         else
         {
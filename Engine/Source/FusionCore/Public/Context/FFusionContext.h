@@ -50,6 +50,9 @@ namespace CE
 
         bool IsLayoutDirty() const { return layoutDirty; }
 
+        //! @brief Incremented by every layout pass. Caches of computed positions & sizes compare against it.
+        u64 GetLayoutVersion() const { return layoutVersion; }
+
         Ref<FFusionContext> GetParentContext() const { return parentContext.Lock(); }
 
         bool ParentContextExistsRecursive(Ref<FFusionContext> parent) const;
@@ -152,6 +155,7 @@ namespace CE
         bool ghosted = false;
         bool layoutDirty = true;
         bool dirty = true;
+        u64 layoutVersion = 0;
         bool isDestroyed = false;
         bool isRootContext = false;
 
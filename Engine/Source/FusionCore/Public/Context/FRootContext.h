@@ -18,6 +18,8 @@ namespace CE
 
     private:
 
+        //! @brief The hovered widget followed by its ancestors. Only used during TickNativeContextInput().
+        Array<FWidget*> hoveredWidgetChain{};
 
     };
     
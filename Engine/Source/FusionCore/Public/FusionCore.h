@@ -74,6 +74,7 @@ namespace CE
 
 #include "Layout/LayoutTypes.h"
 #include "Layout/FLayoutManager.h"
+#include "Layout/FHitTestIndex.h"
 
 #include "Style/FStyle.h"
 #include "Style/FButtonStyle.h"
@@ -0,0 +1,49 @@
+#pragma once
+
+namespace CE
+{
+    /*
+    *   Bounding volume hierarchy over a set of rects, for point queries.
+    *   Containers use it to find the children under the mouse without testing every child.
+    */
+    class FUSIONCORE_API FHitTestIndex
+    {
+    public:
+
+        static constexpr u32 MaxLeafSize = 4;
+
+        //! @brief Builds the hierarchy. The value returned by Query() for a rect is its index in the array.
+        void Build(const Array<Rect>& rects);
+
+        //! @brief Appends the index of every rect that contains the point, in no particular order.
+        void Query(Vec2 point, Array<u32>& outIndices) const;
+
+        void Clear();
+
+        bool IsEmpty() const { return nodes.IsEmpty(); }
+
+    private:
+
+        struct Node
+        {
+            Rect bounds{};
+
+            //! @brief Leaf: first item in the items array. Internal node: index of the second child, the first one follows this node.
+            u32 offset = 0;
+            //! @brief Number of items in a leaf, 0 for internal nodes.
+            u32 count = 0;
+        };
+
+        struct Item
+        {
+            Rect rect{};
+            u32 index = 0;
+        };
+
+        u32 BuildRecursive(u32 first, u32 count);
+
+        Array<Node> nodes{};
+        Array<Item> items{};
+    };
+
+} // namespace CE
@@ -27,6 +27,7 @@ namespace CE
         Vec2 GetWhitePixelUV() const;
         Vec2 GetTransparentPixelUV() const;
 
+        //! @brief Returns the image and marks it as used in the current frame.
         ImageItem FindImage(const Name& imageName);
 
         // - Public API -
@@ -128,14 +129,16 @@ namespace CE
 
         // - Atlas -
 
-        struct FAtlasImage : IntrusiveBase
+        struct FUSIONCORE_API FAtlasImage : IntrusiveBase
         {
-            FAtlasImage(u32 atlasSize) : atlasSize(atlasSize)
+            FAtlasImage(u32 atlasSize, bool useSkyline = false) : atlasSize(atlasSize), useSkyline(useSkyline)
             {
                 layerIndex = 0;
                 root = new BinaryNode;
 
                 root->rect = Rect(0, 0, atlasSize, atlasSize);
+
+                ResetSkyline();
             }
 
             virtual ~FAtlasImage()
@@ -143,16 +146,58 @@ namespace CE
                 root = nullptr;
             }
 
+            //! @brief Allocates a rect of the given size using this layer's packer, and adds it to the used area.
+            //! @return The node holding the rect, or nullptr if it doesn't fit.
+            Ptr<BinaryNode> Insert(Vec2i imageSize);
+
+            //! @brief Releases a node returned by Insert(), and removes it from the used area.
+            void Free(const Ptr<BinaryNode>& node);
+
+            u32 GetUsedArea() const { return root->usedArea; }
+
             u32 atlasSize = 0;
             int layerIndex = 0;
+            bool useSkyline = false;
 
+            //! @brief Root of the binary tree packer. With the skyline packer, only its rect and usedArea are used
+            //! and every image node is a detached leaf.
             Ptr<BinaryNode> root = nullptr;
             HashMap<Name, Ptr<BinaryNode>> nodesByImageName;
+
+        private:
+
+            //! @brief A horizontal run of the skyline: rows >= y are free within [x, x + width).
+            struct SkylineSegment
+            {
+                int x = 0;
+                int y = 0;
+                int width = 0;
+            };
+
+            //! @brief Sorted, non-overlapping segments that cover the whole atlas width.
+            Array<SkylineSegment> skyline;
+
+            void ResetSkyline();
+
+            bool SkylineFits(int segmentIndex, Vec2i imageSize, int& outY) const;
+
+            void AddSkylineLevel(int segmentIndex, int x, int y, int width, int height);
+
+            void SplitSkyline(int x);
+
+            void MergeSkyline();
+
+            Ptr<BinaryNode> InsertSkyline(Vec2i imageSize);
+
+            void FreeSkyline(const Ptr<BinaryNode>& node);
         };
 
         // - Utils API -
 
-        ImageItem AddImage(const Name& name, const CMImage& imageSource);
+        //! @brief Adds the image to the atlas.
+        //! @param evictable If true, the image may be evicted when it is the least recently used one and the atlas
+        //! is full. Only pass true if the caller can add the image again when FindImage() no longer returns it.
+        ImageItem AddImage(const Name& name, const CMImage& imageSource, bool evictable = false);
         bool RemoveImage(const Name& name);
 
         void UpdateImageAtlasItems();
@@ -168,8 +213,47 @@ namespace CE
         FIELD(Config)
         u32 atlasSize = 4096;
 
+        //! @brief Once this many layers exist, least recently used images are evicted instead of adding a layer.
+        //! 0 means no limit.
+        FIELD(Config)
+        u32 maxArrayLayers = 4;
+
+        //! @brief Minimum number of frames an evictable image must go unused before it can be evicted.
+        FIELD(Config)
+        u32 evictionMinFrames = 8;
+
+        //! @brief Use the skyline packer for new layers instead of the binary tree packer.
+        FIELD(Config)
+        bool useSkylinePacker = false;
+
         // - Internals -
 
+        struct ImageEntry
+        {
+            ImageItem item{};
+            u64 lastUsedFrame = 0;
+            bool evictable = false;
+        };
+
+        struct DirtyRegion
+        {
+            int layerIndex = 0;
+            Vec2i offset{};
+            Vec2i size{};
+        };
+
+        static constexpr u32 MaxDirtyRegionsPerImage = 64;
+
+        void CreateAtlasTexture(u32 imageIndex);
+
+        void GrowLayerCapacity(u32 layerCount);
+
+        void AddDirtyRegion(int layerIndex, Vec2i offset, Vec2i size);
+
+        //! @brief Evicts least recently used images until one of the size fits.
+        //! @return The node holding the rect, or nullptr if nothing could be evicted.
+        Ptr<BinaryNode> EvictAndInsert(Vec2i imageSize, Ptr<FAtlasImage>& outAtlas);
+
         RHI::Buffer* stagingBuffer = nullptr;
         RHI::Fence* stagingBufferFence = nullptr;
         RHI::CommandList* stagingCommandList = nullptr;
@@ -179,11 +263,20 @@ namespace CE
         StaticArray<RPI::Texture*, RHI::Limits::MaxSwapChainImageCount> atlasTexturesPerFrame;
 
         Array<Ptr<FAtlasImage>> atlasLayers;
-        StaticArray<bool, RHI::Limits::MaxSwapChainImageCount> flushRequiredPerImage;
+        //! @brief Number of layers allocated in the staging buffer and textures. Grows geometrically so that
+        //! adding a layer rarely recreates the textures.
+        u32 layerCapacity = 0;
+
+        StaticArray<bool, RHI::Limits::MaxSwapChainImageCount> flushRequiredPerImage{};
+        StaticArray<bool, RHI::Limits::MaxSwapChainImageCount> fullCopyRequiredPerImage{};
+        StaticArray<Array<DirtyRegion>, RHI::Limits::MaxSwapChainImageCount> dirtyRegionsPerImage{};
+
+        u64 frameCounter = 0;
+        bool imagesEvicted = false;
 
         // - Cache -
 
-        HashMap<Name, ImageItem> imagesByName;
+        HashMap<Name, ImageEntry> imagesByName;
         ImageItem whitePixel{};
         ImageItem transparentPixel{};
 
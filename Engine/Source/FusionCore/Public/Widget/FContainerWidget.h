@@ -8,6 +8,9 @@ namespace CE
         CE_CLASS(FContainerWidget, FWidget)
     public:
 
+        //! @brief Containers with at least this many children find the children under the mouse through a FHitTestIndex.
+        static constexpr u32 HitTestIndexThreshold = 16;
+
         FContainerWidget();
 
         u32 GetChildCount() const { return children.GetSize(); }
@@ -26,6 +29,8 @@ namespace CE
 
         FWidget* HitTest(Vec2 localMousePos) override;
 
+        void OnChildTransformChanged(FWidget* child) override;
+
         bool ChildExistsRecursive(FWidget* child) override;
 
         void ApplyStyleRecursively() override;
@@ -54,11 +59,27 @@ namespace CE
 
     	void OnChildWidgetDestroyed(FWidget* child) override;
 
+        //! @brief Returns the top-most enabled child hit by the mouse position, given in this widget's content space.
+        FWidget* HitTestChildren(Vec2 transformedMousePos);
+
+        void MarkHitTestIndexDirty() { isHitTestIndexDirty = true; }
+
     protected: // - Fields -
 
         FIELD()
         Array<WeakRef<FWidget>> children{};
 
+    private:
+
+        void UpdateHitTestIndex();
+
+        //! @brief Rects of the children in this widget's content space. Rebuilt lazily after a layout pass of the context,
+        //! or when a child's transform changes.
+        FHitTestIndex childHitTestIndex{};
+        Array<u32> hitTestCandidates{};
+        u64 hitTestIndexLayoutVersion = 0;
+        bool isHitTestIndexDirty = true;
+
     public: // - Fusion Properties -
 
         FUSION_PROPERTY(bool, ClipChildren);
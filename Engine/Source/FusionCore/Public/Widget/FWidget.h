@@ -39,6 +39,9 @@ namespace CE
 
         virtual void OnChildWidgetDestroyed(FWidget* child) {}
 
+        //! @brief Called when the local transform of a direct child is recalculated, outside of layout too (e.g. scrolling).
+        virtual void OnChildTransformChanged(FWidget* child) {}
+
         virtual void OnPostComputeLayout();
 
         bool AddChild(FWidget* child);
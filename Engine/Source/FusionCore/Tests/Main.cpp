@@ -559,3 +559,368 @@ TEST(FusionCore, Rendering)
 	TEST_END_GUI;
 }
 
+
+TEST(FusionCore, SkylinePacker)
+{
+	constexpr int atlasSize = 256;
+
+	Ptr<FImageAtlas::FAtlasImage> atlas = new FImageAtlas::FAtlasImage(atlasSize, true);
+
+	Array<Ptr<FImageAtlas::BinaryNode>> nodes;
+	u32 expectedArea = 0;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		Vec2i imageSize = Vec2i(8 + (i * 7) % 24, 8 + (i * 13) % 24);
+		Ptr<FImageAtlas::BinaryNode> node = atlas->Insert(imageSize);
+		if (node == nullptr)
+			break;
+
+		EXPECT_EQ(node->GetSize(), imageSize);
+		EXPECT_LE(node->rect.max.x, atlasSize);
+		EXPECT_LE(node->rect.max.y, atlasSize);
+
+		for (const auto& other : nodes)
+		{
+			EXPECT_FALSE(node->rect.Overlaps(other->rect));
+		}
+
+		node->imageName = "Valid";
+		nodes.Add(node);
+
+		expectedArea += imageSize.width * imageSize.height;
+		EXPECT_EQ(atlas->GetUsedArea(), expectedArea);
+	}
+
+	EXPECT_GT(nodes.GetSize(), 50);
+
+	// A full layer rejects what doesn't fit, without changing the used area
+	EXPECT_EQ(atlas->Insert(Vec2i(atlasSize, atlasSize)), nullptr);
+	EXPECT_EQ(atlas->GetUsedArea(), expectedArea);
+
+	// Removing the last image gives its space back to the skyline
+	Ptr<FImageAtlas::BinaryNode> last = nodes.Top();
+	Vec2i lastSize = last->GetSize();
+	Rect lastRect = last->rect;
+	atlas->Free(last);
+	nodes.Pop();
+
+	expectedArea -= lastSize.width * lastSize.height;
+	EXPECT_EQ(atlas->GetUsedArea(), expectedArea);
+
+	Ptr<FImageAtlas::BinaryNode> reinserted = atlas->Insert(lastSize);
+	ASSERT_NE(reinserted, nullptr);
+	EXPECT_EQ(reinserted->rect.min, lastRect.min);
+	nodes.Add(reinserted);
+
+	// Once every image is freed, the layer is reset completely and fits a full size image again
+	for (const auto& node : nodes)
+	{
+		atlas->Free(node);
+	}
+	nodes.Clear();
+
+	EXPECT_EQ(atlas->GetUsedArea(), 0u);
+
+	Ptr<FImageAtlas::BinaryNode> full = atlas->Insert(Vec2i(atlasSize, atlasSize));
+	ASSERT_NE(full, nullptr);
+	EXPECT_EQ(full->rect.min, Vec2(0, 0));
+	EXPECT_EQ(atlas->GetUsedArea(), (u32)(atlasSize * atlasSize));
+
+	atlas->Free(full);
+	EXPECT_EQ(atlas->GetUsedArea(), 0u);
+}
+
+TEST(FusionCore, DirtyRectUpload)
+{
+	TEST_BEGIN;
+
+	constexpr u32 size = 64;
+	constexpr u32 layerCount = 2;
+	constexpr u64 layerByteSize = (u64)size * size * sizeof(u32);
+
+	// Same layout as the image atlas: one tightly packed staging image per layer
+	RHI::TextureDescriptor textureDesc{};
+	textureDesc.name = "Dirty Rect Texture";
+	textureDesc.width = textureDesc.height = size;
+	textureDesc.dimension = RHI::Dimension::Dim2DArray;
+	textureDesc.arrayLayers = layerCount;
+	textureDesc.format = RHI::Format::R8G8B8A8_UNORM;
+	textureDesc.bindFlags = RHI::TextureBindFlags::ShaderRead;
+	RHI::Texture* texture = RHI::gDynamicRHI->CreateTexture(textureDesc);
+
+	RHI::BufferDescriptor bufferDesc{};
+	bufferDesc.name = "Dirty Rect Staging";
+	bufferDesc.bindFlags = RHI::BufferBindFlags::StagingBuffer;
+	bufferDesc.bufferSize = layerByteSize * layerCount;
+	bufferDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
+	RHI::Buffer* stagingBuffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+
+	bufferDesc.name = "Dirty Rect Readback";
+	RHI::Buffer* readbackBuffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+
+	RHI::CommandQueue* queue = RHI::gDynamicRHI->GetPrimaryGraphicsQueue();
+	RHI::CommandList* commandList = RHI::gDynamicRHI->AllocateCommandList(queue);
+	RHI::Fence* fence = RHI::gDynamicRHI->CreateFence(false);
+
+	auto getTexel = [](u32 layer, u32 x, u32 y) -> u32
+		{
+			return 0xFF000000u | (layer << 16) | (y << 8) | x;
+		};
+
+	auto submit = [&](const auto& record)
+		{
+			commandList->Begin();
+			record();
+			commandList->End();
+
+			fence->Reset();
+			queue->Execute(1, &commandList, fence);
+			fence->WaitForFence();
+		};
+
+	// Clear the whole texture with a full copy
+	{
+		void* data;
+		stagingBuffer->Map(0, stagingBuffer->GetBufferSize(), &data);
+		memset(data, 0, stagingBuffer->GetBufferSize());
+		stagingBuffer->Unmap();
+	}
+
+	submit([&]
+		{
+			RHI::ResourceBarrierDescriptor barrier{};
+			barrier.resource = stagingBuffer;
+			barrier.fromState = RHI::ResourceState::Undefined;
+			barrier.toState = RHI::ResourceState::CopySource;
+			commandList->ResourceBarrier(1, &barrier);
+
+			barrier.resource = texture;
+			barrier.fromState = RHI::ResourceState::Undefined;
+			barrier.toState = RHI::ResourceState::CopyDestination;
+			commandList->ResourceBarrier(1, &barrier);
+
+			RHI::BufferToTextureCopy copy{};
+			copy.srcBuffer = stagingBuffer;
+			copy.dstTexture = texture;
+			copy.layerCount = layerCount;
+			commandList->CopyTextureRegion(copy);
+		});
+
+	// Upload a dirty rect of the second layer from the middle of the staging image
+	{
+		void* data;
+		stagingBuffer->Map(0, stagingBuffer->GetBufferSize(), &data);
+		u32* texels = (u32*)data;
+		for (u32 layer = 0; layer < layerCount; layer++)
+		{
+			for (u32 y = 0; y < size; y++)
+			{
+				for (u32 x = 0; x < size; x++)
+				{
+					texels[(layer * size + y) * size + x] = getTexel(layer, x, y);
+				}
+			}
+		}
+		stagingBuffer->Unmap();
+	}
+
+	const Vec2i dirtyOffset = Vec2i(8, 16);
+	const Vec2i dirtySize = Vec2i(20, 10);
+
+	submit([&]
+		{
+			RHI::BufferToTextureCopy copy{};
+			copy.srcBuffer = stagingBuffer;
+			copy.bufferOffset = (layerByteSize + ((u64)dirtyOffset.y * size + dirtyOffset.x) * sizeof(u32));
+			copy.bufferRowLength = size;
+			copy.bufferImageHeight = size;
+			copy.dstTexture = texture;
+			copy.baseArrayLayer = 1;
+			copy.layerCount = 1;
+			copy.dstOffset = Vec3i(dirtyOffset.x, dirtyOffset.y, 0);
+			copy.dstExtent = Vec3i(dirtySize.x, dirtySize.y, 1);
+			commandList->CopyTextureRegion(copy);
+
+			RHI::ResourceBarrierDescriptor barrier{};
+			barrier.resource = texture;
+			barrier.fromState = RHI::ResourceState::CopyDestination;
+			barrier.toState = RHI::ResourceState::CopySource;
+			commandList->ResourceBarrier(1, &barrier);
+
+			barrier.resource = readbackBuffer;
+			barrier.fromState = RHI::ResourceState::Undefined;
+			barrier.toState = RHI::ResourceState::CopyDestination;
+			commandList->ResourceBarrier(1, &barrier);
+
+			RHI::TextureToBufferCopy readback{};
+			readback.srcTexture = texture;
+			readback.layerCount = layerCount;
+			readback.dstBuffer = readbackBuffer;
+			commandList->CopyTextureRegion(readback);
+		});
+
+	// Only the dirty rect was written, with the texels at the same position of the staging image
+	{
+		void* data;
+		readbackBuffer->Map(0, readbackBuffer->GetBufferSize(), &data);
+		const u32* texels = (const u32*)data;
+
+		int mismatches = 0;
+		for (u32 layer = 0; layer < layerCount; layer++)
+		{
+			for (u32 y = 0; y < size; y++)
+			{
+				for (u32 x = 0; x < size; x++)
+				{
+					bool dirty = layer == 1 &&
+						(int)x >= dirtyOffset.x && (int)x < dirtyOffset.x + dirtySize.x &&
+						(int)y >= dirtyOffset.y && (int)y < dirtyOffset.y + dirtySize.y;
+					u32 expected = dirty ? getTexel(layer, x, y) : 0;
+
+					if (texels[(layer * size + y) * size + x] != expected)
+						mismatches++;
+				}
+			}
+		}
+
+		EXPECT_EQ(mismatches, 0);
+
+		readbackBuffer->Unmap();
+	}
+
+	RHI::gDynamicRHI->FreeCommandLists(1, &commandList);
+	RHI::gDynamicRHI->DestroyFence(fence);
+	RHI::gDynamicRHI->DestroyBuffer(readbackBuffer);
+	RHI::gDynamicRHI->DestroyBuffer(stagingBuffer);
+	RHI::gDynamicRHI->DestroyTexture(texture);
+
+	TEST_END;
+}
+
+TEST(FusionCore, ImageAtlasEviction)
+{
+	TEST_BEGIN;
+
+	Ref<FImageAtlas> atlas = CreateObject<FImageAtlas>(GetTransient("FusionCore"), "EvictionTestAtlas");
+
+	// Only one 40x40 image fits in a 64x64 layer
+	ClassType* atlasClass = FImageAtlas::StaticClass();
+	atlasClass->FindField("atlasSize")->ForceSetFieldValue<u32>(atlas.Get(), 64);
+	atlasClass->FindField("maxArrayLayers")->ForceSetFieldValue<u32>(atlas.Get(), 2);
+	atlasClass->FindField("evictionMinFrames")->ForceSetFieldValue<u32>(atlas.Get(), 4);
+	atlasClass->FindField("useSkylinePacker")->ForceSetFieldValue<bool>(atlas.Get(), false);
+
+	atlas->Init();
+	EXPECT_EQ(atlas->GetArrayLayers(), 1u);
+
+	Array<u8> pixels{};
+	pixels.Resize(40 * 40, 128);
+	CMImage image = CMImage::LoadRawImageFromMemory(pixels.GetData(), 40, 40, CMImageFormat::R8, CMImageSourceFormat::None, 8, 8);
+
+	auto nextFrame = [&](int count)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				atlas->Flush(0);
+			}
+		};
+
+	// Frame 0 & 1: one image per layer, until the layer limit is reached
+	FImageAtlas::ImageItem first = atlas->AddImage("First", image, true);
+	ASSERT_TRUE(first.IsValid());
+	EXPECT_EQ(first.layerIndex, 0);
+
+	nextFrame(1);
+
+	FImageAtlas::ImageItem second = atlas->AddImage("Second", image, true);
+	ASSERT_TRUE(second.IsValid());
+	EXPECT_EQ(second.layerIndex, 1);
+	EXPECT_EQ(atlas->GetArrayLayers(), 2u);
+
+	// Frame 6: both images are old enough, the least recently used one is evicted
+	nextFrame(5);
+
+	FImageAtlas::ImageItem third = atlas->AddImage("Third", image, true);
+	ASSERT_TRUE(third.IsValid());
+	EXPECT_EQ(third.layerIndex, first.layerIndex);
+	EXPECT_EQ(atlas->GetArrayLayers(), 2u);
+
+	EXPECT_FALSE(atlas->FindImage("First").IsValid());
+	EXPECT_TRUE(atlas->FindImage("Second").IsValid());
+
+	// Frame 8: the remaining images were used less than evictionMinFrames ago, so a layer is added instead
+	nextFrame(2);
+
+	FImageAtlas::ImageItem fourth = atlas->AddImage("Fourth", image, true);
+	ASSERT_TRUE(fourth.IsValid());
+	EXPECT_EQ(fourth.layerIndex, 2);
+	EXPECT_EQ(atlas->GetArrayLayers(), 3u);
+
+	EXPECT_TRUE(atlas->FindImage("Second").IsValid());
+	EXPECT_TRUE(atlas->FindImage("Third").IsValid());
+
+	// Images that aren't evictable are never evicted
+	nextFrame(10);
+
+	FImageAtlas::ImageItem fifth = atlas->AddImage("Fifth", image, true);
+	ASSERT_TRUE(fifth.IsValid());
+	EXPECT_EQ(atlas->GetArrayLayers(), 3u);
+	EXPECT_TRUE(atlas->FindImage("__WhitePixel").IsValid());
+	EXPECT_TRUE(atlas->FindImage("__TransparentPixel").IsValid());
+
+	atlas->Shutdown();
+	atlas->BeginDestroy();
+
+	TEST_END;
+}
+
+TEST(FusionCore, HitTestIndex)
+{
+	// A grid of rows, like a big tree or property editor, plus a few overlapping & empty rects
+	Array<Rect> rects{};
+	for (int row = 0; row < 500; ++row)
+	{
+		for (int column = 0; column < 4; ++column)
+		{
+			rects.Add(Rect::FromSize(Vec2(column * 100.0f, row * 20.0f), Vec2(95.0f, 18.0f)));
+		}
+	}
+	rects.Add(Rect::FromSize(Vec2(50, 50), Vec2(300, 300)));
+	rects.Add(Rect::FromSize(Vec2(0, 0), Vec2(400, 10000)));
+	rects.Add(Rect(10, 10, 5, 5)); // Inverted, never hit
+
+	FHitTestIndex index{};
+	index.Build(rects);
+	EXPECT_FALSE(index.IsEmpty());
+
+	Array<u32> hits{};
+	Array<u32> expected{};
+
+	for (int i = 0; i < 2000; ++i)
+	{
+		Vec2 point = Vec2((i * 37) % 420 - 10.0f, (i * 7919) % 10100 - 50.0f);
+
+		hits.Clear();
+		index.Query(point, hits);
+		hits.Sort([](u32 lhs, u32 rhs) { return lhs < rhs; });
+
+		expected.Clear();
+		for (int r = 0; r < rects.GetSize(); ++r)
+		{
+			if (rects[r].right >= rects[r].left && rects[r].Contains(point))
+				expected.Add(r);
+		}
+
+		ASSERT_EQ(hits.GetSize(), expected.GetSize());
+		for (int h = 0; h < hits.GetSize(); ++h)
+		{
+			EXPECT_EQ(hits[h], expected[h]);
+		}
+	}
+
+	index.Clear();
+	hits.Clear();
+	index.Query(Vec2(60, 60), hits);
+	EXPECT_TRUE(hits.IsEmpty());
+}
@@ -40,6 +40,7 @@ void GameLoop::PreInit(int argc, char** argv)
 
 	options.add_options()
 		("h,help", "Print this help info and exit")
+		("async-log", "Format & write log messages on a dedicated log thread")
 		;
 
 	options.allow_unrecognised_options();
@@ -55,7 +56,10 @@ void GameLoop::PreInit(int argc, char** argv)
 			return;
 		}
 
-
+		if (result["async-log"].as<bool>())
+		{
+			Logger::EnableAsync();
+		}
 	}
 	catch (std::exception exc)
 	{
@@ -0,0 +1,178 @@
+#include "VulkanRHIPrivate.h"
+
+namespace CE::Vulkan
+{
+
+	static RHI::BindlessTableDescriptor ClampToDeviceLimits(VulkanDevice* device, RHI::BindlessTableDescriptor desc)
+	{
+		VkPhysicalDeviceDescriptorIndexingProperties indexingProperties{};
+		indexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+
+		VkPhysicalDeviceProperties2 properties{};
+		properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+		properties.pNext = &indexingProperties;
+		vkGetPhysicalDeviceProperties2(device->GetPhysicalHandle(), &properties);
+
+		// Leave room for the regular SRGs that share the per-stage limits with the table
+		constexpr u32 reservedDescriptors = 64;
+
+		u32 maxTextures = Math::Min(indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+			indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages);
+		u32 maxBuffers = Math::Min(indexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers,
+			indexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers);
+
+		if (maxTextures > reservedDescriptors)
+			desc.textureCapacity = Math::Min(desc.textureCapacity, maxTextures - reservedDescriptors);
+		if (maxBuffers > reservedDescriptors)
+			desc.bufferCapacity = Math::Min(desc.bufferCapacity, maxBuffers - reservedDescriptors);
+
+		return desc;
+	}
+
+	BindlessTable::BindlessTable(VulkanDevice* device, const RHI::BindlessTableDescriptor& desc)
+		: RHI::BindlessTable(ClampToDeviceLimits(device, desc)), device(device)
+	{
+		VkDescriptorSetLayoutBinding textureBinding{};
+		textureBinding.binding = TextureBinding;
+		textureBinding.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+		textureBinding.descriptorCount = GetTextureCapacity();
+		textureBinding.stageFlags = VK_SHADER_STAGE_ALL;
+		setLayoutBindings.Add(textureBinding);
+
+		VkDescriptorSetLayoutBinding bufferBinding{};
+		bufferBinding.binding = BufferBinding;
+		bufferBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		bufferBinding.descriptorCount = GetBufferCapacity();
+		bufferBinding.stageFlags = VK_SHADER_STAGE_ALL;
+		setLayoutBindings.Add(bufferBinding);
+
+		// Slots are written while command buffers that index other slots are still pending
+		VkDescriptorBindingFlags bindingFlags[2] = {
+			VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT,
+			VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT
+		};
+
+		VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+		bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+		bindingFlagsInfo.bindingCount = 2;
+		bindingFlagsInfo.pBindingFlags = bindingFlags;
+
+		VkDescriptorSetLayoutCreateInfo setLayoutCI{};
+		setLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		setLayoutCI.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+		setLayoutCI.bindingCount = setLayoutBindings.GetSize();
+		setLayoutCI.pBindings = setLayoutBindings.GetData();
+		setLayoutCI.pNext = &bindingFlagsInfo;
+
+		if (vkCreateDescriptorSetLayout(device->GetHandle(), &setLayoutCI, VULKAN_CPU_ALLOCATOR, &setLayout) != VK_SUCCESS)
+		{
+			CE_LOG(Error, All, "Failed to create bindless descriptor set layout");
+			return;
+		}
+
+		VkDescriptorPoolSize poolSizes[2] = {
+			{ .type = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, .descriptorCount = GetTextureCapacity() },
+			{ .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = GetBufferCapacity() }
+		};
+
+		VkDescriptorPoolCreateInfo poolCI{};
+		poolCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolCI.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+		poolCI.maxSets = 1;
+		poolCI.poolSizeCount = 2;
+		poolCI.pPoolSizes = poolSizes;
+
+		if (vkCreateDescriptorPool(device->GetHandle(), &poolCI, VULKAN_CPU_ALLOCATOR, &descriptorPool) != VK_SUCCESS)
+		{
+			CE_LOG(Error, All, "Failed to create bindless descriptor pool");
+			return;
+		}
+
+		VkDescriptorSetAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = descriptorPool;
+		allocInfo.descriptorSetCount = 1;
+		allocInfo.pSetLayouts = &setLayout;
+
+		if (vkAllocateDescriptorSets(device->GetHandle(), &allocInfo, &descriptorSet) != VK_SUCCESS)
+		{
+			CE_LOG(Error, All, "Failed to allocate bindless descriptor set");
+			descriptorSet = nullptr;
+			return;
+		}
+	}
+
+	BindlessTable::~BindlessTable()
+	{
+		// Freeing the pool frees the set
+		if (descriptorPool)
+		{
+			vkDestroyDescriptorPool(device->GetHandle(), descriptorPool, VULKAN_CPU_ALLOCATOR);
+			descriptorPool = nullptr;
+			descriptorSet = nullptr;
+		}
+
+		if (setLayout)
+		{
+			vkDestroyDescriptorSetLayout(device->GetHandle(), setLayout, VULKAN_CPU_ALLOCATOR);
+			setLayout = nullptr;
+		}
+	}
+
+	void BindlessTable::WriteTexture(u32 index, RHI::Texture* rhiTexture, RHI::TextureView* rhiTextureView)
+	{
+		if (descriptorSet == nullptr)
+			return;
+
+		VkDescriptorImageInfo imageInfo{};
+		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+		if (rhiTextureView != nullptr)
+		{
+			imageInfo.imageView = ((Vulkan::TextureView*)rhiTextureView)->GetImageView();
+		}
+		else if (rhiTexture != nullptr)
+		{
+			imageInfo.imageView = ((Vulkan::Texture*)rhiTexture)->GetImageView();
+		}
+
+		if (imageInfo.imageView == nullptr)
+			return;
+
+		VkWriteDescriptorSet write{};
+		write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		write.dstSet = descriptorSet;
+		write.dstBinding = TextureBinding;
+		write.dstArrayElement = index;
+		write.descriptorCount = 1;
+		write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+		write.pImageInfo = &imageInfo;
+
+		vkUpdateDescriptorSets(device->GetHandle(), 1, &write, 0, nullptr);
+	}
+
+	void BindlessTable::WriteBuffer(u32 index, const RHI::BufferView& bufferView)
+	{
+		if (descriptorSet == nullptr)
+			return;
+
+		RHI::Buffer* buffer = bufferView.GetBuffer();
+
+		VkDescriptorBufferInfo bufferInfo{};
+		bufferInfo.buffer = (VkBuffer)buffer->GetHandle();
+		bufferInfo.offset = bufferView.GetByteOffset();
+		bufferInfo.range = bufferView.GetByteCount() > 0 ? bufferView.GetByteCount() : buffer->GetBufferSize() - bufferInfo.offset;
+
+		VkWriteDescriptorSet write{};
+		write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		write.dstSet = descriptorSet;
+		write.dstBinding = BufferBinding;
+		write.dstArrayElement = index;
+		write.descriptorCount = 1;
+		write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		write.pBufferInfo = &bufferInfo;
+
+		vkUpdateDescriptorSets(device->GetHandle(), 1, &write, 0, nullptr);
+	}
+
+} // namespace CE::Vulkan
@@ -0,0 +1,44 @@
+#pragma once
+
+namespace CE::Vulkan
+{
+
+	//! @brief Single update-after-bind descriptor set with a sampled image array (binding 0) and a storage buffer
+	//! array (binding 1). Owned by the VulkanDevice and bound at the SRGType::Bindless set number.
+	class BindlessTable : public RHI::BindlessTable
+	{
+	public:
+
+		static constexpr u32 TextureBinding = 0;
+		static constexpr u32 BufferBinding = 1;
+
+		BindlessTable(VulkanDevice* device, const RHI::BindlessTableDescriptor& desc);
+
+		virtual ~BindlessTable();
+
+		bool IsValid() const { return descriptorSet != nullptr; }
+
+		inline VkDescriptorSetLayout GetSetLayout() const { return setLayout; }
+
+		inline VkDescriptorSet GetDescriptorSet() const { return descriptorSet; }
+
+		inline const List<VkDescriptorSetLayoutBinding>& GetSetLayoutBindings() const { return setLayoutBindings; }
+
+	protected:
+
+		void WriteTexture(u32 index, RHI::Texture* texture, RHI::TextureView* textureView) override;
+
+		void WriteBuffer(u32 index, const RHI::BufferView& bufferView) override;
+
+	private:
+
+		VulkanDevice* device = nullptr;
+
+		VkDescriptorPool descriptorPool = nullptr;
+		VkDescriptorSetLayout setLayout = nullptr;
+		VkDescriptorSet descriptorSet = nullptr;
+
+		List<VkDescriptorSetLayoutBinding> setLayoutBindings{};
+	};
+
+} // namespace CE::Vulkan
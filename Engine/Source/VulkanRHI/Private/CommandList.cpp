@@ -106,7 +106,21 @@ namespace CE::Vulkan
 				continue;
 
 			int setNumber = srg->GetSetNumber();
-			srg->FlushBindings();
+
+			if (shaderResourcesPrepared)
+			{
+#if CE_BUILD_DEBUG
+				if (srg->currentImageIndex != currentImageIndex || !srg->IsCompiled() || srg->needsRecompile)
+				{
+					CE_LOG(Error, All, "SRG of type {} was not prepared before parallel command list recording", (int)srg->GetSRGType());
+				}
+#endif
+			}
+			else
+			{
+				srg->currentImageIndex = currentImageIndex;
+				srg->FlushBindings();
+			}
 
 			srgsToMerge[setNumber].Add(srg);
 		}
@@ -118,107 +132,231 @@ namespace CE::Vulkan
 
 			if (srgsToMerge[setNumber].GetSize() == 1)
 			{
-				if (needsSrgCommit || commitedSRGsBySetNumber[setNumber] != srgsToMerge[setNumber][0]->GetDescriptorSet()) // SRG has changed
-				{
-					DescriptorSet* descriptorSet = srgsToMerge[setNumber][0]->GetDescriptorSet();
-
-					srgsToMerge[setNumber][0]->currentImageIndex = currentImageIndex;
-					srgsToMerge[setNumber][0]->FlushBindings();
-
-					if (commitedSRGsBySetNumber[setNumber] != nullptr)
-					{
-						--commitedSRGsBySetNumber[setNumber]->usageCount;
-					}
-					commitedSRGsBySetNumber[setNumber] = srgsToMerge[setNumber][0]->GetDescriptorSet();
-					++commitedSRGsBySetNumber[setNumber]->usageCount;
-
-					VkDescriptorSet descriptorSetHandle = commitedSRGsBySetNumber[setNumber]->GetHandle();
-					vkCmdBindDescriptorSets(commandBuffer, boundPipeline->GetBindPoint(),
-						boundPipeline->GetVkPipelineLayout(), setNumber, 1, &descriptorSetHandle, 0, nullptr);
-				}
+				BindDescriptorSet(setNumber, srgsToMerge[setNumber][0]);
 			}
 			else // > 1 (Merge SRGs)
 			{
-				auto first = &*srgsToMerge[setNumber].begin();
-				auto last = &*(srgsToMerge[setNumber].end() - 1);
-				auto mergedSrg = srgManager->FindOrCreateMergedSRG(srgsToMerge[setNumber].GetSize(), srgsToMerge[setNumber].GetData());
+				Vulkan::MergedShaderResourceGroup* mergedSrg = nullptr;
 
-				//if (commitedSRGsBySetNumber[setNumber] != (Vulkan::ShaderResourceGroup*)mergedSrg) // SRG has changed
+				if (shaderResourcesPrepared)
 				{
-					mergedSrg->currentImageIndex = currentImageIndex;
-					mergedSrg->FlushBindings();
-
-					if (commitedSRGsBySetNumber[setNumber] != nullptr)
+					mergedSrg = srgManager->FindMergedSRG(srgsToMerge[setNumber].GetSize(), srgsToMerge[setNumber].GetData());
+				}
+				else
+				{
+					mergedSrg = srgManager->FindOrCreateMergedSRG(srgsToMerge[setNumber].GetSize(), srgsToMerge[setNumber].GetData());
+					if (mergedSrg != nullptr)
 					{
-						--commitedSRGsBySetNumber[setNumber]->usageCount;
+						mergedSrg->currentImageIndex = currentImageIndex;
+						mergedSrg->FlushBindings();
 					}
-					commitedSRGsBySetNumber[setNumber] = mergedSrg->GetDescriptorSet();
-					++commitedSRGsBySetNumber[setNumber]->usageCount;
+				}
 
-					VkDescriptorSet descriptorSet = commitedSRGsBySetNumber[setNumber]->GetHandle();
-					vkCmdBindDescriptorSets(commandBuffer, boundPipeline->GetBindPoint(),
-						boundPipeline->GetVkPipelineLayout(), setNumber, 1, &descriptorSet, 0, nullptr);
+				if (mergedSrg == nullptr)
+				{
+					// Merging only fails on mismatching set numbers, or on a prepared command list whose SRGs weren't prepared
+					CE_LOG(Error, All, "No merged SRG for the {} SRGs bound to descriptor set {}. The set is left unbound.",
+						srgsToMerge[setNumber].GetSize(), setNumber);
+					continue;
 				}
+
+				BindDescriptorSet(setNumber, mergedSrg);
+			}
+		}
+
+		if (boundPipeline->UsesBindlessTable())
+		{
+			BindlessTable* bindlessTable = device->GetBindlessTable();
+
+			if (bindlessTable != nullptr && (needsSrgCommit || !bindlessTableBound))
+			{
+				VkDescriptorSet descriptorSetHandle = bindlessTable->GetDescriptorSet();
+				vkCmdBindDescriptorSets(commandBuffer, boundPipeline->GetBindPoint(),
+					boundPipeline->GetVkPipelineLayout(), boundPipeline->GetBindlessSetNumber(), 1, &descriptorSetHandle, 0, nullptr);
+
+				bindlessTableBound = true;
+				bindingStats.descriptorSetBinds++;
+			}
+			else if (bindlessTable != nullptr)
+			{
+				bindingStats.descriptorSetBindsSkipped++;
 			}
 		}
 
 		needsSrgCommit = false;
 	}
 
-	void CommandList::BindPipelineState(RHI::PipelineState* rhiPipelineState)
+	void CommandList::BindDescriptorSet(int setNumber, Vulkan::ShaderResourceGroup* srg)
 	{
-		if (rhiPipelineState == nullptr)
+		DescriptorSet* descriptorSet = srg->GetDescriptorSet();
+		if (descriptorSet == nullptr)
 			return;
 
-		RHI::PipelineStateType pipelineType = rhiPipelineState->GetPipelineType();
-		Vulkan::PipelineState* pipelineState = (Vulkan::PipelineState*)rhiPipelineState;
+		u32 dynamicOffsetCount = Math::Min(srg->GetDynamicOffsetCount(), RHI::Limits::Pipeline::MaxDynamicOffsetCount);
+		FixedArray<u32, RHI::Limits::Pipeline::MaxDynamicOffsetCount> dynamicOffsets{};
+		dynamicOffsets.Resize(dynamicOffsetCount);
+		if (dynamicOffsetCount > 0)
+		{
+			srg->GetDynamicOffsets(dynamicOffsets.GetData());
+		}
 
-		// No need to bind the same pipeline again
-		if (boundPipeline == pipelineState->GetPipeline())
+		// Per-object SRGs share one descriptor set and differ only by their dynamic offsets
+		const auto& commitedOffsets = commitedDynamicOffsetsBySetNumber[setNumber];
+		bool offsetsChanged = commitedOffsets.GetSize() != dynamicOffsetCount ||
+			(dynamicOffsetCount > 0 && memcmp(commitedOffsets.GetData(), dynamicOffsets.GetData(), sizeof(u32) * dynamicOffsetCount) != 0);
+
+		if (!needsSrgCommit && commitedSRGsBySetNumber[setNumber] == descriptorSet && !offsetsChanged)
+		{
+			bindingStats.descriptorSetBindsSkipped++;
 			return;
-		
-		boundPipeline = pipelineState->GetPipeline();
-		
-		if (pipelineType == RHI::PipelineStateType::Graphics)
+		}
+
+		if (commitedSRGsBySetNumber[setNumber] != nullptr)
 		{
-			Vulkan::GraphicsPipeline* gfxPipeline = (Vulkan::GraphicsPipeline*)boundPipeline;
-			VkPipeline vkPipeline = gfxPipeline->FindOrCompile(currentPass, currentSubpass);
+			--commitedSRGsBySetNumber[setNumber]->usageCount;
+		}
+		commitedSRGsBySetNumber[setNumber] = descriptorSet;
+		++descriptorSet->usageCount;
+
+		commitedDynamicOffsetsBySetNumber[setNumber] = dynamicOffsets;
+
+		VkDescriptorSet descriptorSetHandle = descriptorSet->GetHandle();
+		vkCmdBindDescriptorSets(commandBuffer, boundPipeline->GetBindPoint(),
+			boundPipeline->GetVkPipelineLayout(), setNumber, 1, &descriptorSetHandle,
+			dynamicOffsetCount, dynamicOffsetCount > 0 ? dynamicOffsets.GetData() : nullptr);
+
+		bindingStats.descriptorSetBinds++;
+	}
+
+	void CommandList::PrepareShaderResources()
+	{
+		StaticArray<
+			FixedArray<Vulkan::ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount>,
+			RHI::Limits::Pipeline::MaxShaderResourceGroupCount
+		> srgsToMerge{};
 
-			if (curPipelineType != VK_PIPELINE_BIND_POINT_GRAPHICS)
+		for (auto srg : boundSRGs)
+		{
+			if (!srg)
+				continue;
+
+			srg->currentImageIndex = currentImageIndex;
+			srg->FlushBindings();
+
+			srgsToMerge[srg->GetSetNumber()].Add(srg);
+		}
+
+		for (int setNumber = 0; setNumber < RHI::Limits::Pipeline::MaxShaderResourceGroupCount; setNumber++)
+		{
+			if (srgsToMerge[setNumber].GetSize() <= 1)
+				continue;
+
+			auto mergedSrg = srgManager->FindOrCreateMergedSRG(srgsToMerge[setNumber].GetSize(), srgsToMerge[setNumber].GetData());
+			if (mergedSrg == nullptr)
 			{
-				needsSrgCommit = true;
+				CE_LOG(Error, All, "Failed to merge the {} SRGs bound to descriptor set {}", srgsToMerge[setNumber].GetSize(), setNumber);
+				continue;
 			}
 
-			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
-			curPipelineType = VK_PIPELINE_BIND_POINT_GRAPHICS;
+			mergedSrg->currentImageIndex = currentImageIndex;
+			mergedSrg->FlushBindings();
+		}
+	}
+
+	void CommandList::BindPipelineState(RHI::PipelineState* rhiPipelineState)
+	{
+		if (rhiPipelineState == nullptr)
+			return;
+
+		RHI::PipelineStateType pipelineType = rhiPipelineState->GetPipelineType();
+		Vulkan::PipelineState* pipelineState = (Vulkan::PipelineState*)rhiPipelineState;
+		Vulkan::Pipeline* pipeline = pipelineState->GetPipeline();
+		if (pipeline == nullptr)
+			return;
+
+		VkPipeline vkPipeline = VK_NULL_HANDLE;
+		VkPipelineBindPoint bindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
+
+		if (pipelineType == RHI::PipelineStateType::Graphics)
+		{
+			// The same graphics pipeline compiles to a different VkPipeline per render pass
+			Vulkan::GraphicsPipeline* gfxPipeline = (Vulkan::GraphicsPipeline*)pipeline;
+			vkPipeline = gfxPipeline->FindOrCompile(currentPass, currentSubpass);
+			bindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 		}
 		else if (pipelineType == RHI::PipelineStateType::Compute)
 		{
-			if (curPipelineType != VK_PIPELINE_BIND_POINT_COMPUTE)
-			{
-				needsSrgCommit = true;
-			}
+			vkPipeline = pipeline->GetPipeline();
+			bindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+		}
+		else
+		{
+			return;
+		}
 
-			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, boundPipeline->GetPipeline());
-			curPipelineType = VK_PIPELINE_BIND_POINT_COMPUTE;
+		// No need to bind the same pipeline again
+		if (boundVkPipeline == vkPipeline && curPipelineType == bindPoint)
+		{
+			bindingStats.pipelineBindsSkipped++;
+			return;
 		}
+
+		if (curPipelineType != bindPoint ||
+			(boundPipeline != nullptr && boundPipeline->GetVkPipelineLayout() != pipeline->GetVkPipelineLayout()))
+		{
+			// Descriptor sets are only guaranteed to stay bound across compatible pipeline layouts
+			needsSrgCommit = true;
+		}
+
+		boundPipeline = pipeline;
+		boundVkPipeline = vkPipeline;
+
+		vkCmdBindPipeline(commandBuffer, bindPoint, vkPipeline);
+		curPipelineType = bindPoint;
+
+		bindingStats.pipelineBinds++;
 	}
 
 	void CommandList::BindVertexBuffers(u32 firstInputSlot, u32 count, const RHI::VertexBufferView* bufferViews)
 	{
-		count = Math::Min(count, RHI::Limits::Pipeline::MaxVertexInputSlotCount);
+		if (firstInputSlot >= RHI::Limits::Pipeline::MaxVertexInputSlotCount)
+			return;
+
+		count = Math::Min(count, RHI::Limits::Pipeline::MaxVertexInputSlotCount - firstInputSlot);
 
 		FixedArray<VkBuffer, RHI::Limits::Pipeline::MaxVertexInputSlotCount> buffers{};
 		FixedArray<VkDeviceSize, RHI::Limits::Pipeline::MaxVertexInputSlotCount> offsets{};
 
+		bool changed = false;
+
 		for (int i = 0; i < count; i++)
 		{
 			Vulkan::Buffer* buffer = (Vulkan::Buffer*)bufferViews[i].GetBuffer();
 			buffers.Add(buffer->GetBuffer());
 			offsets.Add((VkDeviceSize)bufferViews[i].GetByteOffset());
+
+			u32 slot = firstInputSlot + i;
+			if (boundVertexBuffers[slot] != buffers[i] || boundVertexBufferOffsets[slot] != offsets[i])
+			{
+				changed = true;
+			}
+		}
+
+		if (!changed)
+		{
+			bindingStats.vertexBufferBindsSkipped++;
+			return;
+		}
+
+		for (int i = 0; i < count; i++)
+		{
+			boundVertexBuffers[firstInputSlot + i] = buffers[i];
+			boundVertexBufferOffsets[firstInputSlot + i] = offsets[i];
 		}
 
 		vkCmdBindVertexBuffers(commandBuffer, firstInputSlot, count, buffers.GetData(), offsets.GetData());
+
+		bindingStats.vertexBufferBinds++;
 	}
 
 	void CommandList::BindIndexBuffer(const RHI::IndexBufferView& bufferView)
@@ -236,7 +374,22 @@ namespace CE::Vulkan
 			break;
 		}
 
-		vkCmdBindIndexBuffer(commandBuffer, buffer->GetBuffer(), bufferView.GetByteOffset(), indexType);
+		VkBuffer vkBuffer = buffer->GetBuffer();
+		VkDeviceSize offset = bufferView.GetByteOffset();
+
+		if (boundIndexBuffer == vkBuffer && boundIndexBufferOffset == offset && boundIndexType == indexType)
+		{
+			bindingStats.indexBufferBindsSkipped++;
+			return;
+		}
+
+		boundIndexBuffer = vkBuffer;
+		boundIndexBufferOffset = offset;
+		boundIndexType = indexType;
+
+		vkCmdBindIndexBuffer(commandBuffer, vkBuffer, offset, indexType);
+
+		bindingStats.indexBufferBinds++;
 	}
 
 	void CommandList::DrawIndexed(const DrawIndexedArguments& args)
@@ -769,14 +922,24 @@ namespace CE::Vulkan
 		Vulkan::Buffer* srcBuffer = (Vulkan::Buffer*)region.srcBuffer;
 
 		VkBufferImageCopy copy{};
-		copy.imageOffset = { 0, 0, 0 };
-		copy.imageExtent.width = dstTexture->GetWidth(region.mipSlice);
-		copy.imageExtent.height = dstTexture->GetHeight(region.mipSlice);
-		copy.imageExtent.depth = dstTexture->GetDepth(region.mipSlice);
+		copy.imageOffset = { region.dstOffset.x, region.dstOffset.y, region.dstOffset.z };
+
+		if (region.dstExtent.x > 0 && region.dstExtent.y > 0 && region.dstExtent.z > 0)
+		{
+			copy.imageExtent.width = region.dstExtent.x;
+			copy.imageExtent.height = region.dstExtent.y;
+			copy.imageExtent.depth = region.dstExtent.z;
+		}
+		else
+		{
+			copy.imageExtent.width = dstTexture->GetWidth(region.mipSlice) - region.dstOffset.x;
+			copy.imageExtent.height = dstTexture->GetHeight(region.mipSlice) - region.dstOffset.y;
+			copy.imageExtent.depth = dstTexture->GetDepth(region.mipSlice) - region.dstOffset.z;
+		}
 
 		copy.bufferOffset = region.bufferOffset;
-		copy.bufferImageHeight = 0; // 0 means data is tightly packed
-		copy.bufferRowLength = 0; // 0 means data is tightly packed
+		copy.bufferImageHeight = region.bufferImageHeight; // 0 means data is tightly packed
+		copy.bufferRowLength = region.bufferRowLength; // 0 means data is tightly packed
 
 		copy.imageSubresource.aspectMask = dstTexture->aspectMask;
 		copy.imageSubresource.baseArrayLayer = region.baseArrayLayer;
@@ -844,7 +1007,39 @@ namespace CE::Vulkan
 		
 		vkBeginCommandBuffer(commandBuffer, &cmdBeginInfo);
 
+		ResetBoundState();
+		bindingStats = {};
+	}
+
+	void CommandList::BeginInRenderPass(RenderPass* renderPass, u32 subpass, FrameBuffer* frameBuffer)
+	{
+		VkCommandBufferInheritanceInfo inheritanceInfo{};
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.renderPass = renderPass->GetHandle();
+		inheritanceInfo.subpass = subpass;
+		inheritanceInfo.framebuffer = frameBuffer != nullptr ? frameBuffer->GetHandle() : VK_NULL_HANDLE;
+
+		VkCommandBufferBeginInfo cmdBeginInfo{};
+		cmdBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		cmdBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		cmdBeginInfo.pInheritanceInfo = &inheritanceInfo;
+
+		vkBeginCommandBuffer(commandBuffer, &cmdBeginInfo);
+
+		ResetBoundState();
+		bindingStats = {};
+
+		currentPass = renderPass;
+		currentSubpass = subpass;
+	}
+
+	void CommandList::ResetBoundState()
+	{
 		boundPipeline = nullptr;
+		boundVkPipeline = VK_NULL_HANDLE;
+		bindlessTableBound = false;
+		curPipelineType = VK_PIPELINE_BIND_POINT_MAX_ENUM;
+		needsSrgCommit = true;
 		
 		for (int i = 0; i < boundSRGs.GetSize(); i++)
 		{
@@ -858,12 +1053,25 @@ namespace CE::Vulkan
 				commitedSRGsBySetNumber[i]->usageCount--;
 			}
 			commitedSRGsBySetNumber[i] = nullptr;
+			commitedDynamicOffsetsBySetNumber[i].Clear();
 		}
+
+		for (int i = 0; i < boundVertexBuffers.GetSize(); i++)
+		{
+			boundVertexBuffers[i] = VK_NULL_HANDLE;
+			boundVertexBufferOffsets[i] = 0;
+		}
+
+		boundIndexBuffer = VK_NULL_HANDLE;
+		boundIndexBufferOffset = 0;
+		boundIndexType = VK_INDEX_TYPE_MAX_ENUM;
 	}
 
 	void CommandList::End()
 	{
 		vkEndCommandBuffer(commandBuffer);
+
+		SubmitBindingStats();
 	}
 
 	void CommandList::BeginRenderTarget(RHI::RenderTarget* rhiRenderTarget, RHI::RenderTargetBuffer* renderTargetBuffer, RHI::AttachmentClearValue* clearValuesPerAttachment)
@@ -29,6 +29,15 @@ namespace CE::Vulkan
 
 		void CommitShaderResources() override;
 
+		//! @brief Flushes the currently set SRGs (and creates merged SRGs if required) without recording any command.
+		//! Used before recording secondary command lists from multiple threads, so that they never modify shared SRGs.
+		void PrepareShaderResources();
+
+		//! @brief When set, CommitShaderResources() only reads the bound SRGs and never flushes them or creates merged
+		//! SRGs: PrepareShaderResources() must have done that for every draw on the recording thread beforehand.
+		//! Set on secondary command lists recorded from job threads.
+		inline void SetShaderResourcesPrepared(bool prepared) { shaderResourcesPrepared = prepared; }
+
 		void BindPipelineState(RHI::PipelineState* pipelineState) override;
 
 		void BindVertexBuffers(u32 firstInputSlot, u32 count, const RHI::VertexBufferView* bufferViews) override;
@@ -51,10 +60,16 @@ namespace CE::Vulkan
 		void Begin() override;
 		void End() override;
 
+		//! @brief Begins a secondary command list that continues the given subpass of the render pass.
+		void BeginInRenderPass(RenderPass* renderPass, u32 subpass, FrameBuffer* frameBuffer);
+
 		void BeginRenderTarget(RHI::RenderTarget* renderTarget, RHI::RenderTargetBuffer* renderTargetBuffer, RHI::AttachmentClearValue* clearValuesPerAttachment) override;
 		void EndRenderTarget() override;
 
 	private:
+
+		//! @brief Forgets every cached binding. The command buffer state is undefined after Begin() and vkCmdExecuteCommands.
+		void ResetBoundState();
 		
 		VulkanDevice* device = nullptr;
 		ShaderResourceManager* srgManager = nullptr;
@@ -70,11 +85,31 @@ namespace CE::Vulkan
 		Vulkan::Pipeline* boundPipeline = nullptr;
 
 		bool needsSrgCommit = true;
+		bool shaderResourcesPrepared = false;
 		VkPipelineBindPoint curPipelineType = VK_PIPELINE_BIND_POINT_MAX_ENUM;
 
 		StaticArray<Vulkan::ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount> boundSRGs{};
 		StaticArray<Vulkan::DescriptorSet*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount> commitedSRGsBySetNumber{};
 
+		// - State cache -
+
+		//! @brief Binds the descriptor set unless the same set with the same dynamic offsets is already bound at setNumber.
+		void BindDescriptorSet(int setNumber, Vulkan::ShaderResourceGroup* srg);
+
+		VkPipeline boundVkPipeline = VK_NULL_HANDLE;
+
+		//! @brief True if the device's bindless table is bound at the bound pipeline's bindless set number.
+		bool bindlessTableBound = false;
+
+		StaticArray<VkBuffer, RHI::Limits::Pipeline::MaxVertexInputSlotCount> boundVertexBuffers{};
+		StaticArray<VkDeviceSize, RHI::Limits::Pipeline::MaxVertexInputSlotCount> boundVertexBufferOffsets{};
+
+		VkBuffer boundIndexBuffer = VK_NULL_HANDLE;
+		VkDeviceSize boundIndexBufferOffset = 0;
+		VkIndexType boundIndexType = VK_INDEX_TYPE_MAX_ENUM;
+
+		StaticArray<FixedArray<u32, RHI::Limits::Pipeline::MaxDynamicOffsetCount>, RHI::Limits::Pipeline::MaxShaderResourceGroupCount> commitedDynamicOffsetsBySetNumber{};
+
 		friend class FrameGraphCompiler;
 		friend class FrameGraphExecuter;
 	};
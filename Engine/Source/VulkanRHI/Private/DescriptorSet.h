@@ -29,6 +29,15 @@ namespace CE::Vulkan
 
         Atomic<int> usageCount = 0;
 
+        //! @brief Non-zero if the set is shared between SRGs with identical bindings. See ShaderResourceManager::AcquireSharedDescriptorSet().
+        SIZE_T sharedHash = 0;
+        //! @brief Full binding key of a shared set, compared on lookup so that hash collisions never share a set.
+        Array<u64> sharedBindingKey{};
+        //! @brief Number of SRGs that share this set.
+        int shareCount = 0;
+        //! @brief Shared sets are written once by the SRG that created them.
+        bool descriptorsWritten = false;
+
         bool failed = false;
 
         friend class ShaderResourceManager;
@@ -9,6 +9,7 @@ namespace CE::Vulkan
 		const VkPhysicalDeviceProperties& gpuProps = device->gpuProperties;
 		maxConstantBufferRange = gpuProps.limits.maxUniformBufferRange;
 		maxStructuredBufferRange = gpuProps.limits.maxStorageBufferRange;
+		constantBufferOffsetAlignment = gpuProps.limits.minUniformBufferOffsetAlignment;
 
 		VkPhysicalDeviceFeatures features;
 		vkGetPhysicalDeviceFeatures(device->gpu, &features);
@@ -19,6 +19,11 @@ namespace CE::Vulkan
 
 		device->GetShaderResourceManager()->DestroyQueuedSRG();
 
+		if (BindlessTable* bindlessTable = device->GetBindlessTable())
+		{
+			bindlessTable->AdvanceFrame();
+		}
+
 		FrameGraph* frameGraph = executeRequest.frameGraph;
 		compiler = (Vulkan::FrameGraphCompiler*)executeRequest.compiler;
 		//Vulkan::Scope* presentingScope = (Vulkan::Scope*)frameGraph->presentingScope;
@@ -120,6 +125,11 @@ namespace CE::Vulkan
 
 		device->GetShaderResourceManager()->DestroyQueuedSRG();
 
+		if (BindlessTable* bindlessTable = device->GetBindlessTable())
+		{
+			bindlessTable->AdvanceFrame();
+		}
+
 		RHI::FrameGraph* frameGraph = executeRequest.frameGraph;
 		compiler = (Vulkan::FrameGraphCompiler*)executeRequest.compiler;
 		bool swapChainExists = frameGraph->presentSwapChains.NotEmpty();
@@ -691,96 +701,47 @@ namespace CE::Vulkan
 					beginInfo.renderArea.extent.width = frameBuffer->GetWidth();
 					beginInfo.renderArea.extent.height = frameBuffer->GetHeight();
 
-					vkCmdBeginRenderPass(cmdBuffer, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+					VkViewport viewport{};
+					viewport.x = viewport.y = 0;
+					viewport.width = frameBuffer->GetWidth();
+					viewport.height = frameBuffer->GetHeight();
+					viewport.minDepth = 0.0f;
+					viewport.maxDepth = 1.0f;
+
+					VkRect2D scissor{};
+					scissor.offset.x = scissor.offset.y = 0;
+					scissor.extent.width = viewport.width;
+					scissor.extent.height = viewport.height;
+
+					vkCmdBeginRenderPass(cmdBuffer, &beginInfo, 
+						!shouldNotExecuteButShouldClear && UsesSecondaryCommandLists(currentScope) 
+						? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS 
+						: VK_SUBPASS_CONTENTS_INLINE);
 					{
-						VkViewport viewport{};
-						viewport.x = viewport.y = 0;
-						viewport.width = frameBuffer->GetWidth();
-						viewport.height = frameBuffer->GetHeight();
-						viewport.minDepth = 0.0f;
-						viewport.maxDepth = 1.0f;
-						vkCmdSetViewport(cmdBuffer, 0, 1, &viewport);
-
-						VkRect2D scissor{};
-						scissor.offset.x = scissor.offset.y = 0;
-						scissor.extent.width = viewport.width;
-						scissor.extent.height = viewport.height;
-						vkCmdSetScissor(cmdBuffer, 0, 1, &scissor);
+						bool setDynamicState = true;
 
 						while (!shouldNotExecuteButShouldClear && currentScope != nullptr)
 						{
 							RHI::DrawList* drawList = currentScope->drawList;
 
-							// Submit draw items
-							for (int i = 0; drawList != nullptr && i < drawList->GetDrawItemCount(); i++)
+							if (UsesSecondaryCommandLists(currentScope))
 							{
-								for (auto srg : currentScope->externalShaderResourceGroups)
-								{
-									commandList->SetShaderResourceGroup(srg);
-								}
+								RecordDrawListParallel(commandList, currentScope, frameBuffer, viewport, scissor);
 
-								if (currentScope->passShaderResourceGroup)
-								{
-									commandList->SetShaderResourceGroup(currentScope->passShaderResourceGroup);
-								}
-								if (currentScope->subpassShaderResourceGroup)
+								// Primary command buffer state is undefined after executing secondary command buffers
+								setDynamicState = true;
+							}
+							else if (drawList != nullptr)
+							{
+								if (setDynamicState)
 								{
-									commandList->SetShaderResourceGroup(currentScope->subpassShaderResourceGroup);
+									vkCmdSetViewport(cmdBuffer, 0, 1, &viewport);
+									vkCmdSetScissor(cmdBuffer, 0, 1, &scissor);
+									setDynamicState = false;
 								}
 
-								const auto& drawItemProperties = drawList->GetDrawItem(i);
-								const RHI::DrawItem* drawItem = drawItemProperties.item;
-
-								if (drawItem->enabled)
-								{
-									// TODO: Try using pipelineCollection instead of pipelineState
-
-									// Bind Pipeline
-									RHI::PipelineState* pipeline = drawItem->pipelineState;
-									if (pipeline)
-									{
-										commandList->BindPipelineState(pipeline);
-									}
-
-									// Bind SRGs
-									for (int j = 0; j < drawItem->shaderResourceGroupCount; j++)
-									{
-										if (drawItem->shaderResourceGroups[j] != nullptr)
-										{
-											commandList->SetShaderResourceGroup(drawItem->shaderResourceGroups[j]);
-										}
-									}
-
-									for (int j = 0; j < drawItem->uniqueShaderResourceGroupCount; j++)
-									{
-										if (drawItem->uniqueShaderResourceGroups[j] != nullptr)
-										{
-											commandList->SetShaderResourceGroup(drawItem->uniqueShaderResourceGroups[j]);
-										}
-									}
-
-									// Commit SRGs
-									commandList->CommitShaderResources();
-
-									// Draw Indexed
-									commandList->BindVertexBuffers(0, drawItem->vertexBufferViewCount, drawItem->vertexBufferViews);
-
-									if (drawItem->rootConstantSize > 0 && drawItem->rootConstants != nullptr && 
-										(int)drawItem->rootConstantSize % 4 == 0)
-									{
-										commandList->SetRootConstants(0, (u32)drawItem->rootConstantSize / 4, drawItem->rootConstants);
-									}
-									
-									if (drawItem->arguments.type == DrawArgumentsIndexed)
-									{
-										commandList->BindIndexBuffer(*drawItem->indexBufferView);
-										commandList->DrawIndexed(drawItem->arguments.indexedArgs);
-									}
-									else if (drawItem->arguments.type == DrawArgumentsLinear)
-									{
-										commandList->DrawLinear(drawItem->arguments.linearArgs);
-									}
-								}
+								// Submit draw items
+								RecordDrawItems(commandList, currentScope, drawList, 0, drawList->GetDrawItemCount());
 							}
 
 							if (currentScope->nextSubPass == nullptr) // No more subpasses left
@@ -832,7 +793,9 @@ namespace CE::Vulkan
 							{
 								scopeIndex++;
 								currentScope = (Vulkan::Scope*)currentScope->nextSubPass;
-								vkCmdNextSubpass(cmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
+								vkCmdNextSubpass(cmdBuffer, UsesSecondaryCommandLists(currentScope) 
+									? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS 
+									: VK_SUBPASS_CONTENTS_INLINE);
 								commandList->currentSubpass++;
 								commandList->ClearShaderResourceGroups();
 
@@ -1156,5 +1119,216 @@ namespace CE::Vulkan
 
 		return result == VK_SUCCESS;
 	}
-    
+
+	bool FrameGraphExecuter::UsesSecondaryCommandLists(Vulkan::Scope* scope) const
+	{
+		if (drawListChunkSize == 0 || scope == nullptr || scope->drawList == nullptr)
+			return false;
+
+		return scope->drawList->GetDrawItemCount() > drawListChunkSize;
+	}
+
+	void FrameGraphExecuter::RecordDrawItems(Vulkan::CommandList* commandList, Vulkan::Scope* scope, RHI::DrawList* drawList,
+		u32 firstItem, u32 endItem)
+	{
+		for (u32 i = firstItem; i < endItem; i++)
+		{
+			for (auto srg : scope->externalShaderResourceGroups)
+			{
+				commandList->SetShaderResourceGroup(srg);
+			}
+
+			if (scope->passShaderResourceGroup)
+			{
+				commandList->SetShaderResourceGroup(scope->passShaderResourceGroup);
+			}
+			if (scope->subpassShaderResourceGroup)
+			{
+				commandList->SetShaderResourceGroup(scope->subpassShaderResourceGroup);
+			}
+
+			const auto& drawItemProperties = drawList->GetDrawItem(i);
+			const RHI::DrawItem* drawItem = drawItemProperties.item;
+
+			if (!drawItem->enabled)
+				continue;
+
+			// TODO: Try using pipelineCollection instead of pipelineState
+
+			// Bind Pipeline
+			RHI::PipelineState* pipeline = drawItem->pipelineState;
+			if (pipeline)
+			{
+				commandList->BindPipelineState(pipeline);
+			}
+
+			// Bind SRGs
+			for (int j = 0; j < drawItem->shaderResourceGroupCount; j++)
+			{
+				if (drawItem->shaderResourceGroups[j] != nullptr)
+				{
+					commandList->SetShaderResourceGroup(drawItem->shaderResourceGroups[j]);
+				}
+			}
+
+			for (int j = 0; j < drawItem->uniqueShaderResourceGroupCount; j++)
+			{
+				if (drawItem->uniqueShaderResourceGroups[j] != nullptr)
+				{
+					commandList->SetShaderResourceGroup(drawItem->uniqueShaderResourceGroups[j]);
+				}
+			}
+
+			// Commit SRGs
+			commandList->CommitShaderResources();
+
+			// Draw Indexed
+			commandList->BindVertexBuffers(0, drawItem->vertexBufferViewCount, drawItem->vertexBufferViews);
+
+			if (drawItem->rootConstantSize > 0 && drawItem->rootConstants != nullptr && 
+				(int)drawItem->rootConstantSize % 4 == 0)
+			{
+				commandList->SetRootConstants(0, (u32)drawItem->rootConstantSize / 4, drawItem->rootConstants);
+			}
+			
+			if (drawItem->arguments.type == DrawArgumentsIndexed)
+			{
+				commandList->BindIndexBuffer(*drawItem->indexBufferView);
+				commandList->DrawIndexed(drawItem->arguments.indexedArgs);
+			}
+			else if (drawItem->arguments.type == DrawArgumentsLinear)
+			{
+				commandList->DrawLinear(drawItem->arguments.linearArgs);
+			}
+		}
+	}
+
+	void FrameGraphExecuter::PrepareDrawItems(Vulkan::CommandList* commandList, Vulkan::Scope* scope, RHI::DrawList* drawList)
+	{
+		ZoneScoped;
+
+		// SRGs and pipelines are shared between draw items (and hence between jobs). Flush the SRGs and compile
+		// the pipeline variants here, so the recording jobs only ever read from them.
+		for (u32 i = 0; i < drawList->GetDrawItemCount(); i++)
+		{
+			const RHI::DrawItem* drawItem = drawList->GetDrawItem(i).item;
+			if (!drawItem->enabled)
+				continue;
+
+			commandList->ClearShaderResourceGroups();
+
+			for (auto srg : scope->externalShaderResourceGroups)
+			{
+				commandList->SetShaderResourceGroup(srg);
+			}
+
+			commandList->SetShaderResourceGroup(scope->passShaderResourceGroup);
+			commandList->SetShaderResourceGroup(scope->subpassShaderResourceGroup);
+
+			for (int j = 0; j < drawItem->shaderResourceGroupCount; j++)
+			{
+				commandList->SetShaderResourceGroup(drawItem->shaderResourceGroups[j]);
+			}
+
+			for (int j = 0; j < drawItem->uniqueShaderResourceGroupCount; j++)
+			{
+				commandList->SetShaderResourceGroup(drawItem->uniqueShaderResourceGroups[j]);
+			}
+
+			commandList->PrepareShaderResources();
+
+			if (drawItem->pipelineState != nullptr && drawItem->pipelineState->GetPipelineType() == RHI::PipelineStateType::Graphics)
+			{
+				Vulkan::PipelineState* pipelineState = (Vulkan::PipelineState*)drawItem->pipelineState;
+				Vulkan::GraphicsPipeline* gfxPipeline = (Vulkan::GraphicsPipeline*)pipelineState->GetPipeline();
+				if (gfxPipeline != nullptr)
+				{
+					gfxPipeline->FindOrCompile(commandList->currentPass, commandList->currentSubpass);
+				}
+			}
+		}
+
+		commandList->ClearShaderResourceGroups();
+	}
+
+	void FrameGraphExecuter::RecordDrawListParallel(Vulkan::CommandList* commandList, Vulkan::Scope* scope, FrameBuffer* frameBuffer,
+		const VkViewport& viewport, const VkRect2D& scissor)
+	{
+		ZoneScoped;
+
+		RHI::DrawList* drawList = scope->drawList;
+		const u32 drawItemCount = drawList->GetDrawItemCount();
+		const u32 chunkCount = (drawItemCount + drawListChunkSize - 1) / drawListChunkSize;
+		const u32 imageIndex = currentSubmissionIndex;
+		RenderPass* renderPass = commandList->currentPass;
+		const u32 subpass = commandList->currentSubpass;
+
+		PrepareDrawItems(commandList, scope, drawList);
+
+		FixedArray<VkCommandBuffer, MaxParallelRecordingChunks> secondaryCommandBuffers{};
+		JobContext* jobContext = JobContext::GetGlobalContext();
+		JobCompletion* jobCompletion = jobContext != nullptr ? new JobCompletion(jobContext) : nullptr;
+
+		// Split the draw list evenly if the number of chunks exceeds the limit
+		const u32 numChunks = Math::Min<u32>(chunkCount, MaxParallelRecordingChunks);
+		const u32 itemsPerChunk = (drawItemCount + numChunks - 1) / numChunks;
+
+		for (u32 chunk = 0; chunk < numChunks; chunk++)
+		{
+			const u32 firstItem = chunk * itemsPerChunk;
+			const u32 endItem = Math::Min(firstItem + itemsPerChunk, drawItemCount);
+			if (firstItem >= endItem)
+				break;
+
+			Vulkan::CommandList* secondary = scope->GetOrCreateSecondaryCommandList(imageIndex, chunk);
+			if (secondary == nullptr)
+				break;
+
+			// PrepareDrawItems() already flushed every SRG and created the merged ones: the jobs only read them
+			secondary->SetShaderResourcesPrepared(true);
+
+			secondaryCommandBuffers.Add(secondary->GetCommandBuffer());
+
+			auto recordChunk = [this, secondary, scope, drawList, renderPass, subpass, frameBuffer, viewport, scissor, imageIndex, firstItem, endItem](Job*)
+				{
+					ZoneScoped;
+
+					secondary->BeginInRenderPass(renderPass, subpass, frameBuffer);
+					secondary->SetCurrentImageIndex(imageIndex);
+
+					VkCommandBuffer secondaryCmdBuffer = secondary->GetCommandBuffer();
+					vkCmdSetViewport(secondaryCmdBuffer, 0, 1, &viewport);
+					vkCmdSetScissor(secondaryCmdBuffer, 0, 1, &scissor);
+
+					RecordDrawItems(secondary, scope, drawList, firstItem, endItem);
+
+					secondary->ClearShaderResourceGroups();
+					secondary->End();
+				};
+
+			if (jobCompletion == nullptr)
+			{
+				recordChunk(nullptr);
+				continue;
+			}
+
+			Job* job = new JobFunction(recordChunk, true, jobContext);
+			job->SetDependent(jobCompletion);
+			job->Start();
+		}
+
+		if (jobCompletion != nullptr)
+		{
+			jobCompletion->StartAndWaitForCompletion();
+			delete jobCompletion;
+		}
+
+		if (!secondaryCommandBuffers.IsEmpty())
+		{
+			vkCmdExecuteCommands(commandList->GetCommandBuffer(), secondaryCommandBuffers.GetSize(), secondaryCommandBuffers.GetData());
+		}
+
+		commandList->ResetBoundState();
+	}
+
 } // namespace CE::Vulkan
@@ -24,9 +24,25 @@ namespace CE::Vulkan
 
 	private:
 
+		//! @brief Upper limit on the number of secondary command lists a single subpass is split into.
+		static constexpr u32 MaxParallelRecordingChunks = 64;
+
 		bool ExecuteScope(const RHI::FrameGraphExecuteRequest& executeRequest, Vulkan::Scope* scope, HashSet<RHI::ScopeId>& executedScopes, 
 			HashSet<Vulkan::SwapChain*>& usedSwapChains);
 
+		//! @brief Returns true if the scope's draw list is large enough to be recorded into secondary command lists in parallel.
+		bool UsesSecondaryCommandLists(Vulkan::Scope* scope) const;
+
+		//! @brief Records the draw items in range [firstItem, endItem). Safe to call from job threads once PrepareDrawItems() is done.
+		void RecordDrawItems(Vulkan::CommandList* commandList, Vulkan::Scope* scope, RHI::DrawList* drawList, u32 firstItem, u32 endItem);
+
+		void PrepareDrawItems(Vulkan::CommandList* commandList, Vulkan::Scope* scope, RHI::DrawList* drawList);
+
+		//! @brief Records the scope's draw list into secondary command lists in chunks on the JobManager,
+		//! and executes them in the current subpass of the primary command list.
+		void RecordDrawListParallel(Vulkan::CommandList* commandList, Vulkan::Scope* scope, FrameBuffer* frameBuffer,
+			const VkViewport& viewport, const VkRect2D& scissor);
+
 		VulkanDevice* device = nullptr;
 		FrameGraphCompiler* compiler = nullptr;
 
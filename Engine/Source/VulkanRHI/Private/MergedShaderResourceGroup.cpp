@@ -12,51 +12,56 @@ namespace CE::Vulkan
 		if (srgCount == 0)
 			return;
 
-		int i = 0;
 		combinedSRGs.Resize(srgCount);
 
-		auto srgManager = device->GetShaderResourceManager();
-
-		for (int j = 0; j < RHI::Limits::MaxSwapChainImageCount; j++)
+		for (int i = 0; i < srgCount; i++)
 		{
-			for (int i = 0; i < srgCount; i++)
+			auto srg = srgs[i];
+			combinedSRGs[i] = srg;
+
+			if (setNumber == -1)
+			{
+				setNumber = srg->setNumber;
+			}
+			else if (setNumber != srg->setNumber)
+			{
+				failed = true;
+				combinedSRGs.Clear();
+				CE_LOG(Error, All, "Cannot merge SRGs of different descriptor sets: {} and {}", setNumber, srg->setNumber);
+				return;
+			}
+
+			// All input SRGs must be compiled before being merged into a single set.
+			if (!srg->IsCompiled())
+			{
+				srg->Compile();
+			}
+
+			if ((int)srg->GetSRGType() > curSrgType)
+				curSrgType = (int)srg->GetSRGType();
+
+			srgLayout.Merge(srg->GetLayout());
+
+			// Merge bindings
+			for (int j = 0; j < RHI::Limits::MaxSwapChainImageCount; j++)
 			{
-				auto srg = srgs[i];
-
-				combinedSRGs[i++] = srg;
-				srgManager->mergedSRGsBySourceSRG[srg].Add(this);
-
-				if (setNumber == -1)
-				{
-					setNumber = srg->setNumber;
-				}
-				else if (setNumber != srg->setNumber)
-				{
-					failed = true;
-					CE_LOG(Error, All, "");
-					return;
-				}
-
-				// All input SRGs must be compiled before being merged into a single set.
-				if (!srg->IsCompiled())
-				{
-					srg->Compile();
-				}
-
-				if ((int)srg->GetSRGType() > curSrgType)
-					curSrgType = (int)srg->GetSRGType();
-
-				srgLayout.Merge(srg->GetLayout());
-
-				// Merge bindings
 				bufferInfosBoundBySlot[j].AddRange(srg->bufferInfosBoundBySlot[j]);
 				imageInfosBoundBySlot[j].AddRange(srg->imageInfosBoundBySlot[j]);
 			}
 		}
 
+		// Register once per source SRG, and only once the merge can't fail anymore
+		auto srgManager = device->GetShaderResourceManager();
+		for (ShaderResourceGroup* srg : combinedSRGs)
+		{
+			srgManager->mergedSRGsBySourceSRG[srg].Add(this);
+		}
+
 		combinedSRGs.Sort([](Vulkan::ShaderResourceGroup* a, Vulkan::ShaderResourceGroup* b)
 			{
-				return (int)a->GetSRGType() <= (int)b->GetSRGType();
+				if (a->GetSRGType() != b->GetSRGType())
+					return (int)a->GetSRGType() < (int)b->GetSRGType();
+				return a < b;
 			});
 
 		mergedHash = combinedSRGs[0]->GetHash();
@@ -79,4 +84,41 @@ namespace CE::Vulkan
 		}
     }
 
+    u32 MergedShaderResourceGroup::GetDynamicOffsetCount() const
+    {
+		u32 count = 0;
+		for (ShaderResourceGroup* srg : combinedSRGs)
+		{
+			count += srg->GetDynamicOffsetCount();
+		}
+		return count;
+    }
+
+    void MergedShaderResourceGroup::GetDynamicOffsets(u32* outOffsets) const
+    {
+		// The offsets of the source SRGs can change without recreating the merged SRG, so always read them
+		FixedArray<Pair<int, u32>, RHI::Limits::Pipeline::MaxDynamicOffsetCount> offsets{};
+
+		for (ShaderResourceGroup* srg : combinedSRGs)
+		{
+			const HashMap<int, u32>& srgOffsets = srg->dynamicOffsetsBySlot[currentImageIndex];
+
+			for (int slot : srg->dynamicOffsetSlots)
+			{
+				auto it = srgOffsets.Find(slot);
+				offsets.Add({ slot, it != srgOffsets.End() ? it->second : 0 });
+			}
+		}
+
+		std::sort(offsets.begin(), offsets.end(), [](const Pair<int, u32>& lhs, const Pair<int, u32>& rhs)
+			{
+				return lhs.first < rhs.first;
+			});
+
+		for (int i = 0; i < offsets.GetSize(); i++)
+		{
+			outOffsets[i] = offsets[i].second;
+		}
+    }
+
 } // namespace CE::Vulkan
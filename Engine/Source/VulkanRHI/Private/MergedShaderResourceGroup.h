@@ -21,6 +21,10 @@ namespace CE::Vulkan
 
 		SIZE_T GetHash() const override { return mergedHash; }
 
+		u32 GetDynamicOffsetCount() const override;
+
+		void GetDynamicOffsets(u32* outOffsets) const override;
+
 	private:
 
 		Array<ShaderResourceGroup*> combinedSRGs{};
@@ -12,7 +12,7 @@ namespace CE::Vulkan
 
         for (VkDescriptorSetLayout setLayout : setLayouts)
         {
-            if (setLayout == emptySetLayout)
+            if (setLayout == emptySetLayout || setLayout == bindlessSetLayout)
                 continue;
 
             vkDestroyDescriptorSetLayout(device->GetHandle(), setLayout, VULKAN_CPU_ALLOCATOR);
@@ -85,8 +85,16 @@ namespace CE::Vulkan
             vkCreateDescriptorSetLayout(device->GetHandle(), &emptySetCI, VULKAN_CPU_ALLOCATOR, &emptySetLayout);
         }
 
+        BindlessTable* bindlessTable = device->GetBindlessTable();
+
         for (const RHI::ShaderResourceGroupLayout& srgLayout : desc.srgLayouts)
         {
+            if (srgLayout.srgType == RHI::SRGType::Bindless && bindlessTable == nullptr)
+            {
+                CE_LOG(Error, All, "Pipeline {} uses bindless resources, which are not supported by this device", desc.name);
+                continue;
+            }
+
             int setNumber = srgManager->GetDescriptorSetNumber(srgLayout.srgType);
 
             if (setNumber < lowestSetNumber)
@@ -104,6 +112,20 @@ namespace CE::Vulkan
                 if (srgManager->GetDescriptorSetNumber(srgLayout.srgType) != setNumber)
                     continue;
 
+                if (srgLayout.srgType == RHI::SRGType::Bindless)
+                {
+                    if (bindlessTable == nullptr)
+                        continue;
+
+                    // Every pipeline uses the table's own layout, so the one descriptor set is compatible with all of them
+                    found = true;
+                    bindlessSetLayout = bindlessTable->GetSetLayout();
+                    bindlessSetNumber = setNumber;
+                    setLayoutBindingsMap[setNumber] = bindlessTable->GetSetLayoutBindings();
+                    setLayouts.Add(bindlessSetLayout);
+                    break;
+                }
+
                 found = true;
 
                 List<VkDescriptorBindingFlags> bindingFlags{};
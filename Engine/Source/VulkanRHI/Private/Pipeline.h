@@ -29,6 +29,11 @@ namespace CE::Vulkan
 
 		bool HasPushConstants() const { return pushConstantRanges.GetSize() > 0; }
 
+		//! @brief Returns true if the shaders declare the SRG_Bindless set, i.e. the device's BindlessTable must be bound.
+		bool UsesBindlessTable() const { return bindlessSetNumber >= 0; }
+
+		int GetBindlessSetNumber() const { return bindlessSetNumber; }
+
 		VkPushConstantRange GetPushConstant() const
 		{
 			if (pushConstantRanges.IsEmpty())
@@ -40,6 +45,9 @@ namespace CE::Vulkan
 		VulkanDevice* device = nullptr;
 		VkPipelineLayout pipelineLayout = nullptr;
 		VkDescriptorSetLayout emptySetLayout = nullptr;
+		//! @brief Owned by the device's BindlessTable.
+		VkDescriptorSetLayout bindlessSetLayout = nullptr;
+		int bindlessSetNumber = -1;
 
 		RHI::PipelineStateType pipelineType = RHI::PipelineStateType::Graphics;
 
@@ -22,6 +22,8 @@ namespace CE::Vulkan
 		}
 		commandListsByFamilyIndexPerImage.Clear();
 
+		DestroySecondaryCommandLists();
+
         if (renderPass)
         {
             // No need to destroy it. RenderPassCache manages it.
@@ -46,6 +48,7 @@ namespace CE::Vulkan
 		vkDeviceWaitIdle(device->GetHandle());
 
 		DestroySyncObjects();
+		DestroySecondaryCommandLists();
 
 		//delete passShaderResourceGroup;
 		//passShaderResourceGroup = nullptr;
@@ -459,4 +462,56 @@ namespace CE::Vulkan
 		renderFinishedFences.Clear();
 	}
 
+	Vulkan::CommandList* Scope::GetOrCreateSecondaryCommandList(u32 imageIndex, u32 chunkIndex)
+	{
+		if (imageIndex >= RHI::Limits::MaxSwapChainImageCount || queue == nullptr)
+			return nullptr;
+
+		Array<Vulkan::CommandList*>& commandLists = secondaryCommandListsPerImage[imageIndex];
+		u32 familyIndex = queue->GetFamilyIndex();
+
+		while (commandLists.GetSize() <= chunkIndex)
+		{
+			VkCommandPoolCreateInfo poolCI{};
+			poolCI.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			poolCI.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			poolCI.queueFamilyIndex = familyIndex;
+
+			VkCommandPool pool = nullptr;
+			if (vkCreateCommandPool(device->GetHandle(), &poolCI, VULKAN_CPU_ALLOCATOR, &pool) != VK_SUCCESS)
+				return nullptr;
+
+			VkCommandBufferAllocateInfo allocInfo{};
+			allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			allocInfo.commandPool = pool;
+			allocInfo.commandBufferCount = 1;
+			allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+
+			VkCommandBuffer cmdBuffer = nullptr;
+			if (vkAllocateCommandBuffers(device->GetHandle(), &allocInfo, &cmdBuffer) != VK_SUCCESS)
+			{
+				vkDestroyCommandPool(device->GetHandle(), pool, VULKAN_CPU_ALLOCATOR);
+				return nullptr;
+			}
+
+			commandLists.Add(new Vulkan::CommandList(device, cmdBuffer, RHI::CommandListType::Indirect, familyIndex, pool));
+		}
+
+		return commandLists[chunkIndex];
+	}
+
+	void Scope::DestroySecondaryCommandLists()
+	{
+		for (int i = 0; i < secondaryCommandListsPerImage.GetSize(); i++)
+		{
+			for (Vulkan::CommandList* commandList : secondaryCommandListsPerImage[i])
+			{
+				VkCommandPool pool = commandList->GetCommandPool();
+				delete commandList;
+				vkDestroyCommandPool(device->GetHandle(), pool, VULKAN_CPU_ALLOCATOR);
+			}
+			secondaryCommandListsPerImage[i].Clear();
+		}
+	}
+
 } // namespace CE::Vulkan
@@ -42,9 +42,16 @@ namespace CE::Vulkan
 
 		virtual bool CompileInternal(const RHI::FrameGraphCompileRequest& compileRequest) override;
 
+		//! @brief Returns the secondary command list used to record the given chunk of this scope's draw list.
+		//! Each secondary command list owns a separate command pool, so chunks can be recorded from any job thread.
+		//! Should only be called from the thread executing the frame graph.
+		Vulkan::CommandList* GetOrCreateSecondaryCommandList(u32 imageIndex, u32 chunkIndex);
+
 	private:
 
 		void DestroySyncObjects();
+
+		void DestroySecondaryCommandLists();
 		
 		//FixedArray<VkSemaphore, RHI::Limits::MaxSwapChainImageCount> renderFinishedSemaphores{};
 		FixedArray<HashMap<RHI::ScopeId, VkSemaphore>, RHI::Limits::MaxSwapChainImageCount> signalSemaphoresByConsumerScope{};
@@ -62,6 +69,8 @@ namespace CE::Vulkan
 
 		FixedArray<Array<Vulkan::CommandList*>, RHI::Limits::MaxSwapChainImageCount> commandListsByFamilyIndexPerImage{};
 
+		StaticArray<Array<Vulkan::CommandList*>, RHI::Limits::MaxSwapChainImageCount> secondaryCommandListsPerImage{};
+
 		VulkanDevice* device = nullptr;
         CommandQueue* queue = nullptr;
 		RenderPass* renderPass = nullptr;
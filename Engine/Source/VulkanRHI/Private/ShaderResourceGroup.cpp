@@ -49,6 +49,11 @@ namespace CE::Vulkan
             srgSlots.Add({ RHI::SRGType::PerObject, 5 });
             srgSlots.Add({ RHI::SRGType::PerDraw, 6 });
         }
+
+        if (maxBoundDescriptorSets > (u32)RHI::SRGType::Bindless)
+        {
+            srgSlots.Add({ RHI::SRGType::Bindless, (int)RHI::SRGType::Bindless });
+        }
         
         for (const SRGSlot& slot : srgSlots)
         {
@@ -133,28 +138,42 @@ namespace CE::Vulkan
 		return VK_DESCRIPTOR_TYPE_MAX_ENUM;
 	}
 
-	MergedShaderResourceGroup* ShaderResourceManager::FindOrCreateMergedSRG(u32 srgCount, ShaderResourceGroup** srgs)
+	SIZE_T ShaderResourceManager::GetMergedSRGHash(u32 srgCount, ShaderResourceGroup** srgs,
+		FixedArray<ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount>& outSortedSrgs)
 	{
-		SIZE_T mergedSRGHash = 0;
-		FixedArray<Vulkan::ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount> srgArray{};
+		outSortedSrgs.Clear();
 		
 		for (int i = 0; i < srgCount; i++)
 		{
-			srgArray.Add(srgs[i]);
+			outSortedSrgs.Add(srgs[i]);
 		}
         
-		std::sort(srgArray.begin(), srgArray.end(),
+		std::sort(outSortedSrgs.begin(), outSortedSrgs.end(),
             [](Vulkan::ShaderResourceGroup* a, Vulkan::ShaderResourceGroup* b) -> bool
 			{
-				return (int)a->GetSRGType() <= (int)b->GetSRGType();
+				// Ties are broken by address, as MergedShaderResourceGroup does, so any input order gives the same hash
+				if (a->GetSRGType() != b->GetSRGType())
+					return (int)a->GetSRGType() < (int)b->GetSRGType();
+				return a < b;
 			});
 
-		mergedSRGHash = (SIZE_T)srgArray[0];
-		for (int i = 1; i < srgArray.GetSize(); i++)
+		SIZE_T mergedSRGHash = (SIZE_T)outSortedSrgs[0];
+		for (int i = 1; i < outSortedSrgs.GetSize(); i++)
 		{
-			mergedSRGHash = GetCombinedHash(mergedSRGHash, (SIZE_T)srgArray[i]);
+			mergedSRGHash = GetCombinedHash(mergedSRGHash, (SIZE_T)outSortedSrgs[i]);
 		}
 
+		return mergedSRGHash;
+	}
+
+	MergedShaderResourceGroup* ShaderResourceManager::FindOrCreateMergedSRG(u32 srgCount, ShaderResourceGroup** srgs)
+	{
+		if (srgCount == 0 || srgs == nullptr)
+			return nullptr;
+
+		FixedArray<Vulkan::ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount> srgArray{};
+		SIZE_T mergedSRGHash = GetMergedSRGHash(srgCount, srgs, srgArray);
+
 		if (mergedSRGsByHash.KeyExists(mergedSRGHash) && mergedSRGsByHash[mergedSRGHash] != nullptr)
 		{
 			return mergedSRGsByHash[mergedSRGHash];
@@ -163,9 +182,24 @@ namespace CE::Vulkan
 		return CreateMergedSRG(srgArray.GetSize(), srgArray.GetData());
 	}
 
+	MergedShaderResourceGroup* ShaderResourceManager::FindMergedSRG(u32 srgCount, ShaderResourceGroup** srgs) const
+	{
+		if (srgCount == 0 || srgs == nullptr)
+			return nullptr;
+
+		FixedArray<Vulkan::ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount> srgArray{};
+		SIZE_T mergedSRGHash = GetMergedSRGHash(srgCount, srgs, srgArray);
+
+		auto it = mergedSRGsByHash.Find(mergedSRGHash);
+		if (it == mergedSRGsByHash.End())
+			return nullptr;
+
+		return it->second;
+	}
+
 	MergedShaderResourceGroup* ShaderResourceManager::CreateMergedSRG(u32 srgCount, ShaderResourceGroup** srgs)
 	{
-		if (srgCount)
+		if (srgCount == 0 || srgs == nullptr)
 			return nullptr;
 
 		MergedShaderResourceGroup* mergedSRG = new MergedShaderResourceGroup(device, srgCount, srgs);
@@ -247,12 +281,62 @@ namespace CE::Vulkan
 	{
 		if (descriptorSet)
 		{
+			if (descriptorSet->sharedHash != 0)
+			{
+				LockGuard lock{ sharedDescriptorSetMutex };
+
+				if (--descriptorSet->shareCount > 0)
+					return;
+
+				if (sharedDescriptorSetsByHash.KeyExists(descriptorSet->sharedHash))
+				{
+					Array<DescriptorSet*>& bucket = sharedDescriptorSetsByHash[descriptorSet->sharedHash];
+					bucket.Remove(descriptorSet);
+					if (bucket.IsEmpty())
+					{
+						sharedDescriptorSetsByHash.Remove(descriptorSet->sharedHash);
+					}
+				}
+			}
+
 			LockGuard<SharedMutex> lock{ queuedDestroySetMutex };
 
 			queuedDestroySets.Add(descriptorSet);
 		}
 	}
 
+	DescriptorSet* ShaderResourceManager::AcquireSharedDescriptorSet(const Array<u64>& bindingKey, VkDescriptorSetLayout setLayout,
+		const RHI::ShaderResourceGroupLayout& srgLayout, bool& outCreated)
+	{
+		SIZE_T descriptorSetHash = CalculateHash(bindingKey.GetData(), bindingKey.GetSize() * sizeof(u64));
+		if (descriptorSetHash == 0) // 0 marks unshared sets
+			descriptorSetHash = 1;
+
+		LockGuard lock{ sharedDescriptorSetMutex };
+
+		Array<DescriptorSet*>& bucket = sharedDescriptorSetsByHash[descriptorSetHash];
+
+		for (DescriptorSet* sharedSet : bucket)
+		{
+			if (sharedSet->sharedBindingKey.GetSize() == bindingKey.GetSize() &&
+				memcmp(sharedSet->sharedBindingKey.GetData(), bindingKey.GetData(), bindingKey.GetSize() * sizeof(u64)) == 0)
+			{
+				sharedSet->shareCount++;
+				outCreated = false;
+				return sharedSet;
+			}
+		}
+
+		DescriptorSet* descriptorSet = new DescriptorSet(device, setLayout, srgLayout);
+		descriptorSet->sharedHash = descriptorSetHash;
+		descriptorSet->sharedBindingKey = bindingKey;
+		descriptorSet->shareCount = 1;
+
+		bucket.Add(descriptorSet);
+		outCreated = true;
+		return descriptorSet;
+	}
+
     ShaderResourceGroup::ShaderResourceGroup(VulkanDevice* device, const RHI::ShaderResourceGroupLayout& srgLayout)
 		: device(device)
     {
@@ -314,8 +398,19 @@ namespace CE::Vulkan
 			bindingSlotsByVariableName[variable.name] = variable.bindingSlot;
 			variableBindingsByName[variable.name] = entry;
 			variableBindingsBySlot[variable.bindingSlot] = entry;
+
+			if (variable.usesDynamicOffset)
+			{
+				dynamicOffsetSlots.Add(variable.bindingSlot);
+			}
 		}
 
+		// Dynamic offsets are consumed in binding order
+		dynamicOffsetSlots.Sort([](int lhs, int rhs)
+			{
+				return lhs < rhs;
+			});
+
 		// TODO: Implement variable size arrays
 
 		VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
@@ -383,13 +478,10 @@ namespace CE::Vulkan
 		if (!bindingSlotsByVariableName.KeyExists(name))
 			return false;
 
-		int bindingSlot = bindingSlotsByVariableName[name];
-
 		for (int i = 0; i < RHI::Limits::MaxSwapChainImageCount; i++)
 		{
+			// Marks the SRG for recompilation only if the descriptor actually changed
 			Bind(i, name, bufferView);
-
-			needsRecompile = true;
 		}
 		
 		return true;
@@ -532,7 +624,16 @@ namespace CE::Vulkan
 		VkDescriptorBufferInfo bufferWrite{};
 		bufferWrite.buffer = (VkBuffer)bufferView.GetBuffer()->GetHandle();
 		bufferWrite.offset = bufferView.GetByteOffset();
-		bufferWrite.range = size > 0 ? size : bufferView.GetBuffer()->GetBufferSize();
+		bufferWrite.range = size > 0 ? size : bufferView.GetBuffer()->GetBufferSize() - bufferWrite.offset;
+
+		if (dynamicOffsetSlots.Exists(bindingSlot))
+		{
+			// The offset is supplied when the descriptor set is bound, so changing it does not require a new set.
+			// The range must not depend on it either: a whole buffer binding is resolved by the driver at bind time.
+			dynamicOffsetsBySlot[i][bindingSlot] = (u32)bufferWrite.offset;
+			bufferWrite.offset = 0;
+			bufferWrite.range = size > 0 ? size : VK_WHOLE_SIZE;
+		}
 
 		if (bufferInfosBoundBySlot[i][bindingSlot].GetSize() == 1 &&
 			bufferInfosBoundBySlot[i][bindingSlot][0].buffer == bufferWrite.buffer &&
@@ -917,9 +1018,22 @@ namespace CE::Vulkan
 			}
 
 			if (dynamicArrayName.IsValid())
+			{
 				descriptorSets[i] = new DescriptorSet(device, setLayout, srgLayout, dynamicArraySize);
+			}
+			else if (dynamicOffsetSlots.NotEmpty() && !IsMerged())
+			{
+				// SRGs that only differ by their dynamic offsets (e.g. per-object data in a shared buffer) share one set
+				Array<u64> bindingKey{};
+				GetDescriptorSetKey(i, bindingKey);
+
+				bool created = false;
+				descriptorSets[i] = device->GetShaderResourceManager()->AcquireSharedDescriptorSet(bindingKey, setLayout, srgLayout, created);
+			}
 			else
+			{
 				descriptorSets[i] = new DescriptorSet(device, setLayout, srgLayout);
+			}
 		}
 
 		UpdateBindings();
@@ -951,6 +1065,12 @@ namespace CE::Vulkan
 			if (descriptorSet == nullptr)
 				continue;
 
+			// A shared set may already be bound by in-flight command buffers, and its contents can't differ anyway
+			if (descriptorSet->sharedHash != 0 && descriptorSet->descriptorsWritten)
+				continue;
+
+			descriptorSet->descriptorsWritten = true;
+
 			Array<VkWriteDescriptorSet> writes{};
 			writes.Resize(bufferInfosBoundBySlot[i].GetSize() + imageInfosBoundBySlot[i].GetSize());
 			int idx = 0;
@@ -1005,5 +1125,56 @@ namespace CE::Vulkan
 		}
 	}
 
-} // namespace CE
+	void ShaderResourceGroup::GetDynamicOffsets(u32* outOffsets) const
+	{
+		const HashMap<int, u32>& offsets = dynamicOffsetsBySlot[currentImageIndex];
 
+		for (int i = 0; i < dynamicOffsetSlots.GetSize(); i++)
+		{
+			auto it = offsets.Find(dynamicOffsetSlots[i]);
+			outOffsets[i] = it != offsets.End() ? it->second : 0;
+		}
+	}
+
+	void ShaderResourceGroup::GetDescriptorSetKey(int imageIndex, Array<u64>& outKey) const
+	{
+		outKey.Clear();
+
+		for (const RHI::SRGVariableDescriptor& variable : srgLayout.variables)
+		{
+			outKey.Add(variable.bindingSlot);
+			outKey.Add((u64)variable.type);
+			outKey.Add(variable.arrayCount);
+			outKey.Add((u64)variable.shaderStages);
+			outKey.Add((u64)variable.usesDynamicOffset);
+
+			// The range is the bound size, which doesn't depend on the dynamic offset (see Bind())
+			auto bufferIt = bufferInfosBoundBySlot[imageIndex].Find((int)variable.bindingSlot);
+			if (bufferIt != bufferInfosBoundBySlot[imageIndex].End())
+			{
+				outKey.Add(bufferIt->second.GetSize());
+
+				for (const VkDescriptorBufferInfo& bufferInfo : bufferIt->second)
+				{
+					outKey.Add((u64)bufferInfo.buffer);
+					outKey.Add((u64)bufferInfo.offset);
+					outKey.Add((u64)bufferInfo.range);
+				}
+			}
+
+			auto imageIt = imageInfosBoundBySlot[imageIndex].Find((int)variable.bindingSlot);
+			if (imageIt != imageInfosBoundBySlot[imageIndex].End())
+			{
+				outKey.Add(imageIt->second.GetSize());
+
+				for (const VkDescriptorImageInfo& imageInfo : imageIt->second)
+				{
+					outKey.Add((u64)imageInfo.imageView);
+					outKey.Add((u64)imageInfo.sampler);
+					outKey.Add((u64)imageInfo.imageLayout);
+				}
+			}
+		}
+	}
+
+} // namespace CE
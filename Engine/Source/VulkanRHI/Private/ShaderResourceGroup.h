@@ -26,6 +26,10 @@ namespace CE::Vulkan
 
 		MergedShaderResourceGroup* FindOrCreateMergedSRG(u32 srgCount, ShaderResourceGroup** srgs);
 
+		//! @brief Returns the merged SRG of the given SRGs if FindOrCreateMergedSRG() already created it, or nullptr.
+		//! Never modifies the manager, so parallel command list recording can call it once the SRGs are prepared.
+		MergedShaderResourceGroup* FindMergedSRG(u32 srgCount, ShaderResourceGroup** srgs) const;
+
 		MergedShaderResourceGroup* CreateMergedSRG(u32 srgCount, ShaderResourceGroup** srgs);
 		void RemoveMergedSRG(MergedShaderResourceGroup* srg);
 		void OnSRGDestroyed(ShaderResourceGroup* srg);
@@ -34,7 +38,18 @@ namespace CE::Vulkan
 
 		void QueueDestroy(DescriptorSet* descriptorSet);
 
+		//! @brief Returns the descriptor set shared by all SRGs with the given layout and bindings, creating it if needed.
+		//! Each call must be paired with a QueueDestroy() of the returned set.
+		//! @param bindingKey Key written by ShaderResourceGroup::GetDescriptorSetKey().
+		//! @param outCreated Set to true if a new descriptor set was created and its descriptors must be written.
+		DescriptorSet* AcquireSharedDescriptorSet(const Array<u64>& bindingKey, VkDescriptorSetLayout setLayout,
+			const RHI::ShaderResourceGroupLayout& srgLayout, bool& outCreated);
+
 	private:
+
+		//! @brief Sorts the SRGs by type into outSortedSrgs and returns the hash their merged SRG is registered under.
+		static SIZE_T GetMergedSRGHash(u32 srgCount, ShaderResourceGroup** srgs,
+			FixedArray<ShaderResourceGroup*, RHI::Limits::Pipeline::MaxShaderResourceGroupCount>& outSortedSrgs);
         
         struct SRGSlot
         {
@@ -55,6 +70,10 @@ namespace CE::Vulkan
 
 		HashMap<SIZE_T, MergedShaderResourceGroup*> mergedSRGsByHash{};
 
+		Mutex sharedDescriptorSetMutex{};
+		//! @brief Shared sets by the hash of their binding key. Sets whose keys collide share a bucket.
+		HashMap<SIZE_T, Array<DescriptorSet*>> sharedDescriptorSetsByHash{};
+
 		/// @brief HashMap of Merged SRG by each source SRG. Used to manage lifetime of Merged SRG.
 		/// If any one of the source SRG that comprises the Merged SRG is destroyed, the Merged SRG should be destroyed.
 		HashMap<Vulkan::ShaderResourceGroup*, Array<MergedShaderResourceGroup*>> mergedSRGsBySourceSRG{};
@@ -101,6 +120,13 @@ namespace CE::Vulkan
 		inline int GetSetNumber() const { return setNumber; }
 
 		inline DescriptorSet* GetDescriptorSet() const { return descriptorSets[currentImageIndex]; }
+
+		//! @brief Number of dynamic offsets consumed when this SRG's descriptor set is bound.
+		virtual u32 GetDynamicOffsetCount() const { return dynamicOffsetSlots.GetSize(); }
+
+		//! @brief Writes the dynamic offsets of the current image, ordered by binding slot.
+		virtual void GetDynamicOffsets(u32* outOffsets) const;
+
 		inline VkDescriptorSetLayout GetDescriptorSetLayout() const { return setLayout; }
 
 		void Compile() override;
@@ -128,6 +154,10 @@ namespace CE::Vulkan
 
 		void UpdateBindings();
 
+		//! @brief Writes the layout and everything bound for the image, except dynamic offsets, as a flat key.
+		//! SRGs with equal keys can share a single descriptor set.
+		void GetDescriptorSetKey(int imageIndex, Array<u64>& outKey) const;
+
 		bool failed = false;
 		bool needsRecompile = true;
 
@@ -151,6 +181,10 @@ namespace CE::Vulkan
 		StaticArray<HashMap<int, List<VkDescriptorBufferInfo>>, RHI::Limits::MaxSwapChainImageCount> bufferInfosBoundBySlot{};
 		StaticArray<HashMap<int, List<VkDescriptorImageInfo>>, RHI::Limits::MaxSwapChainImageCount> imageInfosBoundBySlot{};
 
+		//! @brief Binding slots of the variables that use dynamic offsets, in ascending order.
+		Array<int> dynamicOffsetSlots{};
+		StaticArray<HashMap<int, u32>, RHI::Limits::MaxSwapChainImageCount> dynamicOffsetsBySlot{};
+
 		friend class GraphicsPipelineState;
 		friend class CommandList;
         friend class VulkanDescriptorSet;
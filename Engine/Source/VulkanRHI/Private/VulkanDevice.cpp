@@ -57,6 +57,16 @@ namespace CE::Vulkan
 
 		srgManager = new ShaderResourceManager(this);
 
+		if (bindlessSupported)
+		{
+			bindlessTable = new BindlessTable(this, RHI::BindlessTableDescriptor());
+			if (!bindlessTable->IsValid())
+			{
+				delete bindlessTable;
+				bindlessTable = nullptr;
+			}
+		}
+
 		commandAllocator = new CommandBufferAllocator(this);
 
 		renderPassCache = new RenderPassCache(this);
@@ -76,6 +86,9 @@ namespace CE::Vulkan
 		delete commandAllocator;
 		commandAllocator = nullptr;
 
+		delete bindlessTable;
+		bindlessTable = nullptr;
+
 		delete srgManager;
 		srgManager = nullptr;
 
@@ -396,6 +409,38 @@ namespace CE::Vulkan
 		descriptorIndexingFeatures.descriptorBindingVariableDescriptorCount = VK_TRUE;
 		descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
 
+		// The bindless table is updated while command buffers that use it are in flight
+		bindlessSupported = false;
+#if PLATFORM_DESKTOP
+		{
+			VkPhysicalDeviceDescriptorIndexingFeatures supportedIndexingFeatures{};
+			supportedIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+			VkPhysicalDeviceFeatures2 supportedFeatures{};
+			supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			supportedFeatures.pNext = &supportedIndexingFeatures;
+			vkGetPhysicalDeviceFeatures2(gpu, &supportedFeatures);
+
+			bindlessSupported = 
+				gpuProperties.limits.maxBoundDescriptorSets > (u32)RHI::SRGType::Bindless &&
+				supportedIndexingFeatures.shaderSampledImageArrayNonUniformIndexing &&
+				supportedIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing &&
+				supportedIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind &&
+				supportedIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind &&
+				supportedIndexingFeatures.descriptorBindingUpdateUnusedWhilePending &&
+				supportedIndexingFeatures.descriptorBindingPartiallyBound &&
+				supportedIndexingFeatures.runtimeDescriptorArray;
+
+			if (bindlessSupported)
+			{
+				descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+				descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+				descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+				descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+			}
+		}
+#endif
+
 #if PLATFORM_DESKTOP
 		deviceCI.pNext = &descriptorIndexingFeatures;
 #endif
@@ -15,6 +15,7 @@ namespace CE::Vulkan
     class Texture;
 	class DescriptorPool;
 	class ShaderResourceManager;
+	class BindlessTable;
 	class CommandBufferAllocator;
 	class RenderPassCache;
     class DeviceLimits;
@@ -101,6 +102,12 @@ namespace CE::Vulkan
 			return srgManager;
 		}
 
+		//! @brief Returns nullptr if the GPU does not support update-after-bind descriptor indexing.
+		INLINE BindlessTable* GetBindlessTable() const
+		{
+			return bindlessTable;
+		}
+
 		INLINE const VkPhysicalDeviceMemoryProperties& GetMemoryProperties() const
 		{
 			return memoryProperties;
@@ -170,6 +177,8 @@ namespace CE::Vulkan
 
 		RenderPassCache* renderPassCache = nullptr;
 		ShaderResourceManager* srgManager = nullptr;
+		BindlessTable* bindlessTable = nullptr;
+		bool bindlessSupported = false;
         VkCommandPool gfxCommandPool = nullptr;
 
         HashMap<u32, VkCommandPool> queueFamilyToCmdPool{};
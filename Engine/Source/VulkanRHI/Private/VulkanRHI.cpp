@@ -505,6 +505,11 @@ namespace CE::Vulkan
 		delete shaderResourceGroup;
 	}
 
+	RHI::BindlessTable* VulkanRHI::GetBindlessTable()
+	{
+		return device->GetBindlessTable();
+	}
+
     RHI::PipelineState* VulkanRHI::CreateGraphicsPipeline(const RHI::GraphicsPipelineDescriptor& desc)
     {
         return new Vulkan::PipelineState(device, desc);
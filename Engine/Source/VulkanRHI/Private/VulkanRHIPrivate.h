@@ -22,6 +22,7 @@
 #include "DescriptorSet.h"
 #include "ShaderResourceGroup.h"
 #include "MergedShaderResourceGroup.h"
+#include "BindlessTable.h"
 #include "MemoryHeap.h"
 #include "Sampler.h"
 #include "Texture.h"
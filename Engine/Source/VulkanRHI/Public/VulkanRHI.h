@@ -141,6 +141,8 @@ namespace CE::Vulkan
 		virtual RHI::ShaderResourceGroup* CreateShaderResourceGroup(const RHI::ShaderResourceGroupLayout& srgLayout) override;
 		virtual void DestroyShaderResourceGroup(RHI::ShaderResourceGroup* shaderResourceGroup) override;
 
+		virtual RHI::BindlessTable* GetBindlessTable() override;
+
 		// - Pipeline State -
 
         virtual RHI::PipelineState* CreateGraphicsPipeline(const RHI::GraphicsPipelineDescriptor& desc) override;
@@ -562,3 +562,317 @@ TEST(RHI, FrameScheduler)
 
 	WINDOW_TEST_END;
 }
+
+TEST(RHI, ParallelShaderResourceRecording)
+{
+	TEST_BEGIN;
+	InitJobManager();
+
+	Vulkan::VulkanRHI* vulkanRHI = (Vulkan::VulkanRHI*)RHI::gDynamicRHI;
+	Vulkan::ShaderResourceManager* srgManager = vulkanRHI->GetDevice()->GetShaderResourceManager();
+
+	RHI::BufferDescriptor bufferDesc{};
+	bufferDesc.name = "ParallelRecordingBuffer";
+	bufferDesc.bufferSize = 256;
+	bufferDesc.bindFlags = RHI::BufferBindFlags::ConstantBuffer;
+	bufferDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
+
+	RHI::Buffer* buffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+	ASSERT_NE(buffer, nullptr);
+
+	// One SRG per type, so that the types sharing a descriptor set get merged
+	Array<RHI::ShaderResourceGroup*> srgs{};
+	for (int type = 0; type < (int)RHI::SRGType::Bindless; type++)
+	{
+		RHI::ShaderResourceGroupLayout layout{};
+		layout.srgType = (RHI::SRGType)type;
+		layout.variables.Add(RHI::SRGVariableDescriptor("_Data", 0, RHI::ShaderResourceType::ConstantBuffer, RHI::ShaderStage::Default));
+
+		RHI::ShaderResourceGroup* srg = RHI::gDynamicRHI->CreateShaderResourceGroup(layout);
+		ASSERT_NE(srg, nullptr);
+		srg->Bind("_Data", RHI::BufferView(buffer));
+		srgs.Add(srg);
+	}
+
+	Vulkan::CommandList* commandList = (Vulkan::CommandList*)RHI::gDynamicRHI->AllocateCommandList(RHI::gDynamicRHI->GetPrimaryGraphicsQueue());
+	ASSERT_NE(commandList, nullptr);
+
+	// Serial pass: flush every SRG and create the merged ones
+	commandList->SetShaderResourceGroups(srgs);
+	commandList->PrepareShaderResources();
+	commandList->ClearShaderResourceGroups();
+
+	HashMap<int, Array<Vulkan::ShaderResourceGroup*>> srgsBySetNumber{};
+	for (RHI::ShaderResourceGroup* srg : srgs)
+	{
+		Vulkan::ShaderResourceGroup* vulkanSrg = (Vulkan::ShaderResourceGroup*)srg;
+		EXPECT_TRUE(vulkanSrg->IsCompiled());
+		srgsBySetNumber[vulkanSrg->GetSetNumber()].Add(vulkanSrg);
+	}
+
+	// Descriptor set every set number must resolve to, read before the parallel part
+	HashMap<int, Vulkan::DescriptorSet*> expectedSets{};
+	for (auto& [setNumber, setSrgs] : srgsBySetNumber)
+	{
+		if (setSrgs.GetSize() == 1)
+		{
+			expectedSets[setNumber] = setSrgs[0]->GetDescriptorSet();
+			continue;
+		}
+
+		Vulkan::MergedShaderResourceGroup* mergedSrg = srgManager->FindMergedSRG(setSrgs.GetSize(), setSrgs.GetData());
+		ASSERT_NE(mergedSrg, nullptr);
+		expectedSets[setNumber] = mergedSrg->GetDescriptorSet();
+	}
+
+	// Parallel pass: recording jobs only look the SRGs up, as CommitShaderResources() does on prepared command lists
+	constexpr int JobCount = 8;
+	constexpr int IterationsPerJob = 1000;
+
+	std::atomic<int> mismatches = 0;
+	JobContext* jobContext = JobContext::GetGlobalContext();
+	JobCompletion* jobCompletion = new JobCompletion(jobContext);
+
+	for (int i = 0; i < JobCount; i++)
+	{
+		Job* job = new JobFunction([&](Job*)
+			{
+				for (int iteration = 0; iteration < IterationsPerJob; iteration++)
+				{
+					for (auto& [setNumber, setSrgs] : srgsBySetNumber)
+					{
+						Vulkan::DescriptorSet* descriptorSet = nullptr;
+						if (setSrgs.GetSize() == 1)
+						{
+							descriptorSet = setSrgs[0]->GetDescriptorSet();
+						}
+						else if (Vulkan::MergedShaderResourceGroup* mergedSrg = srgManager->FindMergedSRG(setSrgs.GetSize(), setSrgs.GetData()))
+						{
+							descriptorSet = mergedSrg->GetDescriptorSet();
+						}
+
+						if (descriptorSet != expectedSets.Get(setNumber))
+							mismatches++;
+					}
+				}
+			}, true, jobContext);
+
+		job->SetDependent(jobCompletion);
+		job->Start();
+	}
+
+	jobCompletion->StartAndWaitForCompletion();
+	delete jobCompletion;
+
+	EXPECT_EQ(mismatches.load(), 0);
+
+	// Nothing got recompiled or replaced while the jobs ran
+	for (auto& [setNumber, setSrgs] : srgsBySetNumber)
+	{
+		if (setSrgs.GetSize() == 1)
+		{
+			EXPECT_EQ(setSrgs[0]->GetDescriptorSet(), expectedSets[setNumber]);
+		}
+	}
+
+	RHI::CommandList* commandLists[] = { commandList };
+	RHI::gDynamicRHI->FreeCommandLists(1, commandLists);
+
+	for (RHI::ShaderResourceGroup* srg : srgs)
+	{
+		RHI::gDynamicRHI->DestroyShaderResourceGroup(srg);
+	}
+	RHI::gDynamicRHI->DestroyBuffer(buffer);
+
+	ShutdownJobManager();
+	TEST_END;
+}
+
+static RHI::ShaderResourceGroupLayout MakeDynamicOffsetLayout(u32 variableCount)
+{
+	RHI::ShaderResourceGroupLayout layout{};
+	layout.srgType = RHI::SRGType::PerObject;
+
+	for (u32 i = 0; i < variableCount; i++)
+	{
+		RHI::SRGVariableDescriptor variable(String::Format("_ObjectData{}", i), i, RHI::ShaderResourceType::ConstantBuffer, RHI::ShaderStage::Default);
+		variable.usesDynamicOffset = true;
+		layout.variables.Add(variable);
+	}
+
+	return layout;
+}
+
+TEST(RHI, SharedDescriptorSets)
+{
+	TEST_BEGIN;
+
+	RHI::BufferDescriptor bufferDesc{};
+	bufferDesc.name = "SharedSetBuffer";
+	bufferDesc.bufferSize = 1024;
+	bufferDesc.bindFlags = RHI::BufferBindFlags::ConstantBuffer;
+	bufferDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
+
+	RHI::Buffer* buffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+	RHI::Buffer* otherBuffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+	ASSERT_NE(buffer, nullptr);
+	ASSERT_NE(otherBuffer, nullptr);
+
+	RHI::ShaderResourceGroupLayout layout = MakeDynamicOffsetLayout(1);
+
+	auto createSrg = [&](RHI::BufferView bufferView) -> Vulkan::ShaderResourceGroup*
+		{
+			RHI::ShaderResourceGroup* srg = RHI::gDynamicRHI->CreateShaderResourceGroup(layout);
+			srg->Bind("_ObjectData0", bufferView);
+			srg->FlushBindings();
+			return (Vulkan::ShaderResourceGroup*)srg;
+		};
+
+	// Same buffer and size at different offsets: only the dynamic offsets differ
+	Vulkan::ShaderResourceGroup* srgA = createSrg(RHI::BufferView(buffer, 0, 256));
+	Vulkan::ShaderResourceGroup* srgB = createSrg(RHI::BufferView(buffer, 256, 256));
+	ASSERT_NE(srgA->GetDescriptorSet(), nullptr);
+	EXPECT_EQ(srgA->GetDescriptorSet(), srgB->GetDescriptorSet());
+
+	// Whole buffer bindings at different offsets share too: the bound size doesn't depend on the offset
+	Vulkan::ShaderResourceGroup* srgWholeA = createSrg(RHI::BufferView(buffer, 0));
+	Vulkan::ShaderResourceGroup* srgWholeB = createSrg(RHI::BufferView(buffer, 512));
+	EXPECT_EQ(srgWholeA->GetDescriptorSet(), srgWholeB->GetDescriptorSet());
+	EXPECT_NE(srgWholeA->GetDescriptorSet(), srgA->GetDescriptorSet());
+
+	// Different size or buffer: different bindings, different sets
+	Vulkan::ShaderResourceGroup* srgSize = createSrg(RHI::BufferView(buffer, 0, 128));
+	Vulkan::ShaderResourceGroup* srgOther = createSrg(RHI::BufferView(otherBuffer, 0, 256));
+	EXPECT_NE(srgSize->GetDescriptorSet(), srgA->GetDescriptorSet());
+	EXPECT_NE(srgOther->GetDescriptorSet(), srgA->GetDescriptorSet());
+
+	// Rebinding another buffer moves the SRG to another set and leaves the shared one to the other SRG
+	Vulkan::DescriptorSet* sharedSet = srgB->GetDescriptorSet();
+	srgA->Bind("_ObjectData0", RHI::BufferView(otherBuffer, 0, 256));
+	srgA->FlushBindings();
+	EXPECT_EQ(srgA->GetDescriptorSet(), srgOther->GetDescriptorSet());
+	EXPECT_EQ(srgB->GetDescriptorSet(), sharedSet);
+
+	for (Vulkan::ShaderResourceGroup* srg : { srgA, srgB, srgWholeA, srgWholeB, srgSize, srgOther })
+	{
+		RHI::gDynamicRHI->DestroyShaderResourceGroup(srg);
+	}
+	RHI::gDynamicRHI->DestroyBuffer(buffer);
+	RHI::gDynamicRHI->DestroyBuffer(otherBuffer);
+
+	TEST_END;
+}
+
+TEST(RHI, DynamicOffsets)
+{
+	TEST_BEGIN;
+
+	RHI::BufferDescriptor bufferDesc{};
+	bufferDesc.name = "DynamicOffsetBuffer";
+	bufferDesc.bufferSize = 2048;
+	bufferDesc.bindFlags = RHI::BufferBindFlags::ConstantBuffer;
+	bufferDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
+
+	RHI::Buffer* buffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+	ASSERT_NE(buffer, nullptr);
+
+	RHI::ShaderResourceGroupLayout layout = MakeDynamicOffsetLayout(2);
+	Vulkan::ShaderResourceGroup* srg = (Vulkan::ShaderResourceGroup*)RHI::gDynamicRHI->CreateShaderResourceGroup(layout);
+	ASSERT_NE(srg, nullptr);
+
+	// Bound out of slot order: offsets are still reported by binding slot
+	srg->Bind("_ObjectData1", RHI::BufferView(buffer, 1024, 256));
+	srg->Bind("_ObjectData0", RHI::BufferView(buffer, 256, 256));
+	srg->FlushBindings();
+
+	ASSERT_EQ(srg->GetDynamicOffsetCount(), 2);
+
+	u32 offsets[2] = {};
+	srg->GetDynamicOffsets(offsets);
+	EXPECT_EQ(offsets[0], 256);
+	EXPECT_EQ(offsets[1], 1024);
+
+	// Moving a binding only changes its dynamic offset: the descriptor set is kept
+	Vulkan::DescriptorSet* descriptorSet = srg->GetDescriptorSet();
+	ASSERT_NE(descriptorSet, nullptr);
+
+	srg->Bind("_ObjectData0", RHI::BufferView(buffer, 768, 256));
+	srg->FlushBindings();
+
+	EXPECT_EQ(srg->GetDescriptorSet(), descriptorSet);
+	srg->GetDynamicOffsets(offsets);
+	EXPECT_EQ(offsets[0], 768);
+	EXPECT_EQ(offsets[1], 1024);
+
+	RHI::gDynamicRHI->DestroyShaderResourceGroup(srg);
+	RHI::gDynamicRHI->DestroyBuffer(buffer);
+
+	TEST_END;
+}
+
+namespace BindlessTests
+{
+	//! @brief Table without descriptors, to test slot allocation alone.
+	class TestBindlessTable : public RHI::BindlessTable
+	{
+	public:
+
+		TestBindlessTable(const RHI::BindlessTableDescriptor& desc) : BindlessTable(desc)
+		{}
+
+	protected:
+
+		void WriteTexture(u32 index, RHI::Texture* texture, RHI::TextureView* textureView) override {}
+
+		void WriteBuffer(u32 index, const RHI::BufferView& bufferView) override {}
+	};
+}
+
+TEST(RHI, BindlessTableSlotReuse)
+{
+	TEST_BEGIN;
+
+	RHI::BufferDescriptor bufferDesc{};
+	bufferDesc.name = "BindlessBuffer";
+	bufferDesc.bufferSize = 256;
+	bufferDesc.bindFlags = RHI::BufferBindFlags::StructuredBuffer;
+	bufferDesc.defaultHeapType = RHI::MemoryHeapType::Upload;
+
+	RHI::Buffer* buffer = RHI::gDynamicRHI->CreateBuffer(bufferDesc);
+	ASSERT_NE(buffer, nullptr);
+
+	RHI::BindlessTableDescriptor tableDesc{};
+	tableDesc.bufferCapacity = 2;
+
+	BindlessTests::TestBindlessTable* table = new BindlessTests::TestBindlessTable(tableDesc);
+
+	u32 first = table->AddBuffer(RHI::BufferView(buffer));
+	u32 second = table->AddBuffer(RHI::BufferView(buffer));
+	EXPECT_EQ(first, 0);
+	EXPECT_EQ(second, 1);
+	EXPECT_EQ(table->AddBuffer(RHI::BufferView(buffer)), RHI::BindlessTable::InvalidIndex);
+
+	table->RemoveBuffer(first);
+	EXPECT_EQ(table->GetBufferCount(), 1);
+
+	// In-flight frames may still index the removed slot, so it stays reserved for FrameLatency frames
+	for (u32 frame = 1; frame < RHI::BindlessTable::FrameLatency; frame++)
+	{
+		table->AdvanceFrame();
+		EXPECT_EQ(table->AddBuffer(RHI::BufferView(buffer)), RHI::BindlessTable::InvalidIndex);
+	}
+
+	table->AdvanceFrame();
+	EXPECT_EQ(table->AddBuffer(RHI::BufferView(buffer)), first);
+	EXPECT_EQ(table->GetBufferCount(), 2);
+
+	// Removing an invalid or never allocated slot is ignored
+	table->RemoveBuffer(RHI::BindlessTable::InvalidIndex);
+	table->RemoveBuffer(tableDesc.bufferCapacity);
+	EXPECT_EQ(table->GetBufferCount(), 2);
+
+	delete table;
+	RHI::gDynamicRHI->DestroyBuffer(buffer);
+
+	TEST_END;
+}
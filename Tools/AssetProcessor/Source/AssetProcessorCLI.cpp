@@ -5,7 +5,7 @@
 
 namespace CE
 {
-	constexpr u32 StampFileVersion = 2;
+	constexpr u32 StampFileVersion = 3;
 
 	AssetProcessorCLI::AssetProcessorCLI(int argc, char** argv)
 	{
@@ -19,6 +19,9 @@ namespace CE
 			("T,target", "Target platform. Values: Windows, Linux, Mac, Android, iOS", cxxopts::value<std::string>()->default_value(""))
 			("t,temp", "Temporary directory path", cxxopts::value<std::string>())
 			("P,project", "Project root directory", cxxopts::value<std::string>()->default_value(""))
+			("ddc", "Derived data cache directory. Defaults to DerivedDataCache inside the temporary directory.", cxxopts::value<std::string>()->default_value(""))
+			("shared-ddc", "Shared derived data cache directory (e.g. a network folder) to fetch imported assets from.", cxxopts::value<std::string>()->default_value(""))
+			("no-ddc", "Always import assets, without using the derived data cache.")
 			;
 
 		try
@@ -43,6 +46,13 @@ namespace CE
 		inputRoot = parsedOptions["D"].as<std::string>();
 		outputRoot = parsedOptions["R"].as<std::string>();
 
+		if (!parsedOptions["no-ddc"].as<bool>())
+		{
+			String ddcDir = parsedOptions["ddc"].as<std::string>();
+			derivedDataCacheDir = ddcDir.NotEmpty() ? IO::Path(ddcDir) : tempDir / "DerivedDataCache";
+			sharedDerivedDataCacheDir = parsedOptions["shared-ddc"].as<std::string>();
+		}
+
 		tempDir = tempDir / "AssetCache";
 
 		String targetName = parsedOptions["T"].as<std::string>();
@@ -243,6 +253,27 @@ namespace CE
 									}
 								}
 							}
+
+							if (version >= 3)
+							{
+								// Files the asset was imported from besides its source, ex: headers included by a shader
+								u32 numSourceDependencies = 0;
+								reader >> numSourceDependencies;
+
+								for (u32 j = 0; j < numSourceDependencies && !needsProcessing; j++)
+								{
+									String dependencyPath = "";
+									u64 dependencyTimeInt = 0;
+									reader >> dependencyPath;
+									reader >> dependencyTimeInt;
+
+									IO::Path dependency = dependencyPath;
+									if (!dependency.Exists() || dependency.GetLastWriteTime() != DateTime::FromNumber(dependencyTimeInt))
+									{
+										needsProcessing = true;
+									}
+								}
+							}
 						}
 
 						if (needsProcessing) // Source asset modified OR stamp version is different
@@ -271,6 +302,12 @@ namespace CE
 		}
 
 		Logger::Initialize();
+
+		if (!derivedDataCacheDir.IsEmpty())
+		{
+			derivedDataCache.Initialize(derivedDataCacheDir, sharedDerivedDataCacheDir);
+			ShaderCache::Get().Initialize(derivedDataCacheDir / "Shaders");
+		}
 	
 		JobContext* jobContext = JobContext::GetGlobalContext();
 		JobManager* jobManager = jobContext->GetJobManager();
@@ -357,6 +394,8 @@ namespace CE
 			assetImporter->SetLogging(true);
 			assetImporter->SetTargetPlatform(targetPlatform);
 			assetImporter->SetTempDirectoryPath(tempDir);
+			assetImporter->SetDerivedDataCache(&derivedDataCache);
+			assetImporter->SetAssetDefinitionVersion(assetDef->GetAssetVersion());
 
 			importers.Add(assetImporter);
 			assetDefinitions.Add(assetDef);
@@ -428,7 +467,7 @@ namespace CE
 		{
 			for (int i = 0; i < assetImportResults.GetSize(); i++)
 			{
-				const auto& [success, sourcePath, productPath, errorMessage] = assetImportResults[i];
+				const auto& [success, sourcePath, productPath, errorMessage, sourceDependencies] = assetImportResults[i];
 
 				IO::Path relativePath = IO::Path::GetRelative(sourcePath, inputRoot);
 				IO::Path stampFilePath = tempDir / relativePath.ReplaceExtension(".stamp");
@@ -447,6 +486,13 @@ namespace CE
 					writer << assetDefinitionVersions[i];
 
 					writer << assetImporterVersions[i];
+
+					writer << (u32)sourceDependencies.GetSize();
+					for (const IO::Path& dependency : sourceDependencies)
+					{
+						writer << dependency.GetString();
+						writer << dependency.GetLastWriteTime().ToNumber();
+					}
 				}
 				else
 				{
@@ -455,6 +501,24 @@ namespace CE
 			}
 		}
 
+		if (derivedDataCache.IsEnabled())
+		{
+			DerivedDataCache::Statistics statistics = derivedDataCache.GetStatistics();
+			u32 lookups = statistics.hits + statistics.misses;
+			f32 hitRate = lookups > 0 ? (f32)statistics.hits / (f32)lookups * 100.0f : 0.0f;
+
+			LOG("Derived data cache: " << statistics.hits << " hits, " << statistics.misses << " misses ("
+				<< hitRate << "% hit rate), " << statistics.stores << " stored. "
+				<< statistics.bytesRead / 1024 << " KB fetched, " << statistics.bytesWritten / 1024 << " KB written.");
+		}
+
+		if (ShaderCache::Get().IsEnabled())
+		{
+			ShaderCache::Statistics statistics = ShaderCache::Get().GetStatistics();
+
+			LOG("Shader cache: " << statistics.hits << " hits, " << statistics.misses << " misses, " << statistics.stores << " stored.");
+		}
+
 		Logger::Shutdown();
 
 		PreShutdown();
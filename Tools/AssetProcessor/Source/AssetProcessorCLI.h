@@ -60,6 +60,10 @@ namespace CE
 
 		Array<IO::Path> includePaths{};
 
+		IO::Path derivedDataCacheDir{};
+		IO::Path sharedDerivedDataCacheDir{};
+		DerivedDataCache derivedDataCache{};
+
 		AssetDefinitionRegistry* assetDefRegistry = nullptr;
 	};
 
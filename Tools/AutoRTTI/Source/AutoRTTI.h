@@ -4,5 +4,6 @@
 
 #include "Language/Token.h"
 #include "Language/HeaderAST.h"
+#include "Language/HeaderParseCache.h"
 #include "Language/ModuleAST.h"
 #include "RTTI/RTTIGenerator.h"
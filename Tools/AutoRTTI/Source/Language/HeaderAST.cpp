@@ -1231,5 +1231,168 @@ namespace CE
         return ast;
     }
 
+    static void SerializeStrings(Stream* stream, const Array<String>& strings)
+    {
+        *stream << (u32)strings.GetSize();
+        for (const String& string : strings)
+        {
+            *stream << string;
+        }
+    }
+
+    static void DeserializeStrings(Stream* stream, Array<String>& outStrings)
+    {
+        u32 count = 0;
+        *stream >> count;
+        outStrings.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            *stream >> outStrings[i];
+        }
+    }
+
+    static void SerializeStruct(Stream* stream, const StructInfo& structInfo)
+    {
+        *stream << structInfo.nameSpace;
+        *stream << structInfo.name;
+
+        *stream << (u32)structInfo.superClasses.GetSize();
+        for (const Name& superClass : structInfo.superClasses)
+        {
+            *stream << superClass;
+        }
+
+        SerializeStrings(stream, structInfo.attribs);
+
+        *stream << (u32)structInfo.fields.GetSize();
+        for (const FieldInfo& field : structInfo.fields)
+        {
+            *stream << field.name;
+            SerializeStrings(stream, field.attribs);
+        }
+
+        *stream << (u32)structInfo.functions.GetSize();
+        for (const FunctionInfo& function : structInfo.functions)
+        {
+            *stream << function.name;
+            *stream << function.signature;
+            *stream << function.returnType;
+            *stream << function.isSignal;
+            *stream << function.isEvent;
+            SerializeStrings(stream, function.attribs);
+        }
+    }
+
+    static void DeserializeStruct(Stream* stream, StructInfo& structInfo)
+    {
+        u32 count = 0;
+
+        *stream >> structInfo.nameSpace;
+        *stream >> structInfo.name;
+
+        *stream >> count;
+        structInfo.superClasses.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            *stream >> structInfo.superClasses[i];
+        }
+
+        DeserializeStrings(stream, structInfo.attribs);
+
+        *stream >> count;
+        structInfo.fields.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            *stream >> structInfo.fields[i].name;
+            DeserializeStrings(stream, structInfo.fields[i].attribs);
+        }
+
+        *stream >> count;
+        structInfo.functions.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            FunctionInfo& function = structInfo.functions[i];
+            *stream >> function.name;
+            *stream >> function.signature;
+            *stream >> function.returnType;
+            *stream >> function.isSignal;
+            *stream >> function.isEvent;
+            DeserializeStrings(stream, function.attribs);
+        }
+    }
+
+    void HeaderAST::Serialize(Stream* stream) const
+    {
+        *stream << (u32)classes.GetSize();
+        for (const ClassInfo& classInfo : classes)
+        {
+            SerializeStruct(stream, classInfo);
+        }
+
+        *stream << (u32)structs.GetSize();
+        for (const StructInfo& structInfo : structs)
+        {
+            SerializeStruct(stream, structInfo);
+        }
+
+        *stream << (u32)enums.GetSize();
+        for (const EnumInfo& enumInfo : enums)
+        {
+            *stream << enumInfo.nameSpace;
+            *stream << enumInfo.name;
+
+            *stream << (u32)enumInfo.constants.GetSize();
+            for (const EnumConstInfo& constant : enumInfo.constants)
+            {
+                *stream << constant.name;
+                SerializeStrings(stream, constant.attribs);
+            }
+
+            SerializeStrings(stream, enumInfo.attribs);
+        }
+    }
+
+    HeaderAST* HeaderAST::Deserialize(Stream* stream)
+    {
+        auto ast = new HeaderAST;
+        u32 count = 0;
+
+        *stream >> count;
+        ast->classes.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            DeserializeStruct(stream, ast->classes[i]);
+        }
+
+        *stream >> count;
+        ast->structs.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            DeserializeStruct(stream, ast->structs[i]);
+        }
+
+        *stream >> count;
+        ast->enums.Resize(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            EnumInfo& enumInfo = ast->enums[i];
+            *stream >> enumInfo.nameSpace;
+            *stream >> enumInfo.name;
+
+            u32 numConstants = 0;
+            *stream >> numConstants;
+            enumInfo.constants.Resize(numConstants);
+            for (u32 j = 0; j < numConstants; j++)
+            {
+                *stream >> enumInfo.constants[j].name;
+                DeserializeStrings(stream, enumInfo.constants[j].attribs);
+            }
+
+            DeserializeStrings(stream, enumInfo.attribs);
+        }
+
+        return ast;
+    }
+
 } // namespace CE
 
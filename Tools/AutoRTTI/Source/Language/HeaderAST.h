@@ -57,6 +57,11 @@ namespace CE
         virtual ~HeaderAST();
         
         static HeaderAST* ProcessHeader(HeaderTokenizer* tokens);
+
+        //! @brief Writes the parsed types in binary form, used by the on-disk parse cache.
+        void Serialize(Stream* stream) const;
+
+        static HeaderAST* Deserialize(Stream* stream);
         
         Array<ClassInfo> classes{};
         Array<StructInfo> structs{};
@@ -0,0 +1,148 @@
+
+#include "HeaderParseCache.h"
+
+namespace CE
+{
+	// Written after the last entry, so a truncated file is detected
+	static constexpr u32 EndMarker = 0x454E4421;
+
+	HeaderParseCache::~HeaderParseCache()
+	{
+		Clear();
+	}
+
+	void HeaderParseCache::Load(const IO::Path& cacheFilePath)
+	{
+		Clear();
+
+		if (!cacheFilePath.Exists())
+			return;
+
+		FileStream fileStream{ cacheFilePath, Stream::Permissions::ReadOnly };
+		fileStream.SetBinaryMode(true);
+		if (!fileStream.IsOpen())
+			return;
+
+		u32 version = 0;
+		fileStream >> version;
+		if (version != Version)
+			return;
+
+		u32 numEntries = 0;
+		fileStream >> numEntries;
+
+		for (u32 i = 0; i < numEntries && !fileStream.IsOutOfBounds(); i++)
+		{
+			String headerPath = "";
+			Entry entry{};
+
+			fileStream >> headerPath;
+			fileStream >> entry.contentHash.high64;
+			fileStream >> entry.contentHash.low64;
+			entry.ast = HeaderAST::Deserialize(&fileStream);
+
+			auto it = entries.Find(IO::Path(headerPath));
+			if (it != entries.end())
+			{
+				delete it->second.ast;
+			}
+
+			entries[IO::Path(headerPath)] = entry;
+		}
+
+		u32 endMarker = 0;
+		fileStream >> endMarker;
+
+		if (endMarker != EndMarker)
+		{
+			CE_LOG(Warn, All, "Ignoring corrupt RTTI parse cache: {}", cacheFilePath);
+			Clear();
+		}
+	}
+
+	bool HeaderParseCache::Save(const IO::Path& cacheFilePath)
+	{
+		u32 numEntries = 0;
+		for (const auto& [headerPath, entry] : entries)
+		{
+			if (entry.isUsed)
+				numEntries++;
+		}
+
+		// Write to a temporary file first, so an interrupted build never leaves a partially written cache behind
+		IO::Path tempPath = cacheFilePath.GetString() + ".tmp";
+
+		{
+			FileStream fileStream{ tempPath, Stream::Permissions::WriteOnly };
+			fileStream.SetBinaryMode(true);
+			if (!fileStream.IsOpen())
+				return false;
+
+			fileStream << Version;
+			fileStream << numEntries;
+
+			for (const auto& [headerPath, entry] : entries)
+			{
+				if (!entry.isUsed)
+					continue;
+
+				fileStream << headerPath.GetString();
+				fileStream << entry.contentHash.high64;
+				fileStream << entry.contentHash.low64;
+				entry.ast->Serialize(&fileStream);
+			}
+
+			fileStream << EndMarker;
+		}
+
+		std::error_code error{};
+		fs::rename((fs::path)tempPath, (fs::path)cacheFilePath, error);
+		if (error)
+		{
+			CE_LOG(Warn, All, "Failed to write RTTI parse cache {}: {}", cacheFilePath, error.message());
+			fs::remove((fs::path)tempPath, error);
+			return false;
+		}
+
+		return true;
+	}
+
+	const HeaderAST* HeaderParseCache::Find(const IO::Path& headerPath, const Hash128& contentHash)
+	{
+		auto it = entries.Find(headerPath);
+		if (it == entries.end())
+			return nullptr;
+
+		Entry& entry = it->second;
+		if (entry.contentHash.high64 != contentHash.high64 || entry.contentHash.low64 != contentHash.low64)
+			return nullptr;
+
+		entry.isUsed = true;
+		return entry.ast;
+	}
+
+	void HeaderParseCache::Add(const IO::Path& headerPath, const Hash128& contentHash, HeaderAST* ast)
+	{
+		auto it = entries.Find(headerPath);
+		if (it != entries.end() && it->second.ast != ast)
+		{
+			delete it->second.ast;
+		}
+
+		Entry entry{};
+		entry.contentHash = contentHash;
+		entry.ast = ast;
+		entry.isUsed = true;
+		entries[headerPath] = entry;
+	}
+
+	void HeaderParseCache::Clear()
+	{
+		for (auto& [headerPath, entry] : entries)
+		{
+			delete entry.ast;
+		}
+		entries.Clear();
+	}
+
+} // namespace CE
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "HeaderAST.h"
+
+namespace CE
+{
+    /*
+    *   Parse results of a module's headers, saved next to the generated files.
+    *   Entries are keyed by a hash of the header's content, so a header that didn't change
+    *   is never tokenized & parsed again. Not thread safe: lookups & additions happen on the main thread.
+    */
+    class HeaderParseCache
+    {
+    public:
+        //! @brief Increment it whenever the tokenizer, the parser or the serialized format changes.
+        static constexpr u32 Version = 1;
+
+        HeaderParseCache() = default;
+        ~HeaderParseCache();
+
+        HeaderParseCache(const HeaderParseCache&) = delete;
+        HeaderParseCache& operator=(const HeaderParseCache&) = delete;
+
+        //! @brief Loads the entries of a previous run. A missing, outdated or corrupt cache file is ignored.
+        void Load(const IO::Path& cacheFilePath);
+
+        //! @brief Saves the entries that were found or added since Load(), the others belong to headers that no longer exist.
+        bool Save(const IO::Path& cacheFilePath);
+
+        //! @return The cached parse result, owned by the cache. Null if the header's content changed or was never parsed.
+        const HeaderAST* Find(const IO::Path& headerPath, const Hash128& contentHash);
+
+        //! @brief Takes ownership of the parse result.
+        void Add(const IO::Path& headerPath, const Hash128& contentHash, HeaderAST* ast);
+
+        void Clear();
+
+    private:
+
+        struct Entry
+        {
+            Hash128 contentHash{};
+            HeaderAST* ast = nullptr;
+            bool isUsed = false;
+        };
+
+        HashMap<IO::Path, Entry> entries{};
+    };
+
+} // namespace CE
@@ -100,17 +100,38 @@ namespace CE
         if (headerTokens.KeyExists(headerFilePath))
             return headerTokens[headerFilePath];
 
-        HeaderTokenizer* self = new HeaderTokenizer;
-        headerTokens.Add({ headerFilePath, self });
-
-        self->headerPath = headerFilePath;
-
         std::ifstream file{ (fs::path)headerFilePath };
         std::stringstream stringStream;
         stringStream << file.rdbuf();
         file.close();
 
-        auto source = stringStream.str();
+        HeaderTokenizer* self = Tokenize(headerFilePath, stringStream.str());
+        headerTokens.Add({ headerFilePath, self });
+
+        //for (const auto& headerInclude : self->headerIncludes)
+        //{
+        //    fs::path includedHeaderRelativePath = headerInclude;
+
+        //    for (const auto& includeDir : includeSearchPaths)
+        //    {
+        //        fs::path includeDirPath = includeDir;
+
+        //        if (fs::exists(includeDirPath / includedHeaderRelativePath)) // Found the header
+        //        {
+        //            Tokenize(includeDirPath / includedHeaderRelativePath, includeSearchPaths);
+        //            break;
+        //        }
+        //    }
+        //}
+
+        return self;
+    }
+
+    HeaderTokenizer* HeaderTokenizer::Tokenize(IO::Path headerFilePath, const std::string& source)
+    {
+        HeaderTokenizer* self = new HeaderTokenizer;
+        self->headerPath = headerFilePath;
+
         auto length = source.length();
 
         int cursor = 0;
@@ -386,22 +407,6 @@ namespace CE
             cursor++;
         }
 
-        //for (const auto& headerInclude : self->headerIncludes)
-        //{
-        //    fs::path includedHeaderRelativePath = headerInclude;
-
-        //    for (const auto& includeDir : includeSearchPaths)
-        //    {
-        //        fs::path includeDirPath = includeDir;
-
-        //        if (fs::exists(includeDirPath / includedHeaderRelativePath)) // Found the header
-        //        {
-        //            Tokenize(includeDirPath / includedHeaderRelativePath, includeSearchPaths);
-        //            break;
-        //        }
-        //    }
-        //}
-
         return self;
     }
 
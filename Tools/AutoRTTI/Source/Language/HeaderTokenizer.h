@@ -13,6 +13,10 @@ namespace CE
 
         static HeaderTokenizer* Tokenize(IO::Path headerFilePath, const Array<IO::Path>& includeSearchPaths);
 
+        //! @brief Tokenizes the already loaded content of a header. It doesn't use the shared token cache,
+        //! so it can be called from multiple threads at once.
+        static HeaderTokenizer* Tokenize(IO::Path headerFilePath, const std::string& source);
+
     private:
         void AddToken(TokenType type, int line, std::string lexeme = "");
 
@@ -20,11 +20,9 @@ namespace CE
 		processedHeaders.Clear();
 	}
 
-	void ModuleAST::ProcessHeader(IO::Path headerPath, const Array<IO::Path>& includeSearchPaths, 
+	void ModuleAST::ProcessHeader(IO::Path headerPath, const HeaderAST* ast, 
 		std::stringstream& outStream, std::stringstream& implStream, CE::Array<String>& registrantList)
 	{
-		auto tokens = HeaderTokenizer::Tokenize(headerPath, includeSearchPaths);
-
         outStream << "#pragma once\n\n";
 
 		std::string apiName = moduleName.ToUpper() + "_API";
@@ -37,8 +35,6 @@ namespace CE
 		{
 			String::IsAlphabet('a');
 		}
-        
-        auto ast = HeaderAST::ProcessHeader(tokens);
 
 		for (const auto& enumInfo : ast->enums)
 		{
@@ -215,9 +211,6 @@ namespace CE
 
 			registrantList.Add(fullName);
 		}
-        
-        delete tokens;
-        delete ast;
 	}
 
 } // namespace CE
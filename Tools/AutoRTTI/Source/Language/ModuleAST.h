@@ -16,7 +16,9 @@ namespace CE
         ModuleAST(String moduleName);
         ~ModuleAST();
 
-        void ProcessHeader(IO::Path headerPath, const Array<IO::Path>& includeSearchPaths, 
+        //! @brief Writes the RTTI macros of an already parsed header. Headers have to be processed in the same order on every run,
+        //! since the registrants & implementations are appended to the module's lists.
+        void ProcessHeader(IO::Path headerPath, const HeaderAST* ast, 
             std::stringstream& outStream, std::stringstream& implStream, CE::Array<String>& registrantList);
 
     private:
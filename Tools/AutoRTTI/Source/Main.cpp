@@ -26,6 +26,7 @@ int main(int argc, char** argv)
         ("I,inc", "Include search directories", cxxopts::value<std::vector<std::string>>()->default_value(""))
         ("n,noapi", "Do not use X_API export macros")
         ("f,force", "Force update output headers")
+        ("j,jobs", "Number of threads used to parse headers, 0 uses all hardware threads", cxxopts::value<u32>()->default_value("0"))
 		("e,exclude", "Exclude files from directories", cxxopts::value<std::vector<std::string>>()->default_value(""))
         ;
 
@@ -61,6 +62,8 @@ int main(int argc, char** argv)
         bool noApi = result["noapi"].as<bool>();
 
         gShouldEmitApiMacro = !noApi;
+        RTTIGenerator::numThreads = result["jobs"].as<u32>();
+        RTTIGenerator::useParseCache = !forceUpdate;
         
         if (!forceUpdate)
         {
@@ -6,6 +6,31 @@ namespace CE
 	bool gShouldEmitApiMacro = true;
 
 	Array<IO::Path> RTTIGenerator::includeSearchPaths{};
+	u32 RTTIGenerator::numThreads = 0;
+	bool RTTIGenerator::useParseCache = true;
+
+	// Leaves the file untouched when its content is the same, so the targets that include it are not rebuilt
+	static bool WriteFileIfChanged(const fs::path& filePath, const std::string& content)
+	{
+		if (fs::exists(filePath))
+		{
+			std::ifstream existingFile{ filePath, std::ios_base::in };
+			std::string existingContent((std::istreambuf_iterator<char>(existingFile)),
+				(std::istreambuf_iterator<char>()));
+
+			if (existingContent == content)
+				return false;
+		}
+
+		std::ofstream outFile{ filePath, std::ios_base::out | std::ios_base::trunc };
+		if (outFile.is_open())
+		{
+			outFile << content;
+			outFile.close();
+		}
+
+		return true;
+	}
 
 	void RTTIGenerator::GenerateRTTI(String moduleName, IO::Path moduleHeaderRootPath, IO::Path outputPath, ModuleStamp& moduleStamp)
 	{
@@ -25,11 +50,11 @@ namespace CE
 
 		CE::Array<IO::Path> filesToRemove{};
 
-		bool anyHeaderModified = false;
+		IO::Path parseCachePath = outputPath / (moduleName + ".rtticache");
 
 		outputPath.IterateChildren([&](const IO::Path& entry)
 			{
-				if (entry.GetFileName().GetString().EndsWith(".private.h"))
+				if (entry.GetFileName().GetString().EndsWith(".private.h") || entry == parseCachePath)
 				{
 					return;
 				}
@@ -37,6 +62,18 @@ namespace CE
 				filesToRemove.Add(entry);
 			});
 
+		struct HeaderEntry
+		{
+			fs::path headerPath{};
+			fs::path headerGeneratedPath{};
+			std::string content{};
+			Hash128 contentHash{};
+			const HeaderAST* ast = nullptr;
+			HeaderAST* parsedAst = nullptr;
+		};
+
+		Array<HeaderEntry> headers{};
+
 		for (auto entry : fs::recursive_directory_iterator(modulePath))
 		{
 			if (entry.is_directory() || entry.path().extension() != ".h")
@@ -80,10 +117,85 @@ namespace CE
 			}
 
 			sourceHeaderPaths.Add(headerRelPathFinal.string());
-            
+
+			HeaderEntry& header = headers.EmplaceBack();
+			header.headerPath = headerPath;
+			header.headerGeneratedPath = headerGeneratedPath;
+			header.content = std::move(inputHeaderFileContent);
+			header.contentHash = CalculateHash128(header.content.data(), header.content.size());
+		}
+
+		HeaderParseCache parseCache{};
+		if (useParseCache)
+		{
+			parseCache.Load(parseCachePath);
+		}
+
+		Array<HeaderEntry*> headersToParse{};
+
+		for (HeaderEntry& header : headers)
+		{
+			header.ast = parseCache.Find(header.headerPath, header.contentHash);
+			if (header.ast == nullptr)
+			{
+				headersToParse.Add(&header);
+			}
+		}
+
+		// Headers are independent of each other, so they are tokenized & parsed in parallel.
+		// The RTTI is written afterwards in directory order, so the generated files don't depend on thread timing.
+		if (headersToParse.NotEmpty())
+		{
+			u32 threadCount = numThreads > 0 ? numThreads : Thread::GetHardwareConcurrency();
+			threadCount = Math::Clamp<u32>(threadCount, 1, headersToParse.GetSize());
+
+			Atomic<u32> nextHeader = 0;
+
+			auto parseHeaders = [&]
+				{
+					while (true)
+					{
+						u32 index = nextHeader++;
+						if (index >= headersToParse.GetSize())
+							break;
+
+						HeaderEntry* header = headersToParse[index];
+						HeaderTokenizer* tokens = HeaderTokenizer::Tokenize(header->headerPath, header->content);
+						header->parsedAst = HeaderAST::ProcessHeader(tokens);
+						delete tokens;
+					}
+				};
+
+			Array<Thread*> threads{};
+			for (u32 i = 1; i < threadCount; i++)
+			{
+				threads.Add(new Thread(parseHeaders));
+			}
+
+			parseHeaders();
+
+			for (Thread* thread : threads)
+			{
+				thread->Join();
+				delete thread;
+			}
+			threads.Clear();
+
+			for (HeaderEntry* header : headersToParse)
+			{
+				header->ast = header->parsedAst;
+				parseCache.Add(header->headerPath, header->contentHash, header->parsedAst);
+			}
+		}
+
+		for (HeaderEntry& header : headers)
+		{
+			const fs::path& headerPath = header.headerPath;
+			const fs::path& headerGeneratedPath = header.headerGeneratedPath;
+
             std::stringstream outStream{};
 
-			moduleAST.ProcessHeader(headerPath, includeSearchPaths, outStream, implStream, registrantList);
+			moduleAST.ProcessHeader(headerPath, header.ast, outStream, implStream, registrantList);
 
             auto outString = outStream.str();
 
@@ -110,79 +222,62 @@ namespace CE
 			if (skipHeaderGen)
 				continue;
 
-			anyHeaderModified = true;
-			
-			std::ofstream outFile{ headerGeneratedPath, std::ios_base::out };
-			if (outFile.is_open())
-			{
-				outFile << outString;
-				outFile.close();
-			}
+			WriteFileIfChanged(headerGeneratedPath, outString);
 
 			moduleStamp.headers.Add({ IO::Path(headerPath), crc });
 		}
 
+		if (useParseCache)
+		{
+			parseCache.Save(parseCachePath);
+		}
+
 		// Remove unnecessary headers from outputPath
 		for (const auto& path : filesToRemove)
 		{
-			if (path.GetExtension() != ".stamp")
-			{
-				anyHeaderModified = true;
-			}
-
 			IO::Path::Remove(path);
 		}
 		filesToRemove.Clear();
 
 		IO::Path moduleGenFilePath = outputPath / (moduleName + ".private.h");
 
-		// Generate module file ONLY if either a header was modified or if it doesn't exist
-		if (anyHeaderModified || !moduleGenFilePath.Exists())
-		{
-			if (moduleGenFilePath.Exists())
-			{
-				IO::Path::Remove(moduleGenFilePath);
-			}
-
-			std::ofstream moduleImplFile{ (fs::path)moduleGenFilePath, std::ios::out | std::ios::trunc };
-			if (moduleImplFile.is_open())
-			{
-				moduleImplFile << "#pragma once\n\n";
+		std::stringstream moduleImplFile{};
 
-				moduleImplFile << "#include \"CoreMinimal.h\"\n";
+		moduleImplFile << "#pragma once\n\n";
 
-				for (auto headerPath : sourceHeaderPaths)
-				{
-					moduleImplFile << "#include \"" << headerPath.GetCString() << "\"\n";
-				}
+		moduleImplFile << "#include \"CoreMinimal.h\"\n";
 
-				moduleImplFile << implStream.str() << "\n";
+		for (auto headerPath : sourceHeaderPaths)
+		{
+			moduleImplFile << "#include \"" << headerPath.GetCString() << "\"\n";
+		}
 
-				moduleImplFile << "static void CERegisterModuleTypes()\n{\n";
-				moduleImplFile << "\tCE_REGISTER_TYPES(\n";
-				for (int i = 0; i < registrantList.GetSize(); i++)
-				{
-					moduleImplFile << "\t\t" << registrantList[i].GetCString();
-					if (i < registrantList.GetSize() - 1)
-						moduleImplFile << ",";
-					moduleImplFile << "\n";
-				}
-				moduleImplFile << "\t);\n}\n";
+		moduleImplFile << implStream.str() << "\n";
 
-				moduleImplFile << "static void CEDeregisterModuleTypes()\n{\n";
-				moduleImplFile << "\tCE_DEREGISTER_TYPES(\n";
-				for (int i = 0; i < registrantList.GetSize(); i++)
-				{
-					moduleImplFile << "\t\t" << registrantList[i].GetCString();
-					if (i < registrantList.GetSize() - 1)
-						moduleImplFile << ",";
-					moduleImplFile << "\n";
-				}
-				moduleImplFile << "\t);\n}\n";
+		moduleImplFile << "static void CERegisterModuleTypes()\n{\n";
+		moduleImplFile << "\tCE_REGISTER_TYPES(\n";
+		for (int i = 0; i < registrantList.GetSize(); i++)
+		{
+			moduleImplFile << "\t\t" << registrantList[i].GetCString();
+			if (i < registrantList.GetSize() - 1)
+				moduleImplFile << ",";
+			moduleImplFile << "\n";
+		}
+		moduleImplFile << "\t);\n}\n";
 
-				moduleImplFile.close();
-			}
+		moduleImplFile << "static void CEDeregisterModuleTypes()\n{\n";
+		moduleImplFile << "\tCE_DEREGISTER_TYPES(\n";
+		for (int i = 0; i < registrantList.GetSize(); i++)
+		{
+			moduleImplFile << "\t\t" << registrantList[i].GetCString();
+			if (i < registrantList.GetSize() - 1)
+				moduleImplFile << ",";
+			moduleImplFile << "\n";
 		}
+		moduleImplFile << "\t);\n}\n";
+
+		// The module file is generated from the content of every header, so it is compared instead of tracking which header changed
+		WriteFileIfChanged((fs::path)moduleGenFilePath, moduleImplFile.str());
 	}
 
 } // namespace CE
@@ -4,6 +4,7 @@
 
 #include "Language/HeaderTokenizer.h"
 #include "Language/HeaderAST.h"
+#include "Language/HeaderParseCache.h"
 #include "Language/ModuleAST.h"
 
 namespace CE
@@ -44,6 +45,12 @@ namespace CE
         static void GenerateRTTI(String moduleName, IO::Path moduleHeaderRootPath, IO::Path outputPath, ModuleStamp& moduleStamp);
 
         static Array<IO::Path> includeSearchPaths;
+
+        //! @brief Number of threads used to parse headers. 0 uses every hardware thread.
+        static u32 numThreads;
+
+        //! @brief If false, every header is parsed again instead of reusing the module's parse cache.
+        static bool useParseCache;
     };
 
     
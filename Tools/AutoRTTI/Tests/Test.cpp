@@ -0,0 +1,222 @@
+#include "Core.h"
+
+#include "Language/HeaderParseCache.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+using namespace CE;
+
+#define TEST_BEGIN TestBegin()
+#define TEST_END TestEnd()
+
+static void TestBegin()
+{
+	ModuleManager::Get().LoadModule("Core");
+}
+
+static void TestEnd()
+{
+	ModuleManager::Get().UnloadModule("Core");
+}
+
+static const std::string TestHeaderSource = R"(
+#pragma once
+
+namespace CE
+{
+	ENUM()
+	enum class TestMode
+	{
+		First,
+		Second
+	};
+
+	CLASS()
+	class TestObject : public Object
+	{
+		CE_CLASS(TestObject, Object)
+	public:
+
+		FIELD()
+		int value = 0;
+
+		FIELD()
+		TestMode mode = TestMode::First;
+	};
+}
+
+#include "TestObject.rtti.h"
+)";
+
+static void WriteHeader(const IO::Path& headerPath, const std::string& content)
+{
+	std::ofstream file{ (fs::path)headerPath, std::ios_base::out | std::ios_base::trunc };
+	file << content;
+}
+
+//! @brief Reads & hashes the header the same way RTTIGenerator does.
+static std::string ReadHeader(const IO::Path& headerPath, Hash128& outContentHash)
+{
+	std::ifstream file{ (fs::path)headerPath, std::ios_base::in };
+	std::string content((std::istreambuf_iterator<char>(file)), (std::istreambuf_iterator<char>()));
+	outContentHash = CalculateHash128(content.data(), content.size());
+	return content;
+}
+
+static HeaderAST* ParseHeader(const IO::Path& headerPath, const std::string& content)
+{
+	HeaderTokenizer* tokens = HeaderTokenizer::Tokenize(headerPath, content);
+	HeaderAST* ast = HeaderAST::ProcessHeader(tokens);
+	delete tokens;
+	return ast;
+}
+
+static void ExpectSameAST(const HeaderAST* cached, const HeaderAST* parsed)
+{
+	ASSERT_NE(cached, nullptr);
+	ASSERT_NE(parsed, nullptr);
+
+	ASSERT_EQ(cached->classes.GetSize(), parsed->classes.GetSize());
+	for (int i = 0; i < parsed->classes.GetSize(); i++)
+	{
+		EXPECT_EQ(cached->classes[i].nameSpace, parsed->classes[i].nameSpace);
+		EXPECT_EQ(cached->classes[i].name, parsed->classes[i].name);
+
+		ASSERT_EQ(cached->classes[i].superClasses.GetSize(), parsed->classes[i].superClasses.GetSize());
+		for (int j = 0; j < parsed->classes[i].superClasses.GetSize(); j++)
+		{
+			EXPECT_EQ(cached->classes[i].superClasses[j], parsed->classes[i].superClasses[j]);
+		}
+
+		ASSERT_EQ(cached->classes[i].fields.GetSize(), parsed->classes[i].fields.GetSize());
+		for (int j = 0; j < parsed->classes[i].fields.GetSize(); j++)
+		{
+			EXPECT_EQ(cached->classes[i].fields[j].name, parsed->classes[i].fields[j].name);
+		}
+	}
+
+	EXPECT_EQ(cached->structs.GetSize(), parsed->structs.GetSize());
+
+	ASSERT_EQ(cached->enums.GetSize(), parsed->enums.GetSize());
+	for (int i = 0; i < parsed->enums.GetSize(); i++)
+	{
+		EXPECT_EQ(cached->enums[i].name, parsed->enums[i].name);
+
+		ASSERT_EQ(cached->enums[i].constants.GetSize(), parsed->enums[i].constants.GetSize());
+		for (int j = 0; j < parsed->enums[i].constants.GetSize(); j++)
+		{
+			EXPECT_EQ(cached->enums[i].constants[j].name, parsed->enums[i].constants[j].name);
+		}
+	}
+}
+
+TEST(HeaderParseCache, RoundTrip)
+{
+	TEST_BEGIN;
+
+	IO::Path tempDirectory = PlatformDirectories::GetLaunchDir() / "Temp/HeaderParseCacheTest";
+	if (tempDirectory.Exists())
+	{
+		IO::Path::RemoveRecursively(tempDirectory);
+	}
+	IO::Path::CreateDirectories(tempDirectory);
+
+	IO::Path headerPath = tempDirectory / "TestObject.h";
+	IO::Path otherHeaderPath = tempDirectory / "OtherObject.h";
+	IO::Path cacheFilePath = tempDirectory / "Test.rtticache";
+
+	WriteHeader(headerPath, TestHeaderSource);
+	WriteHeader(otherHeaderPath, TestHeaderSource);
+
+	Hash128 contentHash{};
+	std::string content = ReadHeader(headerPath, contentHash);
+
+	HeaderAST* parsed = ParseHeader(headerPath, content);
+	ASSERT_EQ(parsed->classes.GetSize(), 1);
+	EXPECT_EQ(parsed->classes[0].name, Name("TestObject"));
+	EXPECT_EQ(parsed->classes[0].fields.GetSize(), 2);
+	EXPECT_EQ(parsed->enums.GetSize(), 1);
+
+	// Save & load
+	{
+		HeaderParseCache cache{};
+		cache.Load(cacheFilePath);
+		EXPECT_EQ(cache.Find(headerPath, contentHash), nullptr);
+
+		cache.Add(headerPath, contentHash, ParseHeader(headerPath, content));
+		cache.Add(otherHeaderPath, contentHash, ParseHeader(otherHeaderPath, content));
+		EXPECT_TRUE(cache.Save(cacheFilePath));
+		EXPECT_TRUE(cacheFilePath.Exists());
+	}
+
+	{
+		HeaderParseCache cache{};
+		cache.Load(cacheFilePath);
+
+		ExpectSameAST(cache.Find(headerPath, contentHash), parsed);
+		ExpectSameAST(cache.Find(otherHeaderPath, contentHash), parsed);
+
+		// Entries are keyed by path
+		EXPECT_EQ(cache.Find(tempDirectory / "Missing.h", contentHash), nullptr);
+	}
+
+	// A newer timestamp alone keeps the entry: the content is the same, so the parse result is too
+	WriteHeader(headerPath, TestHeaderSource);
+	{
+		Hash128 rewrittenHash{};
+		ReadHeader(headerPath, rewrittenHash);
+
+		HeaderParseCache cache{};
+		cache.Load(cacheFilePath);
+		ExpectSameAST(cache.Find(headerPath, rewrittenHash), parsed);
+	}
+
+	// A content change invalidates the entry
+	WriteHeader(headerPath, TestHeaderSource + "\n// Edited\n");
+	Hash128 editedHash{};
+	{
+		std::string editedContent = ReadHeader(headerPath, editedHash);
+		EXPECT_FALSE(editedHash.high64 == contentHash.high64 && editedHash.low64 == contentHash.low64);
+
+		HeaderParseCache cache{};
+		cache.Load(cacheFilePath);
+		EXPECT_EQ(cache.Find(headerPath, editedHash), nullptr);
+		ExpectSameAST(cache.Find(otherHeaderPath, contentHash), parsed);
+
+		cache.Add(headerPath, editedHash, ParseHeader(headerPath, editedContent));
+		EXPECT_TRUE(cache.Save(cacheFilePath));
+
+		cache.Load(cacheFilePath);
+		EXPECT_EQ(cache.Find(headerPath, contentHash), nullptr);
+		ExpectSameAST(cache.Find(headerPath, editedHash), parsed);
+	}
+
+	// Entries that weren't looked up since Load() belong to removed headers, and aren't saved again
+	{
+		HeaderParseCache cache{};
+		cache.Load(cacheFilePath);
+		EXPECT_NE(cache.Find(otherHeaderPath, contentHash), nullptr);
+		EXPECT_TRUE(cache.Save(cacheFilePath));
+
+		cache.Load(cacheFilePath);
+		EXPECT_NE(cache.Find(otherHeaderPath, contentHash), nullptr);
+		EXPECT_EQ(cache.Find(headerPath, editedHash), nullptr);
+	}
+
+	// A truncated cache file is ignored
+	{
+		u64 fileSize = fs::file_size((fs::path)cacheFilePath);
+		fs::resize_file((fs::path)cacheFilePath, fileSize - sizeof(u32));
+
+		HeaderParseCache cache{};
+		cache.Load(cacheFilePath);
+		EXPECT_EQ(cache.Find(otherHeaderPath, contentHash), nullptr);
+	}
+
+	delete parsed;
+	IO::Path::RemoveRecursively(tempDirectory);
+
+	TEST_END;
+}
@@ -2,9 +2,9 @@
 #include "ResourceCompiler.h"
 
 #include "cxxopts.hpp"
+#include "miniz.h"
 
 #include <iostream>
-#include <chrono>
 
 #define MAX_RESOURCE_SIZE 12_MB
 
@@ -54,8 +54,6 @@ static HashSet<Name> textFileExts = {
 	".shader", ".hlsl", ".glsl"
 };
 
-typedef std::chrono::high_resolution_clock Clock;
-
 int main(int argc, char** argv)
 {
     using namespace CE;
@@ -73,6 +71,7 @@ int main(int argc, char** argv)
         ("d,dir", "Resource root path", cxxopts::value<std::string>())
         ("o,output", "Generated output directory", cxxopts::value<std::string>())
         ("f,force", "Force update output")
+        ("u,uncompressed", "Embed resources without compressing them")
         ;
 
     try
@@ -89,6 +88,7 @@ int main(int argc, char** argv)
         IO::Path resourceDirPath = result["d"].as<std::string>();
         IO::Path outPath = result["o"].as<std::string>();
 		IO::Path timeStampFile = outPath / "stamp.json";
+		bool noCompression = result["uncompressed"].as<bool>();
 
         if (!outPath.Exists())
         {
@@ -187,61 +187,86 @@ int main(int argc, char** argv)
 				continue;
 			}
 
-			FileStream data = FileStream(outFilePath);
-			data.SetAsciiMode(true);
-
-			data << "#pragma once\n\n";
+			Array<u8> content{};
+			content.Resize(length);
+			if (length > 0)
+			{
+				reader.Read(content.GetData(), length);
+			}
+			reader.Close();
 
+			// Text is embedded with a null terminator, so the loaded data can be used as a C string
 			if (textFileExts.Exists(srcFileRelative.GetExtension().GetString()))
 			{
-				data << "static const char " << relativePathIdentifier << "_Data[] = R\"(";
-				int counter = 0;
+				content.Add(0);
+			}
+
+			u32 uncompressedLength = 0;
+			const u8* embeddedData = content.GetData();
+			u32 embeddedLength = (u32)content.GetSize();
+
+			Array<u8> compressed{};
 
-				while (!reader.IsOutOfBounds())
+			if (!noCompression && content.NotEmpty())
+			{
+				// Read back by Decompress() in Core, which expects the zlib format
+				mz_ulong compressedLength = mz_compressBound((mz_ulong)content.GetSize());
+				compressed.Resize(compressedLength);
+				if (mz_compress2(compressed.GetData(), &compressedLength, content.GetData(), (mz_ulong)content.GetSize(), MZ_BEST_COMPRESSION) != MZ_OK)
 				{
-					auto byte = reader.ReadByte();
-					if (byte == 0)
-						break;
-
-					const char append[2] = { (char)byte, 0 };
-					data << String(append);
-					
-					counter++;
+					compressedLength = 0;
 				}
-				data << ")\";\n";
 
-				data << "static const u32 " << relativePathIdentifier << "_Length = sizeof(" << relativePathIdentifier << "_Data);\n";
+				// Already compressed formats (png, etc) are kept as is, they would only be slower to load
+				if (compressedLength > 0 && compressedLength < content.GetSize() - content.GetSize() / 8)
+				{
+					uncompressedLength = (u32)content.GetSize();
+					embeddedData = compressed.GetData();
+					embeddedLength = (u32)compressedLength;
+				}
 			}
-			else
-			{
-				data << "static const char " << relativePathIdentifier << "_Data[] = {\n\t";
-				int counter = 0;
 
-				auto t1 = Clock::now();
+			std::string output{};
+			output.reserve(64 + (SIZE_T)embeddedLength * 5);
 
-				while (!reader.IsOutOfBounds())
+			output += "#pragma once\n\n";
+			output += "static const u8 " + std::string(relativePathIdentifier.GetCString()) + "_Data[] = {\n\t";
+
+			char number[8];
+			for (u32 i = 0; i < embeddedLength; i++)
+			{
+				if (i > 0 && i % 64 == 0)
 				{
-					if (counter >= 64)
-					{
-						counter = 0;
-						data << "\n\t";
-					}
-
-					auto byte = reader.ReadByte();
-					data << "(char)" << (int)byte << ", ";
-					counter++;
+					output += "\n\t";
 				}
-				data << "};\n";
 
-				data << "static const u32 " << relativePathIdentifier << "_Length = " << length << ";\n";
+				int numberLength = snprintf(number, sizeof(number), "%u,", (u32)embeddedData[i]);
+				output.append(number, numberLength);
 			}
-			
+
+			if (embeddedLength == 0)
+			{
+				output += "0";
+			}
+
+			output += "\n};\n";
+			output += "static const u32 " + std::string(relativePathIdentifier.GetCString()) + "_Length = " + std::to_string(embeddedLength) + ";\n";
+			output += "static const u32 " + std::string(relativePathIdentifier.GetCString()) + "_UncompressedLength = " + std::to_string(uncompressedLength) + ";\n";
+
+			FileStream data = FileStream(outFilePath);
+			data.SetBinaryMode(true);
+			data.Write(output.data(), output.size());
 			data.Close();
-			reader.Close();
 
 			generatedResources.Add({ srcFileRelative.GetString().Replace({ '\\' }, '/'), relativePathIdentifier});
 		}
 
+		// The index is searched with a binary search at runtime, which compares paths with strcmp()
+		generatedResources.Sort([](const ResourceInfo& lhs, const ResourceInfo& rhs)
+			{
+				return strcmp(lhs.generatedFilePath.GetString().GetCString(), rhs.generatedFilePath.GetString().GetCString()) < 0;
+			});
+
 		{
 			FileStream resourceHeader = FileStream(outPath / "Resource.h", Stream::Permissions::WriteOnly);
 			resourceHeader.SetAsciiMode(true);
@@ -256,24 +281,32 @@ int main(int argc, char** argv)
 			
 			resourceHeader << "\n";
 
-			resourceHeader << "static void CERegisterModuleResources()\n{\n";
-			for (const auto& info : generatedResources)
+			if (generatedResources.NotEmpty())
 			{
-				resourceHeader << "\tCE::GetResourceManager()->RegisterResource(";
-				resourceHeader << "\"" << moduleName << "\", ";
-				resourceHeader << "\"" << info.generatedFilePath.GetString() << "\", ";
-				resourceHeader << "(void*)" << info.resourceIdentifier << "_Data, ";
-				resourceHeader << info.resourceIdentifier << "_Length);\n";
+				resourceHeader << "static const CE::ResourceIndexEntry CEModuleResourceIndex[] = {\n";
+				for (const auto& info : generatedResources)
+				{
+					resourceHeader << "\t{ ";
+					resourceHeader << "\"" << info.generatedFilePath.GetString() << "\", ";
+					resourceHeader << info.resourceIdentifier << "_Data, ";
+					resourceHeader << info.resourceIdentifier << "_Length, ";
+					resourceHeader << info.resourceIdentifier << "_UncompressedLength },\n";
+				}
+				resourceHeader << "};\n\n";
 			}
+
+			resourceHeader << "static void CERegisterModuleResources()\n{\n";
+			resourceHeader << "\tCE::GetResourceManager()->RegisterResourceIndex(";
+			resourceHeader << "\"" << moduleName << "\", ";
+			if (generatedResources.NotEmpty())
+				resourceHeader << "CEModuleResourceIndex, (u32)COUNTOF(CEModuleResourceIndex));\n";
+			else
+				resourceHeader << "nullptr, 0);\n";
 			resourceHeader << "}\n\n";
 
 			resourceHeader << "static void CEDeregisterModuleResources()\n{\n";
-			for (const auto& info : generatedResources)
-			{
-				resourceHeader << "\tCE::GetResourceManager()->DeregisterResource(";
-				resourceHeader << "\"" << moduleName << "\", ";
-				resourceHeader << "\"" << info.generatedFilePath.GetString() << "\");\n";
-			}
+			resourceHeader << "\tCE::GetResourceManager()->DeregisterResourceIndex(";
+			resourceHeader << "\"" << moduleName << "\");\n";
 			resourceHeader << "}\n\n";
 
 			resourceHeader.Close();